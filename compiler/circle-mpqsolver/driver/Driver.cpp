@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MPQSolver.h"
+
+#include <arser/arser.h>
+#include <vconone/vconone.h>
+
+#include <luci/CircleExporter.h>
+#include <luci/CircleFileExpContract.h>
+
+#include <iostream>
+
+void print_version(void)
+{
+  std::cout << "circle-mpqsolver version " << vconone::get_string() << std::endl;
+  std::cout << vconone::get_copyright() << std::endl;
+}
+
+int entry(const int argc, char **argv)
+{
+  using namespace mpqsolver;
+
+  arser::Arser arser("Searching data types of layers for mixed-precision quantization");
+
+  arser.add_argument("--version")
+    .nargs(0)
+    .required(false)
+    .default_value(false)
+    .help("Show version information and exit")
+    .exit_with(print_version);
+
+  arser.add_argument("--input_model")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(true)
+    .help("Input float model filepath, with min/max of activations recorded by record-minmax");
+
+  arser.add_argument("--input_data")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(true)
+    .help("Input data filepath of calibration data in hdf5");
+
+  arser.add_argument("--output_model")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(true)
+    .help("Output quantized model filepath");
+
+  arser.add_argument("--max_error")
+    .nargs(1)
+    .type(arser::DataType::FLOAT)
+    .help("Budget of squared error of outputs relative to the float model. 0.01 (default)");
+
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .help("Number of threads to quantize and interpret with. 1 (default) runs them on the main "
+          "thread, 0 uses all hardware threads.");
+
+  try
+  {
+    arser.parse(argc, argv);
+  }
+  catch (const std::runtime_error &err)
+  {
+    std::cout << err.what() << std::endl;
+    std::cout << arser;
+    return 255;
+  }
+
+  auto input_model_path = arser.get<std::string>("--input_model");
+  auto input_data_path = arser.get<std::string>("--input_data");
+  auto output_model_path = arser.get<std::string>("--output_model");
+
+  // Default values
+  float max_error = 0.01f;
+  int32_t num_threads = 1;
+
+  if (arser["--max_error"])
+    max_error = arser.get<float>("--max_error");
+
+  if (max_error < 0.0f)
+    throw std::runtime_error("Budget of error should not be negative");
+
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+
+  if (num_threads < 0)
+    throw std::runtime_error("Number of threads should not be negative");
+
+  MPQSolver solver(max_error, static_cast<uint32_t>(num_threads));
+
+  solver.initialize(input_model_path);
+  solver.loadData(input_data_path);
+
+  auto module = solver.run();
+
+  for (const auto &layer : solver.layerDTypes())
+  {
+    if (layer.second == loco::DataType::S16)
+      std::cout << "int16: " << layer.first << std::endl;
+  }
+
+  // Export to output Circle file
+  luci::CircleExporter exporter;
+
+  luci::CircleFileExpContract contract(module.get(), output_model_path);
+
+  if (!exporter.invoke(&contract))
+  {
+    std::cerr << "ERROR: Failed to export '" << output_model_path << "'" << std::endl;
+    return 255;
+  }
+
+  return EXIT_SUCCESS;
+}
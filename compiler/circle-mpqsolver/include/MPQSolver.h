@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MPQSOLVER_H__
+#define __MPQSOLVER_H__
+
+#include <luci/IR/Module.h>
+#include <luci/Pass/QuantizationParameters.h>
+#include <luci_interpreter/Interpreter.h>
+#include <pepper/threadpool.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mpqsolver
+{
+
+// Values of inputs (or outputs) of the model, for each record
+using Dataset = std::vector<std::vector<std::vector<float>>>;
+
+// Quantization error of layers, which is squared error relative to the float values
+using LayerErrors = std::map<std::string /* layer name */, float>;
+
+/**
+ * @brief MPQSolver searches data types of layers for mixed-precision quantization
+ * @details Layers are quantized to uint8 (channel-wise) except those promoted to int16, which
+ *          are taken in the order of sensitivity, i.e. how much quantization error a layer adds
+ *          to that of its inputs, until the error of the model outputs is within the budget.
+ */
+class MPQSolver
+{
+public:
+  // 'num_threads' threads are used to quantize and interpret (0 means all hardware threads)
+  explicit MPQSolver(float max_error, uint32_t num_threads = 1);
+
+  ~MPQSolver();
+
+  // Load the float model whose activations have min/max recorded by record-minmax
+  void initialize(const std::string &input_model_path);
+
+  // Load the calibration data in hdf5 to measure quantization errors with
+  void loadData(const std::string &input_data_path);
+
+  // Return the model quantized with the data types found, which meet the budget if possible
+  std::unique_ptr<luci::Module> run(void);
+
+  // Data types of layers found by the last run
+  const luci::LayerDTypes &layerDTypes(void) const { return _layer_dtypes; }
+
+private:
+  std::unique_ptr<luci::Module> importModule(void) const;
+  std::unique_ptr<luci::Module> quantize(const luci::LayerDTypes &layer_dtypes) const;
+  float evaluate(const luci::Module *module, LayerErrors *layer_errors = nullptr);
+  std::vector<std::string> sortBySensitivity(const LayerErrors &layer_errors) const;
+
+private:
+  float _max_error;
+  uint32_t _num_threads;
+
+  std::vector<char> _model_data;
+  std::unique_ptr<luci::Module> _float_module;
+  std::unique_ptr<pepper::ThreadPool> _thread_pool;
+
+  Dataset _inputs;
+  Dataset _float_outputs;
+
+  luci::LayerDTypes _layer_dtypes;
+};
+
+} // namespace mpqsolver
+
+#endif // __MPQSOLVER_H__
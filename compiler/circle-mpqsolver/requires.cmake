@@ -0,0 +1,9 @@
+require("arser")
+require("dio-hdf5")
+require("foder")
+require("logo")
+require("luci")
+require("luci-interpreter")
+require("pepper-threadpool")
+require("safemain")
+require("vconone")
@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MPQSolver.h"
+
+#include <dio_hdf5/HDF5Importer.h>
+#include <foder/FileLoader.h>
+#include <luci/Importer.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/Pass/CircleShapeInferencePass.h>
+#include <luci/Pass/CircleTypeInferencePass.h>
+#include <luci/Pass/PropagateQuantParamPass.h>
+#include <luci/Pass/QuantizeDequantizeWeightsPass.h>
+#include <luci/Pass/QuantizeWithMinMaxPass.h>
+#include <logo/Phase.h>
+#include <logo/RemoveDeadNodeWithQueryPass.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+uint32_t num_elements(const luci::CircleNode *node)
+{
+  uint32_t num = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    num *= node->dim(i).value();
+  return num;
+}
+
+// Return true if node is not an operator of its own (e.g. CircleInput, CircleSplitOut)
+bool is_virtual(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+#define CIRCLE_NODE(OPCODE, CLASS)
+#define CIRCLE_VNODE(OPCODE, CLASS) case luci::CircleOpcode::OPCODE:
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Return the node which produces the value of node, skipping virtual outputs of operators
+const luci::CircleNode *producer_of(const luci::CircleNode *node)
+{
+  while (is_virtual(node) && node->arity() > 0)
+    node = loco::must_cast<const luci::CircleNode *>(node->arg(0));
+  return node;
+}
+
+template <typename T>
+std::vector<T> quantize_values(const std::vector<float> &values, const luci::CircleQuantParam *qp)
+{
+  if (qp == nullptr || qp->scale.size() != 1)
+    throw std::runtime_error("Quantized tensor should have per-tensor quantparam");
+
+  const float scale = qp->scale[0];
+  const int64_t zerop = qp->zerop[0];
+  const float qmin = std::numeric_limits<T>::lowest();
+  const float qmax = std::numeric_limits<T>::max();
+
+  std::vector<T> quantized(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    float q = std::round(values[i] / scale) + zerop;
+    quantized[i] = static_cast<T>(std::min(std::max(q, qmin), qmax));
+  }
+  return quantized;
+}
+
+template <typename T>
+std::vector<float> dequantize_values(const T *data, size_t size, float scale, int64_t zerop)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = (static_cast<int64_t>(data[i]) - zerop) * scale;
+  return values;
+}
+
+// Return values of tensor as float, empty if tensor is neither float nor quantized per-tensor
+std::vector<float> dequantize(const luci_interpreter::Tensor *tensor)
+{
+  const size_t size = tensor->shape().num_elements();
+  switch (tensor->element_type())
+  {
+    case loco::DataType::FLOAT32:
+    {
+      const auto data = tensor->data<float>();
+      return std::vector<float>(data, data + size);
+    }
+    case loco::DataType::U8:
+      if (tensor->scales().size() != 1)
+        break;
+      return dequantize_values(tensor->data<uint8_t>(), size, tensor->scale(),
+                               tensor->zero_point());
+    case loco::DataType::S16:
+      if (tensor->scales().size() != 1)
+        break;
+      return dequantize_values(tensor->data<int16_t>(), size, tensor->scale(),
+                               tensor->zero_point());
+    default:
+      break;
+  }
+  return {};
+}
+
+void write_input(luci_interpreter::Interpreter &interpreter, const luci::CircleInput *input,
+                 const std::vector<float> &values)
+{
+  switch (input->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      interpreter.writeInputTensor(input, values.data(), values.size() * sizeof(float));
+      break;
+    case loco::DataType::U8:
+    {
+      auto quantized = quantize_values<uint8_t>(values, input->quantparam());
+      interpreter.writeInputTensor(input, quantized.data(), quantized.size() * sizeof(uint8_t));
+      break;
+    }
+    case loco::DataType::S16:
+    {
+      auto quantized = quantize_values<int16_t>(values, input->quantparam());
+      interpreter.writeInputTensor(input, quantized.data(), quantized.size() * sizeof(int16_t));
+      break;
+    }
+    default:
+      throw std::runtime_error("Unsupported data type of input '" + input->name() + "'");
+  }
+}
+
+std::vector<float> read_output(luci_interpreter::Interpreter &interpreter,
+                               const luci::CircleOutput *output)
+{
+  const auto from = loco::must_cast<const luci::CircleNode *>(output->from());
+  const auto size = num_elements(output);
+
+  switch (output->dtype())
+  {
+    case loco::DataType::FLOAT32:
+    {
+      std::vector<float> values(size);
+      interpreter.readOutputTensor(output, values.data(), size * sizeof(float));
+      return values;
+    }
+    case loco::DataType::U8:
+    {
+      std::vector<uint8_t> quantized(size);
+      interpreter.readOutputTensor(output, quantized.data(), size * sizeof(uint8_t));
+      auto qparam = from->quantparam();
+      assert(qparam != nullptr);
+      return dequantize_values(quantized.data(), size, qparam->scale[0], qparam->zerop[0]);
+    }
+    case loco::DataType::S16:
+    {
+      std::vector<int16_t> quantized(size);
+      interpreter.readOutputTensor(output, quantized.data(), size * sizeof(int16_t));
+      auto qparam = from->quantparam();
+      assert(qparam != nullptr);
+      return dequantize_values(quantized.data(), size, qparam->scale[0], qparam->zerop[0]);
+    }
+    default:
+      throw std::runtime_error("Unsupported data type of output '" + output->name() + "'");
+  }
+}
+
+/**
+ * @brief LayerObserver keeps the values of layers of the last execution as float
+ */
+class LayerObserver final : public luci_interpreter::ExecutionObserver
+{
+public:
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override
+  {
+    if (node->name().empty())
+      return;
+
+    auto values = dequantize(tensor);
+    if (!values.empty())
+      _values[node->name()] = std::move(values);
+  }
+
+  const std::map<std::string, std::vector<float>> &values() const { return _values; }
+
+private:
+  std::map<std::string, std::vector<float>> _values;
+};
+
+/**
+ * @brief ErrorSum accumulates squared error of values against the reference
+ */
+struct ErrorSum
+{
+  double squared_error = 0.0;
+  double squared_reference = 0.0;
+
+  void add(const std::vector<float> &values, const std::vector<float> &reference)
+  {
+    assert(values.size() == reference.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      const double diff = static_cast<double>(values[i]) - reference[i];
+      squared_error += diff * diff;
+      squared_reference += static_cast<double>(reference[i]) * reference[i];
+    }
+  }
+
+  // Error relative to the reference, which is absolute if the reference is all zero
+  float value() const
+  {
+    return static_cast<float>(squared_reference > 0.0 ? squared_error / squared_reference
+                                                       : squared_error);
+  }
+};
+
+} // namespace
+
+namespace mpqsolver
+{
+
+MPQSolver::MPQSolver(float max_error, uint32_t num_threads)
+  : _max_error(max_error), _num_threads(num_threads)
+{
+  if (num_threads != 1)
+    _thread_pool = std::make_unique<pepper::ThreadPool>(num_threads);
+}
+
+MPQSolver::~MPQSolver() = default;
+
+void MPQSolver::initialize(const std::string &input_model_path)
+{
+  _model_data = foder::FileLoader(input_model_path).load();
+
+  // Verify flatbuffers
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(_model_data.data()),
+                                 _model_data.size()};
+  if (!circle::VerifyModelBuffer(verifier))
+    throw std::runtime_error("ERROR: Failed to verify circle '" + input_model_path + "'");
+
+  _float_module = importModule();
+
+  for (auto node : loco::input_nodes(_float_module->graph()))
+  {
+    auto input = loco::must_cast<luci::CircleInput *>(node);
+    if (input->dtype() != loco::DataType::FLOAT32)
+      throw std::runtime_error("Input '" + input->name() + "' of the model should be float32");
+  }
+}
+
+void MPQSolver::loadData(const std::string &input_data_path)
+{
+  assert(_float_module != nullptr);
+
+  dio::hdf5::HDF5Importer importer(input_data_path);
+  importer.importGroup();
+
+  const bool is_raw_data = importer.isRawData();
+
+  const auto num_records = importer.numRecords();
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  const auto input_nodes = loco::input_nodes(_float_module->graph());
+  const auto num_inputs = static_cast<int32_t>(input_nodes.size());
+
+  _inputs.clear();
+  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+  {
+    if (num_inputs != importer.numInputs(record_idx))
+      throw std::runtime_error("Wrong number of inputs.");
+
+    std::vector<std::vector<float>> record;
+    for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    {
+      const auto input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      std::vector<float> values(num_elements(input_node));
+
+      // Skip type/shape check for raw data
+      if (is_raw_data)
+        importer.readTensor(record_idx, input_idx, values.data());
+      else
+      {
+        dio::hdf5::DataType dtype;
+        dio::hdf5::Shape shape(input_node->rank());
+        importer.readTensor(record_idx, input_idx, &dtype, &shape, values.data());
+
+        if (dtype != loco::DataType::FLOAT32 ||
+            static_cast<size_t>(shape.num_elements()) != values.size())
+          throw std::runtime_error("Input data of '" + input_node->name() +
+                                   "' does not match the model");
+      }
+      record.emplace_back(std::move(values));
+    }
+    _inputs.emplace_back(std::move(record));
+  }
+}
+
+std::unique_ptr<luci::Module> MPQSolver::importModule(void) const
+{
+  const auto circle_model = circle::GetModel(_model_data.data());
+  auto module = luci::Importer().importModule(circle_model);
+  if (module == nullptr)
+    throw std::runtime_error("ERROR: Failed to load the model");
+  return module;
+}
+
+std::unique_ptr<luci::Module> MPQSolver::quantize(const luci::LayerDTypes &layer_dtypes) const
+{
+  const auto granularity = luci::QuantizationGranularity::ChannelWise;
+
+  auto module = importModule();
+  for (size_t idx = 0; idx < module->size(); ++idx)
+  {
+    auto g = module->graph(idx);
+
+    // NOTE Activations keep min/max recorded by record-minmax, unlike circle-quantizer clearing
+    //      them before fake quantization, because weights are quantized per layer data type here
+    luci::QuantizeDequantizeWeightsPass fake_quantizer(
+      loco::DataType::FLOAT32, loco::DataType::U8, granularity, _num_threads, layer_dtypes);
+    fake_quantizer.run(g);
+
+    luci::QuantizeWithMinMaxPass quantizer(loco::DataType::FLOAT32, loco::DataType::U8,
+                                           granularity, _num_threads, layer_dtypes);
+    quantizer.run(g);
+
+    // Post-quantization optimizations, the same as those of circle-quantizer
+    logo::Phase phase;
+
+    phase.emplace_back(std::make_unique<luci::PropagateQuantParamPass>());
+
+    phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+    phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+    phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+
+    logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+    phase_runner.run(phase);
+  }
+  return module;
+}
+
+float MPQSolver::evaluate(const luci::Module *module, LayerErrors *layer_errors)
+{
+  luci_interpreter::Interpreter interpreter(module, _thread_pool.get());
+  LayerObserver observer;
+
+  // The float model runs along to compare the values of layers
+  std::unique_ptr<luci_interpreter::Interpreter> float_interpreter;
+  LayerObserver float_observer;
+  std::map<std::string, ErrorSum> layer_sums;
+  if (layer_errors != nullptr)
+  {
+    interpreter.attachObserver(&observer);
+    float_interpreter =
+      std::make_unique<luci_interpreter::Interpreter>(_float_module.get(), _thread_pool.get());
+    float_interpreter->attachObserver(&float_observer);
+  }
+
+  const auto input_nodes = loco::input_nodes(module->graph());
+  const auto output_nodes = loco::output_nodes(module->graph());
+  const auto float_input_nodes = loco::input_nodes(_float_module->graph());
+
+  ErrorSum output_sum;
+  for (size_t record_idx = 0; record_idx < _inputs.size(); ++record_idx)
+  {
+    const auto &record = _inputs[record_idx];
+
+    for (size_t input_idx = 0; input_idx < input_nodes.size(); ++input_idx)
+    {
+      const auto input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      write_input(interpreter, input_node, record[input_idx]);
+    }
+
+    interpreter.interpret();
+
+    for (size_t output_idx = 0; output_idx < output_nodes.size(); ++output_idx)
+    {
+      const auto output_node =
+        loco::must_cast<const luci::CircleOutput *>(output_nodes[output_idx]);
+      output_sum.add(read_output(interpreter, output_node),
+                     _float_outputs[record_idx][output_idx]);
+    }
+
+    if (float_interpreter == nullptr)
+      continue;
+
+    for (size_t input_idx = 0; input_idx < float_input_nodes.size(); ++input_idx)
+    {
+      const auto input_node =
+        loco::must_cast<const luci::CircleInput *>(float_input_nodes[input_idx]);
+      write_input(*float_interpreter, input_node, record[input_idx]);
+    }
+
+    float_interpreter->interpret();
+
+    for (const auto &layer : float_observer.values())
+    {
+      auto it = observer.values().find(layer.first);
+      if (it != observer.values().end() && it->second.size() == layer.second.size())
+        layer_sums[layer.first].add(it->second, layer.second);
+    }
+  }
+
+  if (layer_errors != nullptr)
+  {
+    layer_errors->clear();
+    for (const auto &layer : layer_sums)
+      (*layer_errors)[layer.first] = layer.second.value();
+  }
+
+  return output_sum.value();
+}
+
+std::vector<std::string> MPQSolver::sortBySensitivity(const LayerErrors &layer_errors) const
+{
+  auto error_of = [&layer_errors](const luci::CircleNode *node) {
+    auto it = layer_errors.find(node->name());
+    return it != layer_errors.end() ? it->second : 0.0f;
+  };
+
+  std::vector<std::pair<float /* sensitivity */, std::string>> layers;
+  for (auto node : loco::active_nodes(loco::output_nodes(_float_module->graph())))
+  {
+    auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+    if (is_virtual(circle_node))
+      continue;
+
+    // Only activations with min/max recorded are quantized
+    auto qparam = circle_node->quantparam();
+    if (qparam == nullptr || qparam->min.size() != 1)
+      continue;
+
+    if (layer_errors.find(circle_node->name()) == layer_errors.end())
+      continue;
+
+    // Error of weights belongs to the layer, while that of activations belongs to producers
+    float input_error = 0.0f;
+    for (uint32_t i = 0; i < circle_node->arity(); ++i)
+    {
+      auto input = producer_of(loco::must_cast<const luci::CircleNode *>(circle_node->arg(i)));
+      if (dynamic_cast<const luci::CircleConst *>(input) != nullptr)
+        continue;
+      input_error = std::max(input_error, error_of(input));
+    }
+
+    layers.emplace_back(error_of(circle_node) - input_error, circle_node->name());
+  }
+
+  std::stable_sort(layers.begin(), layers.end(),
+                   [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; });
+
+  std::vector<std::string> names;
+  for (const auto &layer : layers)
+    names.emplace_back(layer.second);
+  return names;
+}
+
+std::unique_ptr<luci::Module> MPQSolver::run(void)
+{
+  assert(_float_module != nullptr);
+  if (_inputs.empty())
+    throw std::runtime_error("Calibration data is not loaded");
+
+  // Outputs of the float model are the reference
+  {
+    luci_interpreter::Interpreter interpreter(_float_module.get(), _thread_pool.get());
+    const auto input_nodes = loco::input_nodes(_float_module->graph());
+    const auto output_nodes = loco::output_nodes(_float_module->graph());
+
+    _float_outputs.clear();
+    for (const auto &record : _inputs)
+    {
+      for (size_t input_idx = 0; input_idx < input_nodes.size(); ++input_idx)
+      {
+        const auto input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+        write_input(interpreter, input_node, record[input_idx]);
+      }
+
+      interpreter.interpret();
+
+      std::vector<std::vector<float>> outputs;
+      for (auto output_node : output_nodes)
+        outputs.emplace_back(
+          read_output(interpreter, loco::must_cast<const luci::CircleOutput *>(output_node)));
+      _float_outputs.emplace_back(std::move(outputs));
+    }
+  }
+
+  _layer_dtypes.clear();
+
+  auto best_module = quantize(_layer_dtypes);
+  LayerErrors layer_errors;
+  auto best_error = evaluate(best_module.get(), &layer_errors);
+  std::cout << "Error of uint8 model: " << best_error << std::endl;
+  if (best_error <= _max_error)
+    return best_module;
+
+  const auto layers = sortBySensitivity(layer_errors);
+
+  // Return true if promoting the first 'count' layers meets the budget
+  auto promote = [&](size_t count) {
+    luci::LayerDTypes layer_dtypes;
+    for (size_t i = 0; i < count; ++i)
+      layer_dtypes[layers[i]] = loco::DataType::S16;
+
+    std::unique_ptr<luci::Module> module;
+    float error = std::numeric_limits<float>::infinity();
+    try
+    {
+      module = quantize(layer_dtypes);
+      error = evaluate(module.get());
+    }
+    catch (const std::exception &e)
+    {
+      // Some kernels may not support the data types, which is not an option then
+      std::cout << "Failed to evaluate: " << e.what() << std::endl;
+    }
+    std::cout << "Error with " << count << " int16 layer(s): " << error << std::endl;
+
+    // Keep the one with the least error if nothing meets the budget
+    const bool meets = error <= _max_error;
+    if (meets || (best_error > _max_error && error < best_error))
+    {
+      best_module = std::move(module);
+      best_error = error;
+      _layer_dtypes = std::move(layer_dtypes);
+    }
+    return meets;
+  };
+
+  // Binary search of the least number of layers to promote, assuming that promoting more layers
+  // does not increase the error
+  size_t lo = 0;
+  size_t hi = layers.size();
+  if (!promote(hi))
+  {
+    std::cout << "WARNING: The budget cannot be met even with all layers in int16" << std::endl;
+    return best_module;
+  }
+  while (hi - lo > 1)
+  {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (promote(mid))
+      hi = mid;
+    else
+      lo = mid;
+  }
+
+  std::cout << "Error of the mixed-precision model: " << best_error << std::endl;
+  return best_module;
+}
+
+} // namespace mpqsolver
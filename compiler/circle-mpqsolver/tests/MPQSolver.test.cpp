@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MPQSolver.h"
+
+#include <luci/CircleExporter.h>
+#include <luci/CircleFileExpContract.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/test/TestIOGraph.h>
+
+#include <H5Cpp.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace mpqsolver;
+
+namespace
+{
+
+const uint32_t num_elements = 64;
+const int32_t num_records = 4;
+
+// Integers in [0, 255], which uint8 input of scale 1 represents exactly
+float value(int32_t r, uint32_t e) { return static_cast<float>((r * 64 + e * 37) % 256); }
+
+void set_minmax(luci::CircleNode *node, float min, float max)
+{
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  qparam->min.push_back(min);
+  qparam->max.push_back(max);
+  node->quantparam(std::move(qparam));
+}
+
+/**
+ *          [input]
+ *           /   \
+ *   [relu_wide] [relu_narrow]
+ *         |       |
+ *     [output_0] [output_1]
+ *
+ * Ranges recorded for the Relus are wider than their values, 100 times for 'relu_wide' and
+ * 10 times for 'relu_narrow'. Relative errors of the model are about
+ *   - 2e-2 with both in uint8
+ *   - 2e-4 with 'relu_wide' in int16
+ *   - 1e-6 with both in int16
+ */
+class TwoReluGraph : public luci::test::TestIGraphlet, public luci::test::TestOsGraphlet<2>
+{
+public:
+  void init(void)
+  {
+    TestIGraphlet::init(g(), {1, num_elements});
+    TestOsGraphlet<2>::init(g(), {{1, num_elements}, {1, num_elements}});
+    set_minmax(input(), 0.0f, 255.0f);
+
+    _relu_wide = relu("relu_wide", 25500.0f);
+    _relu_narrow = relu("relu_narrow", 2550.0f);
+    output(0)->from(_relu_wide);
+    output(1)->from(_relu_narrow);
+  }
+
+private:
+  luci::CircleRelu *relu(const std::string &name, float max)
+  {
+    auto node = g()->nodes()->create<luci::CircleRelu>();
+    node->features(input());
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape({1, num_elements});
+    node->shape_status(luci::ShapeStatus::VALID);
+    node->name(name);
+    set_minmax(node, 0.0f, max);
+    return node;
+  }
+
+private:
+  luci::CircleRelu *_relu_wide = nullptr;
+  luci::CircleRelu *_relu_narrow = nullptr;
+};
+
+class MPQSolverTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _model_path = temp_path();
+    _data_path = temp_path();
+
+    auto module = luci::make_module();
+    TwoReluGraph graph;
+    graph.init();
+    graph.transfer_to(module.get());
+
+    luci::CircleExporter exporter;
+    luci::CircleFileExpContract contract(module.get(), _model_path);
+    ASSERT_TRUE(exporter.invoke(&contract));
+
+    write_data();
+  }
+
+  void write_data(void)
+  {
+    H5::H5File file(_data_path, H5F_ACC_TRUNC);
+    auto value_grp = file.createGroup("value");
+
+    hsize_t dims[] = {1, num_elements};
+    H5::DataSpace space(2, dims);
+    for (int32_t r = 0; r < num_records; r++)
+    {
+      std::vector<float> data;
+      for (uint32_t e = 0; e < num_elements; e++)
+        data.push_back(value(r, e));
+
+      auto record_grp = value_grp.createGroup(std::to_string(r));
+      auto dataset = record_grp.createDataSet("0", H5::PredType::IEEE_F32LE, space);
+      dataset.write(data.data(), H5::PredType::NATIVE_FLOAT);
+    }
+  }
+
+  void TearDown() override
+  {
+    std::remove(_model_path.c_str());
+    std::remove(_data_path.c_str());
+  }
+
+  std::string temp_path(void)
+  {
+    char path[] = "/tmp/circle_mpqsolver_test.XXXXXX";
+    int fd = mkstemp(path);
+    EXPECT_GE(fd, 0);
+    close(fd);
+    return path;
+  }
+
+  // Data types of the Relus in the model returned by MPQSolver with the budget 'max_error'
+  luci::LayerDTypes solve(float max_error)
+  {
+    MPQSolver solver(max_error);
+    solver.initialize(_model_path);
+    solver.loadData(_data_path);
+
+    auto module = solver.run();
+    EXPECT_NE(nullptr, module);
+
+    luci::LayerDTypes dtypes;
+    if (module == nullptr)
+      return dtypes;
+
+    for (auto node : loco::all_nodes(module->graph()))
+    {
+      auto relu = dynamic_cast<luci::CircleRelu *>(node);
+      if (relu != nullptr)
+        dtypes[relu->name()] = relu->dtype();
+    }
+
+    // Layers found by the solver are those in int16
+    for (const auto &dtype : dtypes)
+    {
+      const auto found = solver.layerDTypes().count(dtype.first) > 0;
+      EXPECT_EQ(dtype.second == loco::DataType::S16, found);
+    }
+
+    return dtypes;
+  }
+
+protected:
+  std::string _model_path;
+  std::string _data_path;
+};
+
+} // namespace
+
+TEST_F(MPQSolverTest, all_uint8)
+{
+  auto dtypes = solve(1.0f);
+
+  ASSERT_EQ(2, dtypes.size());
+  EXPECT_EQ(loco::DataType::U8, dtypes.at("relu_wide"));
+  EXPECT_EQ(loco::DataType::U8, dtypes.at("relu_narrow"));
+}
+
+TEST_F(MPQSolverTest, smallest_promotion)
+{
+  // Only the sensitive layer is promoted
+  auto dtypes = solve(1e-3f);
+
+  ASSERT_EQ(2, dtypes.size());
+  EXPECT_EQ(loco::DataType::S16, dtypes.at("relu_wide"));
+  EXPECT_EQ(loco::DataType::U8, dtypes.at("relu_narrow"));
+}
+
+TEST_F(MPQSolverTest, all_int16)
+{
+  auto dtypes = solve(1e-5f);
+
+  ASSERT_EQ(2, dtypes.size());
+  EXPECT_EQ(loco::DataType::S16, dtypes.at("relu_wide"));
+  EXPECT_EQ(loco::DataType::S16, dtypes.at("relu_narrow"));
+}
+
+TEST_F(MPQSolverTest, budget_not_met_NEG)
+{
+  // Nothing meets the budget, so the one with the least error is returned
+  auto dtypes = solve(1e-12f);
+
+  ASSERT_EQ(2, dtypes.size());
+  EXPECT_EQ(loco::DataType::S16, dtypes.at("relu_wide"));
+  EXPECT_EQ(loco::DataType::S16, dtypes.at("relu_narrow"));
+}
+
+TEST_F(MPQSolverTest, run_without_data_NEG)
+{
+  MPQSolver solver(1.0f);
+  solver.initialize(_model_path);
+
+  EXPECT_THROW(solver.run(), std::runtime_error);
+}
+
+TEST_F(MPQSolverTest, data_not_matched_NEG)
+{
+  // Record of half the elements of the input
+  {
+    H5::H5File file(_data_path, H5F_ACC_TRUNC);
+    auto record_grp = file.createGroup("value").createGroup("0");
+    hsize_t dims[] = {1, num_elements / 2};
+    H5::DataSpace space(2, dims);
+    std::vector<float> data(num_elements / 2, 1.0f);
+    auto dataset = record_grp.createDataSet("0", H5::PredType::IEEE_F32LE, space);
+    dataset.write(data.data(), H5::PredType::NATIVE_FLOAT);
+  }
+
+  MPQSolver solver(1.0f);
+  solver.initialize(_model_path);
+
+  EXPECT_THROW(solver.loadData(_data_path), std::runtime_error);
+}
@@ -3,4 +3,5 @@ require("crew")
 require("safemain")
 require("luci")
 require("arser")
+require("pepper-json")
 require("vconone")
@@ -16,6 +16,7 @@
 
 #include "PartitionRead.h"
 #include "PartitionExport.h"
+#include "PartitionCost.h"
 #include "HelperPath.h"
 #include "HelperStrings.h"
 
@@ -31,6 +32,7 @@
 #include <vconone/vconone.h>
 
 #include <iostream>
+#include <memory>
 #include <string>
 
 namespace
@@ -38,6 +40,9 @@ namespace
 
 const char *opt_bks = "--backends";
 const char *opt_def = "--default";
+const char *opt_auto = "--auto";
+const char *opt_stages = "--stages";
+const char *opt_exec_time = "--exec_time";
 const char *opt_part = "partition";
 const char *opt_input = "input";
 const char *opt_work = "work";
@@ -69,6 +74,27 @@ void build_arser(arser::Arser &arser)
     .required(false)
     .help("Default backend to assign");
 
+  arser.add_argument(opt_auto)
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .help("Assign backends by costs to minimize 'latency' or maximize 'throughput' of "
+          "partitions running as a pipeline");
+
+  arser.add_argument(opt_stages)
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .required(false)
+    .help("Maximum number of partitions for --auto. "
+          "Default value: no limit for latency, number of backends for throughput");
+
+  arser.add_argument(opt_exec_time)
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .help("exec_time.json measured by onert to use as costs for --auto. "
+          "Costs are estimated without this.");
+
   arser.add_argument(opt_part)
     .nargs(1)
     .type(arser::DataType::STR)
@@ -160,6 +186,14 @@ bool validate_partition(luci::PartitionTable &partition)
       return false;
     }
   }
+  for (auto &byopname : partition.byopnames)
+  {
+    if (!partee::is_one_of(byopname.second, partition.groups))
+    {
+      std::cerr << "OPNAME " << byopname.first << " is not assigned to one of 'backends' items";
+      return false;
+    }
+  }
   return true;
 }
 
@@ -177,6 +211,10 @@ void dump(std::ostream &os, const luci::PartitionTable &table)
   os << "Assign by OPCODE: " << std::endl;
   for (auto &item : table.byopcodes)
     os << "  " << item.first << "=" << item.second << std::endl;
+
+  os << "Assign by OPNAME: " << std::endl;
+  for (auto &item : table.byopnames)
+    os << "  " << item.first << "=" << item.second << std::endl;
 }
 
 std::ostream &operator<<(std::ostream &os, const luci::PartitionTable &table)
@@ -185,6 +223,59 @@ std::ostream &operator<<(std::ostream &os, const luci::PartitionTable &table)
   return os;
 }
 
+bool auto_partition(arser::Arser &arser, luci::Module *module, luci::PartitionTable &partition)
+{
+  luci::AutoPartitionOption option;
+
+  auto objective = arser.get<std::string>(opt_auto);
+  if (objective == "latency")
+    option.objective = luci::PartitionObjective::Latency;
+  else if (objective == "throughput")
+    option.objective = luci::PartitionObjective::Throughput;
+  else
+  {
+    std::cerr << "ERROR: " << opt_auto << " should be 'latency' or 'throughput'" << std::endl;
+    return false;
+  }
+
+  if (arser[opt_stages])
+  {
+    auto stages = arser.get<int32_t>(opt_stages);
+    if (stages < 1)
+    {
+      std::cerr << "ERROR: " << opt_stages << " should be positive" << std::endl;
+      return false;
+    }
+    option.stages = static_cast<uint32_t>(stages);
+  }
+
+  std::unique_ptr<luci::PartitionCost> cost;
+  if (arser[opt_exec_time])
+  {
+    try
+    {
+      cost = std::make_unique<partee::ExecTimeCost>(
+        partee::read_exec_time(arser.get<std::string>(opt_exec_time)));
+    }
+    catch (const std::runtime_error &err)
+    {
+      std::cerr << "ERROR: " << err.what() << std::endl;
+      return false;
+    }
+  }
+  else
+    cost = std::make_unique<partee::EstimatedCost>();
+
+  if (!luci::auto_partition(module, *cost, option, partition))
+  {
+    std::cerr << "ERROR: Failed to find a partition where backends can run all operators, "
+                 "each with a unique name"
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
 } // namespace
 
 int entry(int argc, char **argv)
@@ -245,6 +336,15 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  if (arser[opt_auto])
+  {
+    INFO(l) << "--- Auto Partition-----------------------------" << std::endl;
+    if (!auto_partition(arser, module.get(), partition))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
   INFO(l) << "--- PartitionConfig final----------------------" << std::endl;
   INFO(l) << partition << std::endl;
 
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <pepper/json.h>
+
+#include <loco/IR/DataTypeTraits.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+// Rough performance of each kind of backend
+struct BackendSpec
+{
+  double macs_per_us;  // multiply-accumulates of convolutions and matrix multiplications
+  double elems_per_us; // output elements of other operators
+  double launch_us;    // overhead to run an operator
+  bool device;         // true if tensors are in a memory other than the host
+};
+
+const BackendSpec &backend_spec(const std::string &group)
+{
+  static const BackendSpec host{1000.0, 1000.0, 0.0, false};
+  static const std::map<std::string, BackendSpec> specs{
+    {"cpu", host},
+    {"ruy", {2000.0, 1000.0, 0.0, false}},
+    {"xnnpack", {2000.0, 1000.0, 0.0, false}},
+    {"acl_neon", {2000.0, 1000.0, 5.0, false}},
+    {"acl_cl", {8000.0, 2000.0, 20.0, true}},
+  };
+  auto it = specs.find(group);
+  return it != specs.end() ? it->second : host;
+}
+
+// Bandwidth and latency to move tensors between the host and devices
+const double transfer_bytes_per_us = 1000.0;
+const double transfer_launch_us = 50.0;
+
+uint64_t num_elements(const luci::CircleNode *node)
+{
+  uint64_t elements = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (not node->dim(i).known())
+      return 0;
+    elements *= node->dim(i).value();
+  }
+  return elements;
+}
+
+uint64_t tensor_size(const luci::CircleNode *node)
+{
+  if (node->dtype() == loco::DataType::Unknown)
+    return 0;
+  return num_elements(node) * loco::size(node->dtype());
+}
+
+// Return dimension of node at axis, counted from the last if negative, 1 if unknown
+uint32_t dim_of(const loco::Node *node, int32_t axis)
+{
+  auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+  const auto rank = static_cast<int32_t>(circle_node->rank());
+  if (axis < 0)
+    axis += rank;
+  if (axis < 0 || axis >= rank || not circle_node->dim(axis).known())
+    return 1;
+  return circle_node->dim(axis).value();
+}
+
+// Return multiply-accumulates per output element, 0 for operators other than
+// convolutions and matrix multiplications
+uint64_t macs_per_element(const luci::CircleNode *node)
+{
+  if (auto conv = dynamic_cast<const luci::CircleConv2D *>(node))
+    return uint64_t{dim_of(conv->filter(), 1)} * dim_of(conv->filter(), 2) *
+           dim_of(conv->filter(), 3);
+  if (auto dconv = dynamic_cast<const luci::CircleDepthwiseConv2D *>(node))
+    return uint64_t{dim_of(dconv->filter(), 1)} * dim_of(dconv->filter(), 2);
+  if (auto tconv = dynamic_cast<const luci::CircleTransposeConv *>(node))
+    return uint64_t{dim_of(tconv->filter(), 1)} * dim_of(tconv->filter(), 2) *
+           dim_of(tconv->filter(), 3);
+  if (auto fc = dynamic_cast<const luci::CircleFullyConnected *>(node))
+    return dim_of(fc->weights(), -1);
+  if (auto bmm = dynamic_cast<const luci::CircleBatchMatMul *>(node))
+    return dim_of(bmm->x(), bmm->adj_x() ? -2 : -1);
+  return 0;
+}
+
+// Operation names of onert which are not same as opcode names of circle
+std::string to_operation(const std::string &opcode)
+{
+  static const std::map<std::string, std::string> renamed{
+    {"AVERAGE_POOL_2D", "AvgPool2D"},
+    {"MAX_POOL_2D", "MaxPool2D"},
+    {"L2_POOL_2D", "L2Pool2D"},
+  };
+  auto it = renamed.find(opcode);
+  return it != renamed.end() ? it->second : opcode;
+}
+
+// Compare names ignoring case and '_', like "CONV_2D" and "Conv2D"
+std::string normalize(const std::string &name)
+{
+  std::string normalized;
+  for (auto c : name)
+  {
+    if (c != '_')
+      normalized.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+  }
+  return normalized;
+}
+
+/**
+ * @brief Return time of size interpolated from measurements, as onert does
+ */
+int64_t interpolate(const std::map<uint32_t, int64_t> &times, uint32_t size)
+{
+  assert(!times.empty());
+
+  auto found = times.find(size);
+  if (found != times.end())
+    return found->second;
+  if (times.size() < 2)
+    return times.begin()->second;
+
+  auto upper = times.upper_bound(size);
+  auto lower = upper;
+  if (upper == times.end())
+  {
+    --upper;
+    lower = std::prev(upper);
+  }
+  else if (upper == times.begin())
+    ++upper;
+  else
+    --lower;
+
+  const auto x0 = static_cast<int64_t>(lower->first);
+  const auto x1 = static_cast<int64_t>(upper->first);
+  const auto y0 = lower->second;
+  const auto y1 = upper->second;
+  const auto x = static_cast<int64_t>(size);
+
+  const int64_t interpolated = y0 + (x - x0) * (y1 - y0) / (x1 - x0);
+  if (interpolated < 0 && x > x1)
+    return y0;
+  return std::max<int64_t>(interpolated, 1);
+}
+
+// onert records this time for operations which a backend does not support
+const int64_t unsupported_time = std::numeric_limits<int32_t>::max();
+
+} // namespace
+
+namespace partee
+{
+
+double EstimatedCost::op_cost(const std::string &, const luci::CircleNode *node,
+                              const std::string &group) const
+{
+  const auto &spec = backend_spec(group);
+  const auto elements = static_cast<double>(num_elements(node));
+  const auto macs = static_cast<double>(macs_per_element(node));
+  if (macs > 0)
+    return spec.launch_us + elements * macs / spec.macs_per_us;
+  return spec.launch_us + elements / spec.elems_per_us;
+}
+
+double EstimatedCost::transfer_cost(const std::string &from, const std::string &to,
+                                    uint64_t size) const
+{
+  if (size == 0 || from == to)
+    return 0.0;
+  // backends in the host just permute tensors, which is as fast as an elementwise operator
+  if (!backend_spec(from).device && !backend_spec(to).device)
+    return static_cast<double>(size) / 4 / backend_spec(to).elems_per_us;
+  return transfer_launch_us + static_cast<double>(size) / transfer_bytes_per_us;
+}
+
+double ExecTimeCost::op_cost(const std::string &opcode, const luci::CircleNode *node,
+                             const std::string &group) const
+{
+  const auto operation = normalize(to_operation(opcode));
+
+  // onert measures an operation by total size of inputs and outputs in bytes
+  uint64_t size = tensor_size(node);
+  bool quant = false;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto input = loco::must_cast<const luci::CircleNode *>(node->arg(i));
+    if (dynamic_cast<const luci::CircleOutputExclude *>(input) != nullptr)
+      continue;
+    size += tensor_size(input);
+    quant = quant || input->dtype() == loco::DataType::U8;
+  }
+  size = std::min<uint64_t>(size, std::numeric_limits<uint32_t>::max());
+
+  auto find_times = [&](const std::string &backend) -> const std::map<uint32_t, int64_t> * {
+    auto found_backend = _measurements.find(backend);
+    if (found_backend == _measurements.end())
+      return nullptr;
+    for (auto &op : found_backend->second)
+    {
+      if (normalize(op.first) != operation)
+        continue;
+      auto found = op.second.find(quant);
+      if (found != op.second.end() && !found->second.empty())
+        return &found->second;
+    }
+    return nullptr;
+  };
+
+  auto times = find_times(group);
+  if (times != nullptr)
+  {
+    const auto time = interpolate(*times, static_cast<uint32_t>(size));
+    return time >= unsupported_time ? -1.0 : static_cast<double>(time);
+  }
+
+  // Not measured in a measured backend while other backends are, as onert measures
+  // every backend that supports it
+  if (_measurements.find(group) != _measurements.end())
+  {
+    for (auto &backend : _measurements)
+    {
+      if (find_times(backend.first) != nullptr)
+        return -1.0;
+    }
+  }
+  return EstimatedCost::op_cost(opcode, node, group);
+}
+
+double ExecTimeCost::transfer_cost(const std::string &from, const std::string &to,
+                                   uint64_t size) const
+{
+  if (size == 0 || from == to)
+    return 0.0;
+
+  // onert records permutation from a backend as an operation named as the other backend
+  auto found_backend = _measurements.find(from);
+  if (found_backend != _measurements.end())
+  {
+    auto found = found_backend->second.find(to);
+    if (found != found_backend->second.end())
+    {
+      for (auto &times : found->second)
+      {
+        if (times.second.empty())
+          continue;
+        const auto clamped = std::min<uint64_t>(size, std::numeric_limits<uint32_t>::max());
+        return static_cast<double>(interpolate(times.second, static_cast<uint32_t>(clamped)));
+      }
+    }
+  }
+  return EstimatedCost::transfer_cost(from, to, size);
+}
+
+ExecTimeCost::Measurements read_exec_time(const std::string &path)
+{
+  std::ifstream fs(path);
+  if (!fs.is_open())
+    throw std::runtime_error("Failed to open exec_time file: " + path);
+
+  std::stringstream ss;
+  ss << fs.rdbuf();
+
+  ExecTimeCost::Measurements measurements;
+  pepper::JsonReader reader(ss.str(), "Invalid exec_time file");
+  reader.object([&](const std::string &backend) {
+    reader.object([&](const std::string &operation) {
+      reader.object([&](const std::string &quant) {
+        auto &times = measurements[backend][operation][quant == "1"];
+        reader.array([&]() {
+          // [size, time]
+          std::vector<int64_t> pair;
+          reader.array([&]() { pair.push_back(reader.int64()); });
+          if (pair.size() != 2)
+            reader.error("size and time are expected");
+          times[static_cast<uint32_t>(pair.at(0))] = pair.at(1);
+        });
+      });
+    });
+  });
+  reader.end();
+  return measurements;
+}
+
+} // namespace partee
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_COST_H__
+#define __CIRCLE_PARTITION_COST_H__
+
+#include <luci/Partition.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace partee
+{
+
+/**
+ * @brief Rough costs in microseconds estimated from the amount of computation of nodes
+ *        and the kind of backends, for when there is no measurement
+ */
+class EstimatedCost : public luci::PartitionCost
+{
+public:
+  double op_cost(const std::string &opcode, const luci::CircleNode *node,
+                 const std::string &group) const override;
+  double transfer_cost(const std::string &from, const std::string &to,
+                       uint64_t size) const override;
+};
+
+/**
+ * @brief Costs in microseconds measured by onert, which are stored in "exec_time.json"
+ *        when onert runs with profiling of HEScheduler
+ * @note  Costs of nodes and transfers which are not measured are estimated as EstimatedCost
+ *        does. A node not measured in a backend measured with other backends is regarded
+ *        as not supported by the backend.
+ */
+class ExecTimeCost final : public EstimatedCost
+{
+public:
+  // backend -> operation -> quantized -> size in bytes -> time
+  using Measurements =
+    std::map<std::string, std::map<std::string, std::map<bool, std::map<uint32_t, int64_t>>>>;
+
+public:
+  ExecTimeCost(Measurements &&measurements) : _measurements(std::move(measurements))
+  {
+    // DO NOTHING
+  }
+
+public:
+  double op_cost(const std::string &opcode, const luci::CircleNode *node,
+                 const std::string &group) const final;
+  double transfer_cost(const std::string &from, const std::string &to,
+                       uint64_t size) const final;
+
+private:
+  Measurements _measurements;
+};
+
+/**
+ * @brief Reads "exec_time.json" of onert, throws std::runtime_error for invalid file
+ */
+ExecTimeCost::Measurements read_exec_time(const std::string &path);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_COST_H__
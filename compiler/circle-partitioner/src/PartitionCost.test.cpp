@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+namespace
+{
+
+using namespace partee;
+
+template <typename T> T *create(loco::Graph *g, std::initializer_list<uint32_t> shape)
+{
+  auto node = g->nodes()->create<T>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape(shape);
+  node->shape_status(luci::ShapeStatus::VALID);
+  return node;
+}
+
+/**
+ * @brief Sqrt of FLOAT32 [4], which onert measures as 32 bytes of input and output,
+ *        and Conv2D of [1, 4, 4, 8] with [8, 3, 3, 8] filter, of 72 MACs per output element
+ */
+class PartitionCostTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    auto input = create<luci::CircleInput>(&_g, {4});
+    _sqrt = create<luci::CircleSqrt>(&_g, {4});
+    _sqrt->x(input);
+
+    auto ifm = create<luci::CircleInput>(&_g, {1, 4, 4, 8});
+    auto filter = create<luci::CircleConst>(&_g, {8, 3, 3, 8});
+    auto bias = create<luci::CircleConst>(&_g, {8});
+    _conv = create<luci::CircleConv2D>(&_g, {1, 4, 4, 8});
+    _conv->input(ifm);
+    _conv->filter(filter);
+    _conv->bias(bias);
+  }
+
+protected:
+  loco::Graph _g;
+  luci::CircleSqrt *_sqrt = nullptr;
+  luci::CircleConv2D *_conv = nullptr;
+};
+
+class ExecTimeFileTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/circle_partitioner_test.XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    _path = path;
+  }
+
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  void write(const std::string &content)
+  {
+    std::ofstream fs(_path);
+    fs << content;
+  }
+
+protected:
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(PartitionCostTest, estimated_op_cost)
+{
+  EstimatedCost cost;
+
+  // 4 elements at 1000 elements/us
+  EXPECT_DOUBLE_EQ(0.004, cost.op_cost("SQRT", _sqrt, "cpu"));
+  // acl_neon adds launch overhead
+  EXPECT_DOUBLE_EQ(5.004, cost.op_cost("SQRT", _sqrt, "acl_neon"));
+  // Unknown backends are regarded as cpu
+  EXPECT_DOUBLE_EQ(0.004, cost.op_cost("SQRT", _sqrt, "unknown"));
+
+  // 128 elements * 72 MACs at 1000 and 8000 MACs/us
+  EXPECT_DOUBLE_EQ(9.216, cost.op_cost("CONV_2D", _conv, "cpu"));
+  EXPECT_DOUBLE_EQ(20.0 + 1.152, cost.op_cost("CONV_2D", _conv, "acl_cl"));
+}
+
+TEST_F(PartitionCostTest, estimated_op_cost_unknown_shape)
+{
+  EstimatedCost cost;
+
+  _sqrt->dim(0).unset();
+  EXPECT_DOUBLE_EQ(0.0, cost.op_cost("SQRT", _sqrt, "cpu"));
+}
+
+TEST(EstimatedCostTest, transfer_cost)
+{
+  EstimatedCost cost;
+
+  EXPECT_DOUBLE_EQ(0.0, cost.transfer_cost("cpu", "cpu", 4000));
+  EXPECT_DOUBLE_EQ(0.0, cost.transfer_cost("cpu", "acl_cl", 0));
+  // Backends in the host permute 1000 float elements
+  EXPECT_DOUBLE_EQ(1.0, cost.transfer_cost("cpu", "ruy", 4000));
+  // Devices pay latency and bandwidth, to and from the host
+  EXPECT_DOUBLE_EQ(54.0, cost.transfer_cost("cpu", "acl_cl", 4000));
+  EXPECT_DOUBLE_EQ(54.0, cost.transfer_cost("acl_cl", "cpu", 4000));
+}
+
+TEST_F(PartitionCostTest, exec_time_op_cost)
+{
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["Sqrt"][false] = {{16, 10}, {48, 30}};
+  measurements["cpu"]["Conv2D"][false] = {{100, 7}};
+  ExecTimeCost cost(std::move(measurements));
+
+  // Interpolated between 16 and 48 bytes
+  EXPECT_DOUBLE_EQ(20.0, cost.op_cost("SQRT", _sqrt, "cpu"));
+  // Names are compared ignoring case and '_', and a single measurement is used for any size
+  EXPECT_DOUBLE_EQ(7.0, cost.op_cost("CONV_2D", _conv, "cpu"));
+}
+
+TEST_F(PartitionCostTest, exec_time_op_cost_exact_and_extrapolated)
+{
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["Sqrt"][false] = {{8, 5}, {16, 9}, {32, 13}};
+  ExecTimeCost cost(std::move(measurements));
+  EXPECT_DOUBLE_EQ(13.0, cost.op_cost("SQRT", _sqrt, "cpu"));
+
+  ExecTimeCost::Measurements smaller;
+  smaller["cpu"]["Sqrt"][false] = {{8, 5}, {16, 9}};
+  ExecTimeCost extrapolated(std::move(smaller));
+  // 9 + (32 - 16) * (9 - 5) / (16 - 8)
+  EXPECT_DOUBLE_EQ(17.0, extrapolated.op_cost("SQRT", _sqrt, "cpu"));
+}
+
+TEST_F(PartitionCostTest, exec_time_renamed_operation)
+{
+  auto pool = create<luci::CircleAveragePool2D>(&_g, {1, 2, 2, 8});
+  pool->value(_conv);
+
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["AvgPool2D"][false] = {{100, 3}};
+  ExecTimeCost cost(std::move(measurements));
+
+  EXPECT_DOUBLE_EQ(3.0, cost.op_cost("AVERAGE_POOL_2D", pool, "cpu"));
+}
+
+TEST_F(PartitionCostTest, exec_time_not_measured_falls_back)
+{
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["Conv2D"][false] = {{100, 7}};
+  ExecTimeCost cost(std::move(measurements));
+
+  EstimatedCost estimated;
+  // No backend measured Sqrt
+  EXPECT_DOUBLE_EQ(estimated.op_cost("SQRT", _sqrt, "cpu"), cost.op_cost("SQRT", _sqrt, "cpu"));
+  // ruy is not measured at all
+  EXPECT_DOUBLE_EQ(estimated.op_cost("CONV_2D", _conv, "ruy"),
+                   cost.op_cost("CONV_2D", _conv, "ruy"));
+}
+
+TEST_F(PartitionCostTest, exec_time_unsupported_NEG)
+{
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["Sqrt"][false] = {{32, 10}};
+  measurements["acl_cl"]["Sqrt"][false] = {{32, 2147483647}};
+  measurements["acl_cl"]["Conv2D"][false] = {{100, 7}};
+  ExecTimeCost cost(std::move(measurements));
+
+  // Recorded as not supported
+  EXPECT_GT(0.0, cost.op_cost("SQRT", _sqrt, "acl_cl"));
+
+  // Measured in cpu, but not in acl_cl which is measured
+  measurements.clear();
+  measurements["cpu"]["Conv2D"][false] = {{100, 7}};
+  measurements["acl_cl"]["Sqrt"][false] = {{32, 2}};
+  ExecTimeCost missing(std::move(measurements));
+  EXPECT_GT(0.0, missing.op_cost("CONV_2D", _conv, "acl_cl"));
+}
+
+TEST_F(PartitionCostTest, exec_time_quantized_NEG)
+{
+  // Only float operation is measured, so quantized one is estimated
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["Sqrt"][false] = {{32, 10}};
+  ExecTimeCost cost(std::move(measurements));
+
+  auto input = loco::must_cast<luci::CircleNode *>(_sqrt->x());
+  input->dtype(loco::DataType::U8);
+  EXPECT_NE(10.0, cost.op_cost("SQRT", _sqrt, "cpu"));
+}
+
+TEST(ExecTimeCostTest, transfer_cost)
+{
+  ExecTimeCost::Measurements measurements;
+  measurements["cpu"]["acl_cl"][false] = {{100, 10}, {200, 20}};
+  ExecTimeCost cost(std::move(measurements));
+
+  EXPECT_DOUBLE_EQ(15.0, cost.transfer_cost("cpu", "acl_cl", 150));
+  EXPECT_DOUBLE_EQ(0.0, cost.transfer_cost("cpu", "acl_cl", 0));
+
+  // Not measured in this direction
+  EstimatedCost estimated;
+  EXPECT_DOUBLE_EQ(estimated.transfer_cost("acl_cl", "cpu", 150),
+                   cost.transfer_cost("acl_cl", "cpu", 150));
+}
+
+TEST_F(ExecTimeFileTest, read_exec_time)
+{
+  write(R"({"cpu": {"Conv2D": {"0": [[100, 5], [200, 10]], "1": []}},
+            "acl_cl": {"cpu": {"0": [[64, 3]]}, "Add": {}}})");
+
+  auto measurements = read_exec_time(_path);
+  ASSERT_EQ(2, measurements.size());
+
+  const auto &conv = measurements.at("cpu").at("Conv2D");
+  ASSERT_EQ(2, conv.size());
+  EXPECT_EQ(5, conv.at(false).at(100));
+  EXPECT_EQ(10, conv.at(false).at(200));
+  EXPECT_TRUE(conv.at(true).empty());
+
+  EXPECT_EQ(3, measurements.at("acl_cl").at("cpu").at(false).at(64));
+  // Operations without measurements are not kept
+  EXPECT_EQ(0, measurements.at("acl_cl").count("Add"));
+}
+
+TEST_F(ExecTimeFileTest, read_exec_time_empty)
+{
+  write("{}");
+
+  EXPECT_TRUE(read_exec_time(_path).empty());
+}
+
+TEST_F(ExecTimeFileTest, read_exec_time_invalid_NEG)
+{
+  write(R"({"cpu": {"Conv2D": {"0": [[100, five]]}}})");
+
+  EXPECT_THROW(read_exec_time(_path), std::runtime_error);
+}
+
+TEST_F(ExecTimeFileTest, read_exec_time_not_closed_NEG)
+{
+  write(R"({"cpu": {"Conv2D)");
+
+  EXPECT_THROW(read_exec_time(_path), std::runtime_error);
+}
+
+TEST(ReadExecTimeTest, no_file_NEG)
+{
+  EXPECT_THROW(read_exec_time("/tmp/circle_partitioner_no_such_file.json"), std::runtime_error);
+}
@@ -30,6 +30,7 @@ using namespace partee;
 
 const char *_section_partition = "partition";
 const char *_section_OPCODE = "OPCODE";
+const char *_section_OPNAME = "OPNAME";
 
 const char *_key_backends = "backends";
 const char *_key_default = "default";
@@ -70,6 +71,11 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
         }
       }
     }
+    else if (section.name == _section_OPNAME)
+    {
+      for (auto &item : section.items)
+        table.byopnames.emplace(item.first, item.second);
+    }
   }
 
   return table;
@@ -99,6 +99,13 @@ int entry(int argc, char **argv)
           "Two arguments required: input_dtype(int8) "
           "output_dtype(uint8)");
 
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .help("Number of threads to quantize weights with, 0 for the number of hardware threads. "
+          "Default value: 1");
+
   arser.add_argument("input").nargs(1).type(arser::DataType::STR).help("Input circle model");
   arser.add_argument("output").nargs(1).type(arser::DataType::STR).help("Output circle model");
 
@@ -172,6 +179,10 @@ int entry(int argc, char **argv)
     options->param(AlgorithmParameters::Quantize_output_dtype, values.at(1));
   }
 
+  if (arser["--num_threads"])
+    options->param(AlgorithmParameters::Quantize_num_threads,
+                   arser.get<std::string>("--num_threads"));
+
   std::string input_path = arser.get<std::string>("input");
   std::string output_path = arser.get<std::string>("output");
 
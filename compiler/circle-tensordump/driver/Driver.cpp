@@ -37,6 +37,10 @@ int entry(int argc, char **argv)
     .nargs(1)
     .type(arser::DataType::STR)
     .help("Dump to hdf5 file. Specify hdf5 file path to be dumped");
+  arser.add_argument("--tensors_to_raw")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .help("Dump to raw binary file with json index. Specify raw file path to be dumped");
 
   try
   {
@@ -49,7 +53,10 @@ int entry(int argc, char **argv)
     return 255;
   }
 
-  if (arser["--tensors_to_hdf5"] == arser["--tensors"])
+  const int num_options = static_cast<int>(arser["--tensors_to_hdf5"]) +
+                          static_cast<int>(arser["--tensors_to_raw"]) +
+                          static_cast<int>(arser["--tensors"]);
+  if (num_options != 1)
   {
     std::cout << "[Error] You must specify one option for how to print." << std::endl;
     std::cout << arser;
@@ -65,6 +72,11 @@ int entry(int argc, char **argv)
     dump = std::move(std::make_unique<circletensordump::DumpTensorsToHdf5>());
     output_path = arser.get<std::string>("--tensors_to_hdf5");
   }
+  if (arser["--tensors_to_raw"])
+  {
+    dump = std::move(std::make_unique<circletensordump::DumpTensorsToRaw>());
+    output_path = arser.get<std::string>("--tensors_to_raw");
+  }
   if (arser["--tensors"])
   {
     dump = std::move(std::make_unique<circletensordump::DumpTensors>());
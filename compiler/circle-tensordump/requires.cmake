@@ -1,4 +1,5 @@
 require("arser")
+require("dio-raw")
 require("foder")
 require("mio-circle")
 require("safemain")
@@ -17,6 +17,8 @@
 #include "Dump.h"
 #include "Reader.h"
 
+#include <dio_raw/RawWriter.h>
+
 #include <H5Cpp.h>
 
 #include <memory>
@@ -357,3 +359,98 @@ void DumpTensorsToHdf5::run(std::ostream &os, const circle::Model *model,
 }
 
 } // namespace circletensordump
+
+namespace
+{
+
+dio::raw::DataType raw_dtype_cast(const circle::TensorType &circle_type)
+{
+  switch (circle_type)
+  {
+    case circle::TensorType_FLOAT32:
+      return dio::raw::DataType::FLOAT32;
+    case circle::TensorType_FLOAT16:
+      return dio::raw::DataType::FLOAT16;
+    case circle::TensorType_INT64:
+      return dio::raw::DataType::INT64;
+    case circle::TensorType_INT32:
+      return dio::raw::DataType::INT32;
+    case circle::TensorType_INT16:
+      return dio::raw::DataType::INT16;
+    case circle::TensorType_INT8:
+      return dio::raw::DataType::INT8;
+    case circle::TensorType_UINT8:
+      return dio::raw::DataType::UINT8;
+    case circle::TensorType_BOOL:
+      return dio::raw::DataType::BOOL;
+    default:
+      throw std::runtime_error("NYI tensor type : " + std::to_string(circle_type));
+  }
+}
+
+std::vector<uint32_t> raw_dims_cast(const flatbuffers::Vector<uint8_t> *data,
+                                    const flatbuffers::Vector<int32_t> *dims,
+                                    dio::raw::DataType dtype)
+{
+  std::vector<uint32_t> ret;
+  if (dims == nullptr)
+  {
+    ret.emplace_back(data->size() / dio::raw::size_of(dtype));
+    return ret;
+  }
+  for (uint32_t d = 0; d < dims->size(); d++)
+  {
+    if (dims->Get(d) < 0)
+      throw std::runtime_error("Dimensions shouldn't be negative");
+    ret.emplace_back(static_cast<uint32_t>(dims->Get(d)));
+  }
+  return ret;
+}
+
+} // namespace
+
+namespace circletensordump
+{
+
+/**
+ *  Only data of constant tensors are written with their own names.
+ *  Quantization parameters are not written.
+ */
+void DumpTensorsToRaw::run(std::ostream &, const circle::Model *model,
+                           const std::string &output_path)
+{
+  // loads a circle model
+  circletensordump::Reader reader(model);
+  uint32_t num_subgraph = reader.num_subgraph();
+
+  dio::raw::RawWriter writer{output_path};
+
+  for (uint32_t subgraph_idx = 0; subgraph_idx < num_subgraph; subgraph_idx++)
+  {
+    reader.select_subgraph(subgraph_idx);
+
+    auto tensors = reader.tensors();
+    for (const auto &tensor : *tensors)
+    {
+      const auto tensor_name = tensor->name();
+      if (tensor_name == nullptr)
+      {
+        assert(false && "There is no tensor name");
+        continue;
+      }
+
+      uint32_t buff_idx = tensor->buffer();
+      auto buff_data_ptr = reader.buffers()->Get(buff_idx)->data();
+      if (buff_data_ptr == nullptr)
+        continue;
+
+      auto dtype = ::raw_dtype_cast(tensor->type());
+      auto dims = ::raw_dims_cast(buff_data_ptr, tensor->shape(), dtype);
+      writer.write(tensor_name->str(), dtype, dims, buff_data_ptr->data(), buff_data_ptr->size());
+    }
+  }
+
+  writer.close();
+}
+
+} // namespace circletensordump
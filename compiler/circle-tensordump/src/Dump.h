@@ -52,6 +52,15 @@ public:
   void run(std::ostream &os, const circle::Model *model, const std::string &output_path) override;
 };
 
+class DumpTensorsToRaw final : public DumpInterface
+{
+public:
+  DumpTensorsToRaw() = default;
+
+public:
+  void run(std::ostream &os, const circle::Model *model, const std::string &output_path) override;
+};
+
 } // namespace circletensordump
 
 #endif // __CIRCLE_TENSORDUMP_DUMP_H__
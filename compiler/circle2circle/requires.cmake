@@ -8,5 +8,6 @@ require("oops")
 require("hermes")
 require("hermes-std")
 require("luci")
+require("luci-interpreter")
 require("arser")
 require("vconone")
@@ -22,6 +22,7 @@
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 #include <luci/UserSettings.h>
+#include <luci_interpreter/ConstantEvaluator.h>
 
 #include <oops/InternalExn.h>
 #include <arser/arser.h>
@@ -44,6 +45,8 @@ int entry(int argc, char **argv)
 {
   // Simple argument parser (based on map)
   luci::CircleOptimizer optimizer;
+  luci_interpreter::ConstantEvaluator constant_evaluator;
+  optimizer.constant_evaluator(&constant_evaluator);
 
   auto options = optimizer.options();
   auto settings = luci::UserSettings::settings();
@@ -72,6 +75,19 @@ int entry(int argc, char **argv)
     .default_value(false)
     .help("This will fold Cast operators with constant input");
 
+  arser.add_argument("--fold_constants")
+    .nargs(0)
+    .required(false)
+    .default_value(false)
+    .help("This will fold operators whose inputs are all constant by evaluating them");
+
+  arser.add_argument("--fold_constants_size_limit")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .help("Maximum size in bytes of a folded constant (argument for --fold_constants). "
+          "Default value: 1048576");
+
   arser.add_argument("--fold_dequantize")
     .nargs(0)
     .required(false)
@@ -286,6 +302,13 @@ int entry(int argc, char **argv)
     .default_value(false)
     .help("This will turn on profiling data generation.");
 
+  arser.add_argument("--out_of_line_threshold")
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .help("Store constant buffers larger than this size in bytes after the model, "
+          "which lets the output exceed 2GB. Default value: 0 (store all in the model)");
+
   arser.add_argument("input").nargs(1).type(arser::DataType::STR).help("Input circle model");
   arser.add_argument("output").nargs(1).type(arser::DataType::STR).help("Output circle model");
 
@@ -349,6 +372,13 @@ int entry(int argc, char **argv)
     options->enable(Algorithms::FoldAddV2);
   if (arser.get<bool>("--fold_cast"))
     options->enable(Algorithms::FoldCast);
+  if (arser.get<bool>("--fold_constants"))
+  {
+    options->enable(Algorithms::FoldConstants);
+    if (arser["--fold_constants_size_limit"])
+      options->param(AlgorithmParameters::FoldConstants_size_limit,
+                     arser.get<std::string>("--fold_constants_size_limit"));
+  }
   if (arser.get<bool>("--fold_dequantize"))
     options->enable(Algorithms::FoldDequantize);
   if (arser.get<bool>("--fold_sparse_to_dense"))
@@ -506,7 +536,21 @@ int entry(int argc, char **argv)
   // Export to output Circle file
   luci::CircleExporter exporter;
 
-  luci::CircleFileExpContract contract(module.get(), output_path);
+  size_t out_of_line_threshold = 0;
+  if (arser["--out_of_line_threshold"])
+  {
+    try
+    {
+      out_of_line_threshold = std::stoull(arser.get<std::string>("--out_of_line_threshold"));
+    }
+    catch (const std::exception &)
+    {
+      std::cerr << "ERROR: Invalid value for --out_of_line_threshold" << std::endl;
+      return 255;
+    }
+  }
+
+  luci::CircleFileExpContract contract(module.get(), output_path, out_of_line_threshold);
 
   if (!exporter.invoke(&contract))
   {
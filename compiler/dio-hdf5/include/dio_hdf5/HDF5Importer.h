@@ -14,8 +14,8 @@
  * limitations under the License.
  */
 
-#ifndef __RECORD_MINMAX_HDF5IMPORTER_H__
-#define __RECORD_MINMAX_HDF5IMPORTER_H__
+#ifndef __DIO_HDF5_H__
+#define __DIO_HDF5_H__
 
 #include <luci_interpreter/core/Tensor.h>
 
@@ -23,12 +23,14 @@
 
 #include <stdexcept>
 
+namespace dio
+{
+namespace hdf5
+{
+
 using Shape = luci_interpreter::Shape;
 using DataType = luci_interpreter::DataType;
 
-namespace record_minmax
-{
-
 // HDF5Importer reads an input data saved in the hdf5 file in the given path
 // The hierarchy of the hdf5 file is as follows.
 // Group "/"
@@ -82,6 +84,7 @@ private:
   H5::Group _value_grp;
 };
 
-} // namespace record_minmax
+} // namespace hdf5
+} // namespace dio
 
-#endif // __RECORD_MINMAX_HDF5IMPORTER_H__
+#endif // __DIO_HDF5_H__
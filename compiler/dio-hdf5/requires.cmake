@@ -0,0 +1 @@
+require("luci-interpreter")
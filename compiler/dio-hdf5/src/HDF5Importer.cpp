@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include "HDF5Importer.h"
+#include "dio_hdf5/HDF5Importer.h"
 
 #include <H5Cpp.h>
 
@@ -108,7 +108,9 @@ void readTensorData(H5::DataSet &tensor, int64_t *buffer)
 
 } // namespace
 
-namespace record_minmax
+namespace dio
+{
+namespace hdf5
 {
 
 int32_t HDF5Importer::numInputs(int32_t record_idx)
@@ -156,4 +158,5 @@ void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, DataType *d
   }
 }
 
-} // namespace record_minmax
+} // namespace hdf5
+} // namespace dio
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIO_RAW_FORMAT_H__
+#define __DIO_RAW_FORMAT_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dio
+{
+namespace raw
+{
+
+// A raw dump consists of two files.
+//
+// <path>      : Data of tensors. Data of each tensor starts at a multiple of ALIGNMENT.
+// <path>.json : Index of tensors as follows.
+//
+// {
+//   "format": "dio-raw", "version": 1, "alignment": 4096,
+//   "tensors": [
+//     { "name": "ifm", "dtype": "float32", "shape": [1, 3, 3, 2], "offset": 0, "size": 72 }
+//   ]
+// }
+//
+// Data is stored in the native (little-endian) byte order.
+
+constexpr uint64_t ALIGNMENT = 4096;
+
+enum class DataType
+{
+  FLOAT32,
+  FLOAT16,
+  INT64,
+  INT32,
+  INT16,
+  INT8,
+  UINT8,
+  BOOL,
+};
+
+struct TensorInfo
+{
+  std::string name;
+  DataType dtype = DataType::FLOAT32;
+  std::vector<uint32_t> shape;
+  // offset of data from the beginning of the data file in bytes
+  uint64_t offset = 0;
+  // size of data in bytes
+  uint64_t size = 0;
+};
+
+uint32_t size_of(DataType dtype);
+uint64_t num_elements(const std::vector<uint32_t> &shape);
+
+std::string to_string(DataType dtype);
+// throws std::runtime_error for unknown names
+DataType to_dtype(const std::string &name);
+
+// path of the index file of a raw dump in the given path
+std::string index_path(const std::string &path);
+
+std::string to_json(const std::vector<TensorInfo> &tensors);
+// throws std::runtime_error for malformed index
+std::vector<TensorInfo> from_json(const std::string &json);
+
+} // namespace raw
+} // namespace dio
+
+#endif // __DIO_RAW_FORMAT_H__
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIO_RAW_READER_H__
+#define __DIO_RAW_READER_H__
+
+#include "dio_raw/RawFormat.h"
+
+#include <string>
+#include <vector>
+
+namespace dio
+{
+namespace raw
+{
+
+// RawReader maps a raw dump in the given path to memory
+// NOTE Data is read from the disk on access, so only compared pages are loaded
+class RawReader final
+{
+public:
+  explicit RawReader(const std::string &path);
+  ~RawReader();
+
+  RawReader(const RawReader &) = delete;
+  RawReader &operator=(const RawReader &) = delete;
+
+public:
+  const std::vector<TensorInfo> &tensors(void) const { return _tensors; }
+
+  // returns nullptr if there is no tensor of the given name
+  const TensorInfo *find(const std::string &name) const;
+
+  // data of a tensor, aligned to ALIGNMENT
+  const uint8_t *data(const TensorInfo &tensor) const { return _base + tensor.offset; }
+
+private:
+  std::vector<TensorInfo> _tensors;
+  const uint8_t *_base = nullptr;
+  uint64_t _length = 0;
+};
+
+} // namespace raw
+} // namespace dio
+
+#endif // __DIO_RAW_READER_H__
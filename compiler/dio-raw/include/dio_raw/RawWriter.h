@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIO_RAW_WRITER_H__
+#define __DIO_RAW_WRITER_H__
+
+#include "dio_raw/RawFormat.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace dio
+{
+namespace raw
+{
+
+// RawWriter writes tensors to a raw dump in the given path
+// NOTE The index is written by close(), which the destructor calls if not called yet
+class RawWriter final
+{
+public:
+  explicit RawWriter(const std::string &path);
+  ~RawWriter();
+
+public:
+  /**
+   * @brief Append a tensor whose data has "size" bytes
+   * @note  "size" should match dtype and shape
+   */
+  void write(const std::string &name, DataType dtype, const std::vector<uint32_t> &shape,
+             const void *data, uint64_t size);
+
+  void close(void);
+
+private:
+  std::string _path;
+  std::ofstream _file;
+  uint64_t _end = 0;
+  std::vector<TensorInfo> _tensors;
+  bool _closed = false;
+};
+
+} // namespace raw
+} // namespace dio
+
+#endif // __DIO_RAW_WRITER_H__
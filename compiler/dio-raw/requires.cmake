@@ -0,0 +1 @@
+require("pepper-json")
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_raw/RawFormat.h"
+
+#include <pepper/json.h>
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+void write_string(std::ostream &os, const std::string &str)
+{
+  os << '"';
+  for (unsigned char c : str)
+  {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (c < 0x20)
+    {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+      os << buf;
+    }
+    else
+      os << c;
+  }
+  os << '"';
+}
+
+dio::raw::TensorInfo read_tensor(pepper::JsonReader &reader)
+{
+  dio::raw::TensorInfo tensor;
+  bool has_dtype = false, has_shape = false, has_offset = false, has_size = false;
+
+  reader.object([&](const std::string &key) {
+    if (key == "name")
+      tensor.name = reader.string();
+    else if (key == "dtype")
+    {
+      tensor.dtype = dio::raw::to_dtype(reader.string());
+      has_dtype = true;
+    }
+    else if (key == "shape")
+    {
+      reader.array([&]() { tensor.shape.emplace_back(static_cast<uint32_t>(reader.uint64())); });
+      has_shape = true;
+    }
+    else if (key == "offset")
+    {
+      tensor.offset = reader.uint64();
+      has_offset = true;
+    }
+    else if (key == "size")
+    {
+      tensor.size = reader.uint64();
+      has_size = true;
+    }
+    else
+      reader.skip();
+  });
+
+  if (!(has_dtype && has_shape && has_offset && has_size))
+    reader.error("missing tensor attribute");
+
+  return tensor;
+}
+
+} // namespace
+
+namespace dio
+{
+namespace raw
+{
+
+uint32_t size_of(DataType dtype)
+{
+  switch (dtype)
+  {
+    case DataType::FLOAT32:
+    case DataType::INT32:
+      return 4;
+    case DataType::INT64:
+      return 8;
+    case DataType::FLOAT16:
+    case DataType::INT16:
+      return 2;
+    case DataType::INT8:
+    case DataType::UINT8:
+    case DataType::BOOL:
+      return 1;
+  }
+  throw std::runtime_error("dio-raw: unknown data type");
+}
+
+uint64_t num_elements(const std::vector<uint32_t> &shape)
+{
+  uint64_t count = 1;
+  for (auto dim : shape)
+    count *= dim;
+  return count;
+}
+
+std::string to_string(DataType dtype)
+{
+  switch (dtype)
+  {
+    case DataType::FLOAT32:
+      return "float32";
+    case DataType::FLOAT16:
+      return "float16";
+    case DataType::INT64:
+      return "int64";
+    case DataType::INT32:
+      return "int32";
+    case DataType::INT16:
+      return "int16";
+    case DataType::INT8:
+      return "int8";
+    case DataType::UINT8:
+      return "uint8";
+    case DataType::BOOL:
+      return "bool";
+  }
+  throw std::runtime_error("dio-raw: unknown data type");
+}
+
+DataType to_dtype(const std::string &name)
+{
+  for (auto dtype : {DataType::FLOAT32, DataType::FLOAT16, DataType::INT64, DataType::INT32,
+                     DataType::INT16, DataType::INT8, DataType::UINT8, DataType::BOOL})
+  {
+    if (to_string(dtype) == name)
+      return dtype;
+  }
+  throw std::runtime_error("dio-raw: unknown data type '" + name + "'");
+}
+
+std::string index_path(const std::string &path) { return path + ".json"; }
+
+std::string to_json(const std::vector<TensorInfo> &tensors)
+{
+  std::ostringstream os;
+
+  os << "{\n";
+  os << "  \"format\": \"dio-raw\",\n";
+  os << "  \"version\": 1,\n";
+  os << "  \"alignment\": " << ALIGNMENT << ",\n";
+  os << "  \"tensors\": [";
+  for (size_t n = 0; n < tensors.size(); ++n)
+  {
+    const auto &tensor = tensors.at(n);
+
+    os << (n == 0 ? "\n" : ",\n");
+    os << "    { \"name\": ";
+    write_string(os, tensor.name);
+    os << ", \"dtype\": \"" << to_string(tensor.dtype) << "\", \"shape\": [";
+    for (size_t d = 0; d < tensor.shape.size(); ++d)
+      os << (d == 0 ? "" : ", ") << tensor.shape.at(d);
+    os << "], \"offset\": " << tensor.offset << ", \"size\": " << tensor.size << " }";
+  }
+  os << (tensors.empty() ? "]\n" : "\n  ]\n");
+  os << "}\n";
+
+  return os.str();
+}
+
+std::vector<TensorInfo> from_json(const std::string &json)
+{
+  std::vector<TensorInfo> tensors;
+
+  pepper::JsonReader reader{json, "dio-raw: malformed index"};
+  reader.object([&](const std::string &key) {
+    if (key == "tensors")
+      reader.array([&]() { tensors.emplace_back(read_tensor(reader)); });
+    else if (key == "version")
+    {
+      if (reader.uint64() != 1)
+        throw std::runtime_error("dio-raw: unsupported index version");
+    }
+    else if (key == "alignment")
+    {
+      // NOTE Coarser alignment is fine
+      auto alignment = reader.uint64();
+      if (alignment == 0 || alignment % ALIGNMENT != 0)
+        throw std::runtime_error("dio-raw: unsupported alignment");
+    }
+    else
+      reader.skip();
+  });
+  reader.end();
+
+  return tensors;
+}
+
+} // namespace raw
+} // namespace dio
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_raw/RawFormat.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+TEST(RawFormatTest, dtype)
+{
+  ASSERT_EQ(4, dio::raw::size_of(dio::raw::DataType::FLOAT32));
+  ASSERT_EQ(8, dio::raw::size_of(dio::raw::DataType::INT64));
+  ASSERT_EQ(1, dio::raw::size_of(dio::raw::DataType::UINT8));
+
+  ASSERT_EQ(dio::raw::DataType::INT16, dio::raw::to_dtype("int16"));
+  ASSERT_EQ("int16", dio::raw::to_string(dio::raw::DataType::INT16));
+}
+
+TEST(RawFormatTest, dtype_NEG)
+{
+  EXPECT_THROW(dio::raw::to_dtype("float"), std::runtime_error);
+}
+
+TEST(RawFormatTest, json)
+{
+  std::vector<dio::raw::TensorInfo> tensors(2);
+  tensors[0].name = "ifm";
+  tensors[0].dtype = dio::raw::DataType::FLOAT32;
+  tensors[0].shape = {1, 3, 3, 2};
+  tensors[0].offset = 0;
+  tensors[0].size = 72;
+  tensors[1].name = "a \"b\"\\c\n";
+  tensors[1].dtype = dio::raw::DataType::UINT8;
+  tensors[1].shape = {};
+  tensors[1].offset = 4096;
+  tensors[1].size = 1;
+
+  auto parsed = dio::raw::from_json(dio::raw::to_json(tensors));
+
+  ASSERT_EQ(2, parsed.size());
+  for (uint32_t n = 0; n < 2; ++n)
+  {
+    ASSERT_EQ(tensors[n].name, parsed[n].name);
+    ASSERT_EQ(tensors[n].dtype, parsed[n].dtype);
+    ASSERT_EQ(tensors[n].shape, parsed[n].shape);
+    ASSERT_EQ(tensors[n].offset, parsed[n].offset);
+    ASSERT_EQ(tensors[n].size, parsed[n].size);
+  }
+}
+
+TEST(RawFormatTest, json_unknown_keys)
+{
+  auto parsed = dio::raw::from_json(R"({ "tensors": [ { "name": "x\u0041", "dtype": "int32",
+    "shape": [2], "offset": 0, "size": 8, "extra": { "a": [1.5, -2e3, true, null] } } ],
+    "comment": "any" })");
+
+  ASSERT_EQ(1, parsed.size());
+  ASSERT_EQ("xA", parsed[0].name);
+  ASSERT_EQ(dio::raw::DataType::INT32, parsed[0].dtype);
+}
+
+TEST(RawFormatTest, json_NEG)
+{
+  EXPECT_THROW(dio::raw::from_json(R"({ "tensors": [ { "name": "x" } ] })"), std::runtime_error);
+  EXPECT_THROW(dio::raw::from_json(R"({ "version": 2, "tensors": [] })"), std::runtime_error);
+  EXPECT_THROW(dio::raw::from_json(R"({ "tensors": [ )"), std::runtime_error);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_raw/RawReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace dio
+{
+namespace raw
+{
+
+RawReader::RawReader(const std::string &path)
+{
+  std::ifstream index{index_path(path)};
+  if (!index.good())
+    throw std::runtime_error("dio-raw: failed to open '" + index_path(path) + "'");
+
+  std::stringstream ss;
+  ss << index.rdbuf();
+  _tensors = from_json(ss.str());
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("dio-raw: failed to open '" + path + "'");
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    ::close(fd);
+    throw std::runtime_error("dio-raw: failed to stat '" + path + "'");
+  }
+  _length = static_cast<uint64_t>(st.st_size);
+
+  for (const auto &tensor : _tensors)
+  {
+    if (tensor.offset % ALIGNMENT != 0 || tensor.offset + tensor.size > _length ||
+        tensor.size != num_elements(tensor.shape) * size_of(tensor.dtype))
+    {
+      ::close(fd);
+      throw std::runtime_error("dio-raw: invalid tensor '" + tensor.name + "' in '" + path + "'");
+    }
+  }
+
+  // NOTE mmap fails for an empty file
+  if (_length > 0)
+  {
+    void *base = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED)
+    {
+      ::close(fd);
+      throw std::runtime_error("dio-raw: failed to map '" + path + "'");
+    }
+    // Tensors are mostly read from the beginning to the end
+    madvise(base, _length, MADV_SEQUENTIAL);
+    _base = static_cast<const uint8_t *>(base);
+  }
+
+  // NOTE Mapping is still valid after the file is closed
+  ::close(fd);
+}
+
+RawReader::~RawReader()
+{
+  if (_base != nullptr)
+    munmap(const_cast<uint8_t *>(_base), _length);
+}
+
+const TensorInfo *RawReader::find(const std::string &name) const
+{
+  for (const auto &tensor : _tensors)
+  {
+    if (tensor.name == name)
+      return &tensor;
+  }
+  return nullptr;
+}
+
+} // namespace raw
+} // namespace dio
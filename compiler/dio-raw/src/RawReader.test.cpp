@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_raw/RawReader.h"
+#include "dio_raw/RawWriter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+class RawDumpTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/dio_raw_test.XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    _path = path;
+  }
+
+  void TearDown() override
+  {
+    std::remove(_path.c_str());
+    std::remove(dio::raw::index_path(_path).c_str());
+  }
+
+protected:
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(RawDumpTest, write_read)
+{
+  std::vector<float> ifm{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  std::vector<int32_t> idx{7, 8};
+  {
+    dio::raw::RawWriter writer{_path};
+    writer.write("ifm", dio::raw::DataType::FLOAT32, {1, 2, 3}, ifm.data(), ifm.size() * 4);
+    writer.write("idx", dio::raw::DataType::INT32, {2}, idx.data(), idx.size() * 4);
+  }
+
+  dio::raw::RawReader reader{_path};
+
+  ASSERT_EQ(2, reader.tensors().size());
+
+  auto t0 = reader.find("ifm");
+  auto t1 = reader.find("idx");
+  ASSERT_NE(nullptr, t0);
+  ASSERT_NE(nullptr, t1);
+  ASSERT_EQ(nullptr, reader.find("ofm"));
+
+  ASSERT_EQ(0, t0->offset);
+  ASSERT_EQ(dio::raw::ALIGNMENT, t1->offset);
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(reader.data(*t1)) % dio::raw::ALIGNMENT);
+
+  auto data0 = reinterpret_cast<const float *>(reader.data(*t0));
+  auto data1 = reinterpret_cast<const int32_t *>(reader.data(*t1));
+  for (uint32_t n = 0; n < ifm.size(); ++n)
+    ASSERT_EQ(ifm[n], data0[n]);
+  for (uint32_t n = 0; n < idx.size(); ++n)
+    ASSERT_EQ(idx[n], data1[n]);
+}
+
+TEST_F(RawDumpTest, size_mismatch_NEG)
+{
+  std::vector<float> ifm{1.0f, 2.0f};
+
+  dio::raw::RawWriter writer{_path};
+  EXPECT_THROW(writer.write("ifm", dio::raw::DataType::FLOAT32, {3}, ifm.data(), 8),
+               std::runtime_error);
+}
+
+TEST_F(RawDumpTest, truncated_NEG)
+{
+  std::vector<float> ifm{1.0f, 2.0f};
+  {
+    dio::raw::RawWriter writer{_path};
+    writer.write("ifm", dio::raw::DataType::FLOAT32, {2}, ifm.data(), 8);
+  }
+  // Drop the data
+  std::fclose(std::fopen(_path.c_str(), "wb"));
+
+  EXPECT_THROW(dio::raw::RawReader{_path}, std::runtime_error);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_raw/RawWriter.h"
+
+#include <stdexcept>
+
+namespace dio
+{
+namespace raw
+{
+
+RawWriter::RawWriter(const std::string &path) : _path{path}
+{
+  _file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!_file.good())
+    throw std::runtime_error("dio-raw: failed to open '" + path + "'");
+}
+
+RawWriter::~RawWriter()
+{
+  if (_closed)
+    return;
+
+  try
+  {
+    close();
+  }
+  catch (...)
+  {
+    // Destructor should not throw. Call close() explicitly to catch errors.
+  }
+}
+
+void RawWriter::write(const std::string &name, DataType dtype, const std::vector<uint32_t> &shape,
+                      const void *data, uint64_t size)
+{
+  if (_closed)
+    throw std::runtime_error("dio-raw: write after close");
+  if (size != num_elements(shape) * size_of(dtype))
+    throw std::runtime_error("dio-raw: size of '" + name + "' does not match its shape");
+
+  TensorInfo tensor;
+  tensor.name = name;
+  tensor.dtype = dtype;
+  tensor.shape = shape;
+  tensor.offset = (_end + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  tensor.size = size;
+
+  // Zero-fill the gap to keep the data of this tensor aligned
+  static const char zeros[ALIGNMENT] = {0};
+  _file.write(zeros, static_cast<std::streamsize>(tensor.offset - _end));
+  _file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+  if (!_file.good())
+    throw std::runtime_error("dio-raw: failed to write '" + _path + "'");
+
+  _end = tensor.offset + size;
+  _tensors.emplace_back(tensor);
+}
+
+void RawWriter::close(void)
+{
+  if (_closed)
+    return;
+  _closed = true;
+
+  _file.close();
+  if (_file.fail())
+    throw std::runtime_error("dio-raw: failed to write '" + _path + "'");
+
+  std::ofstream index{index_path(_path), std::ios::out | std::ios::trunc};
+  index << to_json(_tensors);
+  index.close();
+  if (index.fail())
+    throw std::runtime_error("dio-raw: failed to write '" + index_path(_path) + "'");
+}
+
+} // namespace raw
+} // namespace dio
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FODER_FILE_MAPPER_H__
+#define __FODER_FILE_MAPPER_H__
+
+#ifdef _WIN32
+#include "FileLoader.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace foder
+{
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * @note  On Windows, the file is read into a buffer instead
+ */
+class MappedFile
+{
+public:
+#ifdef _WIN32
+  explicit MappedFile(std::vector<char> &&buffer) : _buffer(std::move(buffer)) {}
+#else
+  MappedFile(void *data, size_t size) : _data(data), _size(size) {}
+  ~MappedFile()
+  {
+    if (_data != nullptr)
+      munmap(_data, _size);
+  }
+#endif
+
+public:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+#ifdef _WIN32
+  const char *data(void) const { return _buffer.data(); }
+  size_t size(void) const { return _buffer.size(); }
+#else
+  const char *data(void) const { return static_cast<const char *>(_data); }
+  size_t size(void) const { return _size; }
+#endif
+
+private:
+#ifdef _WIN32
+  std::vector<char> _buffer;
+#else
+  void *_data;
+  size_t _size;
+#endif
+};
+
+/**
+ * @brief Loads a file by mapping it to memory instead of reading it
+ *
+ * Unlike FileLoader, pages are read on demand and shared with the page cache, so memory which
+ * refers to the file directly is not duplicated.
+ */
+class FileMapper
+{
+public:
+  explicit FileMapper(const std::string &path) : _path(path) {}
+
+public:
+  FileMapper(const FileMapper &) = delete;
+  FileMapper &operator=(const FileMapper &) = delete;
+
+public:
+  std::shared_ptr<const MappedFile> map(void) const
+  {
+#ifdef _WIN32
+    return std::make_shared<const MappedFile>(FileLoader{_path}.load());
+#else
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      std::string errmsg = "ERROR: Failed to open file: " + _path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+      close(fd);
+      std::string errmsg = "ERROR: Failed to read file: " + _path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    const auto size = static_cast<size_t>(st.st_size);
+    void *data = nullptr;
+    if (size > 0)
+    {
+      data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED)
+      {
+        close(fd);
+        std::string errmsg = "ERROR: Failed to map file: " + _path;
+        throw std::runtime_error(errmsg.c_str());
+      }
+    }
+    // The mapping stays valid after closing the file
+    close(fd);
+
+    return std::make_shared<const MappedFile>(data, size);
+#endif
+  }
+
+private:
+  const std::string _path;
+};
+
+} // namespace foder
+
+#endif // __FODER_FILE_MAPPER_H__
@@ -24,26 +24,47 @@
 
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace hermes
 {
 
+class Dispatcher;
+
 /**
  * @brief Logging controller
  *
  * This "Context" serves as a controller for associated logging source/sink.
  *
- * WARNING This "Context" is not yet thread-safe.
- * TODO Support multi-threaded application logging
+ * Messages are delivered to sinks on the posting thread by default. In asynchronous mode,
+ * messages are queued without lock and a background thread delivers them to sinks.
+ *
+ * WARNING Only "post" is thread-safe, and only in asynchronous mode.
  */
 class Context final : private MessageBus, private Source::Registry, private Sink::Registry
 {
+public:
+  Context();
+  ~Context();
+
 public:
   /// @brief Get the global configuration
   const Config *config(void) const;
   /// @brief Update the global configuration
   void config(std::unique_ptr<Config> &&);
 
+public:
+  /// @brief Return true if messages are delivered on a background thread
+  bool async(void) const { return _dispatcher != nullptr; }
+  /**
+   * @brief Turn asynchronous delivery on/off
+   *
+   * NOTE Pending messages are delivered before turning asynchronous delivery off
+   */
+  void async(bool);
+  /// @brief Wait until all the messages posted so far are delivered
+  void flush(void);
+
 public:
   MessageBus *bus(void) { return this; }
 
@@ -67,10 +88,19 @@ private:
   /// This implements "append" method that "Sink::Registry" interface requires.
   void append(std::unique_ptr<Sink> &&sink) override;
 
+private:
+  void reload(Source *source);
+  void deliver(std::unique_ptr<Message> &&msg);
+
 private:
   std::unique_ptr<Config> _config;
   std::set<Source *> _sources;
-  std::set<std::unique_ptr<Sink>> _sinks;
+  std::vector<std::unique_ptr<Sink>> _sinks;
+  /// @brief Messages that each sink accepts
+  std::vector<SourceSetting> _sink_settings;
+  /// @brief Messages that any sink accepts
+  SourceSetting _accepted;
+  std::unique_ptr<Dispatcher> _dispatcher;
 };
 
 } // namespace hermes
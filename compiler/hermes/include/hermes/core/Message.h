@@ -17,6 +17,8 @@
 #ifndef __HERMES_MESSAGE_H__
 #define __HERMES_MESSAGE_H__
 
+#include "hermes/core/Severity.h"
+
 #include <memory>
 #include <sstream>
 #include <string>
@@ -48,7 +50,6 @@ private:
  * @brief Message with metadata
  *
  * TODO Add "Timestamp" field
- * TODO Add "Severity" field
  * TODO Support extensible "attribute" annotation
  */
 class Message final
@@ -56,11 +57,17 @@ class Message final
 public:
   Message() = default;
 
+public:
+  /// @brief Message severity, which is INFO unless specified
+  void severity(const Severity &severity) { _severity = severity; }
+  const Severity &severity(void) const { return _severity; }
+
 public:
   void text(std::unique_ptr<MessageText> &&text) { _text = std::move(text); }
   const MessageText *text(void) const { return _text.get(); }
 
 private:
+  Severity _severity = info();
   std::unique_ptr<MessageText> _text;
 };
 
@@ -18,6 +18,7 @@
 #define __HERMES_SINK_H__
 
 #include "hermes/core/Message.h"
+#include "hermes/core/SourceSetting.h"
 
 #include <memory>
 
@@ -41,6 +42,13 @@ struct Sink
 
   virtual ~Sink() = default;
 
+  /**
+   * @brief Update a given setting to accept the messages that this sink consumes
+   *
+   * "Context" does not even format a message if no sink accepts it.
+   */
+  virtual void configure(SourceSetting &setting) const { setting.accept_all(); }
+
   virtual void notify(const Message *) = 0;
 };
 
@@ -67,10 +67,7 @@ public:
    * NOTE This routine is performance critical as app always invokes this routine
    *      (even when logging is disabled).
    */
-  inline bool check(const Severity &s) const
-  {
-    return static_cast<int32_t>(s.level()) < _setting.limit(s.category()).level();
-  }
+  inline bool check(const Severity &s) const { return _setting.check(s); }
 
 public:
   /**
@@ -82,6 +79,16 @@ public:
    */
   virtual void reload(const Config *);
 
+  /**
+   * @brief Reject messages that a given setting rejects
+   *
+   * "Context" uses this to reject messages that no sink accepts so that "check" fails
+   * before the message is formatted.
+   *
+   * WARNING Do NOT invoke this manually.
+   */
+  void narrow(const Setting &setting) { _setting.narrow(setting); }
+
 public:
   std::unique_ptr<MessageBuffer> buffer(const Severity &) const;
 
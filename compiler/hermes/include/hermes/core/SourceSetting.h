@@ -17,6 +17,9 @@
 #ifndef __HERMES_SOURCE_SETTING_H__
 #define __HERMES_SOURCE_SETTING_H__
 
+#include "hermes/core/Severity.h"
+
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
@@ -93,6 +96,27 @@ public:
     return _ulimits.data() + static_cast<uint32_t>(cat);
   }
 
+  /// @brief Return true if a message with a given severity is acceptable
+  inline bool check(const Severity &s) const
+  {
+    return static_cast<int32_t>(s.level()) < limit(s.category()).level();
+  }
+
+public:
+  /// @brief Accept messages that either this or a given setting accepts
+  void merge(const SourceSetting &s)
+  {
+    for (uint32_t n = 0; n < _ulimits.size(); ++n)
+      _ulimits[n] = std::max(_ulimits[n], s._ulimits[n]);
+  }
+
+  /// @brief Reject messages that either this or a given setting rejects
+  void narrow(const SourceSetting &s)
+  {
+    for (uint32_t n = 0; n < _ulimits.size(); ++n)
+      _ulimits[n] = std::min(_ulimits[n], s._ulimits[n]);
+  }
+
 private:
   /**
    * @brief Allowed message level for each category
@@ -13,14 +13,26 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
 #include "hermes/core/Context.h"
 
+#include "Dispatcher.h"
+
 #include <cassert>
 
 namespace hermes
 {
 
+Context::Context()
+{
+  // DO NOTHING
+}
+
+Context::~Context()
+{
+  // Deliver pending messages while sinks are still alive
+  _dispatcher.reset();
+}
+
 const Config *Context::config(void) const
 {
   // Return the current configuration
@@ -34,32 +46,51 @@ void Context::config(std::unique_ptr<Config> &&config)
   // Apply updated configurations
   for (auto source : _sources)
   {
-    source->reload(_config.get());
+    reload(source);
+  }
+}
+
+void Context::async(bool on)
+{
+  if (on == async())
+    return;
+
+  if (on)
+  {
+    _dispatcher = std::make_unique<Dispatcher>(
+      [this](std::unique_ptr<Message> &&msg) { deliver(std::move(msg)); });
+  }
+  else
+  {
+    _dispatcher.reset();
   }
 }
 
+void Context::flush(void)
+{
+  if (_dispatcher)
+    _dispatcher->flush();
+}
+
 void Context::post(std::unique_ptr<Message> &&msg)
 {
   // Validate message
   assert((msg != nullptr) && "invalid message");
   assert((msg->text() != nullptr) && "missing text");
 
-  // Take the ownership of a given message
-  auto m = std::move(msg);
-
-  // Notify appended sinks
-  for (const auto &sink : _sinks)
+  if (_dispatcher)
   {
-    sink->notify(m.get());
+    _dispatcher->post(std::move(msg));
+    return;
   }
 
-  // TODO Stop the process if "FATAL" message is posted
+  deliver(std::move(msg));
 }
 
 void Context::attach(Source *source)
 {
   // Configure source first
-  source->reload(config());
+  reload(source);
   // Insert source
   _sources.insert(source);
 }
@@ -72,8 +103,49 @@ void Context::detach(Source *source)
 
 void Context::append(std::unique_ptr<Sink> &&sink)
 {
+  // NOTE The background thread reads sinks without lock
+  bool was_async = async();
+  async(false);
+
+  SourceSetting setting;
+  sink->configure(setting);
+
   // Append sink
-  _sinks.insert(std::move(sink));
+  _sinks.emplace_back(std::move(sink));
+  _sink_settings.emplace_back(setting);
+  _accepted.merge(setting);
+
+  // Sources may accept more messages now
+  for (auto source : _sources)
+  {
+    reload(source);
+  }
+
+  async(was_async);
+}
+
+void Context::reload(Source *source)
+{
+  source->reload(config());
+  // Let "check" reject messages that no sink accepts
+  source->narrow(_accepted);
+}
+
+void Context::deliver(std::unique_ptr<Message> &&msg)
+{
+  // Take the ownership of a given message
+  auto m = std::move(msg);
+
+  // Notify appended sinks
+  for (uint32_t n = 0; n < _sinks.size(); ++n)
+  {
+    if (_sink_settings.at(n).check(m->severity()))
+    {
+      _sinks.at(n)->notify(m.get());
+    }
+  }
+
+  // TODO Stop the process if "FATAL" message is posted
 }
 
 } // namespace hermes
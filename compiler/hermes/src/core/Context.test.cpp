@@ -16,6 +16,10 @@
 
 #include "hermes/core/Context.h"
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 TEST(ContextTest, constructor)
@@ -26,3 +30,119 @@ TEST(ContextTest, constructor)
   ASSERT_NE(ctx.sources(), nullptr);
   ASSERT_NE(ctx.sinks(), nullptr);
 }
+
+namespace
+{
+
+struct MockConfig final : public hermes::Config
+{
+  void configure(const hermes::Source *, hermes::Source::Setting &setting) const override
+  {
+    setting.accept_all();
+  }
+};
+
+struct MockSource final : public hermes::Source
+{
+  MockSource(hermes::Context *ctx) { activate(ctx->sources(), ctx->bus()); }
+  ~MockSource() { deactivate(); }
+};
+
+struct MockSink final : public hermes::Sink
+{
+  MockSink(uint32_t *count, bool warn_only) : _count{count}, _warn_only{warn_only} {}
+
+  void configure(hermes::SourceSetting &setting) const override
+  {
+    if (_warn_only)
+    {
+      setting.reject_all();
+      setting.filter(hermes::WARN).accept_all();
+      return;
+    }
+    setting.accept_all();
+  }
+
+  void notify(const hermes::Message *) override { *_count += 1; }
+
+  uint32_t *_count;
+  bool _warn_only;
+};
+
+} // namespace
+
+TEST(ContextTest, reject_without_sink)
+{
+  hermes::Context ctx;
+  ctx.config(std::make_unique<MockConfig>());
+
+  MockSource source{&ctx};
+
+  ASSERT_FALSE(source.check(hermes::warn()));
+  ASSERT_FALSE(source.check(hermes::info()));
+}
+
+TEST(ContextTest, check_sink_setting)
+{
+  uint32_t warn_count = 0;
+  uint32_t all_count = 0;
+
+  hermes::Context ctx;
+  ctx.config(std::make_unique<MockConfig>());
+
+  MockSource source{&ctx};
+
+  ctx.sinks()->append(std::make_unique<MockSink>(&warn_count, true));
+
+  ASSERT_TRUE(source.check(hermes::warn()));
+  ASSERT_FALSE(source.check(hermes::info()));
+
+  ctx.sinks()->append(std::make_unique<MockSink>(&all_count, false));
+
+  ASSERT_TRUE(source.check(hermes::info()));
+
+  HERMES_WARN(source) << "A" << std::endl;
+  HERMES_INFO(source) << "B" << std::endl;
+
+  ASSERT_EQ(warn_count, 1);
+  ASSERT_EQ(all_count, 2);
+}
+
+TEST(ContextTest, async)
+{
+  const uint32_t num_threads = 4;
+  const uint32_t num_messages = 3000;
+
+  uint32_t count = 0;
+
+  hermes::Context ctx;
+  ctx.config(std::make_unique<MockConfig>());
+  ctx.sinks()->append(std::make_unique<MockSink>(&count, false));
+
+  ctx.async(true);
+  ASSERT_TRUE(ctx.async());
+
+  // NOTE Sources SHOULD be attached on the thread that owns the context
+  MockSource source{&ctx};
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&source, num_messages] {
+      for (uint32_t n = 0; n < num_messages; ++n)
+      {
+        HERMES_INFO(source) << n << std::endl;
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  ctx.flush();
+  ASSERT_EQ(count, num_threads * num_messages);
+
+  ctx.async(false);
+  ASSERT_FALSE(ctx.async());
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Dispatcher.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <unordered_map>
+
+namespace
+{
+
+std::atomic<uint64_t> next_dispatcher_id{0};
+
+// Dispatcher whose background thread is the current thread, if any
+thread_local const hermes::Dispatcher *current_dispatcher = nullptr;
+
+} // namespace
+
+namespace hermes
+{
+
+MessageRing::~MessageRing()
+{
+  // Drop messages that are never delivered
+  while (pop() != nullptr)
+    ;
+}
+
+bool MessageRing::push(std::unique_ptr<Message> &&msg)
+{
+  auto tail = _tail.load(std::memory_order_relaxed);
+
+  if (tail - _head.load(std::memory_order_acquire) == CAPACITY)
+    return false;
+
+  _slots[tail % CAPACITY] = msg.release();
+  // NOTE This SHOULD be sequentially consistent as Dispatcher checks "_waiting" after push
+  _tail.store(tail + 1);
+
+  return true;
+}
+
+std::unique_ptr<Message> MessageRing::pop(void)
+{
+  auto head = _head.load(std::memory_order_relaxed);
+
+  if (head == _tail.load(std::memory_order_acquire))
+    return nullptr;
+
+  std::unique_ptr<Message> msg{_slots[head % CAPACITY]};
+  _head.store(head + 1, std::memory_order_release);
+
+  return msg;
+}
+
+bool MessageRing::empty(void) const { return _head.load() == _tail.load(); }
+
+Dispatcher::Dispatcher(const Deliver &deliver) : _id{next_dispatcher_id++}, _deliver{deliver}
+{
+  _thread = std::thread{[this] { run(); }};
+}
+
+Dispatcher::~Dispatcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+    _wakeup.notify_one();
+  }
+
+  // The background thread delivers all the pending messages before it exits
+  _thread.join();
+}
+
+void Dispatcher::post(std::unique_ptr<Message> &&msg)
+{
+  assert(msg != nullptr);
+
+  // Sinks may post while messages are delivered. Deliver them right away, as the ring of this
+  // thread would never be drained if it is full.
+  if (current_dispatcher == this)
+  {
+    _deliver(std::move(msg));
+    return;
+  }
+
+  auto r = ring();
+
+  while (!r->push(std::move(msg)))
+  {
+    // The ring is full. Let the background thread catch up.
+    wake();
+    std::this_thread::yield();
+  }
+
+  if (_waiting.load())
+    wake();
+}
+
+void Dispatcher::flush(void)
+{
+  // NOTE The background thread cannot wait for itself, and its messages are already delivered
+  if (current_dispatcher == this)
+    return;
+
+  std::unique_lock<std::mutex> lock{_mutex};
+
+  // The pass in progress may have missed messages posted just before
+  // NOTE the next one never misses them
+  auto target = _pass + 2;
+
+  _flushing += 1;
+  _wakeup.notify_one();
+  _passed.wait(lock, [&] { return _pass >= target; });
+  _flushing -= 1;
+}
+
+MessageRing *Dispatcher::ring(void)
+{
+  // NOTE Rings are looked up by ID as another Dispatcher may reuse the address of this one
+  thread_local std::unordered_map<uint64_t, std::shared_ptr<MessageRing>> rings;
+
+  auto it = rings.find(_id);
+  if (it != rings.end())
+    return it->second.get();
+
+  auto r = std::make_shared<MessageRing>();
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _rings.emplace_back(r);
+  }
+  rings[_id] = r;
+
+  return r.get();
+}
+
+void Dispatcher::drain(void)
+{
+  std::vector<std::shared_ptr<MessageRing>> rings;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Release rings of exited threads
+    auto released = [](const std::shared_ptr<MessageRing> &r) {
+      return r.use_count() == 1 && r->empty();
+    };
+    _rings.erase(std::remove_if(_rings.begin(), _rings.end(), released), _rings.end());
+
+    rings = _rings;
+  }
+
+  // NOTE Sinks are notified without the lock so that they may log as well
+  for (auto &r : rings)
+  {
+    while (auto msg = r->pop())
+    {
+      _deliver(std::move(msg));
+    }
+  }
+}
+
+bool Dispatcher::idle(void) const
+{
+  for (auto &r : _rings)
+  {
+    if (!r->empty())
+      return false;
+  }
+  return true;
+}
+
+void Dispatcher::run(void)
+{
+  current_dispatcher = this;
+
+  while (true)
+  {
+    bool stop = false;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      stop = _stop;
+    }
+
+    drain();
+
+    std::unique_lock<std::mutex> lock{_mutex};
+
+    _pass += 1;
+    _passed.notify_all();
+
+    if (stop)
+      break;
+
+    // NOTE "post" checks "_waiting" after push, and this checks rings after setting
+    //      "_waiting". So, either the message is found here or "post" wakes this up.
+    _waiting.store(true);
+    if (!_stop && _flushing == 0 && idle())
+    {
+      // NOTE Timeout is just for safety
+      _wakeup.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    _waiting.store(false);
+  }
+}
+
+void Dispatcher::wake(void)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _wakeup.notify_one();
+}
+
+} // namespace hermes
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __HERMES_DISPATCHER_H__
+#define __HERMES_DISPATCHER_H__
+
+#include "hermes/core/Message.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hermes
+{
+
+/**
+ * @brief Lock-free ring of messages between one producer and one consumer
+ */
+class MessageRing final
+{
+public:
+  static constexpr uint32_t CAPACITY = 1024;
+
+public:
+  MessageRing() = default;
+  ~MessageRing();
+
+public:
+  /// @brief Return false if the ring is full (producer only)
+  bool push(std::unique_ptr<Message> &&msg);
+  /// @brief Return nullptr if the ring is empty (consumer only)
+  std::unique_ptr<Message> pop(void);
+
+  bool empty(void) const;
+
+private:
+  std::array<Message *, CAPACITY> _slots;
+
+  // NOTE head and tail are kept on separate cache lines to avoid false sharing
+  alignas(64) std::atomic<uint64_t> _head{0}; // next slot to pop
+  alignas(64) std::atomic<uint64_t> _tail{0}; // next slot to push
+};
+
+/**
+ * @brief Deliver posted messages on a background thread
+ *
+ * Each posting thread owns its own ring, so "post" takes no lock unless it is the first
+ * post from the thread or the background thread is asleep. Messages from the same thread
+ * are delivered in the posted order. Messages posted from the background thread, i.e. by
+ * sinks, are delivered synchronously.
+ */
+class Dispatcher final
+{
+public:
+  using Deliver = std::function<void(std::unique_ptr<Message> &&)>;
+
+public:
+  Dispatcher(const Deliver &deliver);
+  ~Dispatcher();
+
+public:
+  void post(std::unique_ptr<Message> &&msg);
+
+  /// @brief Wait until all the messages posted before this call are delivered
+  void flush(void);
+
+private:
+  MessageRing *ring(void);
+  void drain(void);
+  bool idle(void) const;
+  void run(void);
+  void wake(void);
+
+private:
+  const uint64_t _id;
+  Deliver _deliver;
+
+  std::mutex _mutex;
+  std::condition_variable _wakeup;
+  std::condition_variable _passed;
+
+  // NOTE Each posting thread also holds its ring until the thread exits
+  std::vector<std::shared_ptr<MessageRing>> _rings;
+
+  // Whether the background thread is (about to be) asleep
+  std::atomic<bool> _waiting{false};
+  // The number of drain passes completed by the background thread
+  uint64_t _pass = 0;
+  uint32_t _flushing = 0;
+  bool _stop = false;
+
+  std::thread _thread;
+};
+
+} // namespace hermes
+
+#endif // __HERMES_DISPATCHER_H__
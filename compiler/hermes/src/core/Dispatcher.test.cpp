@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Dispatcher.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+std::unique_ptr<hermes::Message> make_message(uint32_t n)
+{
+  std::stringstream ss;
+  ss << n << std::endl;
+
+  auto msg = std::make_unique<hermes::Message>();
+  msg->text(std::make_unique<hermes::MessageText>(ss));
+  return msg;
+}
+
+} // namespace
+
+TEST(MessageRingTest, push_pop)
+{
+  hermes::MessageRing ring;
+
+  ASSERT_TRUE(ring.empty());
+  ASSERT_EQ(ring.pop(), nullptr);
+
+  ASSERT_TRUE(ring.push(make_message(1)));
+  ASSERT_TRUE(ring.push(make_message(2)));
+  ASSERT_FALSE(ring.empty());
+
+  auto first = ring.pop();
+  auto second = ring.pop();
+
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  ASSERT_EQ(first->text()->line(0), "1");
+  ASSERT_EQ(second->text()->line(0), "2");
+  ASSERT_TRUE(ring.empty());
+}
+
+TEST(MessageRingTest, full_NEG)
+{
+  hermes::MessageRing ring;
+
+  for (uint32_t n = 0; n < hermes::MessageRing::CAPACITY; ++n)
+  {
+    ASSERT_TRUE(ring.push(make_message(n)));
+  }
+
+  auto msg = make_message(0);
+  ASSERT_FALSE(ring.push(std::move(msg)));
+  // A rejected message is left to the caller
+  ASSERT_NE(msg, nullptr);
+}
+
+TEST(DispatcherTest, keep_order_per_thread)
+{
+  const uint32_t num_threads = 3;
+  // NOTE Post more messages than a ring holds
+  const uint32_t num_messages = 4 * hermes::MessageRing::CAPACITY;
+
+  std::vector<std::vector<std::string>> delivered(num_threads);
+
+  hermes::Dispatcher dispatcher{[&delivered](std::unique_ptr<hermes::Message> &&msg) {
+    auto text = msg->text();
+    delivered.at(std::stoul(text->line(0))).emplace_back(text->line(1));
+  }};
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&dispatcher, t, num_messages] {
+      for (uint32_t n = 0; n < num_messages; ++n)
+      {
+        std::stringstream ss;
+        ss << t << std::endl << n << std::endl;
+
+        auto msg = std::make_unique<hermes::Message>();
+        msg->text(std::make_unique<hermes::MessageText>(ss));
+        dispatcher.post(std::move(msg));
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  dispatcher.flush();
+
+  for (uint32_t t = 0; t < num_threads; ++t)
+  {
+    ASSERT_EQ(delivered.at(t).size(), num_messages);
+    for (uint32_t n = 0; n < num_messages; ++n)
+    {
+      ASSERT_EQ(delivered.at(t).at(n), std::to_string(n));
+    }
+  }
+}
+
+TEST(DispatcherTest, deliver_on_destruction)
+{
+  uint32_t count = 0;
+
+  {
+    hermes::Dispatcher dispatcher{[&count](std::unique_ptr<hermes::Message> &&) { count += 1; }};
+
+    for (uint32_t n = 0; n < 10; ++n)
+    {
+      dispatcher.post(make_message(n));
+    }
+  }
+
+  ASSERT_EQ(count, 10);
+}
+
+TEST(DispatcherTest, post_from_deliver)
+{
+  // NOTE Post more messages than a ring holds while a message is delivered
+  const uint32_t num_messages = 2 * hermes::MessageRing::CAPACITY;
+
+  uint32_t count = 0;
+  hermes::Dispatcher *self = nullptr;
+
+  hermes::Dispatcher dispatcher{[&](std::unique_ptr<hermes::Message> &&msg) {
+    count += 1;
+    if (msg->text()->line(0) != "0")
+      return;
+    for (uint32_t n = 1; n <= num_messages; ++n)
+    {
+      self->post(make_message(n));
+    }
+    self->flush();
+  }};
+  self = &dispatcher;
+
+  dispatcher.post(make_message(0));
+  dispatcher.flush();
+
+  ASSERT_EQ(count, num_messages + 1);
+}
@@ -38,4 +38,15 @@ TEST(MessageTest, ctor)
 
   // Text is empty at the beginning
   ASSERT_EQ(msg.text(), nullptr);
+  ASSERT_EQ(msg.severity().category(), hermes::INFO);
+}
+
+TEST(MessageTest, severity)
+{
+  hermes::Message msg;
+
+  msg.severity(hermes::verbose(3));
+
+  ASSERT_EQ(msg.severity().category(), hermes::VERBOSE);
+  ASSERT_EQ(msg.severity().level(), 3);
 }
@@ -64,3 +64,18 @@ TEST(MessageBufferTest, pass_constructed_message_on_descturction)
   ASSERT_EQ(bus.message()->text()->line(0), "Hello");
   ASSERT_EQ(bus.message()->text()->line(1), "Nice to meet you");
 }
+
+TEST(MessageBufferTest, pass_severity)
+{
+  MockMessageBus bus;
+
+  {
+    hermes::MessageBuffer buf{&bus, hermes::warn()};
+
+    buf.os() << "Hello" << std::endl;
+  }
+
+  ASSERT_EQ(bus.count(), 1);
+  ASSERT_NE(bus.message(), nullptr);
+  ASSERT_EQ(bus.message()->severity().category(), hermes::WARN);
+}
@@ -20,6 +20,7 @@
 #include <loco.h>
 
 #include <string>
+#include <vector>
 
 namespace logo
 {
@@ -39,6 +40,26 @@ public:
    * @return false if there was nothing changed
    */
   virtual bool run(loco::Graph *graph) = 0;
+
+public:
+  /**
+   * @brief  Return whether the pass may change the graph at the given node
+   *
+   * @note   PhaseRunner<PhaseStrategy::Worklist> runs the pass again only if a node it matches
+   *         has changed since its last run. Passes match any node unless they override this.
+   */
+  virtual bool matches(const loco::Node *) const { return true; }
+
+  /**
+   * @brief  Run the pass again after the given nodes have changed
+   *
+   * @note   The nodes include neighbours of changed nodes, and other users of nodes which have
+   *         gained or lost a user. Passes which can update the graph incrementally override
+   *         this, otherwise it runs over the whole graph.
+   *
+   * @return false if there was nothing changed
+   */
+  virtual bool update(loco::Graph *graph, const std::vector<loco::Node *> &) { return run(graph); }
 };
 
 std::string pass_name(const Pass *);
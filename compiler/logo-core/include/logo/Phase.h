@@ -21,6 +21,8 @@
 
 #include <loco.h>
 
+#include <chrono>
+#include <functional>
 #include <vector>
 #include <memory>
 
@@ -70,9 +72,14 @@ public:
   void changed(bool changed) { _changed = changed; }
   bool changed(void) const { return _changed; }
 
+  // Time spent to run the pass
+  void elapsed(std::chrono::microseconds elapsed) { _elapsed = elapsed; }
+  std::chrono::microseconds elapsed(void) const { return _elapsed; }
+
 private:
   const Pass *_pass;
   bool _changed;
+  std::chrono::microseconds _elapsed{0};
 };
 
 struct PhaseEventListener
@@ -127,6 +134,9 @@ public:
       info.pass(pass);
 
       _listener->notify(&info);
+
+      // Exclude the time spent by the listener
+      _pass_begin = std::chrono::steady_clock::now();
     }
   }
 
@@ -138,6 +148,8 @@ public:
 
       info.pass(pass);
       info.changed(changed);
+      info.elapsed(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - _pass_begin));
 
       _listener->notify(&info);
     }
@@ -145,6 +157,7 @@ public:
 
 private:
   PhaseEventListener *_listener = nullptr;
+  mutable std::chrono::steady_clock::time_point _pass_begin;
 };
 
 enum class PhaseStrategy
@@ -153,6 +166,8 @@ enum class PhaseStrategy
   Saturate,
   // Same as Saturate but will restart from the first when there is a change
   Restart,
+  // Same as Restart but will run a pass only if nodes it matches have changed since its last run
+  Worklist,
 };
 
 template <PhaseStrategy S> class PhaseRunner;
@@ -187,6 +202,40 @@ private:
   loco::Graph *_graph;
 };
 
+/**
+ * @brief  Phase runner which tracks changed nodes not to rerun passes over unchanged graph
+ *
+ * After each pass that changes the graph, new nodes and nodes whose arguments changed are found
+ * by comparing with the graph before the pass. They and their neighbours are queued for every
+ * pass, and a pass runs again only if any queued node matches it (see Pass::matches).
+ *
+ * Changes which do not appear as arguments, e.g. attributes, are found through the given digest
+ * of each node. If a pass reports a change which is not found at all, every pass runs again.
+ */
+template <> class PhaseRunner<PhaseStrategy::Worklist> final : public PhaseRunnerMixinObservable
+{
+public:
+  using NodeDigest = std::function<uint64_t(const loco::Node *)>;
+
+public:
+  PhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+  PhaseRunner(loco::Graph *graph, const NodeDigest &digest) : _graph{graph}, _digest{digest}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const Phase &) const;
+
+private:
+  loco::Graph *_graph;
+  NodeDigest _digest;
+};
+
 } // namespace logo
 
 #endif // __LOGO_PHASE_H__
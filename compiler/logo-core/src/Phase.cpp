@@ -16,6 +16,96 @@
 
 #include <logo/Phase.h>
 
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+
+// What a node looks like, to find nodes which a pass has changed
+struct NodeState
+{
+  const loco::Dialect *dialect;
+  uint32_t opnum;
+  std::vector<loco::Node *> args;
+  uint64_t digest;
+
+  bool operator==(const NodeState &rhs) const
+  {
+    return dialect == rhs.dialect && opnum == rhs.opnum && args == rhs.args &&
+           digest == rhs.digest;
+  }
+};
+
+using GraphState = std::unordered_map<loco::Node *, NodeState>;
+using NodeDigest = logo::PhaseRunner<logo::PhaseStrategy::Worklist>::NodeDigest;
+
+GraphState capture(loco::Graph *g, const NodeDigest &digest)
+{
+  GraphState state;
+  for (uint32_t i = 0; i < g->nodes()->size(); ++i)
+  {
+    auto node = g->nodes()->at(i);
+    NodeState node_state{node->dialect(), node->opnum(), {}, digest ? digest(node) : 0};
+    for (uint32_t n = 0; n < node->arity(); ++n)
+      node_state.args.emplace_back(node->arg(n));
+    state.emplace(node, std::move(node_state));
+  }
+  return state;
+}
+
+// Return nodes which are new or changed between two states, and their neighbours
+std::unordered_set<loco::Node *> changed_nodes(const GraphState &before, const GraphState &after)
+{
+  std::unordered_set<loco::Node *> changed;
+  auto insert_alive = [&](loco::Node *node) {
+    if (node != nullptr && after.find(node) != after.end())
+      changed.insert(node);
+  };
+  // A node which gains or loses a user changes what its other users see, e.g. whether they
+  // are the only user, so those users are queued too
+  auto insert_with_users = [&](loco::Node *node) {
+    if (node == nullptr || after.find(node) == after.end())
+      return;
+    changed.insert(node);
+    for (auto succ : loco::succs(node))
+      insert_alive(succ);
+  };
+
+  for (const auto &item : after)
+  {
+    auto node = item.first;
+    auto prev = before.find(node);
+    if (prev != before.end() && prev->second == item.second)
+      continue;
+
+    changed.insert(node);
+    for (auto arg : item.second.args)
+      insert_with_users(arg);
+    for (auto succ : loco::succs(node))
+      insert_alive(succ);
+    // Previous arguments have lost a user
+    if (prev != before.end())
+    {
+      for (auto arg : prev->second.args)
+        insert_with_users(arg);
+    }
+  }
+
+  // Arguments of removed nodes have lost a user too
+  for (const auto &item : before)
+  {
+    if (after.find(item.first) != after.end())
+      continue;
+    for (auto arg : item.second.args)
+      insert_with_users(arg);
+  }
+
+  return changed;
+}
+
+} // namespace
+
 namespace logo
 {
 
@@ -68,4 +158,67 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
   notifyPhaseEnd();
 }
 
+void PhaseRunner<PhaseStrategy::Worklist>::run(const Phase &phase) const
+{
+  notifyPhaseBegin();
+
+  // Every pass runs over the whole graph first
+  std::vector<bool> full(phase.size(), true);
+  std::vector<std::unordered_set<loco::Node *>> pending(phase.size());
+  auto state = capture(_graph, _digest);
+
+  for (bool changed = true; changed;)
+  {
+    changed = false;
+
+    for (uint32_t p = 0; p < phase.size(); ++p)
+    {
+      auto &pass = phase[p];
+
+      std::vector<loco::Node *> nodes;
+      for (auto node : pending[p])
+      {
+        // Nodes may have been removed since they were queued
+        if (state.find(node) != state.end() && pass->matches(node))
+          nodes.emplace_back(node);
+      }
+      pending[p].clear();
+
+      const bool run_full = full[p];
+      full[p] = false;
+      if (!run_full && nodes.empty())
+        continue;
+
+      notifyPassBegin(pass.get());
+
+      bool pass_changed = run_full ? pass->run(_graph) : pass->update(_graph, nodes);
+
+      notifyPassEnd(pass.get(), pass_changed);
+
+      if (!pass_changed)
+        continue;
+
+      auto next_state = capture(_graph, _digest);
+      auto changes = changed_nodes(state, next_state);
+      state = std::move(next_state);
+
+      if (changes.empty())
+      {
+        // The change is not visible to the runner, so nothing can be skipped
+        full.assign(phase.size(), true);
+      }
+      else
+      {
+        for (auto &queue : pending)
+          queue.insert(changes.begin(), changes.end());
+      }
+
+      changed = true;
+      break;
+    }
+  }
+
+  notifyPhaseEnd();
+}
+
 } // namespace logo
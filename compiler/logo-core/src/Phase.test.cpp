@@ -54,3 +54,158 @@ TEST(LogoPhaseRestartTests, simple)
 
   SUCCEED();
 }
+
+namespace
+{
+
+// Replace the argument of a Push with a new Forward once, and count matched runs
+struct InsertForward final : public logo::Pass
+{
+  const char *name(void) const final { return "InsertForward"; }
+  bool run(loco::Graph *g) final
+  {
+    ++runs;
+    if (done)
+      return false;
+    auto push = dynamic_cast<loco::Push *>(loco::output_nodes(g).at(0));
+    auto forward = g->nodes()->create<loco::Forward>();
+    forward->input(push->from());
+    push->from(forward);
+    done = true;
+    return true;
+  }
+
+  bool done = false;
+  uint32_t runs = 0;
+};
+
+// Pass which only matches ReLU, which the graph does not have
+struct ReLUOnly final : public logo::Pass
+{
+  const char *name(void) const final { return "ReLUOnly"; }
+  bool matches(const loco::Node *node) const final
+  {
+    return dynamic_cast<const loco::ReLU *>(node) != nullptr;
+  }
+  bool run(loco::Graph *) final
+  {
+    ++runs;
+    return false;
+  }
+
+  uint32_t runs = 0;
+};
+
+// Pass which only matches ReLU, and records the nodes it is updated with
+struct ReLUWatcher final : public logo::Pass
+{
+  const char *name(void) const final { return "ReLUWatcher"; }
+  bool matches(const loco::Node *node) const final
+  {
+    return dynamic_cast<const loco::ReLU *>(node) != nullptr;
+  }
+  bool run(loco::Graph *) final { return false; }
+  bool update(loco::Graph *, const std::vector<loco::Node *> &nodes) final
+  {
+    updated.insert(updated.end(), nodes.begin(), nodes.end());
+    return false;
+  }
+
+  std::vector<loco::Node *> updated;
+};
+
+// Remove a Forward between a node and a Push once
+struct RemoveForward final : public logo::Pass
+{
+  RemoveForward(loco::Forward *forward, loco::Push *push) : _forward{forward}, _push{push} {}
+
+  const char *name(void) const final { return "RemoveForward"; }
+  bool run(loco::Graph *g) final
+  {
+    if (_forward == nullptr)
+      return false;
+    _push->from(_forward->input());
+    _forward->input(nullptr);
+    g->nodes()->destroy(_forward);
+    _forward = nullptr;
+    return true;
+  }
+
+private:
+  loco::Forward *_forward;
+  loco::Push *_push;
+};
+
+} // namespace
+
+TEST(LogoPhaseWorklistTests, simple)
+{
+  loco::Graph g;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{&g};
+  logo::Phase phase;
+
+  phase.emplace_back(std::make_unique<Bumblebee>());
+  phase_runner.run(phase);
+
+  SUCCEED();
+}
+
+TEST(LogoPhaseWorklistTests, skip_unmatched)
+{
+  auto g = loco::make_graph();
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+  push->from(pull);
+  auto input = g->inputs()->create();
+  loco::link(input, pull);
+  auto output = g->outputs()->create();
+  loco::link(output, push);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<ReLUOnly>());
+  phase.emplace_back(std::make_unique<InsertForward>());
+  auto relu_only = dynamic_cast<ReLUOnly *>(phase.at(0).get());
+  auto insert_forward = dynamic_cast<InsertForward *>(phase.at(1).get());
+
+  phase_runner.run(phase);
+
+  ASSERT_TRUE(dynamic_cast<loco::Forward *>(push->from()) != nullptr);
+  // ReLUOnly runs once over the whole graph, and not again after the change
+  ASSERT_EQ(1, relu_only->runs);
+  // InsertForward runs again for the changed nodes, and then nothing is left
+  ASSERT_EQ(2, insert_forward->runs);
+}
+
+TEST(LogoPhaseWorklistTests, queue_other_users)
+{
+  // pull - fwd - relu - push_1
+  //          \- fwd_2 - push_2
+  auto g = loco::make_graph();
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto fwd = g->nodes()->create<loco::Forward>();
+  fwd->input(pull);
+  auto relu = g->nodes()->create<loco::ReLU>();
+  relu->input(fwd);
+  auto push_1 = g->nodes()->create<loco::Push>();
+  push_1->from(relu);
+  auto fwd_2 = g->nodes()->create<loco::Forward>();
+  fwd_2->input(fwd);
+  auto push_2 = g->nodes()->create<loco::Push>();
+  push_2->from(fwd_2);
+  loco::link(g->inputs()->create(), pull);
+  loco::link(g->outputs()->create(), push_1);
+  loco::link(g->outputs()->create(), push_2);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<ReLUWatcher>());
+  phase.emplace_back(std::make_unique<RemoveForward>(fwd_2, push_2));
+  auto watcher = dynamic_cast<ReLUWatcher *>(phase.at(0).get());
+
+  phase_runner.run(phase);
+
+  // fwd has lost a user, which may change what relu sees, e.g. fwd having a single user
+  ASSERT_EQ(1, watcher->updated.size());
+  ASSERT_EQ(relu, watcher->updated.at(0));
+}
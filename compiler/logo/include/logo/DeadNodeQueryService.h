@@ -20,6 +20,8 @@
 #include <loco.h>
 #include <loco/IR/DialectService.h>
 
+#include <set>
+
 namespace logo
 {
 
@@ -28,6 +30,15 @@ struct DeadNodeQueryService : public ::loco::DialectService
   virtual ~DeadNodeQueryService() = default;
   /// @brief Check if the node is dead node
   virtual bool isDeadNode(loco::Node *node) = 0;
+  /**
+   * @brief Check if the node is dead node, where active_nodes are active nodes of its graph
+   * @note  Override this not to enumerate active nodes again for each node
+   */
+  virtual bool isDeadNode(loco::Node *node, const std::set<loco::Node *> &active_nodes)
+  {
+    (void)active_nodes;
+    return isDeadNode(node);
+  }
 };
 
 } // namespace logo
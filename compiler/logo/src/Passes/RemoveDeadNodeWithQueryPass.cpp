@@ -43,15 +43,14 @@ bool RemoveDeadNodeWithQueryPass::run(loco::Graph *g)
   }
 
   // Find the nodes that should not be dead node in candidates
-  for (auto node : candidates)
+  for (auto it = candidates.begin(); it != candidates.end();)
   {
-    if (auto service = node->dialect()->service<DeadNodeQueryService>())
-    {
-      if (!service->isDeadNode(node))
-      {
-        candidates.erase(node);
-      }
-    }
+    auto node = *it;
+    auto service = node->dialect()->service<DeadNodeQueryService>();
+    if (service != nullptr && !service->isDeadNode(node, active_nodes))
+      it = candidates.erase(it);
+    else
+      ++it;
   }
 
   for (auto node : candidates)
@@ -1,3 +1,4 @@
+require("foder")
 require("oops")
 require("loco")
 require("luci")
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <foder/FileMapper.h>
 #include <luci/Importer.h>
 #include <luci_interpreter/Interpreter.h>
 #include <luci/CircleExporter.h>
@@ -49,14 +50,9 @@ void writeDataToFile(const std::string &filename, const char *data, size_t data_
 
 std::unique_ptr<luci::Module> importModel(const std::string &filename)
 {
-  std::ifstream fs(filename, std::ifstream::binary);
-  if (fs.fail())
-  {
-    throw std::runtime_error("Cannot open model file \"" + filename + "\".\n");
-  }
-  std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
-                               std::istreambuf_iterator<char>());
-  return luci::Importer().importModule(circle::GetModel(model_data.data()));
+  // Constants of the module refer to the mapped file, which they keep alive
+  auto model_file = foder::FileMapper(filename).map();
+  return luci::Importer().importModule(circle::GetModel(model_file->data()), model_file);
 }
 
 template <typename NodeT> size_t getTensorSize(const NodeT *node)
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CONSTANT_EVALUATOR_H
+#define LUCI_INTERPRETER_CONSTANT_EVALUATOR_H
+
+#include <luci/Pass/ConstantEvaluator.h>
+
+namespace luci_interpreter
+{
+
+// Evaluates a node whose inputs are all constant with the kernel of the interpreter.
+// Nodes without a kernel, with multiple outputs or with subgraphs are not evaluated.
+class ConstantEvaluator final : public luci::ConstantEvaluator
+{
+public:
+  luci::CircleConst *evaluate(luci::CircleNode *node) override;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CONSTANT_EVALUATOR_H
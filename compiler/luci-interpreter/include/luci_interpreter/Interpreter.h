@@ -28,6 +28,11 @@
 #include <vector>
 #include <unordered_map>
 
+namespace pepper
+{
+class ThreadPool;
+} // namespace pepper
+
 namespace luci_interpreter
 {
 
@@ -51,6 +56,10 @@ class Interpreter
 public:
   explicit Interpreter(const luci::Module *module);
 
+  // Heavy kernels (Conv2D, DepthwiseConv2D, FullyConnected, Add, Mul) split their work between
+  // the threads of 'thread_pool'. The pool is not owned and must outlive the interpreter.
+  Interpreter(const luci::Module *module, pepper::ThreadPool *thread_pool);
+
   ~Interpreter();
 
   void writeInputTensor(const luci::CircleInput *input_node, const void *data, size_t data_size);
@@ -119,16 +119,21 @@ public:
   template <typename T> const T *data() const
   {
     assert(_data_allocated);
-    return reinterpret_cast<const T *>(_data.get());
+    return reinterpret_cast<const T *>(_read_only_data != nullptr ? _read_only_data : _data.get());
   }
 
   template <typename T> T *data()
   {
     if (!_data_allocated)
       allocate();
+    else if (_read_only_data != nullptr)
+      copyReadOnlyData();
     return reinterpret_cast<T *>(_data.get());
   }
 
+  // Refer to the data instead of owning a copy. It is copied when the tensor is written first.
+  void setReadOnlyData(const void *data_ptr, size_t data_size);
+
   const std::string &name() const { return _name; }
 
   void readData(void *data_ptr, size_t data_size) const;
@@ -137,11 +142,15 @@ public:
 
   void resize(const Shape &new_shape);
 
+private:
+  void copyReadOnlyData();
+
 private:
   DataType _element_type;
   Shape _shape;
   AffineQuantization _quantization;
   std::unique_ptr<uint8_t[]> _data;
+  const uint8_t *_read_only_data = nullptr;
   std::string _name;
   bool _data_allocated;
 };
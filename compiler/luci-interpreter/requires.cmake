@@ -1 +1,2 @@
 require(luci)
+require(pepper-threadpool)
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/ConstantEvaluator.h"
+
+#include "loader/KernelBuilder.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <exception>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+template <DataType DT> const void *getConstDataImpl(const luci::CircleConst *node)
+{
+  return node->size<DT>() > 0 ? &node->at<DT>(0) : nullptr;
+}
+
+template <DataType DT> void *resizeConstDataImpl(luci::CircleConst *node, uint32_t num_elements)
+{
+  node->size<DT>(num_elements);
+  return num_elements > 0 ? &node->at<DT>(0) : nullptr;
+}
+
+// Return the data of 'node', or nullptr if its type is not supported
+const void *getConstData(const luci::CircleConst *node)
+{
+  switch (node->dtype())
+  {
+    case DataType::U8:
+      return getConstDataImpl<DataType::U8>(node);
+    case DataType::S16:
+      return getConstDataImpl<DataType::S16>(node);
+    case DataType::S32:
+      return getConstDataImpl<DataType::S32>(node);
+    case DataType::S64:
+      return getConstDataImpl<DataType::S64>(node);
+    case DataType::FLOAT32:
+      return getConstDataImpl<DataType::FLOAT32>(node);
+    case DataType::BOOL:
+      return getConstDataImpl<DataType::BOOL>(node);
+    default:
+      return nullptr;
+  }
+}
+
+size_t getConstDataSize(const luci::CircleConst *node)
+{
+  switch (node->dtype())
+  {
+    case DataType::U8:
+      return node->size<DataType::U8>() * sizeof(uint8_t);
+    case DataType::S16:
+      return node->size<DataType::S16>() * sizeof(int16_t);
+    case DataType::S32:
+      return node->size<DataType::S32>() * sizeof(int32_t);
+    case DataType::S64:
+      return node->size<DataType::S64>() * sizeof(int64_t);
+    case DataType::FLOAT32:
+      return node->size<DataType::FLOAT32>() * sizeof(float);
+    case DataType::BOOL:
+      return node->size<DataType::BOOL>() * sizeof(uint8_t);
+    default:
+      return 0;
+  }
+}
+
+// Resize 'node' to 'num_elements' and return its data, or nullptr if its type is not supported
+void *resizeConstData(luci::CircleConst *node, uint32_t num_elements)
+{
+  switch (node->dtype())
+  {
+    case DataType::U8:
+      return resizeConstDataImpl<DataType::U8>(node, num_elements);
+    case DataType::S16:
+      return resizeConstDataImpl<DataType::S16>(node, num_elements);
+    case DataType::S32:
+      return resizeConstDataImpl<DataType::S32>(node, num_elements);
+    case DataType::S64:
+      return resizeConstDataImpl<DataType::S64>(node, num_elements);
+    case DataType::FLOAT32:
+      return resizeConstDataImpl<DataType::FLOAT32>(node, num_elements);
+    case DataType::BOOL:
+      return resizeConstDataImpl<DataType::BOOL>(node, num_elements);
+    default:
+      return nullptr;
+  }
+}
+
+AffineQuantization getQuantization(const luci::CircleNode *node)
+{
+  AffineQuantization quantization;
+  if (node->quantparam() != nullptr)
+  {
+    const luci::CircleQuantParam *params = node->quantparam();
+    quantization.scale.assign(params->scale.cbegin(), params->scale.cend());
+    quantization.zero_point.assign(params->zerop.cbegin(), params->zerop.cend());
+    quantization.quantized_dimension = params->quantized_dimension;
+  }
+  return quantization;
+}
+
+bool isEvaluable(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    // Auxiliary nodes
+    case luci::CircleOpcode::CIRCLECONST:
+    case luci::CircleOpcode::CIRCLEINPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE:
+    // Nodes with multiple outputs or subgraphs
+    case luci::CircleOpcode::IF:
+    case luci::CircleOpcode::SPLIT:
+    case luci::CircleOpcode::UNPACK:
+      return false;
+    default:
+      return true;
+  }
+}
+
+} // namespace
+
+luci::CircleConst *ConstantEvaluator::evaluate(luci::CircleNode *node)
+{
+  if (!isEvaluable(node))
+    return nullptr;
+
+  std::vector<std::unique_ptr<Tensor>> tensors;
+  std::unordered_map<const loco::Node *, Tensor *> node_to_tensor;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    const auto *const_node = dynamic_cast<const luci::CircleConst *>(node->arg(i));
+    if (const_node == nullptr)
+    {
+      // Only missing optional inputs are allowed besides constants
+      if (dynamic_cast<const luci::CircleOutputExclude *>(node->arg(i)) == nullptr)
+        return nullptr;
+      continue;
+    }
+
+    Shape shape(const_node->rank());
+    for (uint32_t axis = 0; axis < const_node->rank(); ++axis)
+      shape.dim(axis) = const_node->dim(axis).value();
+
+    auto tensor = std::make_unique<Tensor>(const_node->dtype(), std::move(shape),
+                                           getQuantization(const_node), const_node->name());
+    const size_t data_size =
+      tensor->shape().num_elements() * getDataTypeSize(const_node->dtype());
+    if (data_size > 0)
+    {
+      const void *data = getConstData(const_node);
+      if (data == nullptr || data_size != getConstDataSize(const_node))
+        return nullptr;
+      tensor->setReadOnlyData(data, data_size);
+    }
+    node_to_tensor.emplace(const_node, tensor.get());
+    tensors.emplace_back(std::move(tensor));
+  }
+
+  auto output =
+    std::make_unique<Tensor>(node->dtype(), Shape{}, getQuantization(node), node->name());
+  node_to_tensor.emplace(node, output.get());
+
+  // The kernel runs as in RuntimeGraph::execute. Nodes which the interpreter does not support
+  // throw, and are just left unfolded.
+  const std::unordered_map<const loco::Graph *, RuntimeGraph *> graph_to_runtime_graph;
+  KernelBuilder kernel_builder(graph_to_runtime_graph, node_to_tensor);
+  try
+  {
+    std::unique_ptr<Kernel> kernel = node->accept(&kernel_builder);
+    kernel->configure();
+    output->allocate();
+    kernel->execute();
+  }
+  catch (const std::exception &)
+  {
+    return nullptr;
+  }
+
+  const auto &shape = output->shape();
+  auto folded = node->graph()->nodes()->create<luci::CircleConst>();
+  folded->dtype(node->dtype());
+  folded->rank(shape.num_dims());
+  for (int axis = 0; axis < shape.num_dims(); ++axis)
+    folded->dim(axis).set(shape.dim(axis));
+  folded->shape_status(luci::ShapeStatus::VALID);
+
+  void *data = resizeConstData(folded, shape.num_elements());
+  if (data == nullptr)
+  {
+    node->graph()->nodes()->destroy(folded);
+    return nullptr;
+  }
+  output->readData(data, shape.num_elements() * getDataTypeSize(node->dtype()));
+
+  if (node->quantparam() != nullptr)
+  {
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    *quantparam = *node->quantparam();
+    folded->quantparam(std::move(quantparam));
+  }
+
+  return folded;
+}
+
+} // namespace luci_interpreter
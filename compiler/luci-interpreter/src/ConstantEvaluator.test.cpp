@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/ConstantEvaluator.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Pass/FoldConstantsPass.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+
+using namespace luci_interpreter;
+
+template <typename T> void setShape(T *node, const std::vector<uint32_t> &shape)
+{
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i).set(shape[i]);
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+class ConstantEvaluatorTest : public ::testing::Test
+{
+protected:
+  luci::CircleConst *createConst(const std::vector<float> &values)
+  {
+    auto node = _g.nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    setShape(node, {static_cast<uint32_t>(values.size())});
+    node->size<loco::DataType::FLOAT32>(values.size());
+    for (uint32_t i = 0; i < values.size(); ++i)
+      node->at<loco::DataType::FLOAT32>(i) = values[i];
+    return node;
+  }
+
+  template <typename T> T *createBinary(loco::Node *x, loco::Node *y, uint32_t size)
+  {
+    auto node = _g.nodes()->create<T>();
+    node->x(x);
+    node->y(y);
+    node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    node->dtype(loco::DataType::FLOAT32);
+    setShape(node, {size});
+    node->name("binary");
+    return node;
+  }
+
+  // Connect 'node' to a graph output, so that passes visit it
+  void setOutput(luci::CircleNode *node)
+  {
+    auto output = _g.nodes()->create<luci::CircleOutput>();
+    output->from(node);
+    output->dtype(node->dtype());
+    output->index(_g.outputs()->create()->index());
+  }
+
+  std::vector<float> values(const luci::CircleConst *node)
+  {
+    std::vector<float> result;
+    for (uint32_t i = 0; i < node->size<loco::DataType::FLOAT32>(); ++i)
+      result.push_back(node->at<loco::DataType::FLOAT32>(i));
+    return result;
+  }
+
+protected:
+  loco::Graph _g;
+  ConstantEvaluator _evaluator;
+};
+
+} // namespace
+
+TEST_F(ConstantEvaluatorTest, add)
+{
+  auto add = createBinary<luci::CircleAdd>(createConst({1, 2}), createConst({3, -5}), 2);
+
+  auto folded = _evaluator.evaluate(add);
+  ASSERT_NE(nullptr, folded);
+  EXPECT_EQ(loco::DataType::FLOAT32, folded->dtype());
+  ASSERT_EQ(1, folded->rank());
+  EXPECT_EQ(2, folded->dim(0).value());
+  EXPECT_EQ(luci::ShapeStatus::VALID, folded->shape_status());
+  EXPECT_EQ((std::vector<float>{4, -3}), values(folded));
+}
+
+TEST_F(ConstantEvaluatorTest, mul)
+{
+  auto mul = createBinary<luci::CircleMul>(createConst({1, 2}), createConst({3, -5}), 2);
+
+  auto folded = _evaluator.evaluate(mul);
+  ASSERT_NE(nullptr, folded);
+  EXPECT_EQ((std::vector<float>{3, -10}), values(folded));
+}
+
+TEST_F(ConstantEvaluatorTest, not_constant_input_NEG)
+{
+  auto input = _g.nodes()->create<luci::CircleInput>();
+  input->dtype(loco::DataType::FLOAT32);
+  setShape(input, {2});
+  auto add = createBinary<luci::CircleAdd>(input, createConst({3, -5}), 2);
+
+  EXPECT_EQ(nullptr, _evaluator.evaluate(add));
+}
+
+TEST_F(ConstantEvaluatorTest, unsupported_op_NEG)
+{
+  // luci-interpreter has no kernel for Cos
+  auto cos = _g.nodes()->create<luci::CircleCos>();
+  cos->x(createConst({0, 1}));
+  cos->dtype(loco::DataType::FLOAT32);
+  setShape(cos, {2});
+
+  EXPECT_EQ(nullptr, _evaluator.evaluate(cos));
+}
+
+TEST_F(ConstantEvaluatorTest, multiple_outputs_NEG)
+{
+  auto split_dim = _g.nodes()->create<luci::CircleConst>();
+  split_dim->dtype(loco::DataType::S32);
+  setShape(split_dim, {});
+  split_dim->size<loco::DataType::S32>(1);
+  split_dim->at<loco::DataType::S32>(0) = 0;
+
+  auto split = _g.nodes()->create<luci::CircleSplit>();
+  split->split_dim(split_dim);
+  split->input(createConst({1, 2}));
+  split->num_split(2);
+  split->dtype(loco::DataType::FLOAT32);
+
+  EXPECT_EQ(nullptr, _evaluator.evaluate(split));
+}
+
+TEST_F(ConstantEvaluatorTest, subgraph_NEG)
+{
+  auto cond = _g.nodes()->create<luci::CircleConst>();
+  cond->dtype(loco::DataType::BOOL);
+  setShape(cond, {});
+  cond->size<loco::DataType::BOOL>(1);
+  cond->at<loco::DataType::BOOL>(0) = true;
+
+  auto if_node = _g.nodes()->create<luci::CircleIf>(1, 1);
+  if_node->cond(cond);
+  if_node->input(0, createConst({1, 2}));
+  if_node->dtype(loco::DataType::FLOAT32);
+
+  EXPECT_EQ(nullptr, _evaluator.evaluate(if_node));
+}
+
+TEST_F(ConstantEvaluatorTest, fold_constants_pass)
+{
+  auto add = createBinary<luci::CircleAdd>(createConst({1, 2}), createConst({3, -5}), 2);
+  setOutput(add);
+
+  // The output has 8 bytes
+  luci::FoldConstantsPass pass(&_evaluator, 8);
+  ASSERT_TRUE(pass.run(&_g));
+
+  auto output = loco::must_cast<luci::CircleOutput *>(loco::output_nodes(&_g).at(0));
+  auto folded = dynamic_cast<luci::CircleConst *>(output->from());
+  ASSERT_NE(nullptr, folded);
+  EXPECT_EQ("binary", folded->name());
+  EXPECT_EQ((std::vector<float>{4, -3}), values(folded));
+}
+
+TEST_F(ConstantEvaluatorTest, fold_constants_pass_size_limit_NEG)
+{
+  auto add = createBinary<luci::CircleAdd>(createConst({1, 2}), createConst({3, -5}), 2);
+  setOutput(add);
+
+  luci::FoldConstantsPass pass(&_evaluator, 4);
+  ASSERT_FALSE(pass.run(&_g));
+
+  auto output = loco::must_cast<luci::CircleOutput *>(loco::output_nodes(&_g).at(0));
+  EXPECT_EQ(add, output->from());
+}
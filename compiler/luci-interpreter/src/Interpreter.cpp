@@ -69,11 +69,13 @@ private:
 
 } // namespace
 
-Interpreter::Interpreter(const luci::Module *module)
+Interpreter::Interpreter(const luci::Module *module) : Interpreter(module, nullptr) {}
+
+Interpreter::Interpreter(const luci::Module *module, pepper::ThreadPool *thread_pool)
 {
   _runtime_to_ir = std::make_unique<RuntimeToIR>();
   _event_notifier = std::make_unique<EventNotifierImpl>(*_runtime_to_ir, _observers);
-  _runtime_module = std::make_unique<RuntimeModule>(_event_notifier.get());
+  _runtime_module = std::make_unique<RuntimeModule>(_event_notifier.get(), thread_pool);
   ModuleLoader loader(module, _runtime_module.get(), *_runtime_to_ir, _node_to_tensor);
   loader.load();
 }
@@ -23,16 +23,27 @@
 #include <memory>
 #include <vector>
 
+namespace pepper
+{
+class ThreadPool;
+} // namespace pepper
+
 namespace luci_interpreter
 {
 
 class RuntimeModule
 {
 public:
-  explicit RuntimeModule(EventNotifier *event_notifier) : _event_notifier(event_notifier) {}
+  explicit RuntimeModule(EventNotifier *event_notifier, pepper::ThreadPool *thread_pool = nullptr)
+    : _event_notifier(event_notifier), _thread_pool(thread_pool)
+  {
+  }
 
   EventNotifier *getEventNotifier() const { return _event_notifier; }
 
+  // Pool shared by kernels which split their work between threads; may be null.
+  pepper::ThreadPool *getThreadPool() const { return _thread_pool; }
+
   RuntimeGraph *addGraph()
   {
     _graphs.push_back(std::make_unique<RuntimeGraph>(this));
@@ -51,6 +62,7 @@ private:
   RuntimeGraph *getMainGraph() const { return _graphs[0].get(); }
 
   EventNotifier *const _event_notifier;
+  pepper::ThreadPool *const _thread_pool;
   std::vector<std::unique_ptr<RuntimeGraph>> _graphs;
 };
 
@@ -42,6 +42,30 @@ void Tensor::deallocate()
 {
   _data_allocated = false;
   _data.reset();
+  _read_only_data = nullptr;
+}
+
+void Tensor::setReadOnlyData(const void *data_ptr, size_t data_size)
+{
+  const size_t element_size = getDataTypeSize(element_type());
+  const int32_t num_elements = shape().num_elements();
+  if (data_size != num_elements * element_size)
+  {
+    throw std::invalid_argument("Invalid data size.");
+  }
+  assert(data_ptr != nullptr);
+  deallocate();
+  _read_only_data = static_cast<const uint8_t *>(data_ptr);
+  _data_allocated = true;
+}
+
+void Tensor::copyReadOnlyData()
+{
+  assert(_read_only_data != nullptr);
+  const uint8_t *read_only_data = _read_only_data;
+  const size_t data_size = _shape.num_elements() * getDataTypeSize(_element_type);
+  allocate();
+  std::memcpy(_data.get(), read_only_data, data_size);
 }
 
 void Tensor::readData(void *data_ptr, size_t data_size) const
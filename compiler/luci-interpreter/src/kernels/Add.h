@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <pepper/threadpool.h>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -28,7 +30,8 @@ namespace kernels
 class Add : public KernelWithParams<AddParams>
 {
 public:
-  Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params);
+  Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params,
+      pepper::ThreadPool *thread_pool = nullptr);
 
   const Tensor *input1() const { return _inputs[0]; }
   const Tensor *input2() const { return _inputs[1]; }
@@ -41,6 +44,9 @@ private:
   void evalFloat() const;
   void evalQuantized() const;
   void evalQuantizedS16() const;
+
+private:
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace kernels
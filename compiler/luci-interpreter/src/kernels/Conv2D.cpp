@@ -30,8 +30,9 @@ namespace kernels
 {
 
 Conv2D::Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-               const Conv2DParams &params)
-  : KernelWithParams<Conv2DParams>({input, filter, bias}, {output}, params)
+               const Conv2DParams &params, pepper::ThreadPool *thread_pool)
+  : KernelWithParams<Conv2DParams>({input, filter, bias}, {output}, params),
+    _thread_pool(thread_pool)
 {
 }
 
@@ -173,6 +174,69 @@ void Conv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
+  if (_thread_pool != nullptr && _thread_pool->num_threads() > 1)
+  {
+    // Every task computes a horizontal stripe of the output from the input rows it depends on,
+    // so neither the stripes nor their parts of the im2col buffer overlap.
+    const Shape &input_shape = input()->shape();
+    const Shape &output_shape = output()->shape();
+    const int32_t filter_height = filter()->shape().dim(1);
+
+    const auto *input_data = getTensorData<float>(input());
+    auto *output_data = getTensorData<float>(output());
+
+    float *im2col_data = nullptr;
+    if (_im2col)
+    {
+      try
+      {
+        im2col_data = getTensorData<float>(_im2col.get());
+      }
+      catch (std::bad_alloc &ba)
+      {
+        // Failed memory allocation
+        _im2col->deallocate();
+      }
+    }
+
+    const auto compute_stripe = [&](int32_t batch, int32_t row_begin, int32_t row_end) {
+      int32_t in_begin{};
+      int32_t in_end{};
+      tflite::ConvParams stripe_params = params;
+      computeInputRows(row_begin, row_end, params.stride_height, params.dilation_height_factor,
+                       filter_height, _padding_height, input_shape.dim(1), &in_begin, &in_end,
+                       &stripe_params.padding_values.height);
+
+      const tflite::RuntimeShape stripe_input_shape{1, in_end - in_begin, input_shape.dim(2),
+                                                    input_shape.dim(3)};
+      const tflite::RuntimeShape stripe_output_shape{1, row_end - row_begin, output_shape.dim(2),
+                                                     output_shape.dim(3)};
+      const float *stripe_input_data = input_data + calcOffset(input_shape, batch, in_begin, 0, 0);
+      float *stripe_output_data = output_data + calcOffset(output_shape, batch, row_begin, 0, 0);
+
+      if (im2col_data != nullptr)
+      {
+        const Shape &im2col_shape = _im2col->shape();
+        const tflite::RuntimeShape stripe_im2col_shape{1, row_end - row_begin, im2col_shape.dim(2),
+                                                       im2col_shape.dim(3)};
+        tflite::optimized_ops::Conv(
+          stripe_params, stripe_input_shape, stripe_input_data, getTensorShape(filter()),
+          getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+          stripe_output_shape, stripe_output_data, stripe_im2col_shape,
+          im2col_data + calcOffset(im2col_shape, batch, row_begin, 0, 0));
+      }
+      else
+      {
+        tflite::reference_ops::Conv(
+          stripe_params, stripe_input_shape, stripe_input_data, getTensorShape(filter()),
+          getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+          stripe_output_shape, stripe_output_data, tflite::RuntimeShape(), nullptr);
+      }
+    };
+    parallelForRows(_thread_pool, output_shape.dim(0), output_shape.dim(1), compute_stripe);
+    return;
+  }
+
   if (_im2col)
   {
     try
@@ -233,9 +297,10 @@ void Conv2D::evalQuantized() const
   params.quantized_activation_max = activation_max;
 
   // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
+  const auto num_threads = _thread_pool != nullptr ? _thread_pool->num_threads()
+                                                   : std::thread::hardware_concurrency();
   auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
+  gemmlowp_context->set_max_num_threads(static_cast<int>(num_threads));
 
   tflite::optimized_ops::Conv(
     params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
@@ -281,9 +346,8 @@ void Conv2D::evalQuantizedPerChannel() const
     quantizeMultipliers(effective_output_scale);
   BroadcastableWrapper<ChannelQuantMultipliers> quant_multipliers(multipliers_raw);
 
-  for (int32_t batch = 0; batch < batches; ++batch)
-  {
-    for (int32_t out_y = 0; out_y < output_height; ++out_y)
+  const auto compute_stripe = [&](int32_t batch, int32_t row_begin, int32_t row_end) {
+    for (int32_t out_y = row_begin; out_y < row_end; ++out_y)
     {
       for (int32_t out_x = 0; out_x < output_width; ++out_x)
       {
@@ -327,7 +391,8 @@ void Conv2D::evalQuantizedPerChannel() const
         }
       }
     }
-  }
+  };
+  parallelForRows(_thread_pool, batches, output_height, compute_stripe);
 }
 
 void Conv2D::evalQuantizedS16() const
@@ -367,9 +432,8 @@ void Conv2D::evalQuantizedS16() const
     quantizeMultipliers(effective_output_scale);
   BroadcastableWrapper<ChannelQuantMultipliers> multipliers(multipliers_raw);
 
-  for (int32_t batch = 0; batch < batches; ++batch)
-  {
-    for (int32_t out_y = 0; out_y < output_height; ++out_y)
+  const auto compute_stripe = [&](int32_t batch, int32_t row_begin, int32_t row_end) {
+    for (int32_t out_y = row_begin; out_y < row_end; ++out_y)
     {
       for (int32_t out_x = 0; out_x < output_width; ++out_x)
       {
@@ -412,7 +476,8 @@ void Conv2D::evalQuantizedS16() const
         }
       }
     }
-  }
+  };
+  parallelForRows(_thread_pool, batches, output_height, compute_stripe);
 }
 
 } // namespace kernels
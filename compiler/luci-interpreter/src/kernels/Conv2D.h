@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <pepper/threadpool.h>
+
 #include <memory>
 
 namespace luci_interpreter
@@ -31,7 +33,7 @@ class Conv2D : public KernelWithParams<Conv2DParams>
 {
 public:
   Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-         const Conv2DParams &params);
+         const Conv2DParams &params, pepper::ThreadPool *thread_pool = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *filter() const { return _inputs[1]; }
@@ -51,6 +53,7 @@ private:
   std::unique_ptr<Tensor> _im2col;
   int32_t _padding_height{};
   int32_t _padding_width{};
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace kernels
@@ -117,6 +117,58 @@ TEST(Conv2DTest, FloatCheck)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST(Conv2DTest, FloatThreadPool)
+{
+  Shape input_shape{2, 2, 4, 1};
+  Shape filter_shape{3, 2, 2, 1};
+  Shape bias_shape{3};
+  std::vector<float> input_data{
+    // First batch
+    1, 1, 1, 1, // row = 1
+    2, 2, 2, 2, // row = 2
+    // Second batch
+    1, 2, 3, 4, // row = 1
+    1, 2, 3, 4, // row = 2
+  };
+  std::vector<float> filter_data{
+    1,  2,  3,  4, // first 2x2 filter
+    -1, 1,  -1, 1, // second 2x2 filter
+    -1, -1, 1,  1, // third 2x2 filter
+  };
+  std::vector<float> bias_data{1, 2, 3};
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor filter_tensor = makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 1;
+  params.stride_width = 2;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  pepper::ThreadPool thread_pool{3};
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params, &thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+    18, 2, 5,  // first batch, row = 1, left
+    18, 2, 5,  // first batch, row = 1, right
+    7,  2, -1, // first batch, row = 2, left
+    7,  2, -1, // first batch, row = 2, right
+    17, 4, 3,  // second batch, row = 1, left
+    37, 4, 3,  // second batch, row = 1, right
+    6,  3, 0,  // second batch, row = 2, left
+    12, 3, -4, // second batch, row = 2, right
+  };
+  std::vector<int32_t> ref_output_shape{2, 2, 2, 3};
+  EXPECT_THAT(extractTensorData<float>(output_tensor), FloatArrayNear(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
 TEST(Conv2DTest, Uint8)
 {
   std::vector<float> input_data{
@@ -29,8 +29,10 @@ namespace kernels
 {
 
 DepthwiseConv2D::DepthwiseConv2D(const Tensor *input, const Tensor *filter, const Tensor *bias,
-                                 Tensor *output, const DepthwiseConv2DParams &params)
-  : KernelWithParams<DepthwiseConv2DParams>({input, filter, bias}, {output}, params)
+                                 Tensor *output, const DepthwiseConv2DParams &params,
+                                 pepper::ThreadPool *thread_pool)
+  : KernelWithParams<DepthwiseConv2DParams>({input, filter, bias}, {output}, params),
+    _thread_pool(thread_pool)
 {
 }
 
@@ -148,10 +150,44 @@ void DepthwiseConv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
-    params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
-    getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
-    getTensorShape(output()), getTensorData<float>(output()));
+  if (_thread_pool == nullptr || _thread_pool->num_threads() == 1)
+  {
+    tflite::reference_ops::DepthwiseConv(
+      params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
+      getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+      getTensorShape(output()), getTensorData<float>(output()));
+    return;
+  }
+
+  // Every task computes a horizontal stripe of the output from the input rows it depends on.
+  const Shape &input_shape = input()->shape();
+  const Shape &output_shape = output()->shape();
+  const int32_t filter_height = filter()->shape().dim(1);
+
+  const auto *input_data = getTensorData<float>(input());
+  auto *output_data = getTensorData<float>(output());
+
+  const auto compute_stripe = [&](int32_t batch, int32_t row_begin, int32_t row_end) {
+    int32_t in_begin{};
+    int32_t in_end{};
+    tflite::DepthwiseParams stripe_params = params;
+    computeInputRows(row_begin, row_end, params.stride_height, params.dilation_height_factor,
+                     filter_height, _padding_height, input_shape.dim(1), &in_begin, &in_end,
+                     &stripe_params.padding_values.height);
+
+    const tflite::RuntimeShape stripe_input_shape{1, in_end - in_begin, input_shape.dim(2),
+                                                  input_shape.dim(3)};
+    const tflite::RuntimeShape stripe_output_shape{1, row_end - row_begin, output_shape.dim(2),
+                                                   output_shape.dim(3)};
+    const float *stripe_input_data = input_data + calcOffset(input_shape, batch, in_begin, 0, 0);
+    float *stripe_output_data = output_data + calcOffset(output_shape, batch, row_begin, 0, 0);
+
+    tflite::reference_ops::DepthwiseConv(
+      stripe_params, stripe_input_shape, stripe_input_data, getTensorShape(filter()),
+      getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+      stripe_output_shape, stripe_output_data);
+  };
+  parallelForRows(_thread_pool, output_shape.dim(0), output_shape.dim(1), compute_stripe);
 }
 
 void DepthwiseConv2D::evalQuantizedPerChannel() const
@@ -191,9 +227,8 @@ void DepthwiseConv2D::evalQuantizedPerChannel() const
     quantizeMultipliers(effective_output_scales);
   BroadcastableWrapper<ChannelQuantMultipliers> quant_multipliers(quant_multipliers_raw);
 
-  for (int batch = 0; batch < batches; ++batch)
-  {
-    for (int out_y = 0; out_y < output_height; ++out_y)
+  const auto compute_stripe = [&](int32_t batch, int32_t row_begin, int32_t row_end) {
+    for (int out_y = row_begin; out_y < row_end; ++out_y)
     {
       for (int out_x = 0; out_x < output_width; ++out_x)
       {
@@ -242,7 +277,8 @@ void DepthwiseConv2D::evalQuantizedPerChannel() const
         }
       }
     }
-  }
+  };
+  parallelForRows(_thread_pool, batches, output_height, compute_stripe);
 }
 
 void DepthwiseConv2D::evalQuantized() const
@@ -321,9 +357,8 @@ void DepthwiseConv2D::evalQuantizedS16() const
   int32_t activation_max{};
   calculateActivationRangeQuantized(_params.activation, output(), &activation_min, &activation_max);
 
-  for (int32_t batch = 0; batch < batches; ++batch)
-  {
-    for (int32_t out_y = 0; out_y < output_height; ++out_y)
+  const auto compute_stripe = [&](int32_t batch, int32_t row_begin, int32_t row_end) {
+    for (int32_t out_y = row_begin; out_y < row_end; ++out_y)
     {
       for (int32_t out_x = 0; out_x < output_width; ++out_x)
       {
@@ -369,7 +404,8 @@ void DepthwiseConv2D::evalQuantizedS16() const
         }
       }
     }
-  }
+  };
+  parallelForRows(_thread_pool, batches, output_height, compute_stripe);
 }
 
 } // namespace kernels
@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <pepper/threadpool.h>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -29,7 +31,7 @@ class DepthwiseConv2D : public KernelWithParams<DepthwiseConv2DParams>
 {
 public:
   DepthwiseConv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-                  const DepthwiseConv2DParams &params);
+                  const DepthwiseConv2DParams &params, pepper::ThreadPool *thread_pool = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *filter() const { return _inputs[1]; }
@@ -48,6 +50,7 @@ private:
 private:
   int32_t _padding_height{};
   int32_t _padding_width{};
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace kernels
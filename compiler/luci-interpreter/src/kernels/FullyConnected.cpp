@@ -28,9 +28,58 @@ namespace luci_interpreter
 namespace kernels
 {
 
+namespace
+{
+
+// Splits the layer between threads: by batches if there are several of them, by output units
+// otherwise. Every part is computed by the reference kernel on its own slices of the tensors.
+template <typename T, typename BiasT>
+void evalParallel(pepper::ThreadPool *thread_pool, const tflite::FullyConnectedParams &params,
+                  const Tensor *input, const Tensor *weights, const Tensor *bias, Tensor *output)
+{
+  const int32_t batches = output->shape().dim(0);
+  const int32_t num_units = output->shape().dim(1);
+  const int32_t accum_depth = weights->shape().dim(1);
+
+  const T *input_data = getTensorData<T>(input);
+  const T *weights_data = getTensorData<T>(weights);
+  const BiasT *bias_data = getTensorData<BiasT>(bias);
+  T *output_data = getTensorData<T>(output);
+
+  const auto compute = [&](int32_t batch_begin, int32_t batch_end, int32_t unit_begin,
+                           int32_t unit_end) {
+    const int32_t rows = batch_end - batch_begin;
+    const int32_t units = unit_end - unit_begin;
+    const tflite::RuntimeShape bias_shape =
+      bias_data != nullptr ? tflite::RuntimeShape{units} : tflite::RuntimeShape();
+    tflite::reference_ops::FullyConnected(
+      params, tflite::RuntimeShape{rows, accum_depth}, input_data + batch_begin * accum_depth,
+      tflite::RuntimeShape{units, accum_depth}, weights_data + unit_begin * accum_depth, bias_shape,
+      bias_data != nullptr ? bias_data + unit_begin : nullptr, tflite::RuntimeShape{rows, units},
+      output_data + batch_begin * num_units + unit_begin);
+  };
+
+  if (batches > 1)
+  {
+    pepper::parallel_for(thread_pool, batches, 1, [&](int64_t begin, int64_t end) {
+      compute(static_cast<int32_t>(begin), static_cast<int32_t>(end), 0, num_units);
+    });
+  }
+  else
+  {
+    pepper::parallel_for(thread_pool, num_units, 16, [&](int64_t begin, int64_t end) {
+      compute(0, batches, static_cast<int32_t>(begin), static_cast<int32_t>(end));
+    });
+  }
+}
+
+} // namespace
+
 FullyConnected::FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias,
-                               Tensor *output, const FullyConnectedParams &params)
-  : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params)
+                               Tensor *output, const FullyConnectedParams &params,
+                               pepper::ThreadPool *thread_pool)
+  : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params),
+    _thread_pool(thread_pool)
 {
 }
 
@@ -96,6 +145,12 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
+  if (_thread_pool != nullptr && _thread_pool->num_threads() > 1)
+  {
+    evalParallel<float, float>(_thread_pool, params, input(), weights(), bias(), output());
+    return;
+  }
+
   tflite::reference_ops::FullyConnected(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
     getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
@@ -129,6 +184,13 @@ void FullyConnected::evalQuantized() const
   op_params.quantized_activation_max = output_activation_max;
   op_params.lhs_cacheable = false;
   op_params.rhs_cacheable = false;
+
+  if (_thread_pool != nullptr && _thread_pool->num_threads() > 1)
+  {
+    evalParallel<uint8_t, int32_t>(_thread_pool, op_params, input(), weights(), bias(), output());
+    return;
+  }
+
   tflite::reference_ops::FullyConnected(
     op_params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(weights()),
     getTensorData<uint8_t>(weights()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <pepper/threadpool.h>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -29,7 +31,7 @@ class FullyConnected : public KernelWithParams<FullyConnectedParams>
 {
 public:
   FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias, Tensor *output,
-                 const FullyConnectedParams &params);
+                 const FullyConnectedParams &params, pepper::ThreadPool *thread_pool = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *weights() const { return _inputs[1]; }
@@ -42,6 +44,9 @@ public:
 private:
   void evalFloat() const;
   void evalQuantized() const;
+
+private:
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace kernels
@@ -105,6 +105,36 @@ TYPED_TEST(FullyConnectedTest, Simple)
                    });
 }
 
+TEST(FullyConnectedTest, FloatThreadPool)
+{
+  Shape input_shape{1, 6};
+  Shape weights_shape{3, 6};
+  Shape bias_shape{3};
+  std::vector<float> input_data{-3, -5, 5, 4, 9, -2};
+  std::vector<float> weights_data{
+    -3, -7, 4, -4, -6, 4, // unit = 0
+    3,  5,  2, 3,  -3, -8, // unit = 1
+    -3, 7,  4, 9,  0,  -5, // unit = 2
+  };
+  std::vector<float> bias_data{-1, -5, -8};
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor weights_tensor = makeInputTensor<DataType::FLOAT32>(weights_shape, weights_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  FullyConnectedParams params{};
+  params.activation = Activation::RELU;
+
+  pepper::ThreadPool thread_pool{2};
+  FullyConnected kernel(&input_tensor, &weights_tensor, &bias_tensor, &output_tensor, params,
+                        &thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 3}));
+  EXPECT_THAT(extractTensorData<float>(output_tensor), FloatArrayNear({0, 0, 32}));
+}
+
 TEST(FullyConnectedTest, InvalidBiasType_NEG)
 {
   Shape input_shape{3, 2, 2, 1};
@@ -29,8 +29,9 @@ namespace luci_interpreter
 namespace kernels
 {
 
-Mul::Mul(const Tensor *input1, const Tensor *input2, Tensor *output, const MulParams &params)
-  : KernelWithParams<MulParams>({input1, input2}, {output}, params)
+Mul::Mul(const Tensor *input1, const Tensor *input2, Tensor *output, const MulParams &params,
+         pepper::ThreadPool *thread_pool)
+  : KernelWithParams<MulParams>({input1, input2}, {output}, params), _thread_pool(thread_pool)
 {
 }
 
@@ -81,6 +82,19 @@ void Mul::evalFloat() const
       params, getTensorShape(input1()), getTensorData<float>(input1()), getTensorShape(input2()),
       getTensorData<float>(input2()), getTensorShape(output()), getTensorData<float>(output()));
   }
+  else if (_thread_pool != nullptr && _thread_pool->num_threads() > 1)
+  {
+    const auto *input1_data = getTensorData<float>(input1());
+    const auto *input2_data = getTensorData<float>(input2());
+    auto *output_data = getTensorData<float>(output());
+    const auto compute_block = [&](int64_t begin, int64_t end) {
+      const tflite::RuntimeShape block_shape{static_cast<int32_t>(end - begin)};
+      tflite::optimized_ops::Mul(params, block_shape, input1_data + begin, block_shape,
+                                 input2_data + begin, block_shape, output_data + begin);
+    };
+    pepper::parallel_for(_thread_pool, output()->shape().num_elements(), kElementwiseGrain,
+                         compute_block);
+  }
   else
   {
     tflite::optimized_ops::Mul(params, getTensorShape(input1()), getTensorData<float>(input1()),
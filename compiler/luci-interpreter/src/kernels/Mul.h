@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <pepper/threadpool.h>
+
 #include <cstdint>
 #include <vector>
 
@@ -31,7 +33,8 @@ namespace kernels
 class Mul : public KernelWithParams<MulParams>
 {
 public:
-  Mul(const Tensor *input1, const Tensor *input2, Tensor *output, const MulParams &params);
+  Mul(const Tensor *input1, const Tensor *input2, Tensor *output, const MulParams &params,
+      pepper::ThreadPool *thread_pool = nullptr);
 
   const Tensor *input1() const { return _inputs[0]; }
   const Tensor *input2() const { return _inputs[1]; }
@@ -43,6 +46,9 @@ public:
 private:
   void evalFloat() const;
   void evalQuantizedS16() const;
+
+private:
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace kernels
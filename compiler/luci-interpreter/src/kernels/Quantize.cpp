@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/Quantize.h"
+#include "kernels/Utils.h"
+
+#include <tensorflow/lite/kernels/internal/common.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+
+namespace kernels
+{
+
+Quantize::Quantize(const Tensor *input, Tensor *output) : Kernel({input}, {output}) {}
+
+void Quantize::configure()
+{
+  const auto input_type = input()->element_type();
+  const auto output_type = output()->element_type();
+
+  LUCI_INTERPRETER_CHECK(input_type == DataType::FLOAT32 || input_type == DataType::U8 ||
+                         input_type == DataType::S16);
+  LUCI_INTERPRETER_CHECK(output_type == DataType::U8 || output_type == DataType::S16);
+  if (output_type == DataType::S16)
+    LUCI_INTERPRETER_CHECK(output()->zero_point() == 0);
+
+  if (input_type != DataType::FLOAT32)
+  {
+    double multiplier = input()->scale() / output()->scale();
+    quantizeMultiplier(multiplier, &_output_multiplier, &_output_shift);
+  }
+  output()->resize(input()->shape());
+}
+
+void Quantize::execute() const
+{
+  switch (input()->element_type())
+  {
+    case DataType::FLOAT32:
+      if (output()->element_type() == DataType::U8)
+        evalFloat<uint8_t>();
+      else
+        evalFloat<int16_t>();
+      break;
+    case DataType::U8:
+      if (output()->element_type() == DataType::U8)
+        evalQuantized<uint8_t, uint8_t>();
+      else
+        evalQuantized<uint8_t, int16_t>();
+      break;
+    case DataType::S16:
+      if (output()->element_type() == DataType::U8)
+        evalQuantized<int16_t, uint8_t>();
+      else
+        evalQuantized<int16_t, int16_t>();
+      break;
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+}
+
+template <typename T> void Quantize::evalFloat() const
+{
+  const auto *input_data = getTensorData<float>(input());
+  auto *output_data = getTensorData<T>(output());
+
+  const float scale = output()->scale();
+  const int32_t zero_point = output()->zero_point();
+  const int32_t output_min = std::numeric_limits<T>::min();
+  const int32_t output_max = std::numeric_limits<T>::max();
+
+  const int32_t num_elements = input()->shape().num_elements();
+
+  for (int32_t i = 0; i < num_elements; ++i)
+  {
+    int32_t output_val = static_cast<int32_t>(std::round(input_data[i] / scale)) + zero_point;
+    output_val = std::max(output_val, output_min);
+    output_val = std::min(output_val, output_max);
+    output_data[i] = static_cast<T>(output_val);
+  }
+}
+
+template <typename InputT, typename OutputT> void Quantize::evalQuantized() const
+{
+  const auto *input_data = getTensorData<InputT>(input());
+  auto *output_data = getTensorData<OutputT>(output());
+
+  const int32_t input_zero_point = input()->zero_point();
+  const int32_t output_zero_point = output()->zero_point();
+  const int32_t output_min = std::numeric_limits<OutputT>::min();
+  const int32_t output_max = std::numeric_limits<OutputT>::max();
+
+  const int32_t num_elements = input()->shape().num_elements();
+
+  for (int32_t i = 0; i < num_elements; ++i)
+  {
+    const int32_t input_val = static_cast<int32_t>(input_data[i]) - input_zero_point;
+    int32_t output_val =
+      tflite::MultiplyByQuantizedMultiplier(input_val, _output_multiplier, _output_shift) +
+      output_zero_point;
+    output_val = std::max(output_val, output_min);
+    output_val = std::min(output_val, output_max);
+    output_data[i] = static_cast<OutputT>(output_val);
+  }
+}
+
+} // namespace kernels
+} // namespace luci_interpreter
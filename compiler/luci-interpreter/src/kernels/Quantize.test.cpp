@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/Quantize.h"
+#include "kernels/TestUtils.h"
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+namespace
+{
+
+using namespace testing;
+
+TEST(QuantizeTest, Float_Uint8)
+{
+  std::vector<float> input_data{-1.0f, 0.0f, 1.0f, 2.5f};
+
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>({1, 4}, input_data);
+  Tensor output_tensor = makeOutputTensor(DataType::U8, 0.5, 127);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 4}));
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray({125, 127, 129, 132}));
+}
+
+TEST(QuantizeTest, Uint8_SInt16)
+{
+  std::vector<float> input_data{-1.0f, 0.0f, 1.0f, 2.5f};
+
+  Tensor input_tensor = makeInputTensor<DataType::U8>({1, 4}, 0.5, 127, input_data);
+  Tensor output_tensor = makeOutputTensor(DataType::S16, 0.25, 0);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<int16_t>(output_tensor),
+              ::testing::ElementsAreArray({-4, 0, 4, 10}));
+  EXPECT_THAT(dequantizeTensorData(output_tensor), FloatArrayNear(input_data));
+}
+
+TEST(QuantizeTest, SInt16_Uint8)
+{
+  std::vector<float> input_data{-1.0f, 0.0f, 1.0f, 2.5f};
+
+  Tensor input_tensor = makeInputTensor<DataType::S16>({1, 4}, 0.25, 0, input_data);
+  Tensor output_tensor = makeOutputTensor(DataType::U8, 0.5, 127);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray({125, 127, 129, 132}));
+}
+
+TEST(QuantizeTest, Float_Float_NEG)
+{
+  std::vector<float> input_data{-1.0f, 0.0f, 1.0f, 2.5f};
+
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>({1, 4}, input_data);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
+} // namespace
+} // namespace kernels
+} // namespace luci_interpreter
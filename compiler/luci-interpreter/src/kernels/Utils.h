@@ -23,6 +23,9 @@
 
 #include <tensorflow/lite/kernels/internal/types.h>
 
+#include <pepper/threadpool.h>
+
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <stdexcept>
@@ -76,6 +79,42 @@ inline int32_t calcOffset(const Shape &shape, int32_t d0, int32_t d1, int32_t d2
   return ((d0 * shape.dim(1) + d1) * shape.dim(2) + d2) * shape.dim(3) + d3;
 }
 
+// Minimal number of elements given to a thread by elementwise kernels.
+constexpr int64_t kElementwiseGrain = 16384;
+
+// Computes the input rows [*in_begin, *in_end) read by the output rows [out_begin, out_end) of a
+// convolution along with the padding to use when the input is cut down to these rows.
+inline void computeInputRows(int32_t out_begin, int32_t out_end, int32_t stride,
+                             int32_t dilation_rate, int32_t filter_size, int32_t padding,
+                             int32_t in_size, int32_t *in_begin, int32_t *in_end,
+                             int32_t *row_padding)
+{
+  const int32_t first_row = out_begin * stride - padding;
+  const int32_t last_row = (out_end - 1) * stride - padding + (filter_size - 1) * dilation_rate;
+  *in_begin = std::max(first_row, 0);
+  *in_end = std::max(std::min(last_row + 1, in_size), *in_begin);
+  *row_padding = *in_begin - first_row;
+}
+
+// Calls fn(batch, row_begin, row_end) for horizontal stripes covering all 'batches' x 'height'
+// rows of an NHWC tensor. Stripes are distributed between the threads of 'thread_pool'.
+template <typename Fn>
+void parallelForRows(pepper::ThreadPool *thread_pool, int32_t batches, int32_t height, Fn fn)
+{
+  pepper::parallel_for(thread_pool, static_cast<int64_t>(batches) * height, 1,
+                       [&](int64_t begin, int64_t end) {
+                         while (begin < end)
+                         {
+                           const auto batch = static_cast<int32_t>(begin / height);
+                           const auto row_begin = static_cast<int32_t>(begin % height);
+                           const auto row_end = static_cast<int32_t>(
+                             std::min<int64_t>(height, row_begin + (end - begin)));
+                           fn(batch, row_begin, row_end);
+                           begin += row_end - row_begin;
+                         }
+                       });
+}
+
 void calculateActivationRange(Activation activation, float *activation_min, float *activation_max);
 
 void calculateActivationRangeQuantized(Activation activation, const Tensor *output,
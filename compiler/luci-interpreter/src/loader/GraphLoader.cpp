@@ -109,9 +109,10 @@ bool isTensorProducingNode(const luci::CircleNode *node)
 GraphLoader::GraphLoader(
   const loco::Graph *graph, RuntimeGraph *runtime_graph, RuntimeToIR &runtime_to_ir,
   const std::unordered_map<const loco::Graph *, RuntimeGraph *> &graph_to_runtime_graph,
-  std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor)
+  std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor, pepper::ThreadPool *thread_pool)
   : _graph(graph), _runtime_graph(runtime_graph), _runtime_to_ir(runtime_to_ir),
-    _graph_to_runtime_graph(graph_to_runtime_graph), _node_to_tensor(node_to_tensor)
+    _graph_to_runtime_graph(graph_to_runtime_graph), _node_to_tensor(node_to_tensor),
+    _thread_pool(thread_pool)
 {
 }
 
@@ -152,8 +153,9 @@ void GraphLoader::loadTensors()
     {
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
+      // Constants are never written by kernels, so refer to the constant storage of the module
       if (const_data != nullptr)
-        tensor->writeData(const_data, data_size);
+        tensor->setReadOnlyData(const_data, data_size);
     }
 
     _node_to_tensor.emplace(node, tensor.get());
@@ -185,7 +187,7 @@ void GraphLoader::initInputOutputTensors() const
 
 void GraphLoader::loadOperators()
 {
-  KernelBuilder kernel_builder(_graph_to_runtime_graph, _node_to_tensor);
+  KernelBuilder kernel_builder(_graph_to_runtime_graph, _node_to_tensor, _thread_pool);
 
   // Create kernels for executable nodes. This has to be done in execution order.
   for (const loco::Node *loco_node :
@@ -24,6 +24,11 @@
 
 #include <unordered_map>
 
+namespace pepper
+{
+class ThreadPool;
+} // namespace pepper
+
 namespace luci_interpreter
 {
 
@@ -32,7 +37,8 @@ class GraphLoader
 public:
   GraphLoader(const loco::Graph *graph, RuntimeGraph *runtime_graph, RuntimeToIR &runtime_to_ir,
               const std::unordered_map<const loco::Graph *, RuntimeGraph *> &graph_to_runtime_graph,
-              std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor);
+              std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor,
+              pepper::ThreadPool *thread_pool = nullptr);
 
   void loadTensors();
   void initInputOutputTensors() const;
@@ -45,6 +51,7 @@ private:
 
   const std::unordered_map<const loco::Graph *, RuntimeGraph *> &_graph_to_runtime_graph;
   std::unordered_map<const loco::Node *, Tensor *> &_node_to_tensor;
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace luci_interpreter
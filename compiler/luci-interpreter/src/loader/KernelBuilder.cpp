@@ -59,6 +59,7 @@
 #include "kernels/PadV2.h"
 #include "kernels/Pow.h"
 #include "kernels/Prelu.h"
+#include "kernels/Quantize.h"
 #include "kernels/Relu.h"
 #include "kernels/Relu6.h"
 #include "kernels/Reshape.h"
@@ -157,7 +158,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleAdd *node)
   AddParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Add>(input1, input2, output, params);
+  return std::make_unique<kernels::Add>(input1, input2, output, params, _thread_pool);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleArgMax *node)
@@ -241,7 +242,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleConv2D *node)
   params.dilation_width_factor = node->dilation()->w();
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Conv2D>(input, filter, bias, output, params);
+  return std::make_unique<kernels::Conv2D>(input, filter, bias, output, params, _thread_pool);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleDepthToSpace *node)
@@ -275,7 +276,8 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleDepthwiseConv2D *
   params.dilation_width_factor = node->dilation()->w();
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::DepthwiseConv2D>(input, filter, bias, output, params);
+  return std::make_unique<kernels::DepthwiseConv2D>(input, filter, bias, output, params,
+                                                   _thread_pool);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleDiv *node)
@@ -355,7 +357,8 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleFullyConnected *n
   FullyConnectedParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::FullyConnected>(input, weights, bias, output, params);
+  return std::make_unique<kernels::FullyConnected>(input, weights, bias, output, params,
+                                                  _thread_pool);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleGreater *node)
@@ -620,7 +623,7 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleMul *node)
   MulParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Mul>(input1, input2, output, params);
+  return std::make_unique<kernels::Mul>(input1, input2, output, params, _thread_pool);
 }
 
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleNeg *node)
@@ -727,6 +730,16 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CirclePRelu *node)
   return std::make_unique<kernels::Prelu>(input, alpha, output);
 }
 
+std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleQuantize *node)
+{
+  assert(node->arity() == 1);
+
+  const Tensor *input = getInputTensor(node->input());
+  Tensor *output = getOutputTensor(node);
+
+  return std::make_unique<kernels::Quantize>(input, output);
+}
+
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleRelu *node)
 {
   assert(node->arity() == 1);
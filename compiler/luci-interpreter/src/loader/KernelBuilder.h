@@ -26,6 +26,11 @@
 #include <vector>
 #include <unordered_map>
 
+namespace pepper
+{
+class ThreadPool;
+} // namespace pepper
+
 namespace luci_interpreter
 {
 
@@ -34,8 +39,10 @@ class KernelBuilder : public luci::CircleNodeVisitor<std::unique_ptr<Kernel>>
 public:
   KernelBuilder(
     const std::unordered_map<const loco::Graph *, RuntimeGraph *> &graph_to_runtime_graph,
-    const std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor)
-    : _graph_to_runtime_graph(graph_to_runtime_graph), _node_to_tensor(node_to_tensor)
+    const std::unordered_map<const loco::Node *, Tensor *> &node_to_tensor,
+    pepper::ThreadPool *thread_pool = nullptr)
+    : _graph_to_runtime_graph(graph_to_runtime_graph), _node_to_tensor(node_to_tensor),
+      _thread_pool(thread_pool)
   {
   }
 
@@ -83,6 +90,7 @@ public:
   std::unique_ptr<Kernel> visit(const luci::CircleNotEqual *node) override;
   std::unique_ptr<Kernel> visit(const luci::CircleOutput *node) override;
   std::unique_ptr<Kernel> visit(const luci::CirclePRelu *node) override;
+  std::unique_ptr<Kernel> visit(const luci::CircleQuantize *node) override;
   std::unique_ptr<Kernel> visit(const luci::CirclePack *node) override;
   std::unique_ptr<Kernel> visit(const luci::CirclePad *node) override;
   std::unique_ptr<Kernel> visit(const luci::CirclePadV2 *node) override;
@@ -123,6 +131,7 @@ private:
 private:
   const std::unordered_map<const loco::Graph *, RuntimeGraph *> &_graph_to_runtime_graph;
   const std::unordered_map<const loco::Node *, Tensor *> &_node_to_tensor;
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace luci_interpreter
@@ -56,6 +56,7 @@
 #include <kernels/PadV2.h>
 #include <kernels/Pow.h>
 #include <kernels/Prelu.h>
+#include <kernels/Quantize.h>
 #include <kernels/Relu.h>
 #include <kernels/Relu6.h>
 #include <kernels/Reshape.h>
@@ -882,6 +883,20 @@ TEST_F(KernelBuilderTest, Prelu)
   checkTensor(kernel->output(), op);
 }
 
+TEST_F(KernelBuilderTest, Quantize)
+{
+  auto *input = createInputNode();
+
+  auto *op = createNode<luci::CircleQuantize>();
+  op->input(input);
+
+  auto kernel = buildKernel<kernels::Quantize>(op);
+  ASSERT_THAT(kernel, NotNull());
+
+  checkTensor(kernel->input(), input);
+  checkTensor(kernel->output(), op);
+}
+
 TEST_F(KernelBuilderTest, Relu)
 {
   auto *input = createInputNode();
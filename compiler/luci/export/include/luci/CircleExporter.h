@@ -45,10 +45,19 @@ public:
     // TODO make this pure virtual
     virtual luci::Module *module(void) const;
 
+    // Constant buffers larger than this many bytes are stored out of line, after the model
+    // in the same output, so that the model is not limited by the 2GB size of a flatbuffer.
+    // 0 keeps every buffer in the model.
+    virtual size_t out_of_line_threshold(void) const { return 0; }
+
   public: // Exporter -> Client
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Exporter calls append after store for each piece of data stored out of line
+    // Notice: Please DO NOT STORE ptr and size when implementing this in Client
+    virtual bool append(const char *ptr, const size_t size) const;
   };
 
 public:
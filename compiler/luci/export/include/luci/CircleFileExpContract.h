@@ -37,11 +37,18 @@ public:
   {
     // NOTHING TO DO
   }
+  CircleFileExpContract(luci::Module *module, const std::string &filename,
+                        size_t out_of_line_threshold)
+    : _module(module), _filepath(filename), _out_of_line_threshold(out_of_line_threshold)
+  {
+    // NOTHING TO DO
+  }
   virtual ~CircleFileExpContract() = default;
 
 public:
   loco::Graph *graph(void) const final { return nullptr; }
   luci::Module *module(void) const final { return _module; }
+  size_t out_of_line_threshold(void) const final { return _out_of_line_threshold; }
 
 public:
   bool store(const char *ptr, const size_t size) const final
@@ -55,9 +62,18 @@ public:
     return fs.good();
   }
 
+  bool append(const char *ptr, const size_t size) const final
+  {
+    std::ofstream fs(_filepath, std::ofstream::binary | std::ofstream::app);
+    fs.write(ptr, size);
+
+    return fs.good();
+  }
+
 private:
   luci::Module *_module;
   const std::string _filepath;
+  const size_t _out_of_line_threshold = 0;
 };
 
 } // namespace luci
@@ -29,6 +29,8 @@ namespace luci
 // TODO remove this
 Module *CircleExporter::Contract::module(void) const { return nullptr; }
 
+bool CircleExporter::Contract::append(const char *, const size_t) const { return false; }
+
 CircleExporter::CircleExporter()
 {
   // NOTHING TO DO
@@ -39,26 +41,30 @@ bool CircleExporter::invoke(Contract *contract) const
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
+    CircleExporterImpl impl(module, contract->out_of_line_threshold());
 
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
 
-    // we just send one time
-    return contract->store(ptr, size);
+    // we send the serialized graph at once, followed by buffers stored out of line if any
+    if (!contract->store(ptr, size))
+      return false;
+    return impl.appendOutOfLineBuffers(contract);
   }
 
   auto graph = contract->graph();
   if (graph == nullptr)
     return false;
 
-  CircleExporterImpl impl(graph);
+  CircleExporterImpl impl(graph, contract->out_of_line_threshold());
 
   const char *ptr = impl.getBufferPointer();
   const size_t size = impl.getBufferSize();
 
-  // we just send one time
-  return contract->store(ptr, size);
+  // we send the serialized graph at once, followed by buffers stored out of line if any
+  if (!contract->store(ptr, size))
+    return false;
+  return impl.appendOutOfLineBuffers(contract);
 }
 
 } // namespace luci
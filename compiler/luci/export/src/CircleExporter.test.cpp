@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleExporter.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/Module.h>
+
+#include <mio/circle/schema_generated.h>
+#include <flatbuffers/flatbuffers.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// Keep the exported model in memory
+class MemoryExpContract : public luci::CircleExporter::Contract
+{
+public:
+  MemoryExpContract(luci::Module *module, size_t out_of_line_threshold)
+    : _module(module), _out_of_line_threshold(out_of_line_threshold)
+  {
+    // NOTHING TO DO
+  }
+
+public:
+  loco::Graph *graph(void) const final { return nullptr; }
+  luci::Module *module(void) const final { return _module; }
+  size_t out_of_line_threshold(void) const final { return _out_of_line_threshold; }
+
+public:
+  bool store(const char *ptr, const size_t size) const final
+  {
+    _data.assign(ptr, ptr + size);
+    _model_size = size;
+    return true;
+  }
+
+  bool append(const char *ptr, const size_t size) const override
+  {
+    _data.insert(_data.end(), ptr, ptr + size);
+    return true;
+  }
+
+public:
+  const std::vector<char> &data(void) const { return _data; }
+  size_t model_size(void) const { return _model_size; }
+
+private:
+  luci::Module *_module;
+  const size_t _out_of_line_threshold;
+  mutable std::vector<char> _data;
+  mutable size_t _model_size = 0;
+};
+
+// Same as MemoryExpContract, with the default append which does not support out of line data
+class StoreOnlyExpContract final : public MemoryExpContract
+{
+public:
+  using MemoryExpContract::MemoryExpContract;
+
+public:
+  bool append(const char *ptr, const size_t size) const final
+  {
+    return luci::CircleExporter::Contract::append(ptr, size);
+  }
+};
+
+void set_shape(luci::CircleNode *node, uint32_t size)
+{
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(1);
+  node->dim(0).set(size);
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+/**
+ *  input_a  [big]      input_b  [odd]
+ *       \    /              \    /
+ *      add_a             add_b  [small]
+ *        |                   \    /
+ *     output_a               add_c
+ *                              |
+ *                           output_b
+ */
+class OutOfLineTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _module = luci::make_module();
+    auto g = loco::make_graph();
+
+    auto add_a = add(g.get(), input(g.get(), 64), constant(g.get(), "big", 64));
+    auto add_b = add(g.get(), input(g.get(), 3), constant(g.get(), "odd", 3));
+    auto add_c = add(g.get(), add_b, constant(g.get(), "small", 1));
+    output(g.get(), add_a);
+    output(g.get(), add_c);
+
+    _module->add(std::move(g));
+  }
+
+  luci::CircleInput *input(loco::Graph *g, uint32_t size)
+  {
+    auto graph_input = g->inputs()->create();
+    auto node = g->nodes()->create<luci::CircleInput>();
+    node->index(graph_input->index());
+    node->name("input_" + std::to_string(graph_input->index()));
+    set_shape(node, size);
+    return node;
+  }
+
+  void output(loco::Graph *g, luci::CircleNode *from)
+  {
+    auto graph_output = g->outputs()->create();
+    auto node = g->nodes()->create<luci::CircleOutput>();
+    node->index(graph_output->index());
+    node->name("output_" + std::to_string(graph_output->index()));
+    node->from(from);
+    set_shape(node, from->dim(0).value());
+  }
+
+  luci::CircleConst *constant(loco::Graph *g, const std::string &name, uint32_t size)
+  {
+    auto node = g->nodes()->create<luci::CircleConst>();
+    node->name(name);
+    set_shape(node, size);
+    node->size<loco::DataType::FLOAT32>(size);
+    for (uint32_t i = 0; i < size; ++i)
+      node->at<loco::DataType::FLOAT32>(i) = name.size() * 100.0f + i;
+    return node;
+  }
+
+  luci::CircleAdd *add(loco::Graph *g, luci::CircleNode *x, luci::CircleNode *y)
+  {
+    auto node = g->nodes()->create<luci::CircleAdd>();
+    node->x(x);
+    node->y(y);
+    node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    node->name("add_" + x->name() + "_" + y->name());
+    set_shape(node, x->dim(0).value());
+    return node;
+  }
+
+  // Return the buffer of the tensor 'name' in the exported model
+  const circle::Buffer *buffer(const circle::Model *model, const std::string &name)
+  {
+    auto subgraph = model->subgraphs()->Get(0);
+    for (const auto tensor : *subgraph->tensors())
+    {
+      if (tensor->name()->str() == name)
+        return model->buffers()->Get(tensor->buffer());
+    }
+    return nullptr;
+  }
+
+protected:
+  std::unique_ptr<luci::Module> _module;
+};
+
+} // namespace
+
+TEST_F(OutOfLineTest, round_trip)
+{
+  luci::CircleExporter exporter;
+
+  // Every buffer in the model, as before
+  MemoryExpContract in_line(_module.get(), 0);
+  ASSERT_TRUE(exporter.invoke(&in_line));
+  ASSERT_EQ(in_line.model_size(), in_line.data().size());
+
+  // Buffers larger than 8 bytes after the model
+  MemoryExpContract out_of_line(_module.get(), 8);
+  ASSERT_TRUE(exporter.invoke(&out_of_line));
+
+  const auto &data = out_of_line.data();
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(data.data()),
+                                 out_of_line.model_size());
+  ASSERT_TRUE(circle::VerifyModelBuffer(verifier));
+
+  auto in_line_model = circle::GetModel(in_line.data().data());
+  auto model = circle::GetModel(data.data());
+
+  // 'small' has 4 bytes, so it stays in the model
+  {
+    auto small = buffer(model, "small");
+    ASSERT_NE(nullptr, small);
+    ASSERT_NE(nullptr, small->data());
+    EXPECT_EQ(4, small->data()->size());
+    EXPECT_EQ(0, small->offset());
+  }
+
+  // 'big' and 'odd' follow the model, each aligned to 16 bytes
+  std::vector<std::pair<std::string, const circle::Buffer *>> placed_buffers;
+  for (const std::string name : {"big", "odd"})
+  {
+    auto placed = buffer(model, name);
+    ASSERT_NE(nullptr, placed);
+    EXPECT_EQ(nullptr, placed->data());
+    placed_buffers.emplace_back(name, placed);
+  }
+  std::sort(placed_buffers.begin(), placed_buffers.end(),
+            [](const auto &lhs, const auto &rhs) {
+              return lhs.second->offset() < rhs.second->offset();
+            });
+
+  uint64_t end = out_of_line.model_size();
+  for (const auto &name_buffer : placed_buffers)
+  {
+    SCOPED_TRACE(name_buffer.first);
+    auto placed = name_buffer.second;
+
+    EXPECT_EQ(0, placed->offset() % 16);
+    EXPECT_GE(placed->offset(), end);
+    EXPECT_LT(placed->offset() - end, 16);
+    ASSERT_LE(placed->offset() + placed->size(), data.size());
+
+    // Padding is zero
+    for (uint64_t i = end; i < placed->offset(); ++i)
+      EXPECT_EQ(0, data[i]);
+
+    // Data is the same as the one stored in the model
+    auto expected = buffer(in_line_model, name_buffer.first)->data();
+    ASSERT_NE(nullptr, expected);
+    ASSERT_EQ(expected->size(), placed->size());
+    EXPECT_EQ(0, std::memcmp(expected->data(), data.data() + placed->offset(), placed->size()));
+
+    end = placed->offset() + placed->size();
+  }
+  // Nothing follows the last buffer
+  EXPECT_EQ(end, data.size());
+}
+
+TEST_F(OutOfLineTest, threshold_larger_than_buffers)
+{
+  luci::CircleExporter exporter;
+
+  MemoryExpContract contract(_module.get(), 1024);
+  ASSERT_TRUE(exporter.invoke(&contract));
+  ASSERT_EQ(contract.model_size(), contract.data().size());
+
+  auto model = circle::GetModel(contract.data().data());
+  for (const std::string name : {"big", "odd", "small"})
+  {
+    auto placed = buffer(model, name);
+    ASSERT_NE(nullptr, placed);
+    EXPECT_NE(nullptr, placed->data());
+    EXPECT_EQ(0, placed->offset());
+  }
+}
+
+TEST_F(OutOfLineTest, append_not_supported_NEG)
+{
+  luci::CircleExporter exporter;
+
+  StoreOnlyExpContract contract(_module.get(), 8);
+  EXPECT_FALSE(exporter.invoke(&contract));
+}
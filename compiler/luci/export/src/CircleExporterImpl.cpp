@@ -95,14 +95,30 @@ encodeOperatorCodes(FlatBufferBuilder &builder, std::unordered_map<luci::OpCode,
 
 } // namespace
 
+namespace
+{
+
+constexpr uint64_t OUT_OF_LINE_ALIGNMENT = 16;
+
+} // namespace
+
 namespace luci
 {
 
 using namespace circle;
 using namespace flatbuffers;
 
-CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
-CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(loco::Graph *graph, size_t out_of_line_threshold)
+  : _out_of_line_threshold(out_of_line_threshold)
+{
+  exportGraph(graph);
+}
+
+CircleExporterImpl::CircleExporterImpl(Module *module, size_t out_of_line_threshold)
+  : _out_of_line_threshold(out_of_line_threshold)
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -127,6 +143,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   SerializedModelData md;
   SerializedGraphData gd;
 
+  md._out_of_line_threshold = _out_of_line_threshold;
+
   // This version is taken from comment in fbs
   constexpr uint32_t version = 0;
 
@@ -170,6 +188,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, 0 /* metadata_buffer */, metadata);
   FinishModelBuffer(_builder, model_offset);
+
+  placeOutOfLineBuffers(md);
 }
 
 void CircleExporterImpl::exportModule(Module *module)
@@ -179,6 +199,8 @@ void CircleExporterImpl::exportModule(Module *module)
 
   SerializedModelData md;
 
+  md._out_of_line_threshold = _out_of_line_threshold;
+
   _builder.Clear();
 
   // prepare model data
@@ -237,6 +259,8 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, 0 /* metadata_buffer */, metadata);
   FinishModelBuffer(_builder, model_offset);
+
+  placeOutOfLineBuffers(md);
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
@@ -246,4 +270,47 @@ const char *CircleExporterImpl::getBufferPointer() const
 
 size_t CircleExporterImpl::getBufferSize() const { return _builder.GetSize(); }
 
+void CircleExporterImpl::placeOutOfLineBuffers(SerializedModelData &md)
+{
+  _out_of_line_buffers = std::move(md._out_of_line_buffers);
+  if (_out_of_line_buffers.empty())
+    return;
+
+  auto model = circle::GetModel(_builder.GetBufferPointer());
+  uint64_t offset = _builder.GetSize();
+  for (auto &buffer : _out_of_line_buffers)
+  {
+    // Align data as 'force_align' of Buffer.data does
+    offset = (offset + OUT_OF_LINE_ALIGNMENT - 1) / OUT_OF_LINE_ALIGNMENT * OUT_OF_LINE_ALIGNMENT;
+    buffer.offset = offset;
+    offset += buffer.size;
+
+    // NOTE circle::Buffer is a flatbuffers::Table, whose scalar fields present in the
+    //      finished buffer can be overwritten in place
+    auto circle_buffer = model->buffers()->Get(buffer.buffer_id);
+    auto table = reinterpret_cast<const flatbuffers::Table *>(circle_buffer);
+    bool placed = const_cast<flatbuffers::Table *>(table)->SetField<uint64_t>(
+      circle::Buffer::VT_OFFSET, buffer.offset, 0);
+    if (!placed)
+      INTERNAL_EXN("Failed to place a buffer out of line");
+  }
+}
+
+bool CircleExporterImpl::appendOutOfLineBuffers(const CircleExporter::Contract *contract) const
+{
+  static const char padding[OUT_OF_LINE_ALIGNMENT] = {0};
+
+  uint64_t written = getBufferSize();
+  for (const auto &buffer : _out_of_line_buffers)
+  {
+    assert(buffer.offset >= written && buffer.offset - written < OUT_OF_LINE_ALIGNMENT);
+    if (buffer.offset > written && !contract->append(padding, buffer.offset - written))
+      return false;
+    if (!contract->append(reinterpret_cast<const char *>(buffer.data), buffer.size))
+      return false;
+    written = buffer.offset + buffer.size;
+  }
+  return true;
+}
+
 } // namespace luci
@@ -38,8 +38,8 @@ public:
   CircleExporterImpl() = delete;
   ~CircleExporterImpl() = default;
 
-  explicit CircleExporterImpl(loco::Graph *graph);
-  explicit CircleExporterImpl(Module *module);
+  explicit CircleExporterImpl(loco::Graph *graph, size_t out_of_line_threshold = 0);
+  explicit CircleExporterImpl(Module *module, size_t out_of_line_threshold = 0);
 
   /**
    * @return pointer to buffer with serialized graph
@@ -51,6 +51,12 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @brief append buffers stored out of line, which follow the serialized graph
+   * @return false if the contract failed to append them
+   */
+  bool appendOutOfLineBuffers(const CircleExporter::Contract *contract) const;
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -71,8 +77,15 @@ private:
    */
   void exportModule(Module *module);
 
+  /**
+   * @brief fix positions of buffers stored out of line in the finished flatbuffer
+   */
+  void placeOutOfLineBuffers(SerializedModelData &md);
+
 private:
   flatbuffers::FlatBufferBuilder _builder;
+  const size_t _out_of_line_threshold;
+  std::vector<OutOfLineBuffer> _out_of_line_buffers;
 };
 
 } // namespace luci
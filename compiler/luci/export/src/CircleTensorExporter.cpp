@@ -337,26 +337,55 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, N
 }
 
 template <loco::DataType DT>
-flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+const uint8_t *rawDataByDType(const luci::CircleConst *c, size_t *raw_size)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
   const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
+  *raw_size = size * sizeof(NativeType);
+  return size > 0 ? reinterpret_cast<const uint8_t *>(&c->at<DT>(0)) : nullptr;
+}
+
+// Return the storage of a constant, or nullptr if its type is not stored as it is
+const uint8_t *rawData(const luci::CircleConst *c, size_t *raw_size)
+{
+  switch (c->dtype())
   {
-    raw_data.push_back(c->at<DT>(i));
+    case loco::DataType::FLOAT32:
+      return rawDataByDType<loco::DataType::FLOAT32>(c, raw_size);
+    case loco::DataType::S8:
+      return rawDataByDType<loco::DataType::S8>(c, raw_size);
+    case loco::DataType::S16:
+      return rawDataByDType<loco::DataType::S16>(c, raw_size);
+    case loco::DataType::S32:
+      return rawDataByDType<loco::DataType::S32>(c, raw_size);
+    case loco::DataType::S64:
+      return rawDataByDType<loco::DataType::S64>(c, raw_size);
+    case loco::DataType::U8:
+      return rawDataByDType<loco::DataType::U8>(c, raw_size);
+    case loco::DataType::BOOL:
+      return rawDataByDType<loco::DataType::BOOL>(c, raw_size);
+    default:
+      *raw_size = 0;
+      return nullptr;
   }
-  const size_t raw_size = size * sizeof(NativeType);
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+}
+
+template <loco::DataType DT>
+flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
+                                                          const luci::CircleConst *c)
+{
+  // Elements are stored contiguously, so they are copied into the builder directly
+  size_t raw_size = 0;
+  const uint8_t *raw_data = rawDataByDType<DT>(c, &raw_size);
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
 template <>
 flatbuffers::Offset<circle::Buffer>
-encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder, luci::CircleConst *c)
+encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder,
+                                              const luci::CircleConst *c)
 {
   const uint32_t count = c->size<loco::DataType::STRING>();
   uint32_t raw_size = sizeof(int32_t) * (count + 2);
@@ -484,7 +513,9 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+// Constants are read through const pointers so that external data are not copied
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
@@ -496,7 +527,7 @@ template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci
   return true;
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -549,11 +580,20 @@ uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci
         return key_value.second;
     }
 
-    // When buffer with same values is not found, generate new buffer
-    auto buffer = encodeOpBuffer(builder, node);
-
     auto buffer_id = static_cast<uint32_t>(md._buffers.size());
-    md._buffers.push_back(buffer);
+
+    // When buffer with same values is not found, generate new buffer
+    size_t raw_size = 0;
+    const uint8_t *raw_data = rawData(node, &raw_size);
+    if (md._out_of_line_threshold > 0 && raw_size > md._out_of_line_threshold)
+    {
+      // NOTE offset is a placeholder which is fixed after the flatbuffer is finished.
+      //      It should not be the default value 0, to be present in the flatbuffer.
+      md._buffers.push_back(CreateBuffer(builder, 0, 1 /* offset */, raw_size));
+      md._out_of_line_buffers.push_back(OutOfLineBuffer{buffer_id, raw_data, raw_size, 0});
+    }
+    else
+      md._buffers.push_back(encodeOpBuffer(builder, node));
 
     // Cache the newly generated buffer id
     md._cached_buffer_id.insert({node, buffer_id});
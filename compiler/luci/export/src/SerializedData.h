@@ -109,6 +109,17 @@ struct SubGraphContext
   circle::DataFormat _data_format{circle::DataFormat::DataFormat_CHANNELS_LAST};
 };
 
+// Constant data which is stored after the model flatbuffer
+struct OutOfLineBuffer
+{
+  uint32_t buffer_id;
+  // Storage of the constant node, which is written without a copy
+  const uint8_t *data;
+  uint64_t size;
+  // Position from the start of the file, fixed after the flatbuffer is finished
+  uint64_t offset;
+};
+
 // Prerequisites for circle::Model object creation
 struct SerializedModelData final
 {
@@ -122,6 +133,10 @@ struct SerializedModelData final
   // This is used for removing buffers with same values
   std::map<luci::CircleConst *, uint32_t> _cached_buffer_id;
 
+  // Buffers larger than this are stored out of line. 0 disables it.
+  size_t _out_of_line_threshold = 0;
+  std::vector<OutOfLineBuffer> _out_of_line_buffers;
+
   /**
    * @brief if opcode is not registered in table of opcodes add it
    * @param builtin_code
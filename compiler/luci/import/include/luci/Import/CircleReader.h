@@ -89,8 +89,23 @@ public:
   circle::BuiltinOperator builtin_code(const circle::OperatorT &op) const;
   std::string opcode_name(const circle::OperatorT &op) const;
 
+  /**
+   * @brief Return data of the buffer at @p index in the model memory, or nullptr if none
+   * @note  Unlike buffers(), this is available even if buffer data were not unpacked
+   */
+  const flatbuffers::Vector<uint8_t> *buffer_data(uint32_t index) const;
+  /**
+   * @brief Return the owner of the model memory if constants may refer to it, or nullptr
+   */
+  const std::shared_ptr<const void> &model_owner() const { return _model_owner; }
+
 public:
   bool parse(const circle::Model *model);
+  /**
+   * @brief Parse the model without copying data of buffers other than metadata
+   * @note  @p owner keeps the model memory alive, so that constants can refer to it
+   */
+  bool parse(const circle::Model *model, const std::shared_ptr<const void> &owner);
   bool select_subgraph(uint32_t subgraph);
 
 private:
@@ -99,6 +114,7 @@ private:
 
   const circle::Model *_model_ptr{nullptr};
   const CircleTensorsPtr_t *_tensors_ptr{nullptr};
+  std::shared_ptr<const void> _model_owner;
 };
 
 } // namespace luci
@@ -44,6 +44,12 @@ public:
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  /**
+   * @brief Import a module whose constants refer to the model memory instead of copying it
+   * @note  @p owner keeps the memory of @p model alive while any constant refers to it
+   */
+  std::unique_ptr<Module> importModule(const circle::Model *model,
+                                       const std::shared_ptr<const void> &owner) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
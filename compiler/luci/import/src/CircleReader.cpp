@@ -16,10 +16,39 @@
 
 #include "luci/Import/CircleReader.h"
 
+#include <cassert>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
+namespace
+{
+
+const flatbuffers::Vector<uint8_t> *buffer_data_of(const circle::Model *model, uint32_t index)
+{
+  auto buffers = model->buffers();
+  if (buffers == nullptr || index >= buffers->size())
+    return nullptr;
+  return buffers->Get(index)->data();
+}
+
+// NOTE Buffers stored out of line are placed relative to the start of the file, which a
+//      circle::Model pointer does not tell. Such models are for runtimes that map the file.
+void check_no_out_of_line_buffers(const circle::Model *model)
+{
+  auto buffers = model->buffers();
+  if (buffers == nullptr)
+    return;
+  for (const auto buffer : *buffers)
+  {
+    if (buffer->data() == nullptr && buffer->offset() > 1)
+      throw std::runtime_error("Buffers stored out of line are not supported");
+  }
+}
+
+} // namespace
+
 namespace luci
 {
 
@@ -322,6 +351,7 @@ std::string CircleReader::opcode_name(const circle::OperatorT &op) const
 bool CircleReader::parse(const circle::Model *model)
 {
   assert(model != nullptr);
+  check_no_out_of_line_buffers(model);
 
   _model.reset(model->UnPack());
 
@@ -331,6 +361,63 @@ bool CircleReader::parse(const circle::Model *model)
   return true;
 }
 
+bool CircleReader::parse(const circle::Model *model, const std::shared_ptr<const void> &owner)
+{
+  assert(model != nullptr);
+  assert(owner != nullptr);
+  check_no_out_of_line_buffers(model);
+
+  // Same as UnPack() except that buffers are left empty, as constants refer to the model memory
+  auto unpacked = std::make_unique<circle::ModelT>();
+  unpacked->version = model->version();
+  if (auto opcodes = model->operator_codes())
+  {
+    for (const auto opcode : *opcodes)
+      unpacked->operator_codes.emplace_back(opcode->UnPack());
+  }
+  if (auto subgraphs = model->subgraphs())
+  {
+    for (const auto subgraph : *subgraphs)
+      unpacked->subgraphs.emplace_back(subgraph->UnPack());
+  }
+  if (auto description = model->description())
+    unpacked->description = description->str();
+  if (auto metadata_buffer = model->metadata_buffer())
+    unpacked->metadata_buffer.assign(metadata_buffer->begin(), metadata_buffer->end());
+  if (auto metadata = model->metadata())
+  {
+    for (const auto meta : *metadata)
+      unpacked->metadata.emplace_back(meta->UnPack());
+  }
+  if (auto buffers = model->buffers())
+  {
+    for (uint32_t i = 0; i < buffers->size(); ++i)
+      unpacked->buffers.emplace_back(std::make_unique<circle::BufferT>());
+  }
+
+  // Metadata are still read from the unpacked buffers
+  for (const auto &meta : unpacked->metadata)
+  {
+    if (meta->buffer >= unpacked->buffers.size())
+      continue;
+    auto data = buffer_data_of(model, meta->buffer);
+    if (data != nullptr)
+      unpacked->buffers[meta->buffer]->data.assign(data->begin(), data->end());
+  }
+
+  _model = std::move(unpacked);
+  _model_ptr = model;
+  _model_owner = owner;
+
+  return true;
+}
+
+const flatbuffers::Vector<uint8_t> *CircleReader::buffer_data(uint32_t index) const
+{
+  assert(_model_ptr != nullptr);
+  return buffer_data_of(_model_ptr, index);
+}
+
 bool CircleReader::select_subgraph(uint32_t sgindex)
 {
   if (_model->subgraphs.size() <= sgindex)
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Import/CircleReader.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+// Build a model without operators, whose second buffer is in line or out of line
+void build_model(flatbuffers::FlatBufferBuilder &fbb, bool out_of_line)
+{
+  const std::vector<uint8_t> data(16, 1);
+
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers;
+  buffers.push_back(circle::CreateBuffer(fbb));
+  if (out_of_line)
+    buffers.push_back(circle::CreateBuffer(fbb, 0, 64 /* offset */, data.size()));
+  else
+    buffers.push_back(circle::CreateBuffer(fbb, fbb.CreateVector(data)));
+
+  std::vector<flatbuffers::Offset<circle::SubGraph>> subgraphs;
+  subgraphs.push_back(circle::CreateSubGraph(fbb));
+
+  auto model = circle::CreateModel(fbb, 0, 0, fbb.CreateVector(subgraphs), 0,
+                                   fbb.CreateVector(buffers));
+  circle::FinishModelBuffer(fbb, model);
+}
+
+} // namespace
+
+TEST(CircleReaderTest, parse_in_line)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+  build_model(fbb, false);
+  auto model = circle::GetModel(fbb.GetBufferPointer());
+
+  luci::CircleReader reader;
+  ASSERT_TRUE(reader.parse(model));
+  ASSERT_EQ(2, reader.buffers().size());
+  ASSERT_NE(nullptr, reader.buffer_data(1));
+  EXPECT_EQ(16, reader.buffer_data(1)->size());
+}
+
+TEST(CircleReaderTest, parse_out_of_line_NEG)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+  build_model(fbb, true);
+  auto model = circle::GetModel(fbb.GetBufferPointer());
+
+  luci::CircleReader reader;
+  EXPECT_THROW(reader.parse(model), std::runtime_error);
+}
+
+TEST(CircleReaderTest, parse_out_of_line_with_owner_NEG)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+  build_model(fbb, true);
+  auto model = circle::GetModel(fbb.GetBufferPointer());
+  std::shared_ptr<const void> owner(fbb.GetBufferPointer(), [](const void *) {});
+
+  luci::CircleReader reader;
+  EXPECT_THROW(reader.parse(model, owner), std::runtime_error);
+}
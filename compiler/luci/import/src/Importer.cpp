@@ -275,6 +275,12 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  return importModule(model, nullptr);
+}
+
+std::unique_ptr<Module> Importer::importModule(const circle::Model *model,
+                                               const std::shared_ptr<const void> &owner) const
 {
   auto module = make_module();
 
@@ -287,7 +293,7 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   }
 
   CircleReader reader;
-  if (!reader.parse(model))
+  if (!(owner != nullptr ? reader.parse(model, owner) : reader.parse(model)))
     return nullptr;
 
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
@@ -23,6 +23,8 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -46,7 +48,8 @@ std::ostream &operator<<(std::ostream &os, const std::vector<int32_t> &vect)
 using namespace luci;
 
 template <loco::DataType DT>
-void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements, CircleConst *const_node)
+void copy_data(const flatbuffers::Vector<uint8_t> &raw_data, uint32_t num_elements,
+               CircleConst *const_node, const std::shared_ptr<const void> &owner)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
@@ -57,6 +60,14 @@ void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements, Circ
   }
 
   assert(raw_data.size() == num_elements * sizeof(T));
+
+  // Refer to the model memory if it outlives the node and elements can be read in place
+  if (owner != nullptr && reinterpret_cast<uintptr_t>(raw_data.data()) % alignof(T) == 0)
+  {
+    const_node->bind_external(raw_data.data(), raw_data.size(), owner);
+    return;
+  }
+
   const auto *data = reinterpret_cast<const T *>(raw_data.data());
 
   const_node->size<DT>(num_elements);
@@ -67,8 +78,9 @@ void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements, Circ
 }
 
 template <>
-void copy_data<loco::DataType::STRING>(const std::vector<uint8_t> &raw_data, uint32_t num_elements,
-                                       CircleConst *const_node)
+void copy_data<loco::DataType::STRING>(const flatbuffers::Vector<uint8_t> &raw_data,
+                                       uint32_t num_elements, CircleConst *const_node,
+                                       const std::shared_ptr<const void> &)
 {
   assert(const_node->sparsityparam() == nullptr);
 
@@ -115,9 +127,10 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
   const auto &tensors = reader->tensors();
   const circle::TensorT &const_tensor = *tensors[tensor_index];
 
-  const std::vector<uint8_t> &buffer = reader->buffers()[const_tensor.buffer]->data;
+  const auto buffer = reader->buffer_data(const_tensor.buffer);
+  const bool buffer_empty = (buffer == nullptr || buffer->size() == 0);
   std::vector<int32_t> const_dims = const_tensor.shape; // in NHWC
-  if (const_dims.size() == 0 && buffer.empty())
+  if (const_dims.size() == 0 && buffer_empty)
   {
     // unknown shape tensor and scalar tensor
     return nullptr;
@@ -137,7 +150,7 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
     num_elements = num_elements * const_dims[r];
   }
 
-  if (buffer.empty() && num_elements > 0)
+  if (buffer_empty && num_elements > 0)
   {
     // normal empty tensor
     return nullptr;
@@ -150,38 +163,39 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
           << const_dims << std::endl;
   if (num_elements > 0)
   {
+    const auto &owner = reader->model_owner();
     switch (luci_datatype(const_tensor.type))
     {
       case loco::DataType::FLOAT32:
-        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::FLOAT32>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::U8:
-        copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::U8>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S8:
-        copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S8>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S16:
-        copy_data<loco::DataType::S16>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S16>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S32:
-        copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S32>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::S64:
-        copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S64>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::BOOL:
-        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::BOOL>(*buffer, num_elements, const_node, owner);
         break;
 
       case loco::DataType::STRING:
-        copy_data<loco::DataType::STRING>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::STRING>(*buffer, num_elements, const_node, owner);
         break;
 
       default:
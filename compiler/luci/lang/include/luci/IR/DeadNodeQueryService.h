@@ -21,12 +21,15 @@
 
 #include <loco/IR/Node.h>
 
+#include <set>
+
 namespace luci
 {
 
 struct DeadNodeQueryServiceImpl final : public logo::DeadNodeQueryService
 {
   bool isDeadNode(loco::Node *node) final;
+  bool isDeadNode(loco::Node *node, const std::set<loco::Node *> &active_nodes) final;
 };
 
 } // namespace luci
@@ -24,6 +24,8 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+
 namespace luci
 {
 
@@ -42,8 +44,26 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Refer to @p size bytes at @p data instead of keeping a copy
+   * @note  @p owner keeps @p data alive. The data is copied into this node on the first
+   *        non-const access (copy-on-write), so it is never written through this node.
+   */
+  void bind_external(const uint8_t *data, uint32_t size, const std::shared_ptr<const void> &owner);
+  bool is_external(void) const { return _external_data != nullptr; }
+
+private:
+  const uint8_t *data_ptr(void) const;
+  uint32_t data_size(void) const;
+  void materialize(void);
+
 private:
   std::vector<uint8_t> _data;
+  // Data which this node refers to instead of _data until it is modified
+  const uint8_t *_external_data = nullptr;
+  uint32_t _external_size = 0;
+  std::shared_ptr<const void> _external_owner;
   // TODO use _data for STRING and remove _strings
   std::vector<std::string> _strings; // for STRING type
 };
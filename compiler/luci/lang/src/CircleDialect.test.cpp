@@ -84,4 +84,11 @@ TEST(CircleDialectTest, check_if_dead_node_service)
   ASSERT_FALSE(service->isDeadNode(circle_input2));
   ASSERT_FALSE(service->isDeadNode(circle_output1));
   ASSERT_FALSE(service->isDeadNode(circle_output2));
+
+  // Active nodes can be given not to enumerate them again
+  auto active_nodes = loco::active_nodes(loco::output_nodes(g.get()));
+
+  ASSERT_TRUE(service->isDeadNode(dangling_node, active_nodes));
+  ASSERT_FALSE(service->isDeadNode(dangling_input, active_nodes));
+  ASSERT_FALSE(service->isDeadNode(active_node, active_nodes));
 }
@@ -19,6 +19,21 @@
 
 #include <loco/IR/Graph.h>
 
+namespace
+{
+
+// Return true if node is one of loco::input_nodes() of its graph
+bool is_graph_input(loco::Node *node)
+{
+  auto service = node->dialect()->service<loco::GraphInputIndexQueryService>();
+  if (service == nullptr || !service->associated(node))
+    return false;
+
+  return service->index(node) < node->graph()->inputs()->size();
+}
+
+} // namespace
+
 namespace luci
 {
 
@@ -39,17 +54,19 @@ struct VirtualOutputDetector final : public luci::CircleNodeMutableVisitor<bool>
 bool DeadNodeQueryServiceImpl::isDeadNode(loco::Node *node)
 {
   auto g = node->graph();
-  auto input_nodes_vec = loco::input_nodes(g);
   auto output_nodes_vec = loco::output_nodes(g);
-
-  auto input_nodes = std::set<loco::Node *>(input_nodes_vec.begin(), input_nodes_vec.end());
-  auto output_nodes = std::set<loco::Node *>(output_nodes_vec.begin(), output_nodes_vec.end());
   auto active_nodes = loco::active_nodes(output_nodes_vec);
 
+  return isDeadNode(node, active_nodes);
+}
+
+bool DeadNodeQueryServiceImpl::isDeadNode(loco::Node *node,
+                                          const std::set<loco::Node *> &active_nodes)
+{
   if (active_nodes.find(node) != active_nodes.end())
     return false;
   // input and output nodes are not dead node even if it is not active.
-  if (input_nodes.find(node) != input_nodes.end())
+  if (is_graph_input(node))
     return false;
 
   // if node is one of virtual mulitple outputs, we need to ask the real node
@@ -62,7 +79,7 @@ bool DeadNodeQueryServiceImpl::isDeadNode(loco::Node *node)
       loco::Node *real_node = node->arg(0);
       if (active_nodes.find(real_node) != active_nodes.end())
         return false;
-      if (input_nodes.find(real_node) != input_nodes.end())
+      if (is_graph_input(real_node))
         return false;
     }
   }
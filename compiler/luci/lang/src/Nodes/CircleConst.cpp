@@ -21,16 +21,50 @@
 namespace luci
 {
 
+void CircleConst::bind_external(const uint8_t *data, uint32_t size,
+                                const std::shared_ptr<const void> &owner)
+{
+  assert(data != nullptr);
+  assert(owner != nullptr);
+  assert(_strings.empty());
+  _data.clear();
+  _data.shrink_to_fit();
+  _external_data = data;
+  _external_size = size;
+  _external_owner = owner;
+}
+
+const uint8_t *CircleConst::data_ptr(void) const
+{
+  return is_external() ? _external_data : _data.data();
+}
+
+uint32_t CircleConst::data_size(void) const
+{
+  return is_external() ? _external_size : static_cast<uint32_t>(_data.size());
+}
+
+void CircleConst::materialize(void)
+{
+  if (!is_external())
+    return;
+  _data.assign(_external_data, _external_data + _external_size);
+  _external_data = nullptr;
+  _external_size = 0;
+  _external_owner.reset();
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(data_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return data_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  materialize();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +73,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data_ptr()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,12 +88,13 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data_ptr()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
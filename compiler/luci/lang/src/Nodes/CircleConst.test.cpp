@@ -64,3 +64,24 @@ TEST(CircleConstTest, string)
   ASSERT_EQ(1, const_node.size<loco::DataType::STRING>());
   EXPECT_TRUE(std::string("Hello") == const_node.at<loco::DataType::STRING>(0));
 }
+
+TEST(CircleConstTest, external_copy_on_write)
+{
+  auto owner = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  luci::CircleConst const_node;
+
+  const_node.dtype(loco::DataType::S32);
+  const_node.bind_external(reinterpret_cast<const uint8_t *>(owner->data()),
+                           owner->size() * sizeof(int32_t), owner);
+  ASSERT_TRUE(const_node.is_external());
+
+  const auto &cnode = const_node;
+  ASSERT_EQ(3, cnode.size<loco::DataType::S32>());
+  ASSERT_EQ(&owner->at(1), &cnode.at<loco::DataType::S32>(1));
+
+  const_node.at<loco::DataType::S32>(1) = 5;
+  ASSERT_FALSE(const_node.is_external());
+  ASSERT_EQ(5, cnode.at<loco::DataType::S32>(1));
+  ASSERT_EQ(2, owner->at(1));
+  ASSERT_EQ(3, cnode.at<loco::DataType::S32>(2));
+}
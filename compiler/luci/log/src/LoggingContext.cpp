@@ -19,7 +19,9 @@
 
 #include <hermes/ConsoleReporter.h>
 
+#include <cstdlib>
 #include <memory>
+#include <string>
 
 namespace luci
 {
@@ -33,6 +35,15 @@ hermes::Context *LoggingContext::get(void)
     ctx = new hermes::Context;
     ctx->sinks()->append(std::make_unique<hermes::ConsoleReporter>());
     ctx->config(std::make_unique<LoggerConfig>());
+
+    // Deliver messages on a background thread if LUCI_LOG_ASYNC is set as non-zero value
+    auto async = std::getenv("LUCI_LOG_ASYNC");
+    if (async != nullptr && std::stoi(async) != 0)
+    {
+      ctx->async(true);
+      // NOTE ctx is never destroyed, so deliver pending messages on exit
+      std::atexit([] { LoggingContext::get()->async(false); });
+    }
   }
 
   return ctx;
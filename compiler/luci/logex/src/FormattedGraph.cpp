@@ -264,6 +264,7 @@ private:
   IMPLEMENT(luci::CirclePadV2)
   IMPLEMENT(luci::CirclePow)
   IMPLEMENT(luci::CirclePRelu)
+  IMPLEMENT(luci::CircleQuantize)
   IMPLEMENT(luci::CircleRange)
   IMPLEMENT(luci::CircleRank)
   IMPLEMENT(luci::CircleReduceAny)
@@ -1652,6 +1653,12 @@ bool CircleNodeSummaryBuilder::summary(const luci::CirclePRelu *node, locop::Nod
   return summary_node(tbl(), node, s);
 }
 
+bool CircleNodeSummaryBuilder::summary(const luci::CircleQuantize *node,
+                                       locop::NodeSummary &s) const
+{
+  return use_input(tbl(), node, s);
+}
+
 bool CircleNodeSummaryBuilder::summary(const luci::CircleRange *node, locop::NodeSummary &s) const
 {
   return summary_node(tbl(), node, s);
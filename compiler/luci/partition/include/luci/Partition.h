@@ -18,7 +18,9 @@
 #define __LUCI_PARTITION_H__
 
 #include <luci/IR/Module.h>
+#include <luci/IR/CircleNode.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -38,7 +40,8 @@ struct PartitionTable
   // assign by opcode name: OPCODENAME=group
   std::unordered_map<std::string /* OPCODENAME */, std::string /* group */> byopcodes;
 
-  // TODO add assign by OP name
+  // assign by OP name: OPNAME=group, takes precedence over byopcodes
+  std::unordered_map<std::string /* OPNAME */, std::string /* group */> byopnames;
 };
 
 /**
@@ -66,6 +69,52 @@ struct PartedModules
  */
 PartedModules apply(Module *module, const PartitionTable &partition);
 
+/**
+ * @brief PartitionCost provides costs to search a partition automatically
+ * @note  Costs are in any unit, such as microseconds, but should be in the same unit
+ */
+class PartitionCost
+{
+public:
+  virtual ~PartitionCost() = default;
+
+  /**
+   * @brief return cost to execute node of opcode name in group, negative if not supported
+   */
+  virtual double op_cost(const std::string &opcode, const luci::CircleNode *node,
+                         const std::string &group) const = 0;
+
+  /**
+   * @brief return cost to move tensors of size bytes from group 'from' to group 'to'
+   */
+  virtual double transfer_cost(const std::string &from, const std::string &to,
+                               uint64_t size) const = 0;
+};
+
+enum class PartitionObjective
+{
+  Latency,    // minimize end-to-end latency of running partitions in sequence
+  Throughput, // minimize the slowest stage when partitions run as a pipeline
+};
+
+struct AutoPartitionOption
+{
+  PartitionObjective objective = PartitionObjective::Latency;
+  // maximum number of partitions, 0 for no limit with Latency and number of groups
+  // with Throughput
+  uint32_t stages = 0;
+};
+
+/**
+ * @brief Method to assign nodes of module to groups of partition by OPNAME with lowest cost
+ * @note  partition.groups should be set. Nodes are split into consecutive ranges of the
+ *        execution order, each of them assigned to one group.
+ * @return false if there is no group which can execute some node, or if some node has an
+ *         empty or duplicate name
+ */
+bool auto_partition(const Module *module, const PartitionCost &cost,
+                    const AutoPartitionOption &option, PartitionTable &partition);
+
 } // namespace luci
 
 #endif // __LUCI_PARTITION_H__
@@ -123,6 +123,7 @@ public:
   void visit(const luci::CirclePadV2 *) final;
   void visit(const luci::CirclePow *) final;
   void visit(const luci::CirclePRelu *) final;
+  void visit(const luci::CircleQuantize *) final;
   void visit(const luci::CircleRange *) final;
   void visit(const luci::CircleRank *) final;
   void visit(const luci::CircleReduceAny *) final;
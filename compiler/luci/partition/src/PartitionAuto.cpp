@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionPGroups.h"
+#include "CircleOpCode.h"
+
+#include "luci/Partition.h"
+#include "luci/Log.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+#include <loco/IR/DataTypeTraits.h>
+
+#include <cassert>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace
+{
+
+const double INF = std::numeric_limits<double>::infinity();
+
+// Return size of the output in bytes, 0 if it is not known
+uint64_t tensor_size(const luci::CircleNode *node)
+{
+  if (node->dtype() == loco::DataType::Unknown)
+    return 0;
+
+  uint64_t size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (not node->dim(i).known())
+      return 0;
+    size *= node->dim(i).value();
+  }
+  return size;
+}
+
+/**
+ * @brief Costs of nodes in execution order to search a partition with
+ * @note  A partition is a split of nodes into consecutive ranges, each with a group.
+ *        Graph inputs and constants are regarded to be present in every group, and
+ *        all tensors alive at a split are regarded to move to the next group.
+ */
+class PartitionSearch
+{
+public:
+  PartitionSearch(loco::Graph *graph, const luci::PartitionCost &cost,
+                  const std::vector<std::string> &groups);
+
+public:
+  const std::vector<const luci::CircleNode *> &nodes(void) const { return _nodes; }
+
+  /**
+   * @brief return group index of each node with lowest latency, empty if impossible
+   */
+  std::vector<uint32_t> latency(void) const;
+
+  /**
+   * @brief return group index of each node with lowest objective in 'stages' ranges at most,
+   *        empty if impossible
+   */
+  std::vector<uint32_t> search(luci::PartitionObjective objective, uint32_t stages) const;
+
+private:
+  // cost of nodes [begin, end) in group g
+  double range(uint32_t g, uint32_t begin, uint32_t end) const
+  {
+    if (_fails[g][end] != _fails[g][begin])
+      return INF;
+    return _sums[g][end] - _sums[g][begin];
+  }
+
+  // cost to move tensors alive before node 'at' from group 'from' to group 'to'
+  double transfer(uint32_t at, uint32_t from, uint32_t to) const
+  {
+    return _transfer[(at * _num_groups + from) * _num_groups + to];
+  }
+
+private:
+  uint32_t _num_groups;
+  std::vector<const luci::CircleNode *> _nodes;
+  // prefix sums of costs and count of unsupported nodes per group
+  std::vector<std::vector<double>> _sums;
+  std::vector<std::vector<uint32_t>> _fails;
+  // cost of transfer before each node between each pair of groups
+  std::vector<double> _transfer;
+};
+
+PartitionSearch::PartitionSearch(loco::Graph *graph, const luci::PartitionCost &cost,
+                                 const std::vector<std::string> &groups)
+  : _num_groups(static_cast<uint32_t>(groups.size()))
+{
+  LOGGER(l);
+
+  std::map<const loco::Node *, uint32_t> position;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+    if (!luci::check_allocate_partition(circle_node))
+      continue;
+    position[node] = static_cast<uint32_t>(_nodes.size());
+    _nodes.push_back(circle_node);
+  }
+
+  const auto num_nodes = static_cast<uint32_t>(_nodes.size());
+
+  _sums.assign(_num_groups, std::vector<double>(num_nodes + 1, 0.0));
+  _fails.assign(_num_groups, std::vector<uint32_t>(num_nodes + 1, 0));
+  for (uint32_t i = 0; i < num_nodes; ++i)
+  {
+    auto node = _nodes[i];
+    auto opcode = luci::opcode_name(node);
+    for (uint32_t g = 0; g < _num_groups; ++g)
+    {
+      auto op_cost = cost.op_cost(opcode, node, groups[g]);
+      INFO(l) << "Cost: " << node->name() << ": " << opcode << ", " << groups[g] << " = "
+              << op_cost << std::endl;
+      _sums[g][i + 1] = _sums[g][i] + (op_cost < 0 ? 0 : op_cost);
+      _fails[g][i + 1] = _fails[g][i] + (op_cost < 0 ? 1 : 0);
+    }
+  }
+
+  // size of tensors produced before each node and used from it
+  std::vector<int64_t> delta(num_nodes + 1, 0);
+  for (uint32_t i = 0; i < num_nodes; ++i)
+  {
+    uint32_t last_use = i;
+    for (auto succ : loco::succs(_nodes[i]))
+    {
+      auto it = position.find(succ);
+      if (it != position.end())
+        last_use = std::max(last_use, it->second);
+    }
+    if (last_use == i)
+      continue;
+    const auto size = static_cast<int64_t>(tensor_size(_nodes[i]));
+    delta[i + 1] += size;
+    delta[last_use + 1] -= size;
+  }
+
+  _transfer.assign((num_nodes + 1) * _num_groups * _num_groups, 0.0);
+  int64_t alive = 0;
+  for (uint32_t i = 1; i < num_nodes; ++i)
+  {
+    alive += delta[i];
+    for (uint32_t from = 0; from < _num_groups; ++from)
+    {
+      for (uint32_t to = 0; to < _num_groups; ++to)
+      {
+        if (from == to)
+          continue;
+        _transfer[(i * _num_groups + from) * _num_groups + to] =
+          cost.transfer_cost(groups[from], groups[to], static_cast<uint64_t>(alive));
+      }
+    }
+  }
+}
+
+std::vector<uint32_t> PartitionSearch::latency(void) const
+{
+  const auto num_nodes = static_cast<uint32_t>(_nodes.size());
+
+  // best[i][g]: lowest cost of nodes [0, i] with node i in group g
+  std::vector<std::vector<double>> best(num_nodes, std::vector<double>(_num_groups, INF));
+  std::vector<std::vector<uint32_t>> prev(num_nodes, std::vector<uint32_t>(_num_groups, 0));
+  for (uint32_t i = 0; i < num_nodes; ++i)
+  {
+    for (uint32_t g = 0; g < _num_groups; ++g)
+    {
+      const double node_cost = range(g, i, i + 1);
+      if (node_cost == INF)
+        continue;
+      if (i == 0)
+      {
+        best[i][g] = node_cost;
+        continue;
+      }
+      for (uint32_t p = 0; p < _num_groups; ++p)
+      {
+        const double move = (p == g) ? 0.0 : transfer(i, p, g);
+        const double total = best[i - 1][p] + move + node_cost;
+        if (total < best[i][g])
+        {
+          best[i][g] = total;
+          prev[i][g] = p;
+        }
+      }
+    }
+  }
+
+  std::vector<uint32_t> assign;
+  if (num_nodes == 0)
+    return assign;
+
+  uint32_t g = 0;
+  for (uint32_t c = 1; c < _num_groups; ++c)
+  {
+    if (best[num_nodes - 1][c] < best[num_nodes - 1][g])
+      g = c;
+  }
+  if (best[num_nodes - 1][g] == INF)
+    return assign;
+
+  assign.resize(num_nodes);
+  for (uint32_t i = num_nodes; i-- > 0;)
+  {
+    assign[i] = g;
+    g = prev[i][g];
+  }
+  return assign;
+}
+
+std::vector<uint32_t> PartitionSearch::search(luci::PartitionObjective objective,
+                                              uint32_t stages) const
+{
+  const auto num_nodes = static_cast<uint32_t>(_nodes.size());
+  std::vector<uint32_t> assign;
+  if (num_nodes == 0 || stages == 0)
+    return assign;
+
+  auto combine = [objective](double done, double stage) {
+    return objective == luci::PartitionObjective::Latency ? done + stage
+                                                          : std::max(done, stage);
+  };
+
+  struct Step
+  {
+    double cost = INF;
+    uint32_t begin = 0;
+    uint32_t prev_group = 0;
+  };
+  // best[k][i][g]: lowest cost of nodes [0, i) in k + 1 ranges, the last one in group g
+  std::vector<std::vector<std::vector<Step>>> best(
+    stages, std::vector<std::vector<Step>>(num_nodes + 1, std::vector<Step>(_num_groups)));
+
+  for (uint32_t i = 1; i <= num_nodes; ++i)
+    for (uint32_t g = 0; g < _num_groups; ++g)
+      best[0][i][g].cost = range(g, 0, i);
+
+  for (uint32_t k = 1; k < stages; ++k)
+  {
+    for (uint32_t i = k + 1; i <= num_nodes; ++i)
+    {
+      for (uint32_t g = 0; g < _num_groups; ++g)
+      {
+        auto &step = best[k][i][g];
+        for (uint32_t j = k; j < i; ++j)
+        {
+          const double stage_cost = range(g, j, i);
+          if (stage_cost == INF)
+            continue;
+          // ranges of a same group next to each other are same as one range
+          for (uint32_t p = 0; p < _num_groups; ++p)
+          {
+            if (p == g || best[k - 1][j][p].cost == INF)
+              continue;
+            const double total = combine(best[k - 1][j][p].cost, stage_cost + transfer(j, p, g));
+            if (total < step.cost)
+            {
+              step.cost = total;
+              step.begin = j;
+              step.prev_group = p;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  uint32_t best_k = 0;
+  uint32_t best_g = 0;
+  for (uint32_t k = 0; k < stages; ++k)
+  {
+    for (uint32_t g = 0; g < _num_groups; ++g)
+    {
+      if (best[k][num_nodes][g].cost < best[best_k][num_nodes][best_g].cost)
+      {
+        best_k = k;
+        best_g = g;
+      }
+    }
+  }
+  if (best[best_k][num_nodes][best_g].cost == INF)
+    return assign;
+
+  assign.resize(num_nodes);
+  uint32_t end = num_nodes;
+  for (uint32_t k = best_k + 1; k-- > 0;)
+  {
+    const auto &step = best[k][end][best_g];
+    const uint32_t begin = (k == 0) ? 0 : step.begin;
+    for (uint32_t i = begin; i < end; ++i)
+      assign[i] = best_g;
+    best_g = step.prev_group;
+    end = begin;
+  }
+  return assign;
+}
+
+// Return name of a node which is empty or used twice, as nodes are assigned by OPNAME
+const luci::CircleNode *ambiguous_name(const std::vector<const luci::CircleNode *> &nodes)
+{
+  std::set<std::string> names;
+  for (auto node : nodes)
+  {
+    if (node->name().empty() || !names.insert(node->name()).second)
+      return node;
+  }
+  return nullptr;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool auto_partition(const Module *module, const PartitionCost &cost,
+                    const AutoPartitionOption &option, PartitionTable &partition)
+{
+  assert(module != nullptr);
+  // TODO support multiple subgraphs
+  assert(module->size() == 1);
+
+  LOGGER(l);
+
+  if (partition.groups.empty())
+    return false;
+
+  PartitionSearch search(module->graph(), cost, partition.groups);
+
+  const auto &nodes = search.nodes();
+  if (auto node = ambiguous_name(nodes))
+  {
+    WARN(l) << "Auto: cannot assign by OPNAME as name '" << node->name() << "' of "
+            << luci::opcode_name(node) << " is empty or not unique" << std::endl;
+    return false;
+  }
+
+  std::vector<uint32_t> assign;
+  if (option.objective == PartitionObjective::Latency && option.stages == 0)
+    assign = search.latency();
+  else
+  {
+    auto stages = option.stages;
+    if (stages == 0)
+      stages = static_cast<uint32_t>(partition.groups.size());
+    assign = search.search(option.objective, stages);
+  }
+
+  if (assign.size() != nodes.size())
+    return false;
+
+  for (uint32_t i = 0; i < nodes.size(); ++i)
+  {
+    const auto &group = partition.groups.at(assign[i]);
+    INFO(l) << "Auto: " << nodes[i]->name() << " = " << group << std::endl;
+    partition.byopnames[nodes[i]->name()] = group;
+  }
+  return true;
+}
+
+} // namespace luci
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Partition.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ *  Graph with a chain of Sqrt Ops, named as "sqrt0", "sqrt1", ...
+ */
+class SqrtChainGraph : public TestIOGraph
+{
+public:
+  SqrtChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape, uint32_t length)
+  {
+    TestIOGraph::init(shape, shape);
+
+    loco::Node *input_node = input();
+    for (uint32_t i = 0; i < length; ++i)
+    {
+      auto sqrt = g()->nodes()->create<luci::CircleSqrt>();
+      sqrt->dtype(loco::DataType::FLOAT32);
+      sqrt->shape(shape);
+      sqrt->name("sqrt" + std::to_string(i));
+      sqrt->x(input_node);
+      input_node = sqrt;
+    }
+    output()->from(input_node);
+  }
+};
+
+// Costs of each node by name per group, with fixed transfer cost
+class TableCost final : public luci::PartitionCost
+{
+public:
+  double op_cost(const std::string &, const luci::CircleNode *node,
+                 const std::string &group) const final
+  {
+    return costs.at(group).at(node->name());
+  }
+
+  double transfer_cost(const std::string &, const std::string &, uint64_t size) const final
+  {
+    return size > 0 ? transfer : 0.0;
+  }
+
+public:
+  std::map<std::string, std::map<std::string, double>> costs;
+  double transfer = 0.0;
+};
+
+class PartitionAutoTest : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    SqrtChainGraph g;
+    g.init({2, 3}, 3);
+    g.transfer_to(&_module);
+
+    _cost.costs["A"] = {{"sqrt0", 1}, {"sqrt1", 10}, {"sqrt2", 1}};
+    _cost.costs["B"] = {{"sqrt0", 10}, {"sqrt1", 1}, {"sqrt2", 10}};
+
+    _pt.groups = {"A", "B"};
+    _pt.default_group = "A";
+  }
+
+protected:
+  void rename(const std::string &from, const std::string &to)
+  {
+    auto nodes = _module.graph()->nodes();
+    for (uint32_t i = 0; i < nodes->size(); ++i)
+    {
+      auto node = loco::must_cast<luci::CircleNode *>(nodes->at(i));
+      if (node->name() == from)
+        node->name(to);
+    }
+  }
+
+protected:
+  luci::Module _module;
+  TableCost _cost;
+  luci::PartitionTable _pt;
+};
+
+} // namespace
+
+TEST_F(PartitionAutoTest, latency_split)
+{
+  _cost.transfer = 1;
+
+  luci::AutoPartitionOption option;
+  ASSERT_TRUE(luci::auto_partition(&_module, _cost, option, _pt));
+
+  ASSERT_EQ(3, _pt.byopnames.size());
+  EXPECT_EQ("A", _pt.byopnames["sqrt0"]);
+  EXPECT_EQ("B", _pt.byopnames["sqrt1"]);
+  EXPECT_EQ("A", _pt.byopnames["sqrt2"]);
+}
+
+TEST_F(PartitionAutoTest, latency_transfer)
+{
+  // Moving the tensor costs more than running sqrt1 in A
+  _cost.transfer = 10;
+
+  luci::AutoPartitionOption option;
+  ASSERT_TRUE(luci::auto_partition(&_module, _cost, option, _pt));
+
+  EXPECT_EQ("A", _pt.byopnames["sqrt0"]);
+  EXPECT_EQ("A", _pt.byopnames["sqrt1"]);
+  EXPECT_EQ("A", _pt.byopnames["sqrt2"]);
+}
+
+TEST_F(PartitionAutoTest, latency_stages)
+{
+  _cost.transfer = 1;
+
+  luci::AutoPartitionOption option;
+  option.stages = 2;
+  ASSERT_TRUE(luci::auto_partition(&_module, _cost, option, _pt));
+
+  // A-B costs 1 + 1 + 1 + 10 = 13, which is lower than A only with 12 + 0
+  EXPECT_EQ("A", _pt.byopnames["sqrt0"]);
+  EXPECT_EQ("A", _pt.byopnames["sqrt1"]);
+  EXPECT_EQ("A", _pt.byopnames["sqrt2"]);
+}
+
+TEST_F(PartitionAutoTest, throughput)
+{
+  _cost.costs["A"] = {{"sqrt0", 4}, {"sqrt1", 4}, {"sqrt2", 4}};
+  _cost.costs["B"] = {{"sqrt0", 4}, {"sqrt1", 4}, {"sqrt2", 4}};
+  _cost.transfer = 1;
+
+  luci::AutoPartitionOption option;
+  option.objective = luci::PartitionObjective::Throughput;
+  option.stages = 2;
+  ASSERT_TRUE(luci::auto_partition(&_module, _cost, option, _pt));
+
+  // Slowest stage takes 8 with two stages, instead of 12 with one
+  EXPECT_EQ(_pt.byopnames["sqrt0"], _pt.byopnames["sqrt1"]);
+  EXPECT_NE(_pt.byopnames["sqrt1"], _pt.byopnames["sqrt2"]);
+}
+
+TEST_F(PartitionAutoTest, unsupported_NEG)
+{
+  _cost.costs["A"]["sqrt1"] = -1;
+  _cost.costs["B"]["sqrt1"] = -1;
+
+  luci::AutoPartitionOption option;
+  ASSERT_FALSE(luci::auto_partition(&_module, _cost, option, _pt));
+}
+
+TEST_F(PartitionAutoTest, duplicate_name_NEG)
+{
+  rename("sqrt2", "sqrt0");
+
+  luci::AutoPartitionOption option;
+  ASSERT_FALSE(luci::auto_partition(&_module, _cost, option, _pt));
+  ASSERT_TRUE(_pt.byopnames.empty());
+}
+
+TEST_F(PartitionAutoTest, empty_name_NEG)
+{
+  rename("sqrt1", "");
+  _cost.costs["A"][""] = 1;
+  _cost.costs["B"][""] = 1;
+
+  luci::AutoPartitionOption option;
+  ASSERT_FALSE(luci::auto_partition(&_module, _cost, option, _pt));
+  ASSERT_TRUE(_pt.byopnames.empty());
+}
+
+TEST(PartitionAutoNoGroupTest, no_groups_NEG)
+{
+  luci::Module module;
+  SqrtChainGraph g;
+  g.init({2, 3}, 1);
+  g.transfer_to(&module);
+
+  TableCost cost;
+  luci::PartitionTable pt;
+  luci::AutoPartitionOption option;
+  ASSERT_FALSE(luci::auto_partition(&module, cost, option, pt));
+}
@@ -41,6 +41,11 @@ public:
   bool visit(const luci::CircleNode *) final { return false; }
 };
 
+} // namespace
+
+namespace luci
+{
+
 bool check_allocate_partition(const luci::CircleNode *node)
 {
   IsVirtualNode query;
@@ -58,11 +63,6 @@ bool check_allocate_partition(const luci::CircleNode *node)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
 std::unique_ptr<luci::PGroups> produce_pgroups(const luci::Module *source,
                                                const luci::PartitionTable &partition)
 {
@@ -93,6 +93,9 @@ std::unique_ptr<luci::PGroups> produce_pgroups(const luci::Module *source,
       auto it = partition.byopcodes.find(opcodename);
       if (it != partition.byopcodes.end())
         group = it->second;
+      auto itn = partition.byopnames.find(node->name());
+      if (itn != partition.byopnames.end())
+        group = itn->second;
 
       INFO(l) << "Op: " << node->name() << ": " << opcodename << ", " << node << ", " << group
               << std::endl;
@@ -26,6 +26,11 @@
 namespace luci
 {
 
+/**
+ * @brief return true if node is assigned to a group, false for virtual nodes and constants
+ */
+bool check_allocate_partition(const luci::CircleNode *node);
+
 /**
  * @brief This will produce a PGroups from Module and PartitionTable.
  * @note  Each PGroup will hold one CircleNode and partition key value as group.
@@ -78,3 +78,22 @@ TEST(PartitionPGroupsTest, simple_produce)
 
   ASSERT_EQ(1, pgs->pgroups.size());
 }
+
+TEST(PartitionPGroupsTest, byopname_produce)
+{
+  luci::Module module;
+
+  SqrtGraph g;
+  g.init({3, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.default_group = "A";
+  pt.byopcodes["SQRT"] = "B";
+  pt.byopnames["sqrt"] = "C";
+
+  auto pgs = produce_pgroups(&module, pt);
+
+  ASSERT_EQ(1, pgs->pgroups.size());
+  ASSERT_EQ("C", pgs->pgroups.at(0)->group);
+}
@@ -27,6 +27,8 @@
 namespace luci
 {
 
+class ConstantEvaluator;
+
 class CircleOptimizer final
 {
 public:
@@ -70,6 +72,7 @@ public:
       SubstituteTransposeToReshape,
       RemoveRedundantReshape,
       RemoveFakeQuant,
+      FoldConstants,
     };
 
     enum AlgorithmParameters
@@ -78,6 +81,7 @@ public:
       Quantize_input_dtype,
       Quantize_output_dtype,
       Quantize_granularity, // layer-wise or channel-wise
+      Quantize_num_threads, // threads to quantize weights with, 0 for hardware threads
 
       // sparsify
       Sparsify_tensor_name,
@@ -89,6 +93,9 @@ public:
       // convert NCHW to NHWC
       NCHW_to_NHWC_input_shape,
       NCHW_to_NHWC_output_shape,
+
+      // fold constants
+      FoldConstants_size_limit, // bytes
     };
 
     virtual ~Options() = default;
@@ -103,6 +110,9 @@ public:
   // TODO maybe caller can provide Options as ctor parameters
   Options *options(void);
 
+  // Evaluator for FoldConstants, which is not owned and must outlive the optimizer
+  void constant_evaluator(ConstantEvaluator *evaluator) { _constant_evaluator = evaluator; }
+
 public:
   void optimize(luci::Module *) const;
 
@@ -114,6 +124,7 @@ public:
 
 private:
   std::unique_ptr<Options> _options;
+  ConstantEvaluator *_constant_evaluator = nullptr;
 };
 
 } // namespace luci
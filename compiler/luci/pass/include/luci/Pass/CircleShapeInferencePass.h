@@ -35,6 +35,7 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *graph);
+  bool update(loco::Graph *graph, const std::vector<loco::Node *> &nodes);
 };
 
 } // namespace luci
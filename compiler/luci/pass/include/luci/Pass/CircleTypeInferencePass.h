@@ -35,6 +35,7 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *g);
+  bool update(loco::Graph *g, const std::vector<loco::Node *> &nodes);
 };
 
 } // namespace luci
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_CONSTANT_EVALUATOR_H__
+#define __LUCI_CONSTANT_EVALUATOR_H__
+
+namespace luci
+{
+
+class CircleConst;
+class CircleNode;
+
+/**
+ * @brief  Interface to compute the value of a node whose inputs are all constant
+ *
+ * NOTE luci does not evaluate operators by itself. luci_interpreter::ConstantEvaluator
+ *      implements this with the kernels of luci-interpreter.
+ */
+class ConstantEvaluator
+{
+public:
+  virtual ~ConstantEvaluator() = default;
+
+  /**
+   * @brief  Return a new CircleConst in the graph of 'node' which holds the value of 'node',
+   *         or nullptr if 'node' cannot be evaluated
+   */
+  virtual luci::CircleConst *evaluate(luci::CircleNode *node) = 0;
+};
+
+} // namespace luci
+
+#endif // __LUCI_CONSTANT_EVALUATOR_H__
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_FOLD_CONSTANTS_PASS_H__
+#define __LUCI_FOLD_CONSTANTS_PASS_H__
+
+#include <luci/Pass/ConstantEvaluator.h>
+
+#include <logo/Pass.h>
+
+#include <cstdint>
+
+namespace luci
+{
+
+/**
+ * @brief  Class to fold any operator whose inputs are all constant
+ *
+ * Operators whose output is larger than 'size_limit' bytes are kept as they are, so that
+ * folding does not bloat the model with a large constant computed from small ones.
+ */
+struct FoldConstantsPass final : public logo::Pass
+{
+  FoldConstantsPass(ConstantEvaluator *evaluator, uint32_t size_limit)
+    : _evaluator(evaluator), _size_limit(size_limit)
+  {
+    // DO NOTHING
+  }
+
+  const char *name(void) const final { return "luci::FoldConstantsPass"; }
+
+  bool run(loco::Graph *g) final;
+
+private:
+  ConstantEvaluator *_evaluator;
+  uint32_t _size_limit;
+};
+
+} // namespace luci
+
+#endif // __LUCI_FOLD_CONSTANTS_PASS_H__
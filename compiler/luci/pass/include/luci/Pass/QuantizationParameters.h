@@ -17,6 +17,11 @@
 #ifndef __LUCI_QUANTIZATION_PARAMETERS_H__
 #define __LUCI_QUANTIZATION_PARAMETERS_H__
 
+#include <loco/IR/DataType.h>
+
+#include <string>
+#include <unordered_map>
+
 namespace luci
 {
 
@@ -26,6 +31,9 @@ enum QuantizationGranularity
   ChannelWise = 1,
 };
 
+// Quantized data type of layers by name, which overrides the output data type of quantization
+using LayerDTypes = std::unordered_map<std::string /* layer name */, loco::DataType>;
+
 } // namespace luci
 
 #endif // __LUCI_QUANTIZATION_PARAMETERS_H__
@@ -32,9 +32,15 @@ namespace luci
 class QuantizeWithMinMaxPass : public logo::Pass
 {
 public:
+  /**
+   * @param num_threads Number of threads to quantize weights with, 0 for hardware threads
+   * @param layer_dtypes Data types of layers to quantize other than output_dtype
+   */
   QuantizeWithMinMaxPass(loco::DataType input_dtype, loco::DataType output_dtype,
-                         QuantizationGranularity granularity)
-    : _input_dtype{input_dtype}, _output_dtype{output_dtype}, _granularity{granularity}
+                         QuantizationGranularity granularity, uint32_t num_threads = 1,
+                         const LayerDTypes &layer_dtypes = {})
+    : _input_dtype{input_dtype}, _output_dtype{output_dtype}, _granularity{granularity},
+      _num_threads{num_threads}, _layer_dtypes{layer_dtypes}
   {
     // DO NOTHING
   }
@@ -47,6 +53,8 @@ private:
   loco::DataType _input_dtype;
   loco::DataType _output_dtype;
   QuantizationGranularity _granularity;
+  uint32_t _num_threads;
+  LayerDTypes _layer_dtypes;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct RemoveRedundantTransposePass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveRedundantTransposePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool matches(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct RemoveUnnecessaryReshapePass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveUnnecessaryReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool matches(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct RemoveUnnecessarySplitPass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveUnnecessarySplitPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool matches(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct RemoveUnnecessaryStridedSlicePass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveUnnecessaryStridedSlicePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool matches(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct SubstitutePackToReshapePass final : public logo::Pass
   const char *name(void) const final { return "luci::SubstitutePackToReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool matches(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,7 @@
 #include "luci/Pass/ConvertNCHWToNHWCPass.h"
 #include "luci/Pass/FoldAddV2Pass.h"
 #include "luci/Pass/FoldCastPass.h"
+#include "luci/Pass/FoldConstantsPass.h"
 #include "luci/Pass/FoldDequantizePass.h"
 #include "luci/Pass/FoldSparseToDensePass.h"
 #include "luci/Pass/ForwardReshapeToUnaryOpPass.h"
@@ -120,6 +121,25 @@ bool OptimizeOptionsImpl::query(Algorithm algo)
   return true;
 }
 
+// Digest of attributes which passes and inference depend on, other than graph connectivity
+uint64_t node_digest(const loco::Node *node)
+{
+  auto circle_node = dynamic_cast<const luci::CircleNode *>(node);
+  if (circle_node == nullptr)
+    return 0;
+
+  uint64_t digest = static_cast<uint64_t>(circle_node->dtype());
+  auto mix = [&digest](uint64_t value) { digest = digest * 1000003 ^ value; };
+  mix(static_cast<uint64_t>(circle_node->shape_status()));
+  mix(circle_node->rank());
+  for (uint32_t axis = 0; axis < circle_node->rank(); ++axis)
+  {
+    const auto &dim = circle_node->dim(axis);
+    mix(dim.known() ? dim.value() + 1 : 0);
+  }
+  return digest;
+}
+
 } // namespace
 
 namespace luci
@@ -209,6 +229,19 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<luci::FoldCastPass>());
   }
+  if (_options->query(Options::Algorithm::FoldConstants))
+  {
+    if (_constant_evaluator == nullptr)
+      throw std::runtime_error("FoldConstants needs a constant evaluator");
+
+    // Constants larger than this are usually weights which should not be duplicated
+    uint32_t size_limit = 1024 * 1024;
+    auto size_limit_str = _options->param(Options::AlgorithmParameters::FoldConstants_size_limit);
+    if (!size_limit_str.empty())
+      size_limit = std::stoul(size_limit_str);
+
+    phase.emplace_back(std::make_unique<luci::FoldConstantsPass>(_constant_evaluator, size_limit));
+  }
   if (_options->query(Options::Algorithm::FoldDequantize))
   {
     phase.emplace_back(std::make_unique<luci::FoldDequantizePass>());
@@ -298,14 +331,20 @@ void CircleOptimizer::optimize(loco::Graph *g) const
 
   /* TRANSFORM DECLARATION END */
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  // Passes are revisited only for nodes changed since their last run
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g, node_digest};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
 
 void CircleOptimizer::quantize(loco::Graph *g) const
 {
+  uint32_t num_threads = 1;
+  auto num_threads_str = _options->param(Options::AlgorithmParameters::Quantize_num_threads);
+  if (!num_threads_str.empty())
+    num_threads = std::stoul(num_threads_str);
+
   // Fake quantization of weights
   if (_options->query(Options::Algorithm::QuantizeDequantizeWeights))
   {
@@ -341,8 +380,10 @@ void CircleOptimizer::quantize(loco::Graph *g) const
         circle_node->quantparam(nullptr);
     }
 
-    luci::QuantizeDequantizeWeightsPass fake_quantizer(
-      str_to_dtype(input_dtype), str_to_dtype(output_dtype), str_to_granularity(granularity));
+    luci::QuantizeDequantizeWeightsPass fake_quantizer(str_to_dtype(input_dtype),
+                                                       str_to_dtype(output_dtype),
+                                                       str_to_granularity(granularity),
+                                                       num_threads);
     fake_quantizer.run(g);
   }
 
@@ -374,7 +415,7 @@ void CircleOptimizer::quantize(loco::Graph *g) const
       throw std::runtime_error("Layer-wise quantization only supports uint8 dtype.");
 
     luci::QuantizeWithMinMaxPass quantizer(str_to_dtype(input_dtype), str_to_dtype(output_dtype),
-                                           str_to_granularity(granularity));
+                                           str_to_granularity(granularity), num_threads);
     quantizer.run(g);
 
     // Post-quantization optimizations
@@ -50,6 +50,18 @@ TEST(CircleOptimizerTest, optimize_algorithms)
   SUCCEED();
 }
 
+TEST(CircleOptimizerTest, fold_constants_without_evaluator_NEG)
+{
+  loco::Graph g;
+  luci::CircleOptimizer o;
+
+  auto options = o.options();
+
+  options->enable(Algorithms::FoldConstants);
+
+  EXPECT_THROW(o.optimize(&g), std::runtime_error);
+}
+
 TEST(CircleOptimizerTest, sparsify_simple)
 {
   loco::Graph g;
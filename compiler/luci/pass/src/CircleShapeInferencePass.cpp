@@ -15,6 +15,7 @@
  */
 
 #include "helpers/InferenceCandidates.h"
+#include "helpers/InferenceStamps.h"
 
 #include "luci/Pass/CircleShapeInferencePass.h"
 
@@ -66,6 +67,7 @@ bool CircleShapeInferencePass::run(luci::Module *m)
 bool CircleShapeInferencePass::run(loco::Graph *g)
 {
   luci::sinf::Rule shape_infer_rule;
+  InferenceStamps stamps(InferenceKind::Shape);
   bool changed = false;
 
   for (auto node : inference_candidates(g))
@@ -73,6 +75,40 @@ bool CircleShapeInferencePass::run(loco::Graph *g)
     loco::TensorShape shape;
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
 
+    // Skip nodes which have not changed since they were inferred
+    if (!stamps.dirty(circle_node))
+      continue;
+
+    if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
+    {
+      circle_node->rank(shape.rank());
+      for (uint32_t i = 0; i < shape.rank(); ++i)
+        circle_node->dim(i) = shape.dim(i);
+
+      circle_node->shape_status(luci::ShapeStatus::VALID);
+
+      changed = true;
+    }
+
+    stamps.stamp(circle_node);
+  }
+
+  return changed;
+}
+
+bool CircleShapeInferencePass::update(loco::Graph *g, const std::vector<loco::Node *> &nodes)
+{
+  luci::sinf::Rule shape_infer_rule;
+  InferenceStamps stamps(InferenceKind::Shape);
+  bool changed = false;
+
+  // Infer the given nodes, and users of those whose shape changes
+  InferenceWorklist worklist(g, nodes);
+  while (auto node = worklist.pop())
+  {
+    loco::TensorShape shape;
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
     if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
     {
       circle_node->rank(shape.rank());
@@ -81,8 +117,11 @@ bool CircleShapeInferencePass::run(loco::Graph *g)
 
       circle_node->shape_status(luci::ShapeStatus::VALID);
 
+      worklist.push_succs(node);
       changed = true;
     }
+
+    stamps.stamp(circle_node);
   }
 
   return changed;
@@ -362,3 +362,128 @@ TEST(CircleShapeInferencePassTest, not_used_virtual_op)
 
   SUCCEED();
 }
+
+/**
+ * This test is to check that only changed nodes are inferred again.
+ *
+ * Stride of "conv2d" is changed in place, which is not visible from shape, dtype and
+ * arguments of it. Pass which changes a node in place should reset its shape_status.
+ *
+ *            1x1x1x1
+ *  [filter] ---------+
+ *  [bias]   ---------+
+ *                    |
+ *  input  ------> [conv2d] ------> output
+ *         1x4x4x1            1x4x4x1 (stride=1)
+ *                            1x2x2x1 (stride=2)
+ */
+TEST(CircleShapeInferencePassTest, infer_changed_node_only)
+{
+  luci::CircleShapeInferencePass pass;
+  auto g = loco::make_graph();
+
+  auto shape_inference_run = [&]() {
+    while (pass.run(g.get()) == true)
+      ;
+  };
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto filter = g->nodes()->create<luci::CircleConst>();
+  auto bias = g->nodes()->create<luci::CircleConst>();
+  auto conv2d = g->nodes()->create<luci::CircleConv2D>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  auto graph_input = g->inputs()->create();
+  graph_input->shape({1, 4, 4, 1});
+
+  input->index(graph_input->index());
+  input->shape({1, 4, 4, 1});
+  input->shape_status(luci::ShapeStatus::VALID);
+
+  filter->dtype(loco::DataType::FLOAT32);
+  filter->size<loco::DataType::FLOAT32>(1);
+  filter->shape({1, 1, 1, 1});
+  filter->shape_status(luci::ShapeStatus::VALID);
+
+  bias->dtype(loco::DataType::FLOAT32);
+  bias->size<loco::DataType::FLOAT32>(1);
+  bias->shape({1});
+  bias->shape_status(luci::ShapeStatus::VALID);
+
+  conv2d->input(input);
+  conv2d->filter(filter);
+  conv2d->bias(bias);
+  conv2d->padding(luci::Padding::VALID);
+  conv2d->stride()->h(1);
+  conv2d->stride()->w(1);
+  conv2d->dilation()->h(1);
+  conv2d->dilation()->w(1);
+
+  output->from(conv2d);
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  graph_output->shape({1, 2, 2, 1});
+
+  ASSERT_NO_THROW(shape_inference_run());
+  ASSERT_EQ(4, conv2d->dim(1).value());
+
+  // Nothing has changed since the last run
+  conv2d->stride()->h(2);
+  conv2d->stride()->w(2);
+  ASSERT_FALSE(pass.run(g.get()));
+  ASSERT_EQ(4, conv2d->dim(1).value());
+
+  conv2d->shape_status(luci::ShapeStatus::UNDEFINED);
+  ASSERT_TRUE(pass.run(g.get()));
+  ASSERT_EQ(2, conv2d->dim(1).value());
+  ASSERT_EQ(2, conv2d->dim(2).value());
+}
+
+TEST(CircleShapeInferencePassTest, changed_const_value)
+{
+  luci::CircleShapeInferencePass pass;
+  auto g = loco::make_graph();
+
+  auto shape_inference_run = [&]() {
+    while (pass.run(g.get()) == true)
+      ;
+  };
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto shape = g->nodes()->create<luci::CircleConst>();
+  auto reshape = g->nodes()->create<luci::CircleReshape>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  auto graph_input = g->inputs()->create();
+  graph_input->shape({2, 3});
+
+  input->index(graph_input->index());
+  input->shape({2, 3});
+  input->shape_status(luci::ShapeStatus::VALID);
+
+  shape->dtype(loco::DataType::S32);
+  shape->size<loco::DataType::S32>(2);
+  shape->shape({2});
+  shape->at<loco::DataType::S32>(0) = 3;
+  shape->at<loco::DataType::S32>(1) = 2;
+  shape->shape_status(luci::ShapeStatus::VALID);
+
+  reshape->tensor(input);
+  reshape->shape(shape);
+
+  output->from(reshape);
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  graph_output->shape({6, 1});
+
+  ASSERT_NO_THROW(shape_inference_run());
+  ASSERT_EQ(3, reshape->dim(0).value());
+  ASSERT_EQ(2, reshape->dim(1).value());
+
+  // Values of shape-like constants are checked
+  shape->at<loco::DataType::S32>(0) = 6;
+  shape->at<loco::DataType::S32>(1) = 1;
+  ASSERT_NO_THROW(shape_inference_run());
+  ASSERT_EQ(6, reshape->dim(0).value());
+  ASSERT_EQ(1, reshape->dim(1).value());
+}
@@ -15,6 +15,7 @@
  */
 
 #include "helpers/InferenceCandidates.h"
+#include "helpers/InferenceStamps.h"
 
 #include "luci/Pass/CircleTypeInferencePass.h"
 
@@ -41,6 +42,7 @@ bool CircleTypeInferencePass::run(luci::Module *m)
 bool CircleTypeInferencePass::run(loco::Graph *g)
 {
   luci::tinf::Rule type_infer_rule;
+  InferenceStamps stamps(InferenceKind::Type);
   bool changed = false;
 
   for (auto node : inference_candidates(g))
@@ -48,11 +50,43 @@ bool CircleTypeInferencePass::run(loco::Graph *g)
     loco::DataType dtype;
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
 
+    // Skip nodes which have not changed since they were inferred
+    if (!stamps.dirty(circle_node))
+      continue;
+
     if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
     {
       circle_node->dtype(dtype);
       changed = true;
     }
+
+    stamps.stamp(circle_node);
+  }
+
+  return changed;
+}
+
+bool CircleTypeInferencePass::update(loco::Graph *g, const std::vector<loco::Node *> &nodes)
+{
+  luci::tinf::Rule type_infer_rule;
+  InferenceStamps stamps(InferenceKind::Type);
+  bool changed = false;
+
+  // Infer the given nodes, and users of those whose type changes
+  InferenceWorklist worklist(g, nodes);
+  while (auto node = worklist.pop())
+  {
+    loco::DataType dtype;
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+    if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
+    {
+      circle_node->dtype(dtype);
+      worklist.push_succs(node);
+      changed = true;
+    }
+
+    stamps.stamp(circle_node);
   }
 
   return changed;
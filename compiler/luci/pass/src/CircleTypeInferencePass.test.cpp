@@ -16,6 +16,10 @@
 
 #include "luci/Pass/CircleTypeInferencePass.h"
 
+#include <loco.h>
+
+#include <luci/IR/CircleNodes.h>
+
 #include <gtest/gtest.h>
 
 TEST(CircleTypeInferencePassTest, name)
@@ -24,3 +28,36 @@ TEST(CircleTypeInferencePassTest, name)
   auto const name = pass.name();
   ASSERT_NE(nullptr, name);
 }
+
+TEST(CircleTypeInferencePassTest, changed_arg_dtype)
+{
+  luci::CircleTypeInferencePass pass;
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto relu = g->nodes()->create<luci::CircleRelu>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  input->dtype(loco::DataType::FLOAT32);
+
+  relu->features(input);
+
+  output->from(relu);
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  graph_output->dtype(loco::DataType::FLOAT32);
+
+  ASSERT_TRUE(pass.run(g.get()));
+  ASSERT_EQ(loco::DataType::FLOAT32, relu->dtype());
+  ASSERT_EQ(loco::DataType::FLOAT32, output->dtype());
+  ASSERT_FALSE(pass.run(g.get()));
+
+  input->dtype(loco::DataType::S32);
+  graph_output->dtype(loco::DataType::S32);
+  ASSERT_TRUE(pass.run(g.get()));
+  ASSERT_EQ(loco::DataType::S32, relu->dtype());
+  ASSERT_EQ(loco::DataType::S32, output->dtype());
+  ASSERT_FALSE(pass.run(g.get()));
+}
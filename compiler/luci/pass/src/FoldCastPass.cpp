@@ -104,4 +104,9 @@ bool FoldCastPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldCastPass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleCast *>(node) != nullptr;
+}
+
 } // namespace luci
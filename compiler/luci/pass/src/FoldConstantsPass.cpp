@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <loco/IR/DataTypeTraits.h>
+
+namespace
+{
+
+// Nodes which are not operators by themselves
+bool is_virtual(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CIRCLECONST:
+    case luci::CircleOpcode::CIRCLEINPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUTDUMMY:
+    case luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool has_constant_inputs(const luci::CircleNode *node)
+{
+  bool has_const = false;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto arg = node->arg(i);
+    if (dynamic_cast<const luci::CircleConst *>(arg) != nullptr)
+      has_const = true;
+    else if (dynamic_cast<const luci::CircleOutputExclude *>(arg) == nullptr)
+      return false;
+  }
+  return has_const;
+}
+
+// Return the size of the output in bytes, or 0 if it is not known statically
+uint64_t output_size(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID || node->dtype() == loco::DataType::Unknown)
+    return 0;
+
+  uint64_t size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (not node->dim(i).known())
+      return 0;
+    size *= node->dim(i).value();
+  }
+  return size;
+}
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ *  Fold an operator whose inputs are all constant
+ *
+ *    BEFORE
+ *
+ *    [CircleConst] [CircleConst]
+ *              \    /
+ *           [CircleNode]
+ *                |
+ *
+ *    AFTER
+ *
+ *           [CircleConst]
+ *                |
+ *
+ *  Nodes are visited in execution order, so that a chain of such operators is folded at once.
+ */
+bool FoldConstantsPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (is_virtual(circle_node) || not has_constant_inputs(circle_node))
+      continue;
+
+    const auto size = output_size(circle_node);
+    if (size == 0 || size > _size_limit)
+      continue;
+
+    auto folded = _evaluator->evaluate(circle_node);
+    if (folded == nullptr)
+      continue;
+
+    INFO(l) << "FoldConstantsPass folded " << circle_node->name() << " (" << size << " bytes)"
+            << std::endl;
+
+    folded->name(circle_node->name());
+    loco::replace(circle_node).with(folded);
+    changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+#include "PassTestGraphs.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+// Evaluate Neg of a FLOAT32 constant, which is enough to test the pass itself
+class NegEvaluator final : public luci::ConstantEvaluator
+{
+public:
+  luci::CircleConst *evaluate(luci::CircleNode *node) final
+  {
+    evaluated++;
+
+    auto neg = dynamic_cast<luci::CircleNeg *>(node);
+    if (neg == nullptr)
+      return nullptr;
+
+    auto x = loco::must_cast<luci::CircleConst *>(neg->x());
+    auto constant = node->graph()->nodes()->create<luci::CircleConst>();
+    constant->dtype(loco::DataType::FLOAT32);
+    constant->rank(x->rank());
+    for (uint32_t i = 0; i < x->rank(); ++i)
+      constant->dim(i).set(x->dim(i).value());
+    constant->shape_status(luci::ShapeStatus::VALID);
+
+    const auto num_elems = x->size<loco::DataType::FLOAT32>();
+    constant->size<loco::DataType::FLOAT32>(num_elems);
+    for (uint32_t i = 0; i < num_elems; ++i)
+      constant->at<loco::DataType::FLOAT32>(i) = -x->at<loco::DataType::FLOAT32>(i);
+    return constant;
+  }
+
+public:
+  uint32_t evaluated = 0;
+};
+
+/**
+ *  Graph that has a chain of Neg Ops with constant input
+ *
+ *    BEFORE
+ *
+ *         [CircleConst]
+ *               |
+ *             [Neg]
+ *               |
+ *             [Neg]
+ *
+ *    AFTER
+ *
+ *         [CircleConst]
+ *
+ */
+class FoldConstantsTest : public luci::ConstantFoldingAddTestGraph, public ::testing::Test
+{
+public:
+  FoldConstantsTest() : luci::ConstantFoldingAddTestGraph({3}, loco::DataType::FLOAT32) {}
+
+  virtual void SetUp() { init(); }
+
+  loco::Node *createFoldedPattern() override
+  {
+    _x = _g.nodes()->create<luci::CircleConst>();
+    _x->dtype(loco::DataType::FLOAT32);
+    _x->shape({3});
+    _x->shape_status(luci::ShapeStatus::VALID);
+    _x->size<loco::DataType::FLOAT32>(3);
+    for (uint32_t i = 0; i < 3; ++i)
+      _x->at<loco::DataType::FLOAT32>(i) = i + 1;
+    _x->name("x");
+
+    loco::Node *input = _x;
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+      auto neg = _g.nodes()->create<luci::CircleNeg>();
+      neg->dtype(loco::DataType::FLOAT32);
+      neg->shape({3});
+      neg->shape_status(luci::ShapeStatus::VALID);
+      neg->x(input);
+      neg->name("neg" + std::to_string(i));
+      input = neg;
+    }
+    return input;
+  }
+
+protected:
+  luci::CircleConst *_x = nullptr;
+};
+
+} // namespace
+
+TEST(FoldConstantsPassTest, name)
+{
+  NegEvaluator evaluator;
+  luci::FoldConstantsPass pass(&evaluator, 1024);
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FoldConstantsTest, fold_chain)
+{
+  NegEvaluator evaluator;
+  luci::FoldConstantsPass pass(&evaluator, 1024);
+  EXPECT_TRUE(pass.run(graph()));
+
+  auto folded_const = getFoldedPattern();
+  ASSERT_NE(nullptr, folded_const);
+
+  EXPECT_EQ("neg1", folded_const->name());
+  EXPECT_EQ(1, folded_const->rank());
+  EXPECT_EQ(3, folded_const->dim(0).value());
+  EXPECT_EQ(1, folded_const->at<loco::DataType::FLOAT32>(0));
+  EXPECT_EQ(2, folded_const->at<loco::DataType::FLOAT32>(1));
+  EXPECT_EQ(3, folded_const->at<loco::DataType::FLOAT32>(2));
+  // Add has a non-constant input, so it is never evaluated
+  EXPECT_EQ(2, evaluator.evaluated);
+}
+
+TEST_F(FoldConstantsTest, size_limit_NEG)
+{
+  NegEvaluator evaluator;
+  // Output of Neg takes 12 bytes
+  luci::FoldConstantsPass pass(&evaluator, 8);
+  EXPECT_FALSE(pass.run(graph()));
+
+  EXPECT_EQ(nullptr, getFoldedPattern());
+  EXPECT_EQ(0, evaluator.evaluated);
+}
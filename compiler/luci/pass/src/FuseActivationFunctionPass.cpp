@@ -109,4 +109,11 @@ bool FuseActivationFunctionPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseActivationFunctionPass::matches(const loco::Node *node) const
+{
+  auto opcode = loco::must_cast<const luci::CircleNode *>(node)->opcode();
+  return opcode == luci::CircleOpcode::RELU || opcode == luci::CircleOpcode::RELU6 ||
+         opcode == luci::CircleOpcode::RELU_N1_TO_1 || opcode == luci::CircleOpcode::TANH;
+}
+
 } // namespace luci
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InsertQuantizeOp.h"
+#include "QuantizationUtils.h"
+
+#include <luci/Profile/CircleNodeOrigin.h>
+#include <luci/Service/CircleNodeClone.h>
+
+#include <memory>
+#include <stdexcept>
+
+namespace luci
+{
+
+bool InsertQuantizeOp::need_quantize(loco::Node *input) const
+{
+  auto circle_node = loco::must_cast<luci::CircleNode *>(input);
+  if (dynamic_cast<luci::CircleConst *>(circle_node) != nullptr)
+    return false;
+
+  if (circle_node->dtype() != loco::DataType::U8 && circle_node->dtype() != loco::DataType::S16)
+    return false;
+
+  auto qparam = circle_node->quantparam();
+  if (qparam == nullptr || qparam->scale.size() != 1)
+    return false;
+
+  return circle_node->dtype() != quant_type;
+}
+
+loco::Node *InsertQuantizeOp::quantize(loco::Node *input)
+{
+  if (not need_quantize(input))
+    return input;
+
+  auto key = std::make_pair(input, quant_type);
+  auto it = quantize_ops.find(key);
+  if (it != quantize_ops.end())
+    return it->second;
+
+  auto circle_node = loco::must_cast<luci::CircleNode *>(input);
+  auto input_qparam = circle_node->quantparam();
+  const auto scale = input_qparam->scale[0];
+  const auto zerop = input_qparam->zerop[0];
+
+  // Range of values which can be represented by input
+  float min{0};
+  float max{0};
+  if (circle_node->dtype() == loco::DataType::U8)
+  {
+    min = (0 - zerop) * scale;
+    max = (255 - zerop) * scale;
+  }
+  else
+  {
+    min = -32767 * scale;
+    max = 32767 * scale;
+  }
+
+  float scaling_factor{0};
+  int64_t zp{0};
+  float nudged_min{0};
+  float nudged_max{0};
+  if (quant_type == loco::DataType::U8)
+    compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
+  else
+    compute_sym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
+
+  auto quantize = input->graph()->nodes()->create<luci::CircleQuantize>();
+  luci::copy_common_attributes(circle_node, quantize);
+  quantize->input(input);
+  quantize->name(circle_node->name() + "_Quantize");
+  quantize->dtype(quant_type);
+
+  auto qparam = std::make_unique<CircleQuantParam>();
+  qparam->scale.push_back(scaling_factor);
+  qparam->zerop.push_back(zp);
+  quantize->quantparam(std::move(qparam));
+  luci::add_origin(quantize, luci::get_origin(circle_node));
+
+  quantize_ops.emplace(key, quantize);
+  return quantize;
+}
+
+void InsertQuantizeOp::visit(luci::CircleNode *node)
+{
+  for (uint32_t i = 0; i < node->arity(); i++)
+  {
+    if (need_quantize(node->arg(i)))
+      throw std::runtime_error("Unsupported Op for mixed-precision quantization: " +
+                               node->name());
+  }
+}
+
+// These macros are undef at the end of the file
+#define INSERT_QUANTIZE_TO_UNARY_OP(CIRCLE_OP, INPUT) \
+  void InsertQuantizeOp::visit(CIRCLE_OP *node) { node->INPUT(quantize(node->INPUT())); }
+
+#define INSERT_QUANTIZE_TO_BINARY_OP(CIRCLE_OP, INPUT1, INPUT2) \
+  void InsertQuantizeOp::visit(CIRCLE_OP *node)                 \
+  {                                                             \
+    node->INPUT1(quantize(node->INPUT1()));                     \
+    node->INPUT2(quantize(node->INPUT2()));                     \
+  }
+
+#define INSERT_QUANTIZE_TO_VARIADIC_OP(CIRCLE_OP, NUM_INPUTS, INPUT) \
+  void InsertQuantizeOp::visit(CIRCLE_OP *node)                      \
+  {                                                                  \
+    for (uint32_t i = 0; i < node->NUM_INPUTS(); i++)                \
+      node->INPUT(i, quantize(node->INPUT(i)));                      \
+  }
+
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleAbs, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleArgMax, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleArgMin, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleAveragePool2D, value)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleBatchToSpaceND, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleConv2D, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleDepthToSpace, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleDepthwiseConv2D, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleElu, features)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleExp, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleFloor, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleFullyConnected, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleGather, params)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleInstanceNorm, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleLocalResponseNormalization, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleLogistic, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleMaxPool2D, value)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleMean, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleMirrorPad, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleNeg, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CirclePad, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CirclePadV2, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CirclePRelu, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleReduceMax, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleReduceMin, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleReduceProd, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleRelu, features)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleRelu6, features)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleReshape, tensor)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleResizeBilinear, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleResizeNearestNeighbor, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleReverseSequence, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleRsqrt, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSlice, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSoftmax, logits)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSpaceToBatchND, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSpaceToDepth, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSplit, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSplitV, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSqrt, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleStridedSlice, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleSum, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleTanh, x)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleTile, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleTopKV2, input)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleTranspose, a)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleTransposeConv, outBackprop)
+INSERT_QUANTIZE_TO_UNARY_OP(luci::CircleUnpack, value)
+
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleAdd, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleDiv, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleEqual, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleFloorDiv, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleGreater, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleGreaterEqual, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleLess, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleLessEqual, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleMaximum, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleMinimum, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleMul, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleNotEqual, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CirclePow, x, y)
+INSERT_QUANTIZE_TO_BINARY_OP(luci::CircleSub, x, y)
+
+INSERT_QUANTIZE_TO_VARIADIC_OP(luci::CircleAddN, arity, inputs)
+INSERT_QUANTIZE_TO_VARIADIC_OP(luci::CircleConcatenation, numValues, values)
+INSERT_QUANTIZE_TO_VARIADIC_OP(luci::CirclePack, values_count, values)
+
+#undef INSERT_QUANTIZE_TO_UNARY_OP
+#undef INSERT_QUANTIZE_TO_BINARY_OP
+#undef INSERT_QUANTIZE_TO_VARIADIC_OP
+
+} // namespace luci
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_INSERT_QUANTIZE_OP_H__
+#define __LUCI_INSERT_QUANTIZE_OP_H__
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+
+#include <map>
+#include <utility>
+
+namespace luci
+{
+
+/**
+ * @brief Insert Quantize Op between an activation and its user of other quantized data type
+ * @details
+ *
+ * BEFORE
+ *
+ *        [CircleNode]
+ *        (U8 qparam1)
+ *             |
+ *        [CircleNode]
+ *        (S16 layer)
+ *
+ * AFTER
+ *
+ *        [CircleNode]
+ *        (U8 qparam1)
+ *             |
+ *      [CircleQuantize]
+ *        (S16 qparam2)  <- same range as qparam1
+ *             |
+ *        [CircleNode]
+ *        (S16 layer)
+ *
+ * Quantize Op is shared by the users of the same data type.
+ */
+struct InsertQuantizeOp final : public luci::CircleNodeMutableVisitor<void>
+{
+  using QuantizeOps = std::map<std::pair<loco::Node *, loco::DataType>, luci::CircleQuantize *>;
+
+  InsertQuantizeOp(loco::DataType quant_type, QuantizeOps &quantize_ops)
+    : quant_type(quant_type), quantize_ops(quantize_ops)
+  {
+  }
+
+  // Data type of the layer being visited
+  loco::DataType quant_type;
+  QuantizeOps &quantize_ops;
+
+private:
+  // Return true if input is a quantized activation of other data type than quant_type
+  bool need_quantize(loco::Node *input) const;
+
+  // Return Quantize Op of input to quant_type, or input itself if it is not needed
+  loco::Node *quantize(loco::Node *input);
+
+private:
+  // Throw for Ops which do not support inputs of other data type
+  void visit(luci::CircleNode *node);
+
+  void visit(luci::CircleAbs *node);
+  void visit(luci::CircleArgMax *node);
+  void visit(luci::CircleArgMin *node);
+  void visit(luci::CircleAveragePool2D *node);
+  void visit(luci::CircleBatchToSpaceND *node);
+  void visit(luci::CircleConv2D *node);
+  void visit(luci::CircleDepthToSpace *node);
+  void visit(luci::CircleDepthwiseConv2D *node);
+  void visit(luci::CircleElu *node);
+  void visit(luci::CircleExp *node);
+  void visit(luci::CircleFloor *node);
+  void visit(luci::CircleFullyConnected *node);
+  void visit(luci::CircleGather *node);
+  void visit(luci::CircleInstanceNorm *node);
+  void visit(luci::CircleLocalResponseNormalization *node);
+  void visit(luci::CircleLogistic *node);
+  void visit(luci::CircleMaxPool2D *node);
+  void visit(luci::CircleMean *node);
+  void visit(luci::CircleMirrorPad *node);
+  void visit(luci::CircleNeg *node);
+  void visit(luci::CirclePad *node);
+  void visit(luci::CirclePadV2 *node);
+  void visit(luci::CirclePRelu *node);
+  void visit(luci::CircleReduceMax *node);
+  void visit(luci::CircleReduceMin *node);
+  void visit(luci::CircleReduceProd *node);
+  void visit(luci::CircleRelu *node);
+  void visit(luci::CircleRelu6 *node);
+  void visit(luci::CircleReshape *node);
+  void visit(luci::CircleResizeBilinear *node);
+  void visit(luci::CircleResizeNearestNeighbor *node);
+  void visit(luci::CircleReverseSequence *node);
+  void visit(luci::CircleRsqrt *node);
+  void visit(luci::CircleSlice *node);
+  void visit(luci::CircleSoftmax *node);
+  void visit(luci::CircleSpaceToBatchND *node);
+  void visit(luci::CircleSpaceToDepth *node);
+  void visit(luci::CircleSplit *node);
+  void visit(luci::CircleSplitV *node);
+  void visit(luci::CircleSqrt *node);
+  void visit(luci::CircleStridedSlice *node);
+  void visit(luci::CircleSum *node);
+  void visit(luci::CircleTanh *node);
+  void visit(luci::CircleTile *node);
+  void visit(luci::CircleTopKV2 *node);
+  void visit(luci::CircleTranspose *node);
+  void visit(luci::CircleTransposeConv *node);
+  void visit(luci::CircleUnpack *node);
+  void visit(luci::CircleAdd *node);
+  void visit(luci::CircleDiv *node);
+  void visit(luci::CircleEqual *node);
+  void visit(luci::CircleFloorDiv *node);
+  void visit(luci::CircleGreater *node);
+  void visit(luci::CircleGreaterEqual *node);
+  void visit(luci::CircleLess *node);
+  void visit(luci::CircleLessEqual *node);
+  void visit(luci::CircleMaximum *node);
+  void visit(luci::CircleMinimum *node);
+  void visit(luci::CircleMul *node);
+  void visit(luci::CircleNotEqual *node);
+  void visit(luci::CirclePow *node);
+  void visit(luci::CircleSub *node);
+  void visit(luci::CircleAddN *node);
+  void visit(luci::CircleConcatenation *node);
+  void visit(luci::CirclePack *node);
+};
+
+} // namespace luci
+
+#endif // __LUCI_INSERT_QUANTIZE_OP_H__
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InsertQuantizeOp.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+
+void set_qparam(luci::CircleNode *node, loco::DataType dtype, float scale, int64_t zerop)
+{
+  node->dtype(dtype);
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  qparam->scale.push_back(scale);
+  qparam->zerop.push_back(zerop);
+  node->quantparam(std::move(qparam));
+}
+
+/**
+ *     [input]
+ *      /   \
+ *  [relu]  [neg]
+ */
+class InsertQuantizeOpTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _input = _g.nodes()->create<luci::CircleInput>();
+    _input->name("input");
+    // Values in [-128, 127]
+    set_qparam(_input, loco::DataType::U8, 1.0f, 128);
+
+    _relu = _g.nodes()->create<luci::CircleRelu>();
+    _relu->features(_input);
+    _relu->name("relu");
+
+    _neg = _g.nodes()->create<luci::CircleNeg>();
+    _neg->x(_input);
+    _neg->name("neg");
+  }
+
+protected:
+  loco::Graph _g;
+  luci::CircleInput *_input = nullptr;
+  luci::CircleRelu *_relu = nullptr;
+  luci::CircleNeg *_neg = nullptr;
+  luci::InsertQuantizeOp::QuantizeOps _quantize_ops;
+};
+
+} // namespace
+
+TEST_F(InsertQuantizeOpTest, u8_to_s16)
+{
+  luci::InsertQuantizeOp iq(loco::DataType::S16, _quantize_ops);
+  _relu->accept(&iq);
+
+  auto quantize = dynamic_cast<luci::CircleQuantize *>(_relu->features());
+  ASSERT_NE(nullptr, quantize);
+  EXPECT_EQ(_input, quantize->input());
+  EXPECT_EQ(loco::DataType::S16, quantize->dtype());
+  EXPECT_EQ("input_Quantize", quantize->name());
+
+  // Symmetric range which covers that of input
+  auto qparam = quantize->quantparam();
+  ASSERT_NE(nullptr, qparam);
+  EXPECT_FLOAT_EQ(128.0f / 32767, qparam->scale[0]);
+  EXPECT_EQ(0, qparam->zerop[0]);
+}
+
+TEST_F(InsertQuantizeOpTest, s16_to_u8)
+{
+  // Values in [-2, 2]
+  set_qparam(_input, loco::DataType::S16, 2.0f / 32767, 0);
+
+  luci::InsertQuantizeOp iq(loco::DataType::U8, _quantize_ops);
+  _relu->accept(&iq);
+
+  auto quantize = dynamic_cast<luci::CircleQuantize *>(_relu->features());
+  ASSERT_NE(nullptr, quantize);
+  EXPECT_EQ(loco::DataType::U8, quantize->dtype());
+
+  auto qparam = quantize->quantparam();
+  ASSERT_NE(nullptr, qparam);
+  EXPECT_NEAR(4.0f / 255, qparam->scale[0], 1e-6);
+  EXPECT_LE((0 - qparam->zerop[0]) * qparam->scale[0], -2.0f + 1e-2);
+  EXPECT_GE((255 - qparam->zerop[0]) * qparam->scale[0], 2.0f - 1e-2);
+}
+
+TEST_F(InsertQuantizeOpTest, shared_by_users)
+{
+  luci::InsertQuantizeOp iq(loco::DataType::S16, _quantize_ops);
+  _relu->accept(&iq);
+  _neg->accept(&iq);
+
+  ASSERT_EQ(1, _quantize_ops.size());
+  EXPECT_NE(_input, _relu->features());
+  EXPECT_EQ(_relu->features(), _neg->x());
+}
+
+TEST_F(InsertQuantizeOpTest, same_dtype)
+{
+  luci::InsertQuantizeOp iq(loco::DataType::U8, _quantize_ops);
+  _relu->accept(&iq);
+
+  EXPECT_EQ(_input, _relu->features());
+  EXPECT_TRUE(_quantize_ops.empty());
+}
+
+TEST_F(InsertQuantizeOpTest, const_input)
+{
+  auto weights = _g.nodes()->create<luci::CircleConst>();
+  set_qparam(weights, loco::DataType::U8, 1.0f, 128);
+  _neg->x(weights);
+
+  luci::InsertQuantizeOp iq(loco::DataType::S16, _quantize_ops);
+  _neg->accept(&iq);
+
+  // Weights are quantized with the layer, not by Quantize Op
+  EXPECT_EQ(weights, _neg->x());
+  EXPECT_TRUE(_quantize_ops.empty());
+}
+
+TEST_F(InsertQuantizeOpTest, unsupported_op_NEG)
+{
+  auto cos = _g.nodes()->create<luci::CircleCos>();
+  cos->x(_input);
+  cos->name("cos");
+
+  luci::InsertQuantizeOp iq(loco::DataType::S16, _quantize_ops);
+  EXPECT_THROW(cos->accept(&iq), std::runtime_error);
+}
@@ -18,8 +18,12 @@
 
 #include <luci/Log.h>
 
+#include <pepper/threadpool.h>
+
 #include <iostream>
 #include <cmath>
+#include <string>
+#include <vector>
 
 namespace luci
 {
@@ -33,6 +37,72 @@ bool is_quantized(const CircleNode *node)
           node->dtype() == loco::DataType::S64);  // bias (int16 quant)
 }
 
+namespace
+{
+
+// Return true if node has no layer of its own, but shares that of its first input
+bool follows_input_layer(const CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case CircleOpcode::CIRCLEOUTPUT:
+    case CircleOpcode::CIRCLEBIDIRECTIONAL_SEQUENCE_LSTM_OUT:
+    case CircleOpcode::CIRCLECUSTOMOUT:
+    case CircleOpcode::CIRCLEIFOUT:
+    case CircleOpcode::CIRCLENONMAXSUPPRESSIONV4OUT:
+    case CircleOpcode::CIRCLENONMAXSUPPRESSIONV5OUT:
+    case CircleOpcode::CIRCLESPLITOUT:
+    case CircleOpcode::CIRCLESPLITVOUT:
+    case CircleOpcode::CIRCLETOPKV2OUT:
+    case CircleOpcode::CIRCLEUNIQUEOUT:
+    case CircleOpcode::CIRCLEUNPACKOUT:
+    case CircleOpcode::CIRCLEWHILEOUT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Warnings of the job running on this thread in parallel_for_each, nullptr out of the jobs
+thread_local std::vector<std::string> *job_warnings = nullptr;
+
+// Set job_warnings while a job of parallel_for_each runs
+class JobWarningsScope final
+{
+public:
+  JobWarningsScope(std::vector<std::string> *warnings) { job_warnings = warnings; }
+  ~JobWarningsScope() { job_warnings = nullptr; }
+};
+
+// NOTE luci logger is not thread-safe, so warnings of jobs running on other threads are kept
+//      to be logged by the thread calling parallel_for_each
+void warn(const char *message)
+{
+  if (job_warnings != nullptr)
+  {
+    job_warnings->emplace_back(message);
+    return;
+  }
+
+  LOGGER(l);
+  WARN(l) << message << std::endl;
+}
+
+} // namespace
+
+loco::DataType layer_dtype(const CircleNode *node, const LayerDTypes &layer_dtypes,
+                           loco::DataType default_dtype)
+{
+  if (layer_dtypes.empty())
+    return default_dtype;
+
+  while (follows_input_layer(node))
+    node = loco::must_cast<const CircleNode *>(node->arg(0));
+
+  auto it = layer_dtypes.find(node->name());
+  return it != layer_dtypes.end() ? it->second : default_dtype;
+}
+
 // Check if node is weights of conv2d, depthwise_conv2d, or fully_connected layer
 bool is_weights(CircleNode *node)
 {
@@ -168,8 +238,6 @@ void compute_sym_scale_zp(float min, float max, float &scaling_factor, int64_t &
 void compute_asym_scale_zp(float min, float max, float &scaling_factor, int64_t &zp,
                            float &nudged_min, float &nudged_max)
 {
-  LOGGER(l);
-
   assert(min <= max);
   const int32_t kMinScale = 0;
   const int32_t kMaxScale = 255;
@@ -183,7 +251,7 @@ void compute_asym_scale_zp(float min, float max, float &scaling_factor, int64_t
   uint8_t nudged_zero_point = 0;
   if (scale == 0)
   {
-    WARN(l) << "The minimum and maximum values are the same." << std::endl;
+    warn("The minimum and maximum values are the same.");
     if (min >= 0 && max >= 0)
       zero_point_double = kMinScale;
     else
@@ -197,14 +265,14 @@ void compute_asym_scale_zp(float min, float max, float &scaling_factor, int64_t
     nudged_zero_point = kMinScale;
     scale = max / (qmax_double - qmin_double);
     if (min > 0 && max > 0)
-      WARN(l) << "The minimum and maximum values are all positive." << std::endl;
+      warn("The minimum and maximum values are all positive.");
   }
   else if (max < 0)
   {
     assert(min < 0 && max < 0);
     nudged_zero_point = kMaxScale;
     scale = -min / (qmax_double - qmin_double);
-    WARN(l) << "The minimum and maximum values are all negative." << std::endl;
+    warn("The minimum and maximum values are all negative.");
   }
   else
   {
@@ -302,6 +370,36 @@ bool get_channel_dim_index(CircleConst *node, loco::TensorShape &dimension,
   return false;
 }
 
+void parallel_for_each(uint32_t num_threads, uint32_t count,
+                       const std::function<void(uint32_t)> &func)
+{
+  if (num_threads == 1 || count < 2)
+  {
+    for (uint32_t i = 0; i < count; ++i)
+      func(i);
+    return;
+  }
+
+  std::vector<std::vector<std::string>> warnings(count);
+  {
+    pepper::ThreadPool pool(num_threads);
+    pool.parallel_for(count, 1, [&func, &warnings](int64_t begin, int64_t end) {
+      for (auto i = begin; i < end; ++i)
+      {
+        JobWarningsScope scope(&warnings[i]);
+        func(static_cast<uint32_t>(i));
+      }
+    });
+  }
+
+  // Log warnings of jobs on this thread, in the order of jobs as if they ran one by one
+  for (const auto &messages : warnings)
+  {
+    for (const auto &message : messages)
+      warn(message.c_str());
+  }
+}
+
 uint32_t cal_offset(loco::TensorShape &dimension, uint32_t *indices)
 {
   return indices[0] * dimension.dim(1).value() * dimension.dim(2).value() *
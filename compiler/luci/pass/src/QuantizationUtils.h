@@ -18,8 +18,12 @@
 #define __LUCI_QUANTIZATION_UTILS_H__
 
 #include <luci/IR/CircleNodes.h>
+#include <luci/Pass/QuantizationParameters.h>
 #include <loco/IR/TensorShape.h>
 
+#include <cassert>
+#include <functional>
+
 namespace luci
 {
 
@@ -42,6 +46,61 @@ bool get_channel_dim_index(CircleConst *node, loco::TensorShape &dimension,
 
 uint32_t cal_offset(loco::TensorShape &dimension, uint32_t *indices);
 
+/**
+ * @brief Return elements of node as an array to write, nullptr if node is empty
+ * @note  This copies elements which refer to the model file, so loops which only read
+ *        should use the const overload
+ */
+template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type *data_of(CircleConst *node)
+{
+  return node->size<DT>() > 0 ? &node->at<DT>(0) : nullptr;
+}
+
+/**
+ * @brief Return elements of node as an array to read, nullptr if node is empty
+ */
+template <loco::DataType DT>
+const typename loco::DataTypeImpl<DT>::Type *data_of(const CircleConst *node)
+{
+  return node->size<DT>() > 0 ? &node->at<DT>(0) : nullptr;
+}
+
+/**
+ * @brief Call func(begin, end, channel) for each run of consecutive elements of node
+ *        which belong to the same channel, in the order of elements
+ * @note  Per-channel values are fixed in each run, so loops over a run can be vectorized
+ */
+template <typename Func>
+void iterate_per_channel(CircleConst *node, int32_t &channel_dim_index, Func func)
+{
+  loco::TensorShape dimension;
+  dimension.rank(4);
+
+  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  {
+    assert(false);
+    return;
+  }
+
+  uint32_t outer = 1;
+  uint32_t inner = 1;
+  for (int32_t i = 0; i < channel_dim_index; ++i)
+    outer *= dimension.dim(i).value();
+  for (int32_t i = channel_dim_index + 1; i < 4; ++i)
+    inner *= dimension.dim(i).value();
+  const uint32_t channels = dimension.dim(channel_dim_index).value();
+
+  uint32_t offset = 0;
+  for (uint32_t o = 0; o < outer; ++o)
+  {
+    for (uint32_t channel = 0; channel < channels; ++channel)
+    {
+      func(offset, offset + inner, channel);
+      offset += inner;
+    }
+  }
+}
+
 void propagate_concat_quantparam(luci::CircleConcatenation *concat, loco::DataType quant_type);
 
 void propagate_pad_v2_quantparam(luci::CirclePadV2 *pad_v2, loco::DataType quant_type);
@@ -50,6 +109,22 @@ bool is_weights(CircleNode *node);
 
 bool is_quantized(const CircleNode *node);
 
+/**
+ * @brief Return quantized data type of the layer node belongs to, default_dtype if not given
+ * @note  Virtual output nodes (e.g. CircleSplitOut) and CircleOutput belong to their input
+ */
+loco::DataType layer_dtype(const CircleNode *node, const LayerDTypes &layer_dtypes,
+                           loco::DataType default_dtype);
+
+/**
+ * @brief Call func(i) for each i in [0, count) on num_threads threads
+ * @note  num_threads 0 means the number of hardware threads
+ * @note  func must not log by itself. Warnings of compute_asym_scale_zp in func are logged
+ *        after all calls, on the calling thread.
+ */
+void parallel_for_each(uint32_t num_threads, uint32_t count,
+                       const std::function<void(uint32_t)> &func);
+
 } // namespace luci
 
 #endif // __LUCI_QUANTIZATION_UTILS_H__
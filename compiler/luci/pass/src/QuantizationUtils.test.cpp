@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantizationUtils.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+TEST(QuantizationUtilsTest, iterate_per_channel_dwconv)
+{
+  loco::Graph g;
+
+  auto filter = g.nodes()->create<luci::CircleConst>();
+  filter->dtype(loco::DataType::FLOAT32);
+  filter->shape({1, 2, 2, 3});
+  filter->size<loco::DataType::FLOAT32>(12);
+
+  auto dwconv = g.nodes()->create<luci::CircleDepthwiseConv2D>();
+  dwconv->filter(filter);
+
+  // IHWC: channels are the innermost dimension
+  std::vector<uint32_t> channels(12, 100);
+  int32_t channel_dim_index = -1;
+  luci::iterate_per_channel(filter, channel_dim_index,
+                            [&](uint32_t begin, uint32_t end, uint32_t channel) {
+                              for (uint32_t i = begin; i < end; ++i)
+                                channels[i] = channel;
+                            });
+
+  ASSERT_EQ(3, channel_dim_index);
+  for (uint32_t i = 0; i < 12; ++i)
+    ASSERT_EQ(i % 3, channels[i]);
+}
+
+TEST(QuantizationUtilsTest, parallel_for_each)
+{
+  for (uint32_t num_threads : {0, 1, 4})
+  {
+    std::vector<std::atomic<uint32_t>> visits(100);
+    for (auto &visit : visits)
+      visit = 0;
+
+    luci::parallel_for_each(num_threads, 100, [&](uint32_t i) { visits[i]++; });
+
+    for (auto &visit : visits)
+      ASSERT_EQ(1, visit.load());
+  }
+}
+
+TEST(QuantizationUtilsTest, parallel_for_each_empty)
+{
+  uint32_t calls = 0;
+  luci::parallel_for_each(4, 0, [&](uint32_t) { calls++; });
+  ASSERT_EQ(0, calls);
+}
@@ -22,47 +22,12 @@
 #include <luci/Log.h>
 #include <loco/IR/TensorShape.h>
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <functional>
-
-namespace
-{
-
-using namespace luci;
-using IterFunc = std::function<void(uint32_t *, loco::TensorShape &, int32_t)>;
-
-void iterate_per_channel(CircleConst *node, IterFunc func)
-{
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-  int32_t channel_dim_index{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          func(indices, dimension, channel_dim_index);
-        }
-      }
-    }
-  }
-}
-
-} // namespace
+#include <limits>
+#include <map>
 
 namespace luci
 {
@@ -87,23 +52,30 @@ void cal_minmax_per_channel(CircleConst *node, std::vector<float> &min, std::vec
   min.resize(size);
   max.resize(size);
 
-  auto cal_minmax = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-    if (has_min_max_value[channel_idx])
+  const float *data = data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(node));
+
+  auto cal_minmax = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    if (begin == end)
+      return;
+    if (!has_min_max_value[channel])
     {
-      min[channel_idx] = data < min[channel_idx] ? data : min[channel_idx];
-      max[channel_idx] = data > max[channel_idx] ? data : max[channel_idx];
+      min[channel] = data[begin];
+      max[channel] = data[begin];
+      has_min_max_value[channel] = true;
+      ++begin;
     }
-    else
+    float channel_min = min[channel];
+    float channel_max = max[channel];
+    for (uint32_t i = begin; i < end; ++i)
     {
-      min[channel_idx] = data;
-      max[channel_idx] = data;
-      has_min_max_value[channel_idx] = true;
+      channel_min = data[i] < channel_min ? data[i] : channel_min;
+      channel_max = data[i] > channel_max ? data[i] : channel_max;
     }
+    min[channel] = channel_min;
+    max[channel] = channel_max;
   };
 
-  iterate_per_channel(node, cal_minmax);
+  iterate_per_channel(node, channel_dim_index, cal_minmax);
 }
 
 void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vector<float> &max,
@@ -122,24 +94,30 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vec
     compute_sym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
   }
 
-  auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-    data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
-    data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
-    quantized_values[cal_offset(dimension, indices)] =
-      static_cast<int32_t>(std::round(data * scaling_factor_inv));
+  const float *data = data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(node));
+
+  auto quantize = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    const float scaling_factor_inv = 1.0 / scaling_factor[channel];
+    const float channel_min = nudged_min[channel];
+    const float channel_max = nudged_max[channel];
+    for (uint32_t i = begin; i < end; ++i)
+    {
+      auto value = data[i];
+      value = value < channel_min ? channel_min : value;
+      value = value > channel_max ? channel_max : value;
+      quantized_values[i] = static_cast<int32_t>(std::round(value * scaling_factor_inv));
+    }
   };
 
-  iterate_per_channel(node, quantize);
+  int32_t channel_dim_index{0};
+  iterate_per_channel(node, channel_dim_index, quantize);
 
   node->dtype(loco::DataType::S16);      // change the type of tensor
   node->size<loco::DataType::S16>(size); // resize tensor
+  int16_t *output = data_of<loco::DataType::S16>(node);
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    output[i] = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
@@ -149,21 +127,21 @@ void sym_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_fac
   uint32_t size = node->size<loco::DataType::S16>();
   std::vector<float> dequantized_values(size);
 
-  auto dequantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    auto data = node->at<loco::DataType::S16>(cal_offset(dimension, indices));
-    dequantized_values[cal_offset(dimension, indices)] =
-      static_cast<float>(data) * scaling_factor[channel_idx];
+  const int16_t *data = data_of<loco::DataType::S16>(static_cast<const CircleConst *>(node));
+
+  auto dequantize = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    const float channel_scale = scaling_factor[channel];
+    for (uint32_t i = begin; i < end; ++i)
+      dequantized_values[i] = static_cast<float>(data[i]) * channel_scale;
   };
 
-  iterate_per_channel(node, dequantize);
+  int32_t channel_dim_index{0};
+  iterate_per_channel(node, channel_dim_index, dequantize);
 
   node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
   node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
-  }
+  std::copy(dequantized_values.begin(), dequantized_values.end(),
+            data_of<loco::DataType::FLOAT32>(node));
 }
 
 void asymmetric_wquant_per_channel(CircleConst *node, std::vector<float> &min,
@@ -184,23 +162,31 @@ void asymmetric_wquant_per_channel(CircleConst *node, std::vector<float> &min,
     compute_asym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
   }
 
-  auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-    data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
-    data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
-    quantized_values[cal_offset(dimension, indices)] =
-      static_cast<int32_t>(std::round((data - nudged_min[channel_idx]) * scaling_factor_inv));
+  const float *data = data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(node));
+
+  auto quantize = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    const float scaling_factor_inv = 1.0 / scaling_factor[channel];
+    const float channel_min = nudged_min[channel];
+    const float channel_max = nudged_max[channel];
+    for (uint32_t i = begin; i < end; ++i)
+    {
+      auto value = data[i];
+      value = value < channel_min ? channel_min : value;
+      value = value > channel_max ? channel_max : value;
+      quantized_values[i] =
+        static_cast<int32_t>(std::round((value - channel_min) * scaling_factor_inv));
+    }
   };
 
-  iterate_per_channel(node, quantize);
+  int32_t channel_dim_index{0};
+  iterate_per_channel(node, channel_dim_index, quantize);
 
   node->dtype(loco::DataType::U8);      // change the type of tensor
   node->size<loco::DataType::U8>(size); // resize tensor
+  uint8_t *output = data_of<loco::DataType::U8>(node);
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    output[i] = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
@@ -211,21 +197,22 @@ void asymmetric_wdequant_per_channel(CircleConst *node, std::vector<float> &scal
   uint32_t size = node->size<loco::DataType::U8>();
   std::vector<float> dequantized_values(size);
 
-  auto dequantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    auto data = node->at<loco::DataType::U8>(cal_offset(dimension, indices));
-    dequantized_values[cal_offset(dimension, indices)] =
-      static_cast<float>(data) * scaling_factor[channel_idx] + nudged_min[channel_idx];
+  const uint8_t *data = data_of<loco::DataType::U8>(static_cast<const CircleConst *>(node));
+
+  auto dequantize = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    const float channel_scale = scaling_factor[channel];
+    const float channel_min = nudged_min[channel];
+    for (uint32_t i = begin; i < end; ++i)
+      dequantized_values[i] = static_cast<float>(data[i]) * channel_scale + channel_min;
   };
 
-  iterate_per_channel(node, dequantize);
+  int32_t channel_dim_index{0};
+  iterate_per_channel(node, channel_dim_index, dequantize);
 
   node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
   node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
-  }
+  std::copy(dequantized_values.begin(), dequantized_values.end(),
+            data_of<loco::DataType::FLOAT32>(node));
 }
 
 void asymmetric_wdequant_with_minmax_per_layer(CircleConst *node, float scaling_factor,
@@ -247,26 +234,96 @@ void asymmetric_wdequant_with_minmax_per_layer(CircleConst *node, float scaling_
   }
 }
 
+// Quantize and dequantize weights, and set the quantization parameters used
+void quant_dequant_weights(CircleConst *circle_const, loco::DataType output_type,
+                           QuantizationGranularity granularity)
+{
+  // Find min/max per channel-wise
+  if (granularity == QuantizationGranularity::ChannelWise)
+  {
+    std::vector<float> min;
+    std::vector<float> max;
+
+    cal_minmax_per_channel(circle_const, min, max);
+
+    std::vector<float> nudged_min(min.size());
+    std::vector<float> nudged_max(min.size());
+    std::vector<float> scaling_factor(min.size());
+    std::vector<int64_t> zp(min.size());
+
+    if (output_type == loco::DataType::U8)
+    {
+      asymmetric_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
+                                    nudged_max);
+      asymmetric_wdequant_per_channel(circle_const, scaling_factor, nudged_min);
+    }
+    else
+    {
+      sym_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min, nudged_max);
+      sym_wdequant_per_channel(circle_const, scaling_factor);
+    }
+
+    auto quantparam = std::make_unique<CircleQuantParam>();
+    quantparam->min = nudged_min;
+    quantparam->max = nudged_max;
+    quantparam->scale = scaling_factor;
+    quantparam->zerop = zp;
+    circle_const->quantparam(std::move(quantparam));
+  }
+  // Find min/max per layer-wise
+  else
+  {
+    float min = std::numeric_limits<float>::max();
+    float max = std::numeric_limits<float>::lowest();
+    const uint32_t size = circle_const->size<loco::DataType::FLOAT32>();
+    const float *data =
+      data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(circle_const));
+    for (uint32_t i = 0; i < size; i++)
+    {
+      min = data[i] < min ? data[i] : min;
+      max = data[i] > max ? data[i] : max;
+    }
+    float scaling_factor{0};
+    int64_t zp{0};
+    float nudged_min{0};
+    float nudged_max{0};
+
+    asymmetric_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
+                                            nudged_min, nudged_max);
+    asymmetric_wdequant_with_minmax_per_layer(circle_const, scaling_factor, nudged_min);
+    auto quantparam = std::make_unique<CircleQuantParam>();
+    quantparam->min.push_back(nudged_min);
+    quantparam->max.push_back(nudged_max);
+    quantparam->scale.push_back(scaling_factor);
+    quantparam->zerop.push_back(zp);
+    circle_const->quantparam(std::move(quantparam));
+  }
+}
+
 /**
- * @brief QuantizeDequantizeWeights quantizes and dequantizes tensors for weights
- * @details Find min/max values on the fly, quantize the model, and dequantize the model
+ * @brief QuantizeDequantizeWeights finds weights to quantize and dequantize
+ * @details Weights are collected in the order to process, as many times as they are visited,
+ *          with the data type of the layer using them
  */
 struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
 {
   QuantizeDequantizeWeights(loco::DataType input, loco::DataType output,
-                            QuantizationGranularity granularity)
-    : input_type(input), output_type(output), granularity(granularity)
+                            const LayerDTypes &layer_dtypes,
+                            std::vector<std::pair<CircleConst *, loco::DataType>> &weights)
+    : input_type(input), output_type(output), layer_dtypes(layer_dtypes), weights(weights)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
-  QuantizationGranularity granularity;
+  const LayerDTypes &layer_dtypes;
+  std::vector<std::pair<CircleConst *, loco::DataType>> &weights;
 
-  // Quantize and dequantize input tensors of each node
+  // Collect input tensors of each node to quantize and dequantize
   bool visit(luci::CircleNode *node)
   {
-    assert(output_type == loco::DataType::U8 || output_type == loco::DataType::S16);
+    auto quant_type = layer_dtype(node, layer_dtypes, output_type);
+    assert(quant_type == loco::DataType::U8 || quant_type == loco::DataType::S16);
     LOGGER(l);
     INFO(l) << "QuantizeDequantizeWeights visit node: " << node->name() << std::endl;
     auto arity = node->arity();
@@ -279,70 +336,10 @@ struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<b
       if (is_quantized(circle_node))
         continue;
 
+      // NOTE Weights stay in FLOAT32 after dequantization, so weights used by multiple nodes
+      //      are quantized and dequantized again for each of them
       if (is_weights(circle_node))
-      {
-        auto circle_const = loco::must_cast<luci::CircleConst *>(circle_node);
-
-        // Find min/max per channel-wise
-        if (granularity == QuantizationGranularity::ChannelWise)
-        {
-          std::vector<float> min;
-          std::vector<float> max;
-
-          cal_minmax_per_channel(circle_const, min, max);
-
-          std::vector<float> nudged_min(min.size());
-          std::vector<float> nudged_max(min.size());
-          std::vector<float> scaling_factor(min.size());
-          std::vector<int64_t> zp(min.size());
-
-          if (output_type == loco::DataType::U8)
-          {
-            asymmetric_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
-                                          nudged_max);
-            asymmetric_wdequant_per_channel(circle_const, scaling_factor, nudged_min);
-          }
-          else
-          {
-            sym_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
-                                   nudged_max);
-            sym_wdequant_per_channel(circle_const, scaling_factor);
-          }
-
-          auto quantparam = std::make_unique<CircleQuantParam>();
-          quantparam->min = nudged_min;
-          quantparam->max = nudged_max;
-          quantparam->scale = scaling_factor;
-          quantparam->zerop = zp;
-          circle_node->quantparam(std::move(quantparam));
-        }
-        // Find min/max per layer-wise
-        else
-        {
-          float min = std::numeric_limits<float>::max();
-          float max = std::numeric_limits<float>::lowest();
-          for (uint32_t i = 0; i < circle_const->size<loco::DataType::FLOAT32>(); i++)
-          {
-            auto data = circle_const->at<loco::DataType::FLOAT32>(i);
-            min = data < min ? data : min;
-            max = data > max ? data : max;
-          }
-          float scaling_factor{0};
-          int64_t zp{0};
-          float nudged_min{0};
-          float nudged_max{0};
-
-          asymmetric_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
-                                                  nudged_min, nudged_max);
-          asymmetric_wdequant_with_minmax_per_layer(circle_const, scaling_factor, nudged_min);
-          auto quantparam = std::make_unique<CircleQuantParam>();
-          quantparam->min.push_back(nudged_min);
-          quantparam->max.push_back(nudged_max);
-          quantparam->scale.push_back(scaling_factor);
-          quantparam->zerop.push_back(zp);
-          circle_node->quantparam(std::move(quantparam));
-        }
-      }
+        weights.emplace_back(loco::must_cast<luci::CircleConst *>(circle_node), quant_type);
     }
     return false;
   }
@@ -355,14 +352,40 @@ bool QuantizeDequantizeWeightsPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeDequantizeWeightsPass Start" << std::endl;
 
-  // Quantize weights
+  // Find weights
+  std::vector<std::pair<CircleConst *, loco::DataType>> weights;
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeDequantizeWeights qw(_input_dtype, _output_dtype, _granularity);
+    QuantizeDequantizeWeights qw(_input_dtype, _output_dtype, _layer_dtypes, weights);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qw);
   }
 
+  // Quantize weights, each of which is independent of others
+  std::vector<std::pair<CircleConst *, std::vector<loco::DataType> /* in order */>> jobs;
+  std::map<CircleConst *, size_t> job_index;
+  for (auto &w : weights)
+  {
+    auto it = job_index.find(w.first);
+    if (it == job_index.end())
+    {
+      job_index.emplace(w.first, jobs.size());
+      jobs.emplace_back(w.first, std::vector<loco::DataType>{w.second});
+    }
+    else
+      jobs[it->second].second.push_back(w.second);
+  }
+  // Start with larger ones for a better balance between threads
+  std::stable_sort(jobs.begin(), jobs.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.first->template size<loco::DataType::FLOAT32>() >
+           rhs.first->template size<loco::DataType::FLOAT32>();
+  });
+
+  parallel_for_each(_num_threads, static_cast<uint32_t>(jobs.size()), [&](uint32_t i) {
+    for (auto quant_type : jobs[i].second)
+      quant_dequant_weights(jobs[i].first, quant_type, _granularity);
+  });
+
   INFO(l) << "QuantizeDequantizeWeightsPass End" << std::endl;
   return false; // one time run
 }
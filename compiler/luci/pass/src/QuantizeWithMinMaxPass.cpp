@@ -16,6 +16,7 @@
 
 #include "luci/Pass/QuantizeWithMinMaxPass.h"
 #include "QuantizationUtils.h"
+#include "InsertQuantizeOp.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeVisitor.h>
@@ -24,46 +25,11 @@
 
 #include <oops/UserExn.h>
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <functional>
-
-namespace
-{
-
-using namespace luci;
-using IterFunc = std::function<void(uint32_t *, loco::TensorShape &, int32_t)>;
-
-void iterate_per_channel(CircleConst *node, int32_t &channel_dim_index, IterFunc func)
-{
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          func(indices, dimension, channel_dim_index);
-        }
-      }
-    }
-  }
-}
-
-} // namespace
+#include <limits>
 
 namespace luci
 {
@@ -439,22 +405,22 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_facto
   uint32_t size = node->size<loco::DataType::FLOAT32>();
   std::vector<int32_t> quantized_values(size);
 
-  auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int32_t channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-    quantized_values[cal_offset(dimension, indices)] =
-      static_cast<int32_t>(std::round(data * scaling_factor_inv));
+  const float *data = data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(node));
+
+  auto quantize = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    const float scaling_factor_inv = 1.0 / scaling_factor[channel];
+    for (uint32_t i = begin; i < end; ++i)
+      quantized_values[i] = static_cast<int32_t>(std::round(data[i] * scaling_factor_inv));
   };
 
   iterate_per_channel(node, channel_dim_index, quantize);
 
   node->dtype(loco::DataType::S16);      // change the type of tensor
   node->size<loco::DataType::S16>(size); // resize tensor
+  int16_t *output = data_of<loco::DataType::S16>(node);
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    output[i] = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
@@ -469,21 +435,24 @@ void asym_wquant_per_channel(CircleConst *node, std::vector<float> &min,
   uint32_t size = node->size<loco::DataType::FLOAT32>();
   std::vector<int32_t> quantized_values(size);
 
-  auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int32_t channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-    quantized_values[cal_offset(dimension, indices)] =
-      static_cast<int32_t>(std::round((data - min[channel_idx]) * scaling_factor_inv));
+  const float *data = data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(node));
+
+  auto quantize = [&](uint32_t begin, uint32_t end, uint32_t channel) {
+    const float scaling_factor_inv = 1.0 / scaling_factor[channel];
+    const float channel_min = min[channel];
+    for (uint32_t i = begin; i < end; ++i)
+      quantized_values[i] =
+        static_cast<int32_t>(std::round((data[i] - channel_min) * scaling_factor_inv));
   };
 
   iterate_per_channel(node, channel_dim_index, quantize);
 
   node->dtype(loco::DataType::U8);      // change the type of tensor
   node->size<loco::DataType::U8>(size); // resize tensor
+  uint8_t *output = data_of<loco::DataType::U8>(node);
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    output[i] = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
@@ -496,17 +465,18 @@ void asym_wquant_per_layer(CircleConst *node, float min, float scaling_factor)
 
   const float scaling_factor_inv = 1.0 / scaling_factor;
   std::vector<int32_t> quantized_values(size);
+  const float *data = data_of<loco::DataType::FLOAT32>(static_cast<const CircleConst *>(node));
   for (uint32_t i = 0; i < size; ++i)
   {
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    quantized_values[i] = static_cast<int32_t>(std::round((data - min) * scaling_factor_inv));
+    quantized_values[i] = static_cast<int32_t>(std::round((data[i] - min) * scaling_factor_inv));
   }
 
   node->dtype(loco::DataType::U8);      // change the type of tensor
   node->size<loco::DataType::U8>(size); // resize tensor
+  uint8_t *output = data_of<loco::DataType::U8>(node);
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    output[i] = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
@@ -531,13 +501,14 @@ void set_bias(luci::CircleNode *node, luci::CircleConst *bias)
  */
 struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeActivation(loco::DataType input, loco::DataType output)
-    : input_type(input), output_type(output)
+  QuantizeActivation(loco::DataType input, loco::DataType output, const LayerDTypes &layer_dtypes)
+    : input_type(input), output_type(output), layer_dtypes(layer_dtypes)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
+  const LayerDTypes &layer_dtypes;
 
   // Quantize input tensors of each node
   bool visit(luci::CircleNode *node)
@@ -586,7 +557,7 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
         float nudged_min{0};
         float nudged_max{0};
 
-        if (output_type == loco::DataType::U8)
+        if (layer_dtype(circle_node, layer_dtypes, output_type) == loco::DataType::U8)
         {
           compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
           circle_node->dtype(loco::DataType::U8);
@@ -620,14 +591,16 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 
 struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeBias(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-    : input_type(input), output_type(output), granularity(gr)
+  QuantizeBias(loco::DataType input, loco::DataType output, QuantizationGranularity gr,
+               const LayerDTypes &layer_dtypes)
+    : input_type(input), output_type(output), granularity(gr), layer_dtypes(layer_dtypes)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
   QuantizationGranularity granularity;
+  const LayerDTypes &layer_dtypes;
 
   // Quantize bias node
   bool visit(luci::CircleNode *node)
@@ -649,6 +622,8 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
       auto const_bias = loco::must_cast<luci::CircleConst *>(node);
       assert(const_bias->dtype() == loco::DataType::FLOAT32);
 
+      auto quant_type = layer_dtype(output, layer_dtypes, output_type);
+
       CircleConst *new_bias = nullptr;
 
       if (granularity == QuantizationGranularity::ChannelWise)
@@ -664,12 +639,12 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
         std::vector<float> scaling_factor(size);
         std::vector<int64_t> zp(size);
 
-        if (output_type == loco::DataType::U8)
+        if (quant_type == loco::DataType::U8)
         {
           new_bias =
             quant_bias_per_channel(const_bias, input_scale, weight_scale, scaling_factor, zp);
         }
-        else if (output_type == loco::DataType::S16)
+        else if (quant_type == loco::DataType::S16)
         {
           new_bias =
             int16_quant_bias_per_channel(const_bias, input_scale, weight_scale, scaling_factor, zp);
@@ -713,65 +688,76 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
 };
 
 /**
- * @brief QuantizeWeights quantizes tensors for weights
- * @details Find min/max values on the fly and then quantize
+ * @brief Quantize weights using min/max recorded in quantparam
  */
-struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
+void quantize_weights(luci::CircleConst *weights, loco::DataType output_type,
+                      QuantizationGranularity granularity)
 {
-  QuantizeWeights(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-    : input_type(input), output_type(output), granularity(gr)
+  // Find min/max per channel-wise
+  if (granularity == QuantizationGranularity::ChannelWise)
   {
-  }
-
-  loco::DataType input_type;
-  loco::DataType output_type;
-  QuantizationGranularity granularity;
-
-private:
-  void quantize_weights(luci::CircleConst *weights)
-  {
-    // Find min/max per channel-wise
-    if (granularity == QuantizationGranularity::ChannelWise)
+    auto quantparam = weights->quantparam();
+    if (quantparam == nullptr)
     {
-      auto quantparam = weights->quantparam();
-      if (quantparam == nullptr)
-      {
-        assert(false && "quantparam is nullptr");
-        return;
-      }
+      assert(false && "quantparam is nullptr");
+      return;
+    }
 
-      auto min = quantparam->min;
-      auto scaling_factor = quantparam->scale;
-      int32_t channel_dim_index = 0;
+    auto min = quantparam->min;
+    auto scaling_factor = quantparam->scale;
+    int32_t channel_dim_index = 0;
 
-      if (output_type == loco::DataType::U8)
-      {
-        asym_wquant_per_channel(weights, min, scaling_factor, channel_dim_index);
-      }
-      else
-      {
-        sym_wquant_per_channel(weights, scaling_factor, channel_dim_index);
-      }
-      quantparam->min.clear();
-      quantparam->max.clear();
-      quantparam->quantized_dimension = channel_dim_index;
+    if (output_type == loco::DataType::U8)
+    {
+      asym_wquant_per_channel(weights, min, scaling_factor, channel_dim_index);
     }
-    // Find min/max per layer-wise
     else
     {
-      // Quantize using recorded quantparam
-      auto quantparam = weights->quantparam();
-      assert(quantparam != nullptr);
-      assert(quantparam->min.size() == 1);   // only support layer-wise quant
-      assert(quantparam->scale.size() == 1); // only support layer-wise quant
-      auto min = quantparam->min[0];
-      auto scaling_factor = quantparam->scale[0];
-      asym_wquant_per_layer(weights, min, scaling_factor);
-      quantparam->min.clear();
-      quantparam->max.clear();
+      sym_wquant_per_channel(weights, scaling_factor, channel_dim_index);
     }
+    quantparam->min.clear();
+    quantparam->max.clear();
+    quantparam->quantized_dimension = channel_dim_index;
+  }
+  // Find min/max per layer-wise
+  else
+  {
+    // Quantize using recorded quantparam
+    auto quantparam = weights->quantparam();
+    assert(quantparam != nullptr);
+    assert(quantparam->min.size() == 1);   // only support layer-wise quant
+    assert(quantparam->scale.size() == 1); // only support layer-wise quant
+    auto min = quantparam->min[0];
+    auto scaling_factor = quantparam->scale[0];
+    asym_wquant_per_layer(weights, min, scaling_factor);
+    quantparam->min.clear();
+    quantparam->max.clear();
+  }
+}
+
+/**
+ * @brief QuantizeWeights quantizes tensors for weights
+ * @details Weights of Conv2D, DepthwiseConv2D, TransposeConv and FullyConnected are cloned here
+ *          and collected with the data type of their layer to be quantized later, which is
+ *          independent of others
+ */
+struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
+{
+  QuantizeWeights(loco::DataType input, loco::DataType output, QuantizationGranularity gr,
+                  const LayerDTypes &layer_dtypes,
+                  std::vector<std::pair<luci::CircleConst *, loco::DataType>> &weights)
+    : input_type(input), output_type(output), granularity(gr), layer_dtypes(layer_dtypes),
+      weights_to_quantize(weights)
+  {
   }
 
+  loco::DataType input_type;
+  loco::DataType output_type;
+  QuantizationGranularity granularity;
+  const LayerDTypes &layer_dtypes;
+  std::vector<std::pair<luci::CircleConst *, loco::DataType>> &weights_to_quantize;
+
+private:
   bool visit(luci::CircleConv2D *node)
   {
     LOGGER(l);
@@ -782,7 +768,7 @@ private:
     {
       auto new_weights = luci::clone(weights);
       node->filter(new_weights);
-      quantize_weights(new_weights);
+      weights_to_quantize.emplace_back(new_weights, layer_dtype(node, layer_dtypes, output_type));
       return true;
     }
     return false;
@@ -798,7 +784,7 @@ private:
     {
       auto new_weights = luci::clone(weights);
       node->filter(new_weights);
-      quantize_weights(new_weights);
+      weights_to_quantize.emplace_back(new_weights, layer_dtype(node, layer_dtypes, output_type));
       return true;
     }
     return false;
@@ -811,6 +797,7 @@ private:
 
     auto gamma = loco::must_cast<luci::CircleConst *>(node->gamma());
     auto beta = loco::must_cast<luci::CircleConst *>(node->beta());
+    auto quant_type = layer_dtype(node, layer_dtypes, output_type);
 
     bool changed = false;
     if (!is_quantized(gamma))
@@ -818,9 +805,9 @@ private:
       assert(gamma->dtype() == loco::DataType::FLOAT32);
       auto new_gamma = luci::clone(gamma);
       if (granularity == QuantizationGranularity::LayerWise)
-        quant_const(new_gamma, output_type);
+        quant_const(new_gamma, quant_type);
       else if (granularity == QuantizationGranularity::ChannelWise)
-        quant_const_per_channel(new_gamma, output_type);
+        quant_const_per_channel(new_gamma, quant_type);
       node->gamma(new_gamma);
       changed = true;
     }
@@ -829,9 +816,9 @@ private:
       assert(beta->dtype() == loco::DataType::FLOAT32);
       auto new_beta = luci::clone(beta);
       if (granularity == QuantizationGranularity::LayerWise)
-        quant_const(new_beta, output_type);
+        quant_const(new_beta, quant_type);
       else if (granularity == QuantizationGranularity::ChannelWise)
-        quant_const_per_channel(new_beta, output_type);
+        quant_const_per_channel(new_beta, quant_type);
       node->beta(new_beta);
       changed = true;
     }
@@ -845,15 +832,16 @@ private:
     INFO(l) << "QuantizeWeights visit node: " << node->name() << std::endl;
 
     auto alpha = loco::must_cast<luci::CircleConst *>(node->alpha());
+    auto quant_type = layer_dtype(node, layer_dtypes, output_type);
 
     if (!is_quantized(alpha))
     {
       assert(alpha->dtype() == loco::DataType::FLOAT32);
       auto new_alpha = luci::clone(alpha);
       if (granularity == QuantizationGranularity::LayerWise)
-        quant_const(new_alpha, output_type);
+        quant_const(new_alpha, quant_type);
       else if (granularity == QuantizationGranularity::ChannelWise)
-        quant_const_per_channel(new_alpha, output_type);
+        quant_const_per_channel(new_alpha, quant_type);
       node->alpha(new_alpha);
       return true;
     }
@@ -871,7 +859,7 @@ private:
     {
       auto new_weights = luci::clone(weights);
       node->filter(new_weights);
-      quantize_weights(new_weights);
+      weights_to_quantize.emplace_back(new_weights, layer_dtype(node, layer_dtypes, output_type));
       return true;
     }
     return false;
@@ -887,7 +875,7 @@ private:
     {
       auto new_weights = luci::clone(weights);
       node->weights(new_weights);
-      quantize_weights(new_weights);
+      weights_to_quantize.emplace_back(new_weights, layer_dtype(node, layer_dtypes, output_type));
       return true;
     }
     return false;
@@ -1176,23 +1164,47 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   // Quantize activation
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeActivation qa(_input_dtype, _output_dtype);
+    QuantizeActivation qa(_input_dtype, _output_dtype, _layer_dtypes);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qa);
   }
 
+  // Insert Quantize Op where layers of different data types meet
+  if (not _layer_dtypes.empty())
+  {
+    InsertQuantizeOp::QuantizeOps quantize_ops;
+    for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    {
+      auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+      if (circle_node->opcode() == luci::CircleOpcode::QUANTIZE)
+        continue;
+
+      InsertQuantizeOp iq(layer_dtype(circle_node, _layer_dtypes, _output_dtype), quantize_ops);
+      circle_node->accept(&iq);
+    }
+  }
+
   // Quantize weights
+  std::vector<std::pair<luci::CircleConst *, loco::DataType>> weights;
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeWeights qw(_input_dtype, _output_dtype, _granularity);
+    QuantizeWeights qw(_input_dtype, _output_dtype, _granularity, _layer_dtypes, weights);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qw);
   }
+  // Start with larger ones for a better balance between threads
+  std::stable_sort(weights.begin(), weights.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.first->template size<loco::DataType::FLOAT32>() >
+           rhs.first->template size<loco::DataType::FLOAT32>();
+  });
+  parallel_for_each(_num_threads, static_cast<uint32_t>(weights.size()), [&](uint32_t i) {
+    quantize_weights(weights[i].first, weights[i].second, _granularity);
+  });
 
   // Quantize bias
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeBias qb(_input_dtype, _output_dtype, _granularity);
+    QuantizeBias qb(_input_dtype, _output_dtype, _granularity, _layer_dtypes);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qb);
   }
@@ -1209,14 +1221,14 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
     // (2) concat has no fused activation function
     // (3) the input is not concatenation Op
     // (4) the input is not produced to Ops other than concat
-    propagate_concat_quantparam(concat, _output_dtype);
+    propagate_concat_quantparam(concat, layer_dtype(concat, _layer_dtypes, _output_dtype));
   }
 
   // Quantize const inputs other than weights and bias
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    quantize_const_inputs(circle_node, _output_dtype);
+    quantize_const_inputs(circle_node, layer_dtype(circle_node, _layer_dtypes, _output_dtype));
   }
 
   // Update output dtype
@@ -1224,11 +1236,12 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   for (auto node : loco::output_nodes(g))
   {
     auto circle_node = loco::must_cast<luci::CircleOutput *>(node);
-    if (static_cast<luci::CircleNode *>(circle_node->from())->dtype() == _output_dtype)
+    auto quant_type = layer_dtype(circle_node, _layer_dtypes, _output_dtype);
+    if (static_cast<luci::CircleNode *>(circle_node->from())->dtype() == quant_type)
     {
-      circle_node->dtype(_output_dtype);
+      circle_node->dtype(quant_type);
       auto graph_output = graph_outputs->at(circle_node->index());
-      graph_output->dtype(_output_dtype);
+      graph_output->dtype(quant_type);
     }
   }
 
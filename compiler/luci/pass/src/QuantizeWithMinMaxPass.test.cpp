@@ -15,9 +15,206 @@
  */
 
 #include "luci/Pass/QuantizeWithMinMaxPass.h"
+#include "luci/Pass/QuantizeDequantizeWeightsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/test/TestIOGraph.h>
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+using namespace luci::test;
+
+void set_minmax(luci::CircleNode *node, float min, float max)
+{
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  qparam->min.push_back(min);
+  qparam->max.push_back(max);
+  node->quantparam(std::move(qparam));
+}
+
+class ReluGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 4}, {1, 4});
+
+    _relu = g()->nodes()->create<luci::CircleRelu>();
+    _relu->features(input());
+    _relu->dtype(loco::DataType::FLOAT32);
+    _relu->shape({1, 4});
+    _relu->name("relu");
+
+    output()->from(_relu);
+
+    set_minmax(input(), -1.0f, 1.0f);
+    set_minmax(_relu, 0.0f, 1.0f);
+  }
+
+public:
+  luci::CircleRelu *relu(void) { return _relu; }
+
+private:
+  luci::CircleRelu *_relu = nullptr;
+};
+
+/**
+ *  Graph with weights of different sizes and kinds, some of whose channels are all positive
+ *
+ *  [Input] - [Conv2D] - [DepthwiseConv2D] - [Conv2D] - [FullyConnected] - [Output]
+ */
+class MultiWeightsGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 4, 4, 3}, {16, 5});
+    set_minmax(input(), -1.0f, 1.0f);
+
+    auto conv1 = g()->nodes()->create<luci::CircleConv2D>();
+    conv1->input(input());
+    conv1->filter(create_const({8, 3, 3, 3}));
+    conv1->bias(create_const({8}));
+    conv1->padding(luci::Padding::SAME);
+    conv1->fusedActivationFunction(luci::FusedActFunc::NONE);
+    init_node(conv1, {1, 4, 4, 8}, "conv1", -4.0f, 4.0f);
+
+    auto dconv = g()->nodes()->create<luci::CircleDepthwiseConv2D>();
+    dconv->input(conv1);
+    dconv->filter(create_const({1, 3, 3, 8}));
+    dconv->bias(create_const({8}));
+    dconv->padding(luci::Padding::SAME);
+    dconv->depthMultiplier(1);
+    dconv->fusedActivationFunction(luci::FusedActFunc::NONE);
+    init_node(dconv, {1, 4, 4, 8}, "dconv", -8.0f, 8.0f);
+
+    auto conv2 = g()->nodes()->create<luci::CircleConv2D>();
+    conv2->input(dconv);
+    conv2->filter(create_const({16, 1, 1, 8}));
+    conv2->bias(create_const({16}));
+    conv2->padding(luci::Padding::VALID);
+    conv2->fusedActivationFunction(luci::FusedActFunc::NONE);
+    init_node(conv2, {1, 4, 4, 16}, "conv2", -16.0f, 16.0f);
+
+    auto fc = g()->nodes()->create<luci::CircleFullyConnected>();
+    fc->input(conv2);
+    fc->weights(create_const({5, 16}));
+    fc->bias(create_const({5}));
+    fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    init_node(fc, {16, 5}, "fc", -32.0f, 32.0f);
+
+    output()->from(fc);
+  }
+
+private:
+  void init_node(luci::CircleNode *node, const ShapeU32 shape, const std::string &name,
+                 float min, float max)
+  {
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape(shape);
+    node->name(name);
+    set_minmax(node, min, max);
+  }
+
+  // Values are all positive in every third slice of the first dimension
+  luci::CircleConst *create_const(const ShapeU32 shape)
+  {
+    auto node = g()->nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape(shape);
+    node->shape_status(luci::ShapeStatus::VALID);
+
+    uint32_t size = 1;
+    for (uint32_t d = 0; d < node->rank(); ++d)
+      size *= node->dim(d).value();
+    const uint32_t slice = size / node->dim(0).value();
+    node->size<loco::DataType::FLOAT32>(size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      const float value = std::sin(static_cast<float>(_seed++)) * (1 + i % 7);
+      node->at<loco::DataType::FLOAT32>(i) = (i / slice) % 3 == 0 ? std::fabs(value) + 0.1f : value;
+    }
+    return node;
+  }
+
+private:
+  uint32_t _seed = 1;
+};
+
+template <loco::DataType DT>
+void expect_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
+{
+  ASSERT_EQ(lhs->size<DT>(), rhs->size<DT>());
+  for (uint32_t i = 0; i < lhs->size<DT>(); ++i)
+    EXPECT_EQ(lhs->at<DT>(i), rhs->at<DT>(i)) << "index " << i;
+}
+
+// Expect nodes of two graphs built in the same way to have the same types, values and
+// quantization parameters
+// NOTE Nodes are compared in the order of the graph, as passes may create nodes in different
+//      orders even in a single thread
+void expect_same_graphs(loco::Graph *lhs, loco::Graph *rhs)
+{
+  auto lhs_nodes = loco::postorder_traversal(loco::output_nodes(lhs));
+  auto rhs_nodes = loco::postorder_traversal(loco::output_nodes(rhs));
+  ASSERT_EQ(lhs_nodes.size(), rhs_nodes.size());
+  for (uint32_t n = 0; n < lhs_nodes.size(); ++n)
+  {
+    auto lhs_node = loco::must_cast<luci::CircleNode *>(lhs_nodes.at(n));
+    auto rhs_node = loco::must_cast<luci::CircleNode *>(rhs_nodes.at(n));
+    SCOPED_TRACE(lhs_node->name());
+
+    ASSERT_EQ(lhs_node->opcode(), rhs_node->opcode());
+    ASSERT_EQ(lhs_node->dtype(), rhs_node->dtype());
+
+    auto lhs_qparam = lhs_node->quantparam();
+    auto rhs_qparam = rhs_node->quantparam();
+    ASSERT_EQ(lhs_qparam == nullptr, rhs_qparam == nullptr);
+    if (lhs_qparam != nullptr)
+    {
+      EXPECT_EQ(lhs_qparam->scale, rhs_qparam->scale);
+      EXPECT_EQ(lhs_qparam->zerop, rhs_qparam->zerop);
+      EXPECT_EQ(lhs_qparam->min, rhs_qparam->min);
+      EXPECT_EQ(lhs_qparam->max, rhs_qparam->max);
+      EXPECT_EQ(lhs_qparam->quantized_dimension, rhs_qparam->quantized_dimension);
+    }
+
+    auto lhs_const = dynamic_cast<luci::CircleConst *>(lhs_node);
+    if (lhs_const == nullptr)
+      continue;
+    auto rhs_const = loco::must_cast<luci::CircleConst *>(rhs_node);
+    switch (lhs_const->dtype())
+    {
+      case loco::DataType::FLOAT32:
+        expect_same_values<loco::DataType::FLOAT32>(lhs_const, rhs_const);
+        break;
+      case loco::DataType::U8:
+        expect_same_values<loco::DataType::U8>(lhs_const, rhs_const);
+        break;
+      case loco::DataType::S16:
+        expect_same_values<loco::DataType::S16>(lhs_const, rhs_const);
+        break;
+      case loco::DataType::S32:
+        expect_same_values<loco::DataType::S32>(lhs_const, rhs_const);
+        break;
+      case loco::DataType::S64:
+        expect_same_values<loco::DataType::S64>(lhs_const, rhs_const);
+        break;
+      default:
+        FAIL() << "Unexpected data type";
+    }
+  }
+}
+
+} // namespace
+
 TEST(QuantizeWithMinMaxPassTest, name)
 {
   luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
@@ -25,3 +222,86 @@ TEST(QuantizeWithMinMaxPassTest, name)
   auto const name = pass.name();
   ASSERT_NE(nullptr, name);
 }
+
+TEST(QuantizeWithMinMaxPassTest, layer_dtypes_insert_quantize)
+{
+  ReluGraph g;
+  g.init();
+
+  luci::LayerDTypes layer_dtypes;
+  layer_dtypes["relu"] = loco::DataType::S16;
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                    luci::QuantizationGranularity::LayerWise, 1, layer_dtypes);
+  pass.run(g.g());
+
+  EXPECT_EQ(loco::DataType::U8, g.input()->dtype());
+  EXPECT_EQ(loco::DataType::S16, g.relu()->dtype());
+  EXPECT_EQ(loco::DataType::S16, g.output()->dtype());
+
+  auto quantize = dynamic_cast<luci::CircleQuantize *>(g.relu()->features());
+  ASSERT_NE(nullptr, quantize);
+  EXPECT_EQ(g.input(), quantize->input());
+  EXPECT_EQ(loco::DataType::S16, quantize->dtype());
+  ASSERT_NE(nullptr, quantize->quantparam());
+  EXPECT_EQ(0, quantize->quantparam()->zerop[0]);
+}
+
+TEST(QuantizeWithMinMaxPassTest, layer_dtypes_same_NEG)
+{
+  ReluGraph g;
+  g.init();
+
+  luci::LayerDTypes layer_dtypes;
+  layer_dtypes["relu"] = loco::DataType::U8;
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                    luci::QuantizationGranularity::LayerWise, 1, layer_dtypes);
+  pass.run(g.g());
+
+  EXPECT_EQ(loco::DataType::U8, g.relu()->dtype());
+  EXPECT_EQ(g.input(), g.relu()->features());
+}
+
+TEST(QuantizeWithMinMaxPassTest, num_threads)
+{
+  const auto U8 = loco::DataType::U8;
+  const auto S16 = loco::DataType::S16;
+  const auto LayerWise = luci::QuantizationGranularity::LayerWise;
+  const auto ChannelWise = luci::QuantizationGranularity::ChannelWise;
+
+  for (auto param : {std::make_tuple(U8, LayerWise), std::make_tuple(U8, ChannelWise),
+                     std::make_tuple(S16, ChannelWise)})
+  {
+    const auto dtype = std::get<0>(param);
+    const auto granularity = std::get<1>(param);
+    SCOPED_TRACE(std::string(dtype == U8 ? "U8" : "S16") +
+                 (granularity == LayerWise ? " LayerWise" : " ChannelWise"));
+
+    MultiWeightsGraph single;
+    MultiWeightsGraph multi;
+    single.init();
+    multi.init();
+
+    luci::QuantizeDequantizeWeightsPass qdqw_single(loco::DataType::FLOAT32, dtype, granularity,
+                                                    1);
+    luci::QuantizeDequantizeWeightsPass qdqw_multi(loco::DataType::FLOAT32, dtype, granularity,
+                                                   4);
+    qdqw_single.run(single.g());
+    qdqw_multi.run(multi.g());
+    expect_same_graphs(single.g(), multi.g());
+
+    luci::QuantizeWithMinMaxPass qwmm_single(loco::DataType::FLOAT32, dtype, granularity, 1);
+    luci::QuantizeWithMinMaxPass qwmm_multi(loco::DataType::FLOAT32, dtype, granularity, 4);
+    qwmm_single.run(single.g());
+    qwmm_multi.run(multi.g());
+    expect_same_graphs(single.g(), multi.g());
+
+    // Weights are quantized indeed
+    auto fc = loco::must_cast<luci::CircleFullyConnected *>(multi.output()->from());
+    auto weights = loco::must_cast<luci::CircleConst *>(fc->weights());
+    EXPECT_EQ(dtype, weights->dtype());
+    ASSERT_NE(nullptr, weights->quantparam());
+    EXPECT_EQ(granularity == ChannelWise ? 5 : 1, weights->quantparam()->scale.size());
+  }
+}
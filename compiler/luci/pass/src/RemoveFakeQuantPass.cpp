@@ -66,4 +66,9 @@ bool RemoveFakeQuantPass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveFakeQuantPass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleFakeQuant *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -127,4 +127,9 @@ bool RemoveRedundantTransposePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveRedundantTransposePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleTranspose *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -72,4 +72,9 @@ bool RemoveUnnecessaryReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessaryReshapePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleReshape *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -108,4 +108,9 @@ bool RemoveUnnecessarySlicePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessarySlicePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleSlice *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -61,4 +61,9 @@ bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessarySplitPass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleSplitOut *>(node) != nullptr;
+}
+
 } // namespace luci
@@ -121,4 +121,9 @@ bool RemoveUnnecessaryStridedSlicePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessaryStridedSlicePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleStridedSlice *>(node) != nullptr;
+}
+
 } // namespace luci
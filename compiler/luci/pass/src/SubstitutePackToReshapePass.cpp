@@ -123,4 +123,9 @@ bool SubstitutePackToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstitutePackToReshapePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CirclePack *>(node) != nullptr;
+}
+
 } // namespace luci
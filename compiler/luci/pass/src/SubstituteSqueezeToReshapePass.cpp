@@ -180,4 +180,9 @@ bool SubstituteSqueezeToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstituteSqueezeToReshapePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleSqueeze *>(node) != nullptr;
+}
+
 } // namespace luci
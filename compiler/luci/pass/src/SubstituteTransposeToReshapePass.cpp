@@ -134,4 +134,9 @@ bool SubstituteTransposeToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstituteTransposeToReshapePass::matches(const loco::Node *node) const
+{
+  return dynamic_cast<const luci::CircleTranspose *>(node) != nullptr;
+}
+
 } // namespace luci
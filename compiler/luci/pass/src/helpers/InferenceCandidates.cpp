@@ -16,7 +16,10 @@
 
 #include "InferenceCandidates.h"
 
-#include <luci/IR/DeadNodeQueryService.h>
+#include <logo/DeadNodeQueryService.h>
+
+#include <set>
+#include <unordered_set>
 
 namespace luci
 {
@@ -24,16 +27,23 @@ namespace luci
 std::vector<loco::Node *> inference_candidates(loco::Graph *g)
 {
   auto candidates = loco::postorder_traversal(loco::output_nodes(g));
+  std::unordered_set<loco::Node *> visited(candidates.begin(), candidates.end());
+  // Same as visited, built only when there are other nodes to query
+  std::set<loco::Node *> active_nodes;
 
   for (auto node : loco::all_nodes(g))
   {
     // already included as candidate
-    if (std::find(candidates.begin(), candidates.end(), node) != candidates.end())
+    if (visited.find(node) != visited.end())
       continue;
 
+    if (active_nodes.empty())
+      active_nodes.insert(candidates.begin(), candidates.end());
+
     // As the node is not used for both graph output and multiple output operation,
     // it cannot be candidate.
-    if (node->dialect()->service<DeadNodeQueryServiceImpl>()->isDeadNode(node))
+    auto service = node->dialect()->service<logo::DeadNodeQueryService>();
+    if (service != nullptr && service->isDeadNode(node, active_nodes))
       continue;
 
     candidates.emplace_back(node);
@@ -42,4 +52,38 @@ std::vector<loco::Node *> inference_candidates(loco::Graph *g)
   return candidates;
 }
 
+InferenceWorklist::InferenceWorklist(loco::Graph *g, const std::vector<loco::Node *> &nodes)
+{
+  const auto candidates = inference_candidates(g);
+  for (uint32_t i = 0; i < candidates.size(); ++i)
+    _order.emplace(candidates[i], i);
+
+  for (auto node : nodes)
+    push(node);
+}
+
+loco::Node *InferenceWorklist::pop(void)
+{
+  if (_queue.empty())
+    return nullptr;
+
+  auto node = _queue.begin()->second;
+  _queue.erase(_queue.begin());
+  return node;
+}
+
+void InferenceWorklist::push(loco::Node *node)
+{
+  // Nodes which are not candidates are not inferred by a full run either
+  auto it = _order.find(node);
+  if (it != _order.end())
+    _queue.emplace(it->second, node);
+}
+
+void InferenceWorklist::push_succs(loco::Node *node)
+{
+  for (auto succ : loco::succs(node))
+    push(succ);
+}
+
 } // namespace luci
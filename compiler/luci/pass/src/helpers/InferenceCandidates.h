@@ -19,6 +19,9 @@
 
 #include <loco.h>
 
+#include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace luci
@@ -29,6 +32,26 @@ namespace luci
  */
 std::vector<loco::Node *> inference_candidates(loco::Graph *g);
 
+/**
+ * @brief Queue of inference candidates to infer again, where arguments come before their users
+ */
+class InferenceWorklist
+{
+public:
+  InferenceWorklist(loco::Graph *g, const std::vector<loco::Node *> &nodes);
+
+public:
+  // Return the first node in topological order, or nullptr if empty
+  loco::Node *pop(void);
+  void push(loco::Node *node);
+  // Queue users of the node, e.g. when its shape has changed
+  void push_succs(loco::Node *node);
+
+private:
+  std::unordered_map<loco::Node *, uint32_t> _order;
+  std::set<std::pair<uint32_t, loco::Node *>> _queue;
+};
+
 } // namespace luci
 
 #endif // __LUCI_INFERENCE_CANDIDATES_H__
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InferenceStamps.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Arguments of a node and digests of those and the node at the last inference
+ */
+template <luci::InferenceKind K> class InferenceStampAnnotation final : public loco::NodeAnnotation
+{
+public:
+  std::vector<std::pair<const loco::Node *, uint64_t>> args;
+  uint64_t digest = 0;
+};
+
+// Return true if inference of the node reads more than its arguments
+bool reads_beyond_args(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    // Subgraphs are read
+    case luci::CircleOpcode::IF:
+    case luci::CircleOpcode::WHILE:
+    // Arguments of the multiple output node or its subgraphs are read
+    case luci::CircleOpcode::CIRCLEBIDIRECTIONAL_SEQUENCE_LSTM_OUT:
+    case luci::CircleOpcode::CIRCLECUSTOMOUT:
+    case luci::CircleOpcode::CIRCLEIFOUT:
+    case luci::CircleOpcode::CIRCLENONMAXSUPPRESSIONV4OUT:
+    case luci::CircleOpcode::CIRCLENONMAXSUPPRESSIONV5OUT:
+    case luci::CircleOpcode::CIRCLESPLITOUT:
+    case luci::CircleOpcode::CIRCLESPLITVOUT:
+    case luci::CircleOpcode::CIRCLETOPKV2OUT:
+    case luci::CircleOpcode::CIRCLEUNIQUEOUT:
+    case luci::CircleOpcode::CIRCLEUNPACKOUT:
+    case luci::CircleOpcode::CIRCLEWHILEOUT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+class Mixer
+{
+public:
+  void mix(uint64_t value) { _digest = _digest * 1000003 ^ value; }
+  uint64_t digest(void) const { return _digest; }
+
+private:
+  uint64_t _digest = 0;
+};
+
+// Shape-like constants, such as 'paddings' of Pad, have a few elements per axis. Larger ones
+// are weights, which are not worth reading on every inference.
+const uint32_t MAX_SHAPE_LIKE_SIZE = 64;
+
+template <loco::DataType DT> void mix_values(const luci::CircleConst *node, Mixer &mixer)
+{
+  const auto size = node->size<DT>();
+  mixer.mix(size);
+  if (size > MAX_SHAPE_LIKE_SIZE)
+    return;
+  for (uint32_t i = 0; i < size; ++i)
+    mixer.mix(static_cast<uint64_t>(node->at<DT>(i)));
+}
+
+template <luci::InferenceKind K, typename Digest>
+bool stamp_matches(const luci::CircleNode *node, Digest &&digest)
+{
+  auto stamp = node->annot<InferenceStampAnnotation<K>>();
+  if (stamp == nullptr || stamp->args.size() != node->arity())
+    return false;
+
+  for (uint32_t n = 0; n < node->arity(); ++n)
+  {
+    const auto &arg = stamp->args.at(n);
+    if (arg.first != node->arg(n) || arg.second != digest(arg.first))
+      return false;
+  }
+
+  return stamp->digest == digest(node);
+}
+
+template <luci::InferenceKind K, typename Digest>
+void annotate_stamp(luci::CircleNode *node, Digest &&digest)
+{
+  auto stamp = std::make_unique<InferenceStampAnnotation<K>>();
+  for (uint32_t n = 0; n < node->arity(); ++n)
+    stamp->args.emplace_back(node->arg(n), digest(node->arg(n)));
+  stamp->digest = digest(node);
+
+  node->annot(std::move(stamp));
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool InferenceStamps::dirty(const luci::CircleNode *node)
+{
+  if (reads_beyond_args(node))
+    return true;
+
+  auto digest = [](const loco::Node *arg) { return InferenceStamps::digest(arg); };
+  switch (_kind)
+  {
+    case InferenceKind::Shape:
+      return !stamp_matches<InferenceKind::Shape>(node, digest);
+    case InferenceKind::Type:
+      return !stamp_matches<InferenceKind::Type>(node, digest);
+  }
+  return true;
+}
+
+void InferenceStamps::stamp(luci::CircleNode *node)
+{
+  auto digest = [](const loco::Node *arg) { return InferenceStamps::digest(arg); };
+  switch (_kind)
+  {
+    case InferenceKind::Shape:
+      annotate_stamp<InferenceKind::Shape>(node, digest);
+      break;
+    case InferenceKind::Type:
+      annotate_stamp<InferenceKind::Type>(node, digest);
+      break;
+  }
+}
+
+uint64_t InferenceStamps::digest(const loco::Node *node)
+{
+  Mixer mixer;
+  mixer.mix(reinterpret_cast<uintptr_t>(node->dialect()));
+  mixer.mix(node->opnum());
+
+  auto circle_node = dynamic_cast<const luci::CircleNode *>(node);
+  if (circle_node == nullptr)
+    return mixer.digest();
+
+  mixer.mix(static_cast<uint64_t>(circle_node->dtype()));
+  mixer.mix(static_cast<uint64_t>(circle_node->shape_status()));
+  mixer.mix(circle_node->rank());
+  for (uint32_t axis = 0; axis < circle_node->rank(); ++axis)
+  {
+    const auto &dim = circle_node->dim(axis);
+    mixer.mix(dim.known() ? dim.value() + 1 : 0);
+  }
+
+  // Shape inference reads values of shape-like constants, such as 'shape' of Reshape
+  if (circle_node->opcode() == luci::CircleOpcode::CIRCLECONST)
+  {
+    auto const_node = static_cast<const luci::CircleConst *>(circle_node);
+    if (const_node->dtype() == loco::DataType::S32)
+      mix_values<loco::DataType::S32>(const_node, mixer);
+    else if (const_node->dtype() == loco::DataType::S64)
+      mix_values<loco::DataType::S64>(const_node, mixer);
+    else if (const_node->dtype() == loco::DataType::FLOAT32 &&
+             const_node->size<loco::DataType::FLOAT32>() == 1)
+    {
+      // Scalars such as 'delta' of Range
+      const auto value = const_node->scalar<loco::DataType::FLOAT32>();
+      uint32_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      mixer.mix(bits);
+    }
+  }
+
+  return mixer.digest();
+}
+
+} // namespace luci
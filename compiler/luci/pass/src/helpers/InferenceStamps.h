@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_INFERENCE_STAMPS_H__
+#define __LUCI_INFERENCE_STAMPS_H__
+
+#include <luci/IR/CircleNode.h>
+
+#include <cstdint>
+
+namespace luci
+{
+
+enum class InferenceKind
+{
+  Shape,
+  Type,
+};
+
+/**
+ * @brief Stamps on nodes to skip inference of nodes which have not changed since it
+ *        was last done
+ * @note  A node is inferred again when its arguments are replaced, or when its own or its
+ *        arguments' shape, dtype or values of small (shape-like) constants differ from the
+ *        stamp. Passes which change attributes of a node in place should set its shape_status to
+ *        UNDEFINED, as ConvertNCHWToNHWCPass does, so that it is inferred again.
+ */
+class InferenceStamps
+{
+public:
+  explicit InferenceStamps(InferenceKind kind) : _kind{kind}
+  {
+    // DO NOTHING
+  }
+
+public:
+  // Return true if the node should be inferred as it may have changed since its stamp
+  bool dirty(const luci::CircleNode *node);
+  // Stamp the node with its current arguments after inference
+  void stamp(luci::CircleNode *node);
+
+private:
+  static uint64_t digest(const loco::Node *node);
+
+private:
+  InferenceKind _kind;
+};
+
+} // namespace luci
+
+#endif // __LUCI_INFERENCE_STAMPS_H__
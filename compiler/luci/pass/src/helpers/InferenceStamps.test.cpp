@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InferenceStamps.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+void init_shape_const(luci::CircleConst *node, int32_t value)
+{
+  node->dtype(loco::DataType::S32);
+  node->shape({1});
+  node->size<loco::DataType::S32>(1);
+  node->at<loco::DataType::S32>(0) = value;
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+} // namespace
+
+TEST(LuciPassHelpersInferenceStamps, stamp)
+{
+  luci::CircleConst shape;
+  luci::CircleConst other_shape;
+  luci::CircleReshape reshape;
+  init_shape_const(&shape, 4);
+  init_shape_const(&other_shape, 4);
+  reshape.tensor(&shape);
+  reshape.shape(&shape);
+
+  {
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    ASSERT_TRUE(stamps.dirty(&reshape));
+
+    stamps.stamp(&reshape);
+    ASSERT_FALSE(stamps.dirty(&reshape));
+  }
+
+  // Stamps stay on nodes for later runs
+  {
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    ASSERT_FALSE(stamps.dirty(&reshape));
+  }
+
+  // Stamps of each kind are independent
+  {
+    luci::InferenceStamps stamps(luci::InferenceKind::Type);
+    ASSERT_TRUE(stamps.dirty(&reshape));
+  }
+
+  // Argument is replaced
+  {
+    reshape.shape(&other_shape);
+
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    ASSERT_TRUE(stamps.dirty(&reshape));
+
+    stamps.stamp(&reshape);
+    ASSERT_FALSE(stamps.dirty(&reshape));
+  }
+}
+
+TEST(LuciPassHelpersInferenceStamps, changed_arg)
+{
+  luci::CircleConst shape;
+  luci::CircleReshape reshape;
+  init_shape_const(&shape, 4);
+  reshape.tensor(&shape);
+  reshape.shape(&shape);
+
+  {
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    stamps.stamp(&reshape);
+  }
+
+  // Values of constants are read by shape inference
+  {
+    shape.at<loco::DataType::S32>(0) = 2;
+
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    ASSERT_TRUE(stamps.dirty(&reshape));
+    stamps.stamp(&reshape);
+  }
+
+  {
+    shape.shape_status(luci::ShapeStatus::UNDEFINED);
+
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    ASSERT_TRUE(stamps.dirty(&reshape));
+  }
+}
+
+TEST(LuciPassHelpersInferenceStamps, large_const)
+{
+  luci::CircleConst weights;
+  luci::CircleReshape reshape;
+  init_shape_const(&weights, 4);
+  weights.shape({1024});
+  weights.size<loco::DataType::S32>(1024);
+  reshape.tensor(&weights);
+  reshape.shape(&weights);
+
+  {
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    stamps.stamp(&reshape);
+  }
+
+  // Values of large constants are not shape-like, so they are not read
+  {
+    weights.at<loco::DataType::S32>(0) = 2;
+
+    luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+    ASSERT_FALSE(stamps.dirty(&reshape));
+  }
+}
+
+TEST(LuciPassHelpersInferenceStamps, changed_node)
+{
+  luci::CircleConst shape;
+  luci::CircleReshape reshape;
+  init_shape_const(&shape, 4);
+  reshape.tensor(&shape);
+  reshape.shape(&shape);
+
+  reshape.shape_status(luci::ShapeStatus::VALID);
+  {
+    luci::InferenceStamps stamps(luci::InferenceKind::Type);
+    stamps.stamp(&reshape);
+    ASSERT_FALSE(stamps.dirty(&reshape));
+  }
+
+  // Pass may request inference again by resetting shape_status
+  {
+    reshape.shape_status(luci::ShapeStatus::UNDEFINED);
+
+    luci::InferenceStamps stamps(luci::InferenceKind::Type);
+    ASSERT_TRUE(stamps.dirty(&reshape));
+  }
+}
+
+TEST(LuciPassHelpersInferenceStamps, multiple_output_NEG)
+{
+  luci::CircleConst split_dim;
+  luci::CircleSplit split;
+  luci::CircleSplitOut split_out;
+  init_shape_const(&split_dim, 0);
+  split.split_dim(&split_dim);
+  split.input(&split_dim);
+  split_out.input(&split);
+
+  luci::InferenceStamps stamps(luci::InferenceKind::Shape);
+  stamps.stamp(&split_out);
+
+  // Output of split also reads split_dim, which is not its argument
+  ASSERT_TRUE(stamps.dirty(&split_out));
+}
@@ -5,6 +5,7 @@ require("logo")
 require("logo-core")
 require("mio-circle")
 require("oops")
+require("pepper-threadpool")
 require("hermes")
 require("hermes-std")
 require("tflchef")
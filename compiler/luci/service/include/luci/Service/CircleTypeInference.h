@@ -109,6 +109,7 @@ public:
   // loco::DataType visit(const luci::CirclePadV2 *node) final;
   // loco::DataType visit(const luci::CirclePow *node) final;
   // loco::DataType visit(const luci::CirclePRelu *node) final;
+  // loco::DataType visit(const luci::CircleQuantize *node) final;
   // loco::DataType visit(const luci::CircleRange *node) final;
   // loco::DataType visit(const luci::CircleRank *node) final;
   // loco::DataType visit(const luci::CircleMul *node) final;
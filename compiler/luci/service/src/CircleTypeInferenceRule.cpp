@@ -314,6 +314,9 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
     return input_type;
   }
 
+  // Output type of Quantize is determined by quantization, not by input
+  loco::DataType visit(const luci::CircleQuantize *node) final { return node->dtype(); }
+
   loco::DataType visit(const luci::CircleRange *node) final
   {
     return luci::dtype_get(node->start());
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <luci/CircleOptimizer.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/Module.h>
+
+#include <loco.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+const uint32_t NUM_CHAINS = 50;
+const uint32_t NODES_PER_BLOCK = 5;
+const uint32_t H = 16, W = 16, C = 8;
+
+// Set dtype and shape as the importer does from a model file
+void set_tensor(luci::CircleNode *node)
+{
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape({1, H, W, C});
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+luci::CircleConst *create_add_const(loco::Graph *g)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape({C});
+  node->size<loco::DataType::FLOAT32>(C);
+  for (uint32_t i = 0; i < C; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = 0.5f;
+  node->shape_status(luci::ShapeStatus::VALID);
+  return node;
+}
+
+luci::CircleConst *create_shape_const(loco::Graph *g)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->shape({4});
+  node->size<loco::DataType::S32>(4);
+  node->at<loco::DataType::S32>(0) = 1;
+  node->at<loco::DataType::S32>(1) = H;
+  node->at<loco::DataType::S32>(2) = W;
+  node->at<loco::DataType::S32>(3) = C;
+  node->shape_status(luci::ShapeStatus::VALID);
+  return node;
+}
+
+/**
+ * @brief Build chains of blocks of [Add - Relu - Reshape] from one input
+ *
+ *        Relu can be fused into Add and Reshape does not change the shape,
+ *        so that the optimizer removes about a half of nodes.
+ */
+std::unique_ptr<loco::Graph> build_graph(uint32_t num_nodes)
+{
+  auto g = loco::make_graph();
+
+  auto graph_input = g->inputs()->create();
+  graph_input->dtype(loco::DataType::FLOAT32);
+  graph_input->shape({1, H, W, C});
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->index(graph_input->index());
+  set_tensor(input);
+  input->name("input");
+
+  const uint32_t num_blocks = std::max(1u, num_nodes / (NUM_CHAINS * NODES_PER_BLOCK));
+  for (uint32_t chain = 0; chain < NUM_CHAINS; ++chain)
+  {
+    loco::Node *last = input;
+    for (uint32_t block = 0; block < num_blocks; ++block)
+    {
+      const auto suffix = std::to_string(chain) + "_" + std::to_string(block);
+
+      auto add = g->nodes()->create<luci::CircleAdd>();
+      add->x(last);
+      add->y(create_add_const(g.get()));
+      add->fusedActivationFunction(luci::FusedActFunc::NONE);
+      add->name("add_" + suffix);
+      set_tensor(add);
+
+      auto relu = g->nodes()->create<luci::CircleRelu>();
+      relu->features(add);
+      relu->name("relu_" + suffix);
+      set_tensor(relu);
+
+      auto reshape = g->nodes()->create<luci::CircleReshape>();
+      reshape->tensor(relu);
+      reshape->shape(create_shape_const(g.get()));
+      reshape->newShape()->rank(4);
+      reshape->newShape()->dim(0) = 1;
+      reshape->newShape()->dim(1) = H;
+      reshape->newShape()->dim(2) = W;
+      reshape->newShape()->dim(3) = C;
+      reshape->name("reshape_" + suffix);
+      set_tensor(reshape);
+
+      last = reshape;
+    }
+
+    auto graph_output = g->outputs()->create();
+    graph_output->dtype(loco::DataType::FLOAT32);
+    graph_output->shape({1, H, W, C});
+    auto output = g->nodes()->create<luci::CircleOutput>();
+    output->index(graph_output->index());
+    output->from(last);
+    output->name("output_" + std::to_string(chain));
+    set_tensor(output);
+  }
+
+  return g;
+}
+
+} // namespace
+
+/*
+ * @brief OptimizeBenchmark main
+ *
+ *        Give number of nodes and repeat count as optional arguments
+ *
+ *        This will time CircleOptimizer::optimize on a synthetic graph of about
+ *        the given number of nodes, 50000 by default, for the module and then for
+ *        the graph as circle2circle does.
+ *        i.e. "luci_optimizebenchmark 50000 3"
+ */
+int entry(int argc, char **argv)
+{
+  const uint32_t num_nodes = argc > 1 ? std::stoul(argv[1]) : 50000;
+  const uint32_t repeat = argc > 2 ? std::stoul(argv[2]) : 3;
+
+  luci::CircleOptimizer optimizer;
+  auto options = optimizer.options();
+  options->enable(luci::CircleOptimizer::Options::Algorithm::FuseActivationFunction);
+  options->enable(luci::CircleOptimizer::Options::Algorithm::RemoveUnnecessaryReshape);
+
+  using milliseconds = std::chrono::duration<double, std::milli>;
+
+  for (uint32_t r = 0; r < repeat; ++r)
+  {
+    auto module = luci::make_module();
+    module->add(build_graph(num_nodes));
+    auto g = module->graph();
+    const auto before = g->nodes()->size();
+
+    auto begin = std::chrono::steady_clock::now();
+    optimizer.optimize(module.get());
+    auto middle = std::chrono::steady_clock::now();
+    optimizer.optimize(g);
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "[INFO] optimize " << before << " nodes to " << g->nodes()->size()
+              << ": module " << milliseconds(middle - begin).count() << " ms, graph "
+              << milliseconds(end - middle).count() << " ms, total "
+              << milliseconds(end - begin).count() << " ms" << std::endl;
+  }
+
+  return 0;
+}
@@ -23,13 +23,23 @@
 #include <unordered_map>
 #include <vector>
 
+namespace pepper
+{
+class ThreadPool;
+} // namespace pepper
+
 namespace mir_interpreter
 {
 
 class MIRInterpreter : public mir::Visitor
 {
 public:
-  explicit MIRInterpreter() = default;
+  /**
+   * @param thread_pool Pool used to split heavy operations (Conv2D, DepthwiseConv2D,
+   *                    FullyConnected, elementwise arithmetics) between threads.
+   *                    If null, everything is computed on the calling thread.
+   */
+  explicit MIRInterpreter(pepper::ThreadPool *thread_pool = nullptr) : _thread_pool(thread_pool) {}
 
   ~MIRInterpreter() override = default;
 
@@ -94,6 +104,8 @@ private:
 
   /// @brief Mapping of operation outputs to corresponding tensors.
   std::unordered_map<const mir::Operation::Output *, mir::TensorVariant> _tensors;
+
+  pepper::ThreadPool *_thread_pool;
 };
 
 } // namespace mir_interpreter
@@ -1 +1,2 @@
 require("mir")
+require("pepper-threadpool")
@@ -148,7 +148,7 @@ void MIRInterpreter::visit(ops::Conv2DOp &op)
   {
     bias = &(inputs[2].get());
   }
-  Conv2D(inputs[0], inputs[1], op.getAttributes(), outputs[0], bias);
+  Conv2D(inputs[0], inputs[1], op.getAttributes(), outputs[0], bias, _thread_pool);
 }
 
 void MIRInterpreter::visit(ops::MaxPool2DOp &op)
@@ -196,7 +196,7 @@ void MIRInterpreter::visit(ops::FullyConnectedOp &op)
   {
     bias = &(inputs[3].get());
   }
-  FullyConnected(inputs[0], inputs[1], op, outputs[0], bias);
+  FullyConnected(inputs[0], inputs[1], op, outputs[0], bias, _thread_pool);
 }
 
 void MIRInterpreter::visit(ops::CappedReluOp &op)
@@ -215,7 +215,7 @@ void MIRInterpreter::visit(ops::DepthwiseConv2DOp &op)
   {
     bias = &inputs[3].get();
   }
-  DepthwiseConv2D(op, inputs[0], inputs[1], outputs[0], bias);
+  DepthwiseConv2D(op, inputs[0], inputs[1], outputs[0], bias, _thread_pool);
 }
 
 void MIRInterpreter::visit(ops::SliceOp &op)
@@ -328,35 +328,35 @@ void MIRInterpreter::visit(ops::AddOp &op)
 {
   auto inputs = getInputTensors(op);
   auto outputs = allocateOutputTensors(op);
-  Add(inputs[0], inputs[1], outputs[0]);
+  Add(inputs[0], inputs[1], outputs[0], _thread_pool);
 }
 
 void MIRInterpreter::visit(mir::ops::DivOp &op)
 {
   auto inputs = getInputTensors(op);
   auto outputs = allocateOutputTensors(op);
-  Div(inputs[0], inputs[1], outputs[0]);
+  Div(inputs[0], inputs[1], outputs[0], _thread_pool);
 }
 
 void MIRInterpreter::visit(mir::ops::MaxOp &op)
 {
   auto inputs = getInputTensors(op);
   auto outputs = allocateOutputTensors(op);
-  Max(inputs[0], inputs[1], outputs[0]);
+  Max(inputs[0], inputs[1], outputs[0], _thread_pool);
 }
 
 void MIRInterpreter::visit(mir::ops::MulOp &op)
 {
   auto inputs = getInputTensors(op);
   auto outputs = allocateOutputTensors(op);
-  Mul(inputs[0], inputs[1], outputs[0]);
+  Mul(inputs[0], inputs[1], outputs[0], _thread_pool);
 }
 
 void MIRInterpreter::visit(mir::ops::SubOp &op)
 {
   auto inputs = getInputTensors(op);
   auto outputs = allocateOutputTensors(op);
-  Sub(inputs[0], inputs[1], outputs[0]);
+  Sub(inputs[0], inputs[1], outputs[0], _thread_pool);
 }
 
 void MIRInterpreter::visit(mir::ops::DequantizeOp &op)
@@ -31,11 +31,13 @@ using namespace mir;
 
 template <typename T> struct AddImpl
 {
-  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res);
+  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                  pepper::ThreadPool *thread_pool);
 };
 
 template <typename T>
-void AddImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void AddImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                     pepper::ThreadPool *thread_pool)
 {
   TensorVariant broadcasted_lhs(lhs, res.getShape());
   TensorVariant broadcasted_rhs(rhs, res.getShape());
@@ -43,18 +45,19 @@ void AddImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorV
   Tensor<T> rhs_accessor(broadcasted_rhs);
   Tensor<T> res_accessor(res);
 
-  for (const auto &index : ShapeRange(res.getShape()))
-  {
+  parallelForEachIndex(res.getShape(), thread_pool, [&](const Index &index) {
     res_accessor.at(index) = lhs_accessor.at(index) + rhs_accessor.at(index);
-  }
+  });
 }
 
 template <> struct AddImpl<uint8_t>
 {
-  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res);
+  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                  pepper::ThreadPool *);
 };
 
-void AddImpl<uint8_t>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void AddImpl<uint8_t>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                           pepper::ThreadPool *)
 {
   const auto &lhs_type = lhs.getType();
   const auto &rhs_type = rhs.getType();
@@ -118,13 +121,14 @@ void AddImpl<uint8_t>::run(const TensorVariant &lhs, const TensorVariant &rhs, T
   }
 }
 
-void Add(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void Add(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+         pepper::ThreadPool *thread_pool)
 {
   if (lhs.getElementType() != rhs.getElementType())
   {
     throw std::runtime_error{"Add with different input types is unsupported"};
   }
-  dispatch<AddImpl>(res.getElementType(), lhs, rhs, res);
+  dispatch<AddImpl>(res.getElementType(), lhs, rhs, res, thread_pool);
 }
 
 } // namespace mir_interpreter
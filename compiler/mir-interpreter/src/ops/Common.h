@@ -23,6 +23,8 @@
 #include "mir/Shape.h"
 #include "mir/Index.h"
 
+#include <pepper/threadpool.h>
+
 namespace mir_interpreter
 {
 
@@ -60,6 +62,38 @@ template <typename T> void erase(mir::TensorVariant &tv)
 
 mir::Index shift(const mir::Index &in_index, const mir::Shape &shift_from);
 
+/**
+ * @brief Calls fn(index) for every index of shape, distributing indices between threads
+ */
+template <typename F>
+void parallelForEachIndex(const mir::Shape &shape, pepper::ThreadPool *thread_pool, F fn)
+{
+  const int32_t rank = shape.rank();
+  const auto compute_range = [&](int64_t begin, int64_t end) {
+    mir::Index index;
+    index.resize(rank);
+    int64_t offset = begin;
+    for (int32_t axis = rank - 1; axis >= 0; --axis)
+    {
+      index.at(axis) = static_cast<int32_t>(offset % shape.dim(axis));
+      offset /= shape.dim(axis);
+    }
+    for (int64_t i = begin; i < end; ++i)
+    {
+      fn(index);
+      for (int32_t axis = rank - 1; axis >= 0; --axis)
+      {
+        if (++index.at(axis) < shape.dim(axis))
+          break;
+        index.at(axis) = 0;
+      }
+    }
+  };
+  // Small tensors are not worth the synchronization
+  const int64_t grain = 4096;
+  pepper::parallel_for(thread_pool, shape.numElements(), grain, compute_range);
+}
+
 } // namespace mir_interpreter
 
 #endif // _NNC_CORE_BACKEND_INTERPRETER_COMMON_
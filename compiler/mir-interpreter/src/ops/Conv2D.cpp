@@ -38,13 +38,13 @@ template <typename T> struct Conv2DImpl
 {
   static void run(const TensorVariant &input, const TensorVariant &kernel,
                   const Conv2DOpAttributes &attributes, TensorVariant &result,
-                  const TensorVariant *fused_bias);
+                  const TensorVariant *fused_bias, pepper::ThreadPool *thread_pool);
 };
 
 template <typename T>
 void Conv2DImpl<T>::run(const TensorVariant &input, const TensorVariant &kernel,
                         const Conv2DOpAttributes &attributes, TensorVariant &result,
-                        const TensorVariant *fused_bias)
+                        const TensorVariant *fused_bias, pepper::ThreadPool *thread_pool)
 {
   const auto *input_data = reinterpret_cast<const T *>(input.atOffset(0));
   const auto *kernel_data = reinterpret_cast<const T *>(kernel.atOffset(0));
@@ -79,10 +79,12 @@ void Conv2DImpl<T>::run(const TensorVariant &input, const TensorVariant &kernel,
   assert(kernel_shape.dim(3) == in_group_size);
   assert(kernel_shape.dim(0) == num_out_channels);
 
-  for (std::int32_t batch = 0; batch < batch_size; ++batch)
-  {
-    for (std::int32_t out_y = 0; out_y < output_height; ++out_y)
+  // Output rows are independent, so they are distributed between threads
+  const auto compute_rows = [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end; ++row)
     {
+      const auto batch = static_cast<std::int32_t>(row / output_height);
+      const auto out_y = static_cast<std::int32_t>(row % output_height);
       for (std::int32_t out_x = 0; out_x < output_width; ++out_x)
       {
         for (std::int32_t group = 0; group < num_groups; ++group)
@@ -127,19 +129,22 @@ void Conv2DImpl<T>::run(const TensorVariant &input, const TensorVariant &kernel,
         }
       }
     }
-  }
+  };
+
+  pepper::parallel_for(thread_pool, static_cast<int64_t>(batch_size) * output_height, 1,
+                       compute_rows);
 }
 
 template <> struct Conv2DImpl<uint8_t>
 {
   static void run(const TensorVariant &input, const TensorVariant &kernel,
                   const Conv2DOpAttributes &attributes, TensorVariant &result,
-                  const TensorVariant *fused_bias);
+                  const TensorVariant *fused_bias, pepper::ThreadPool *thread_pool);
 };
 
 void Conv2DImpl<uint8_t>::run(const TensorVariant &input, const TensorVariant &kernel,
                               const Conv2DOpAttributes &attributes, TensorVariant &result,
-                              const TensorVariant *fused_bias)
+                              const TensorVariant *fused_bias, pepper::ThreadPool *)
 {
   if (!fused_bias)
   {
@@ -253,9 +258,10 @@ void Conv2DImpl<uint8_t>::run(const TensorVariant &input, const TensorVariant &k
 
 void Conv2D(const mir::TensorVariant &input, const mir::TensorVariant &kernel,
             const mir::Conv2DOpAttributes &attributes, mir::TensorVariant &result,
-            const mir::TensorVariant *fused_bias)
+            const mir::TensorVariant *fused_bias, pepper::ThreadPool *thread_pool)
 {
-  dispatch<Conv2DImpl>(result.getElementType(), input, kernel, attributes, result, fused_bias);
+  dispatch<Conv2DImpl>(result.getElementType(), input, kernel, attributes, result, fused_bias,
+                       thread_pool);
 }
 
 } // namespace mir_interpreter
@@ -20,12 +20,14 @@
 #include "mir/ops/Conv2DOp.h"
 #include "mir/TensorVariant.h"
 
+#include <pepper/threadpool.h>
+
 namespace mir_interpreter
 {
 
 void Conv2D(const mir::TensorVariant &input, const mir::TensorVariant &kernel,
             const mir::Conv2DOpAttributes &attributes, mir::TensorVariant &result,
-            const mir::TensorVariant *fused_bias);
+            const mir::TensorVariant *fused_bias, pepper::ThreadPool *thread_pool);
 
 } // namespace mir_interpreter
 
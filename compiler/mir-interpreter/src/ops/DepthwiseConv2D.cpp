@@ -33,14 +33,14 @@ template <typename T> struct DepthwiseConv2DImpl
 {
   static void run(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &inputv,
                   const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
-                  mir::TensorVariant &output);
+                  mir::TensorVariant &output, pepper::ThreadPool *thread_pool);
 };
 
 template <typename T>
 void DepthwiseConv2DImpl<T>::run(const mir::ops::DepthwiseConv2DOp &op,
                                  const mir::TensorVariant &inputv,
                                  const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
-                                 mir::TensorVariant &output)
+                                 mir::TensorVariant &output, pepper::ThreadPool *thread_pool)
 {
   const Shape &in_shape = op.getInputShape(0);
   const Shape &kernel_shape = op.getInputShape(1);
@@ -64,43 +64,52 @@ void DepthwiseConv2DImpl<T>::run(const mir::ops::DepthwiseConv2DOp &op,
 
   ShapeRange in_range(in_shape);
   ShapeRange kernel_range(kernel_shape);
-  ShapeRange out_range(Shape{out_shape.dim(0), out_shape.dim(1), out_shape.dim(2), 1});
-
-  Index in_index;
-  in_index.resize(4);
 
   erase<T>(output);
 
-  for (const auto &out_index : out_range)
-  {
-    Index out_index_k = out_index;
-    for (const auto &kernel_index : kernel_range)
+  // Every (batch, output row) pair writes its own slice of the output
+  const auto compute_rows = [&](int64_t begin, int64_t end) {
+    Index in_index;
+    in_index.resize(4);
+    for (int64_t row = begin; row < end; ++row)
     {
-      in_index.at(0) = out_index.at(0);
-      for (int i = 0; i < 2; ++i)
-        in_index.at(1 + i) = out_index.at(1 + i) * strides[i] + kernel_index.at(i) - pads[i];
-      in_index.at(3) = kernel_index.at(2);
-
-      if (in_range.contains(in_index))
+      const int32_t b = static_cast<int32_t>(row / out_shape.dim(1));
+      const int32_t y = static_cast<int32_t>(row % out_shape.dim(1));
+      for (int32_t x = 0; x < out_shape.dim(2); ++x)
       {
-        out_index_k.at(3) = kernel_index.at(2) * channel_multiplier + kernel_index.at(3);
-        res_accessor.at(out_index_k) += input.at(in_index) * kernel.at(kernel_index);
+        Index out_index_k{b, y, x, 0};
+        for (const auto &kernel_index : kernel_range)
+        {
+          in_index.at(0) = b;
+          in_index.at(1) = y * strides[0] + kernel_index.at(0) - pads[0];
+          in_index.at(2) = x * strides[1] + kernel_index.at(1) - pads[1];
+          in_index.at(3) = kernel_index.at(2);
+
+          if (in_range.contains(in_index))
+          {
+            out_index_k.at(3) = kernel_index.at(2) * channel_multiplier + kernel_index.at(3);
+            res_accessor.at(out_index_k) += input.at(in_index) * kernel.at(kernel_index);
+          }
+        }
       }
     }
-  }
+  };
+  pepper::parallel_for(thread_pool, static_cast<int64_t>(out_shape.dim(0)) * out_shape.dim(1), 1,
+                       compute_rows);
 }
 
 template <> struct DepthwiseConv2DImpl<uint8_t>
 {
   static void run(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &inputv,
                   const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
-                  mir::TensorVariant &output);
+                  mir::TensorVariant &output, pepper::ThreadPool *thread_pool);
 };
 
 void DepthwiseConv2DImpl<uint8_t>::run(const mir::ops::DepthwiseConv2DOp &op,
                                        const mir::TensorVariant &inputv,
                                        const mir::TensorVariant &kernelv,
-                                       const mir::TensorVariant *biasv, mir::TensorVariant &output)
+                                       const mir::TensorVariant *biasv, mir::TensorVariant &output,
+                                       pepper::ThreadPool *thread_pool)
 {
   if (!biasv)
   {
@@ -172,10 +181,11 @@ void DepthwiseConv2DImpl<uint8_t>::run(const mir::ops::DepthwiseConv2DOp &op,
   int filter_height = kernel_shape.dim(0); // HWIO
   int filter_width = kernel_shape.dim(1);  // HWIO
 
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int out_y = 0; out_y < output_height; ++out_y)
+  const auto compute_rows = [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end; ++row)
     {
+      const int b = static_cast<int>(row / output_height);
+      const int out_y = static_cast<int>(row % output_height);
       for (int out_x = 0; out_x < output_width; ++out_x)
       {
         for (int ic = 0; ic < input_depth; ++ic)
@@ -212,14 +222,16 @@ void DepthwiseConv2DImpl<uint8_t>::run(const mir::ops::DepthwiseConv2DOp &op,
         }
       }
     }
-  }
+  };
+  pepper::parallel_for(thread_pool, static_cast<int64_t>(batches) * output_height, 1, compute_rows);
 }
 
 void DepthwiseConv2D(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &input,
                      const mir::TensorVariant &kernel, mir::TensorVariant &output,
-                     const mir::TensorVariant *bias)
+                     const mir::TensorVariant *bias, pepper::ThreadPool *thread_pool)
 {
-  dispatch<DepthwiseConv2DImpl>(output.getElementType(), op, input, kernel, bias, output);
+  dispatch<DepthwiseConv2DImpl>(output.getElementType(), op, input, kernel, bias, output,
+                                thread_pool);
 }
 
 } // namespace mir_interpreter
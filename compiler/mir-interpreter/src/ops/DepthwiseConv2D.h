@@ -20,12 +20,14 @@
 #include "mir/ops/DepthwiseConv2DOp.h"
 #include "mir/TensorVariant.h"
 
+#include <pepper/threadpool.h>
+
 namespace mir_interpreter
 {
 
 void DepthwiseConv2D(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &input,
                      const mir::TensorVariant &kernel, mir::TensorVariant &output,
-                     const mir::TensorVariant *bias);
+                     const mir::TensorVariant *bias, pepper::ThreadPool *thread_pool);
 
 } // namespace mir_interpreter
 
@@ -27,7 +27,7 @@ namespace mir_interpreter
 
 template <typename T>
 static void fullyConnected2D(const mir::TensorVariant &input, const mir::TensorVariant &weights,
-                             mir::TensorVariant &output)
+                             mir::TensorVariant &output, pepper::ThreadPool *thread_pool)
 {
   assert(input.getShape().rank() == 2);
   assert(weights.getShape().rank() == 2);
@@ -42,17 +42,33 @@ static void fullyConnected2D(const mir::TensorVariant &input, const mir::TensorV
   auto N = input.getShape().dim(1);
   auto wcols = weights.getShape().dim(1);
 
-  for (int32_t r = 0; r < rows; ++r)
-  {
-    for (int32_t k = 0; k < N; ++k)
+  const auto compute = [&](int32_t r_begin, int32_t r_end, int32_t c_begin, int32_t c_end) {
+    for (int32_t r = r_begin; r < r_end; ++r)
     {
-      auto in = in_raw[r * N + k];
-
-      for (int32_t c = 0; c < cols; ++c)
+      for (int32_t k = 0; k < N; ++k)
       {
-        output_raw[r * cols + c] += in * weight_raw[k * wcols + c];
+        auto in = in_raw[r * N + k];
+
+        for (int32_t c = c_begin; c < c_end; ++c)
+        {
+          output_raw[r * cols + c] += in * weight_raw[k * wcols + c];
+        }
       }
     }
+  };
+
+  if (rows > 1)
+  {
+    pepper::parallel_for(thread_pool, rows, 1, [&](int64_t begin, int64_t end) {
+      compute(static_cast<int32_t>(begin), static_cast<int32_t>(end), 0, cols);
+    });
+  }
+  else
+  {
+    // Single row (batch 1): split the output columns instead
+    pepper::parallel_for(thread_pool, cols, 256, [&](int64_t begin, int64_t end) {
+      compute(0, rows, static_cast<int32_t>(begin), static_cast<int32_t>(end));
+    });
   }
 }
 
@@ -60,14 +76,14 @@ template <typename T> struct FullyConnectedImpl
 {
   static void run(const mir::TensorVariant &inputv, const mir::TensorVariant &weightsv,
                   const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                  const mir::TensorVariant *biasv);
+                  const mir::TensorVariant *biasv, pepper::ThreadPool *thread_pool);
 };
 
 template <typename T>
 void FullyConnectedImpl<T>::run(const mir::TensorVariant &inputv,
                                 const mir::TensorVariant &weightsv,
                                 const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                                const mir::TensorVariant *biasv)
+                                const mir::TensorVariant *biasv, pepper::ThreadPool *thread_pool)
 {
   if (biasv)
   {
@@ -82,7 +98,7 @@ void FullyConnectedImpl<T>::run(const mir::TensorVariant &inputv,
   if (input.getShape().rank() == 2 && weights.getShape().rank() == 2 && res.getShape().rank() == 2)
   {
     // optimized case for 2d matrix multiplication
-    fullyConnected2D<T>(inputv, weightsv, res);
+    fullyConnected2D<T>(inputv, weightsv, res, thread_pool);
     return;
   }
 
@@ -97,12 +113,9 @@ void FullyConnectedImpl<T>::run(const mir::TensorVariant &inputv,
   assert(in_shape.dim(in_rank - 1) == w_shape.dim(w_rank - 2));
   (void)in_rank;
 
-  mir::ShapeRange out_range(res.getShape());
-
   int32_t len = w_shape.dim(w_rank - 2);
 
-  for (auto &out_index : out_range)
-  {
+  parallelForEachIndex(res.getShape(), thread_pool, [&](const mir::Index &out_index) {
     mir::Index t_index = out_index;
     T &output_element = accessor.at(out_index);
     int32_t col = t_index.at(w_rank - 1);
@@ -117,20 +130,21 @@ void FullyConnectedImpl<T>::run(const mir::TensorVariant &inputv,
       t_index.at(w_rank - 2) = row;
       output_element += in * w;
     }
-  }
+  });
 }
 
 template <> struct FullyConnectedImpl<uint8_t>
 {
   static void run(const mir::TensorVariant &inputv, const mir::TensorVariant &weightsv,
                   const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                  const mir::TensorVariant *biasv);
+                  const mir::TensorVariant *biasv, pepper::ThreadPool *thread_pool);
 };
 
 void FullyConnectedImpl<uint8_t>::run(const mir::TensorVariant &inputv,
                                       const mir::TensorVariant &weightsv,
                                       const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                                      const mir::TensorVariant *biasv)
+                                      const mir::TensorVariant *biasv,
+                                      pepper::ThreadPool *thread_pool)
 {
   if (!biasv)
   {
@@ -184,10 +198,11 @@ void FullyConnectedImpl<uint8_t>::run(const mir::TensorVariant &inputv,
   int32_t output_min = std::numeric_limits<uint8_t>::min();
   int32_t output_max = std::numeric_limits<uint8_t>::max();
 
-  for (int32_t b = 0; b < batches; ++b)
-  {
-    for (int32_t out_c = 0; out_c < output_depth; ++out_c)
+  const auto compute_outputs = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i)
     {
+      const int32_t b = static_cast<int32_t>(i / output_depth);
+      const int32_t out_c = static_cast<int32_t>(i % output_depth);
       int32_t acc = 0;
       for (int d = 0; d < accum_depth; ++d)
       {
@@ -202,13 +217,15 @@ void FullyConnectedImpl<uint8_t>::run(const mir::TensorVariant &inputv,
       acc = std::min(acc, output_max);
       output_data[out_c + output_depth * b] = static_cast<uint8_t>(acc);
     }
-  }
+  };
+  pepper::parallel_for(thread_pool, static_cast<int64_t>(batches) * output_depth, 64,
+                       compute_outputs);
 }
 
 void FullyConnected(const mir::TensorVariant &input, const mir::TensorVariant &weights,
                     const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                    const mir::TensorVariant *bias)
+                    const mir::TensorVariant *bias, pepper::ThreadPool *thread_pool)
 {
-  dispatch<FullyConnectedImpl>(res.getElementType(), input, weights, op, res, bias);
+  dispatch<FullyConnectedImpl>(res.getElementType(), input, weights, op, res, bias, thread_pool);
 }
 } // namespace mir_interpreter
@@ -20,12 +20,14 @@
 #include "mir/ops/FullyConnectedOp.h"
 #include "mir/ShapeRange.h"
 
+#include <pepper/threadpool.h>
+
 namespace mir_interpreter
 {
 
 void FullyConnected(const mir::TensorVariant &input, const mir::TensorVariant &weights,
                     const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                    const mir::TensorVariant *bias);
+                    const mir::TensorVariant *bias, pepper::ThreadPool *thread_pool);
 
 } // namespace mir_interpreter
 
@@ -17,7 +17,6 @@
 #include "Max.h"
 #include "Common.h"
 
-#include "mir/ShapeRange.h"
 #include "mir/Tensor.h"
 
 #include <algorithm>
@@ -29,11 +28,13 @@ using namespace mir;
 
 template <typename T> struct MaxImpl
 {
-  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res);
+  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                  pepper::ThreadPool *thread_pool);
 };
 
 template <typename T>
-void MaxImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void MaxImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                     pepper::ThreadPool *thread_pool)
 {
   TensorVariant broadcasted_lhs(lhs, res.getShape());
   TensorVariant broadcasted_rhs(rhs, res.getShape());
@@ -41,26 +42,27 @@ void MaxImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorV
   Tensor<T> rhs_accessor(broadcasted_rhs);
   Tensor<T> res_accessor(res);
 
-  for (const auto &index : ShapeRange(res.getShape()))
-  {
+  parallelForEachIndex(res.getShape(), thread_pool, [&](const Index &index) {
     res_accessor.at(index) = std::max(lhs_accessor.at(index), rhs_accessor.at(index));
-  }
+  });
 }
 template <> struct MaxImpl<uint8_t>
 {
-  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                  pepper::ThreadPool *)
   {
     throw std::runtime_error{"NYI"};
   };
 };
 
-void Max(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void Max(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+         pepper::ThreadPool *thread_pool)
 {
   if (lhs.getElementType() != rhs.getElementType())
   {
     throw std::runtime_error{"Max with different input types is unsupported"};
   }
-  dispatch<MaxImpl>(lhs.getElementType(), lhs, rhs, res);
+  dispatch<MaxImpl>(lhs.getElementType(), lhs, rhs, res, thread_pool);
 }
 
 } // namespace mir_interpreter
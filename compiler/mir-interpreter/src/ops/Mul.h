@@ -19,10 +19,13 @@
 
 #include "mir/TensorVariant.h"
 
+#include <pepper/threadpool.h>
+
 namespace mir_interpreter
 {
 
-void Mul(const mir::TensorVariant &lhs, const mir::TensorVariant &rhs, mir::TensorVariant &res);
+void Mul(const mir::TensorVariant &lhs, const mir::TensorVariant &rhs, mir::TensorVariant &res,
+         pepper::ThreadPool *thread_pool);
 
 } // namespace mir_interpreter
 
@@ -17,7 +17,6 @@
 #include "Sub.h"
 #include "Common.h"
 
-#include "mir/ShapeRange.h"
 #include "mir/Tensor.h"
 
 namespace mir_interpreter
@@ -27,11 +26,13 @@ using namespace mir;
 
 template <typename T> struct SubImpl
 {
-  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res);
+  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                  pepper::ThreadPool *thread_pool);
 };
 
 template <typename T>
-void SubImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void SubImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                     pepper::ThreadPool *thread_pool)
 {
   TensorVariant broadcasted_lhs(lhs, res.getShape());
   TensorVariant broadcasted_rhs(rhs, res.getShape());
@@ -39,23 +40,24 @@ void SubImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorV
   Tensor<T> rhs_accessor(broadcasted_rhs);
   Tensor<T> res_accessor(res);
 
-  for (const auto &index : ShapeRange(res.getShape()))
-  {
+  parallelForEachIndex(res.getShape(), thread_pool, [&](const Index &index) {
     res_accessor.at(index) = lhs_accessor.at(index) - rhs_accessor.at(index);
-  }
+  });
 }
 
 template <> struct SubImpl<uint8_t>
 {
-  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+  static void run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+                  pepper::ThreadPool *)
   {
     throw std::runtime_error{"NYI"};
   }
 };
 
-void Sub(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
+void Sub(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res,
+         pepper::ThreadPool *thread_pool)
 {
-  dispatch<SubImpl>(lhs.getElementType(), lhs, rhs, res);
+  dispatch<SubImpl>(lhs.getElementType(), lhs, rhs, res, thread_pool);
 };
 
 } // namespace mir_interpreter
@@ -19,10 +19,13 @@
 
 #include "mir/TensorVariant.h"
 
+#include <pepper/threadpool.h>
+
 namespace mir_interpreter
 {
 
-void Sub(const mir::TensorVariant &lhs, const mir::TensorVariant &rhs, mir::TensorVariant &res);
+void Sub(const mir::TensorVariant &lhs, const mir::TensorVariant &rhs, mir::TensorVariant &res,
+         pepper::ThreadPool *thread_pool);
 
 } // namespace mir_interpreter
 
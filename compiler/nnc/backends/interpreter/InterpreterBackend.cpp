@@ -15,6 +15,7 @@
  */
 
 #include <cstring>
+#include <memory>
 #include <utility>
 #include <vector>
 #include <fstream>
@@ -32,6 +33,7 @@
 #include "mir/Shape.h"
 
 #include "MirInterpreter.h"
+#include <pepper/threadpool.h>
 #include "backends/interpreter/InterpreterBackend.h"
 
 #include "mir/Graph.h"
@@ -129,8 +131,9 @@ static TensorVariant readTensorFromFile(const std::string &filename, const Tenso
   return TensorVariant(type, data.get());
 }
 
-InterpreterBackend::InterpreterBackend(std::string input_dir, std::string output_dir)
-  : _input_dir(std::move(input_dir)), _output_dir(std::move(output_dir))
+InterpreterBackend::InterpreterBackend(std::string input_dir, std::string output_dir,
+                                       uint32_t num_threads)
+  : _input_dir(std::move(input_dir)), _output_dir(std::move(output_dir)), _num_threads(num_threads)
 {
 }
 
@@ -138,7 +141,10 @@ void InterpreterBackend::run(mir::Graph *graph)
 {
   assert(graph);
 
-  mir_interpreter::MIRInterpreter interpreter;
+  std::unique_ptr<pepper::ThreadPool> thread_pool;
+  if (_num_threads != 1)
+    thread_pool = std::make_unique<pepper::ThreadPool>(_num_threads);
+  mir_interpreter::MIRInterpreter interpreter(thread_pool.get());
 
   for (const auto *input_op : graph->getInputs())
   {
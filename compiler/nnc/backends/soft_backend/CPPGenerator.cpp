@@ -235,6 +235,8 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
     const string &tName = _formattedTensors[out_tensor_id];
     out << "  std::shared_ptr<Tensor> " << tName << ";\n";
   }
+  // memory shared by temporary tensors
+  out << "  Tensor _arena;\n";
   // pointer to NN parameters
   out << "  char* _parameters;\n";
   out << "  size_t _paramSize;\n";
@@ -352,7 +354,13 @@ void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer
   assert(td.type == sir::TensorDescriptor::Type::temporary);
   (void)td;
   const string &t_name = _formattedTensors[constructor->tensorId];
-  out << "  Tensor " << t_name << ";\n";
+  const auto &arena_offsets = ma.getArenaOffsets();
+  auto arena_offset = arena_offsets.find(constructor->tensorId);
+  if (arena_offset != arena_offsets.end())
+    out << "  Tensor " << t_name << "(Shape(), _arena.getData() + " << arena_offset->second
+        << ");\n";
+  else
+    out << "  Tensor " << t_name << ";\n";
 }
 
 void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &ma,
@@ -362,6 +370,9 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
   const TensorDescriptor &td = ma.getTensors()[destructor->tensorId];
   assert(td.type == sir::TensorDescriptor::Type::temporary);
   (void)td;
+  // arena-backed tensors do not own memory
+  if (ma.getArenaOffsets().count(destructor->tensorId))
+    return;
   const string &t_name = _formattedTensors[destructor->tensorId];
   out << "  " << t_name << ".clean();\n";
 }
@@ -441,6 +452,9 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   // gen NN constructor
   out << class_name << "::" << class_name
       << "(const string& parametersPath)\n"
+         "  : _arena(Shape{"
+      << ma.getArenaSize()
+      << "})\n"
          "{\n"
          "  readParameters(_parameters, _paramSize, parametersPath, "
       << s.getFormatVersion() << ", " << s.getModelHash()
@@ -20,8 +20,10 @@
 #include "mir/Graph.h"
 #include "mir/OpDefs.h"
 
+#include <algorithm>
 #include <stack>
 #include <map>
+#include <set>
 
 using namespace std;
 
@@ -31,6 +33,71 @@ namespace nnc
 using namespace mir;
 using namespace sir;
 
+namespace
+{
+
+// Offsets of tensors in arena are aligned to 64 bytes
+const size_t ARENA_ALIGNMENT = 64 / sizeof(float);
+
+size_t alignArenaOffset(size_t offset)
+{
+  return (offset + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+}
+
+bool isConstant(const Operation::Output *output)
+{
+  return output->getNode()->getType() == Operation::Type::constant;
+}
+
+/**
+ * @brief Checks that constant operand can be indexed in fused loop without general broadcasting:
+ * it is a scalar, has the same shape as result or is broadcasted along the last dimension.
+ */
+bool isFusibleOperandShape(const Shape &operand_shape, const Shape &out_shape)
+{
+  if (operand_shape.numElements() == 1 || operand_shape == out_shape)
+    return true;
+  if (operand_shape.rank() == 0 || out_shape.rank() == 0)
+    return false;
+  const int32_t last_dim = out_shape.dim(-1);
+  return operand_shape.dim(-1) == last_dim && operand_shape.numElements() == last_dim;
+}
+
+/**
+ * @brief Returns input of operation that carries value computed by the previous operation
+ * of elementwise chain, nullptr if operation can not be fused into a chain
+ */
+const Operation::Output *getChainedInput(const Operation *op)
+{
+  switch (op->getType())
+  {
+    case Operation::Type::ReLU:
+    case Operation::Type::cappedReLU:
+      return op->getInput(0);
+    case Operation::Type::add:
+    case Operation::Type::sub:
+    case Operation::Type::mul:
+    case Operation::Type::div:
+    case Operation::Type::max:
+    {
+      const Operation::Output *lhs = op->getInput(0);
+      const Operation::Output *rhs = op->getInput(1);
+      if (isConstant(lhs) == isConstant(rhs))
+        return nullptr;
+      const Operation::Output *value = isConstant(lhs) ? rhs : lhs;
+      const Operation::Output *operand = isConstant(lhs) ? lhs : rhs;
+      const Shape &out_shape = op->getOutputShape(0);
+      if (value->getShape() != out_shape || !isFusibleOperandShape(operand->getShape(), out_shape))
+        return nullptr;
+      return value;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+} // namespace
+
 void ModelAnalyzer::appendOperationToInference(Operation *op, const string &function_name,
                                                std::vector<size_t> aux_args)
 {
@@ -61,8 +128,8 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
     for (const auto &output : op->getOutputs())
     {
       const auto &tensor_name = output.getName();
-      const auto tensor_id =
-        tensor_name.empty() ? declareTemporaryTensor() : declarePersistentTensor(tensor_name);
+      const auto tensor_id = tensor_name.empty() ? declareArenaTensor(output.getShape())
+                                                 : declarePersistentTensor(tensor_name);
       node_output_tensors.push_back(tensor_id);
     }
   }
@@ -117,6 +184,13 @@ size_t ModelAnalyzer::declareTemporaryTensor()
   return id;
 }
 
+size_t ModelAnalyzer::declareArenaTensor(const mir::Shape &shape)
+{
+  size_t id = declareTemporaryTensor();
+  _arena_candidates[id] = static_cast<size_t>(shape.numElements());
+  return id;
+}
+
 void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_order,
                                      map<size_t, size_t> &first_def, map<size_t, size_t> &last_use)
 {
@@ -150,6 +224,154 @@ void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_orde
   }
 }
 
+void ModelAnalyzer::fuseElementwiseChains()
+{
+  set<const Operation *> absorbed;
+  // maps last operation of chain to call that evaluates the whole chain
+  map<const Operation *, unique_ptr<Action>> fused_calls;
+
+  for (const unique_ptr<Action> &action : _inferenceSequence)
+  {
+    const CallFunction *call = dynamic_cast<CallFunction *>(action.get());
+    assert(call);
+    Operation *op = call->mirOp;
+    if (absorbed.count(op) || getChainedInput(op) == nullptr)
+      continue;
+
+    vector<Operation *> chain{op};
+    while (true)
+    {
+      const Operation::Output *result = chain.back()->getOutput(0);
+      if (!result->getName().empty() || result->getUses().size() != 1)
+        break;
+      Operation *next = result->getUses()[0].getNode();
+      if (getChainedInput(next) != result)
+        break;
+      chain.push_back(next);
+    }
+    // single operation gains nothing from fusion
+    if (chain.size() < 2)
+      continue;
+
+    // first input is the value chain starts from, then constant operands in order of usage
+    vector<size_t> inputs;
+    for (Operation *chained : chain)
+    {
+      auto chained_call = dynamic_cast<const CallFunction *>(_opToDescr[chained]);
+      assert(chained_call);
+      const Operation::Output *chained_input = getChainedInput(chained);
+      for (size_t i = 0; i < chained->getNumInputs(); ++i)
+      {
+        const Operation::Output *input = chained->getInput(i);
+        if (input == chained_input)
+        {
+          if (chained == op)
+            inputs.insert(inputs.begin(), chained_call->inputs[i]);
+        }
+        else
+        {
+          assert(isConstant(input));
+          inputs.push_back(chained_call->inputs[i]);
+        }
+      }
+      absorbed.insert(chained);
+    }
+
+    Operation *last = chain.back();
+    auto last_call = dynamic_cast<const CallFunction *>(_opToDescr[last]);
+    vector<size_t> outputs(last_call->outputs);
+    unique_ptr<CallFunction> fused_call(
+      new CallFunction(last, "fusedElementwise", std::move(inputs), std::move(outputs)));
+    fused_call->fusedOps = std::move(chain);
+    fused_calls[last] = std::move(fused_call);
+  }
+
+  if (fused_calls.empty())
+    return;
+
+  // Fused call takes place of the last operation in chain, all operands are computed before it
+  std::vector<unique_ptr<Action>> old_inference_seq;
+  old_inference_seq.swap(_inferenceSequence);
+  for (unique_ptr<Action> &action : old_inference_seq)
+  {
+    const CallFunction *call = dynamic_cast<CallFunction *>(action.get());
+    const Operation *op = call->mirOp;
+    if (!absorbed.count(op))
+    {
+      _inferenceSequence.push_back(std::move(action));
+      continue;
+    }
+    auto fused = fused_calls.find(op);
+    if (fused != fused_calls.end())
+    {
+      _inferenceSequence.push_back(std::move(fused->second));
+      _opToDescr[op] = _inferenceSequence.back().get();
+    }
+    else
+    {
+      // call of absorbed operation is destroyed with old sequence
+      _opToDescr.erase(op);
+    }
+  }
+}
+
+void ModelAnalyzer::planArena(const map<size_t, size_t> &first_def,
+                              const map<size_t, size_t> &last_use)
+{
+  struct Placement
+  {
+    size_t def;
+    size_t use;
+    size_t offset;
+    size_t size;
+  };
+
+  vector<pair<size_t, size_t>> candidates; // (size, tensor id)
+  for (const auto &def : first_def)
+  {
+    auto it = _arena_candidates.find(def.first);
+    if (it != _arena_candidates.end())
+      candidates.emplace_back(alignArenaOffset(it->second), def.first);
+  }
+  // place large tensors first, tensor id makes order deterministic
+  sort(candidates.begin(), candidates.end(),
+       [](const pair<size_t, size_t> &a, const pair<size_t, size_t> &b) {
+         return a.first != b.first ? a.first > b.first : a.second < b.second;
+       });
+
+  vector<Placement> placed;
+  for (const auto &candidate : candidates)
+  {
+    const size_t size = candidate.first;
+    const size_t id = candidate.second;
+    const size_t def = first_def.at(id);
+    const size_t use = last_use.count(id) ? last_use.at(id) : def;
+
+    // tensors alive at the same time as current one, ordered by offset
+    vector<const Placement *> alive;
+    for (const Placement &p : placed)
+    {
+      if (p.def <= use && def <= p.use)
+        alive.push_back(&p);
+    }
+    sort(alive.begin(), alive.end(),
+         [](const Placement *a, const Placement *b) { return a->offset < b->offset; });
+
+    // first fit
+    size_t offset = 0;
+    for (const Placement *p : alive)
+    {
+      if (offset + size <= p->offset)
+        break;
+      offset = std::max(offset, p->offset + p->size);
+    }
+
+    placed.push_back({def, use, offset, size});
+    _arena_offsets[id] = offset;
+    _arena_size = std::max(_arena_size, offset + size);
+  }
+}
+
 void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_order)
 {
   // Run inference sequence construction over constructed list of operations
@@ -159,6 +381,8 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
     node->accept(this);
   }
 
+  fuseElementwiseChains();
+
   // Insert temporary tensor constructors
   // map temporary tensor id to index in original sequence where it was defined/used first/last time
   map<size_t, size_t> first_def;
@@ -167,6 +391,9 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
   // prepare use-def info
   gatherDefUseInfo(_inferenceSequence, first_def, last_use);
 
+  // share memory between temporary tensors with non-overlapping lifetimes
+  planArena(first_def, last_use);
+
   // insert memory operations
   // Every iteration of loop contains three steps:
   // 1) insert constructors of temporary tensors used in current operations
@@ -123,6 +123,16 @@ public:
 
   size_t getTempTID() const { return _temp_tensor_id; }
 
+  /**
+   * @return Number of float elements in shared arena that backs temporary tensors
+   */
+  size_t getArenaSize() const { return _arena_size; }
+
+  /**
+   * @return Maps id of arena-backed temporary tensor to its offset in arena (in elements)
+   */
+  const std::map<size_t, size_t> &getArenaOffsets() const { return _arena_offsets; }
+
 protected:
   void visit_fallback(mir::Operation &op) override;
 
@@ -167,6 +177,13 @@ private:
    */
   size_t declareTemporaryTensor();
 
+  /**
+   * @brief Declares temporary tensor which data can be placed into shared arena
+   * @param shape Shape of tensor known at compilation time
+   * @return Id of created tensor
+   */
+  size_t declareArenaTensor(const mir::Shape &shape);
+
   /**
    * @brief Gathers info where tensors were defined and used in inference sequence
    * @param sequence Sequence of operations in inference
@@ -176,6 +193,22 @@ private:
   void gatherDefUseInfo(const std::vector<std::unique_ptr<sir::Action>> &post_order,
                         std::map<size_t, size_t> &first_def, std::map<size_t, size_t> &last_use);
 
+  /**
+   * @brief Replaces chains of elementwise operations with single fused calls
+   *
+   * Chain consists of Relu, CappedRelu and binary elementwise operations with constant operand,
+   * where every intermediate result is temporary and used only by next operation of the chain.
+   */
+  void fuseElementwiseChains();
+
+  /**
+   * @brief Assigns offsets in shared arena to temporary tensors with non-overlapping lifetimes
+   * @param first_def Maps tensor id to position in inf sequence where it was defined first time.
+   * @param last_use Maps tensor id to position in inf sequence where it was used last time.
+   */
+  void planArena(const std::map<size_t, size_t> &first_def,
+                 const std::map<size_t, size_t> &last_use);
+
   /**
    * @brief constructs inference sequence from vector of mir::Operations, constructed
    * @param post_order vector representing layout of operations in inference
@@ -198,6 +231,10 @@ private:
   std::vector<size_t> _outputs;
   size_t _max_temp_size = 0;
   size_t _temp_tensor_id = 0;
+  /// @brief number of elements in tensors that can be placed into arena
+  std::map<size_t, size_t> _arena_candidates;
+  std::map<size_t, size_t> _arena_offsets;
+  size_t _arena_size = 0;
   std::vector<sir::TensorDescriptor> _tensors;
   std::map<const mir::Operation *, const sir::Action *> _opToDescr;
 };
@@ -20,6 +20,8 @@
 
 #include "mir/OpDefs.h"
 
+#include "CommonData.def"
+
 #include <algorithm>
 
 #define UNUSED(x) ((void)(x))
@@ -352,6 +354,65 @@ void Serializer::visit(mir::ops::LeakyReluOp &op)
   serializeShape(op.getOutputShape(0));
 }
 
+void Serializer::serializeFusedElementwise(const sir::CallFunction &call)
+{
+  const Shape &out_shape = call.mirOp->getOutputShape(0);
+  serializeShape(out_shape);
+  serializeT<int32_t>(call.fusedOps.size());
+  for (const mir::Operation *op : call.fusedOps)
+  {
+    FusedStepType step_type;
+    float param = 0.0f;
+    switch (op->getType())
+    {
+      case mir::Operation::Type::ReLU:
+        step_type = FusedStepType::RELU;
+        break;
+      case mir::Operation::Type::cappedReLU:
+        step_type = FusedStepType::CAPPED_RELU;
+        param = dynamic_cast<const ops::CappedReluOp *>(op)->getCap();
+        break;
+      case mir::Operation::Type::add:
+        step_type = FusedStepType::ADD;
+        break;
+      case mir::Operation::Type::sub:
+        step_type = FusedStepType::SUB;
+        break;
+      case mir::Operation::Type::mul:
+        step_type = FusedStepType::MUL;
+        break;
+      case mir::Operation::Type::div:
+        step_type = FusedStepType::DIV;
+        break;
+      case mir::Operation::Type::max:
+        step_type = FusedStepType::MAX;
+        break;
+      default:
+        throw std::runtime_error("Unsupported operation in fused elementwise chain");
+    }
+
+    FusedOperandType operand_type = FusedOperandType::NONE;
+    // operand is the first argument of step, matters for Sub and Div
+    int32_t operand_is_lhs = 0;
+    if (op->getNumInputs() == 2)
+    {
+      operand_is_lhs = op->getInput(0)->getNode()->getType() == mir::Operation::Type::constant;
+      const Shape &operand_shape = op->getInputShape(operand_is_lhs ? 0 : 1);
+      if (operand_shape.numElements() == 1)
+        operand_type = FusedOperandType::SCALAR;
+      else if (operand_shape == out_shape)
+        operand_type = FusedOperandType::FULL;
+      else
+        operand_type = FusedOperandType::LAST_DIM;
+    }
+
+    serializeT<int32_t>(etoi(step_type));
+    serializeT<float>(param);
+    serializeT<int32_t>(etoi(operand_type));
+    serializeT<int32_t>(operand_is_lhs);
+  }
+}
+
 void Serializer::serialize(vector<unique_ptr<sir::Action>> &inference_sequence)
 {
   for (unique_ptr<sir::Action> &action : inference_sequence)
@@ -359,6 +420,12 @@ void Serializer::serialize(vector<unique_ptr<sir::Action>> &inference_sequence)
     if (action->type != sir::Action::Type::callFunction)
       continue;
     _curOp = dynamic_cast<sir::CallFunction *>(action.get());
+    if (!_curOp->fusedOps.empty())
+    {
+      _curOp->paramStartOffset = _buffer.size();
+      serializeFusedElementwise(*_curOp);
+      continue;
+    }
     _curOp->mirOp->accept(this);
   }
 }
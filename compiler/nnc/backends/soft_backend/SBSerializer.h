@@ -122,6 +122,11 @@ private:
    * @param padsRank Number of pads to serialize
    */
   template <class Op> void serializePads(const Op &op, int32_t number_of_pads);
+  /**
+   * @brief Serialize steps of fused elementwise call
+   * @param call Call that evaluates chain of elementwise operations
+   */
+  void serializeFusedElementwise(const sir::CallFunction &call);
 
   sir::CallFunction *_curOp = nullptr;
   const uint32_t _formatVersion = 1;
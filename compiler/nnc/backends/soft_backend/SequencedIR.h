@@ -135,6 +135,8 @@ struct CallFunction : public Action
   // list of output tensors
   std::vector<size_t> outputs;
   size_t paramStartOffset;
+  // elementwise operations evaluated in one pass by this call, empty for regular calls
+  std::vector<mir::Operation *> fusedOps;
 };
 
 } // namespace sir
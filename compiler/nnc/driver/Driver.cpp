@@ -125,7 +125,7 @@ static void backend(mir::Graph *graph)
   }
   else if (cli::target == NNC_TARGET_INTERPRETER)
   {
-    InterpreterBackend(cli::interInputDataDir, cli::artifactDir).run(graph);
+    InterpreterBackend(cli::interInputDataDir, cli::artifactDir, cli::interNumThreads).run(graph);
   }
   else
   {
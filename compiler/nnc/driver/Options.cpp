@@ -132,6 +132,10 @@ Option<std::string> interInputDataDir(optname("--input-data-dir"),
                                                "(one file for each input with the same name)"),
                                       ".", // default is current directory
                                       optional(true), optvalues(""), checkInDir);
+Option<uint32_t> interNumThreads(optname("--interpreter-threads"),
+                                 overview("number of threads to run heavy operations with "
+                                          "(0 means all hardware threads)"),
+                                 1, optional(true));
 
 } // namespace cli
 } // namespace nnc
@@ -61,6 +61,7 @@ extern Option<std::string> artifactName; // name of artifact
  * Options for interpreter
  */
 extern Option<std::string> interInputDataDir; // directory with input data files
+extern Option<uint32_t> interNumThreads;      // number of interpreter threads
 
 } // namespace cli
 } // namespace nnc
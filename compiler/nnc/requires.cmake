@@ -1,3 +1,4 @@
 require("adtidas")
 require("mir")
 require("mir-interpreter")
+require("pepper-threadpool")
@@ -1006,3 +1006,58 @@ TEST(cpp_operation_test, broadcast)
     createAndRunTestGraph(op_generator, broadcast, input_ntensors, input_atensor);
   }
 }
+
+TEST(cpp_operations_test, fused_elementwise)
+{
+  // shape is large enough for several blocks of fused loop
+  vector<int> shape_data{3, 7, 11, 5};
+  vector<Tensor> input_atensors(5);
+  vector<unique_ptr<mir::TensorVariant>> input_ntensors(5);
+  fillTensors(input_ntensors[0], input_atensors[0], shape_data, 1.0f);
+  fillTensors(input_ntensors[1], input_atensors[1], {5}, 2.0f);
+  fillTensors(input_ntensors[2], input_atensors[2], {1}, 3.0f);
+  fillTensors(input_ntensors[3], input_atensors[3], shape_data, 4.0f);
+  fillTensors(input_ntensors[4], input_atensors[4], {1}, 5.0f);
+
+  // chain uses every step and operand kind, constant operands are on both sides
+  vector<mir::Operation *> chain;
+  auto op_generator = [&chain](mir::Graph &g,
+                               const std::vector<mir::Operation::Output *> &inputs) {
+    mir::Operation *op = g.create<mir::ops::ReluOp>(inputs[0]);
+    chain.push_back(op);
+    op = g.create<mir::ops::AddOp>(op->getOutput(0), inputs[1]);
+    chain.push_back(op);
+    op = g.create<mir::ops::MulOp>(inputs[2], op->getOutput(0));
+    chain.push_back(op);
+    op = g.create<mir::ops::SubOp>(inputs[3], op->getOutput(0));
+    chain.push_back(op);
+    op = g.create<mir::ops::CappedReluOp>(op->getOutput(0), 1.5f);
+    chain.push_back(op);
+    op = g.create<mir::ops::MaxOp>(op->getOutput(0), inputs[3]);
+    chain.push_back(op);
+    op = g.create<mir::ops::DivOp>(op->getOutput(0), inputs[4]);
+    chain.push_back(op);
+    return op;
+  };
+
+  mir::Graph g;
+  mir::Operation *last = fillGraph(g, op_generator, input_ntensors);
+
+  vector<unique_ptr<sir::Action>> inference_sequence;
+  unique_ptr<sir::CallFunction> fused_call(new sir::CallFunction);
+  fused_call->mirOp = last;
+  fused_call->fusedOps = chain;
+  inference_sequence.push_back(std::move(fused_call));
+  Serializer serializer;
+  serializer.serialize(inference_sequence);
+
+  // interpreter evaluates operations of chain one by one
+  mir::TensorVariant unfused_output = getReferenceTensor(g, last);
+
+  Tensor fused_output;
+  fusedElementwise(fused_output, serializer.getBuffer().data(), input_atensors[0],
+                   input_atensors[1], input_atensors[2], input_atensors[3], input_atensors[3],
+                   input_atensors[4]);
+
+  compareResults(unfused_output, fused_output);
+}
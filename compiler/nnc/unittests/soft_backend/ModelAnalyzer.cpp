@@ -16,9 +16,13 @@
 
 #include "ModelAnalyzer.h"
 #include "mir/Graph.h"
+#include "mir/ops/AddOp.h"
+#include "mir/ops/ConcatOp.h"
+#include "mir/ops/ConstantOp.h"
 #include "mir/ops/InputOp.h"
+#include "mir/ops/OutputOp.h"
 #include "mir/ops/ReluOp.h"
-#include "mir/ops/ConcatOp.h"
+#include "mir/ops/TanhOp.h"
 
 #include <gtest/gtest.h>
 
@@ -81,3 +85,80 @@ TEST(ModelAnalyzer, linearization)
   vector<Operation *> valid_seq2{input, head2, tail2, head1, tail1, join};
   ASSERT_TRUE(op_seq == valid_seq1 || op_seq == valid_seq2);
 }
+
+TEST(ModelAnalyzer, fuse_elementwise_chain)
+{
+  mir::Graph g;
+  /*
+   * Create graph:
+   *   [input]  [bias]
+   *       \     /
+   *        [add]
+   *          |
+   *        [relu]
+   *          |
+   *       [output]
+   */
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  mir::TensorType bias_type{mir::DataType::FLOAT32, Shape{3}};
+  std::vector<float> bias_data{1.0f, 2.0f, 3.0f};
+  Operation *bias = g.create<ops::ConstantOp>(mir::TensorVariant(bias_type, bias_data.data()));
+  Operation *add = g.create<ops::AddOp>(input->getOutput(0), bias->getOutput(0));
+  Operation *relu = g.create<ops::ReluOp>(add->getOutput(0));
+  g.create<ops::OutputOp>(relu->getOutput(0));
+  input->getOutput(0)->setName("input");
+  relu->getOutput(0)->setName("relu");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  const CallFunction *fused = nullptr;
+  for (const auto &action : ma.getInferenceSequence())
+  {
+    const CallFunction *call = getCall(action);
+    if (call == nullptr)
+      continue;
+    ASSERT_NE(call->mirOp, add);
+    if (call->funcName == "fusedElementwise")
+      fused = call;
+  }
+  ASSERT_NE(fused, nullptr);
+  ASSERT_EQ(fused->fusedOps, (vector<Operation *>{add, relu}));
+  ASSERT_EQ(fused->inputs.size(), 2u);
+  ASSERT_EQ(fused->outputs.size(), 1u);
+}
+
+TEST(ModelAnalyzer, arena_reuse)
+{
+  mir::Graph g;
+  // Create graph: [input] -> [tanh1] -> [tanh2] -> [tanh3] -> [tanh4] -> [output]
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *tanh1 = g.create<ops::TanhOp>(input->getOutput(0));
+  Operation *tanh2 = g.create<ops::TanhOp>(tanh1->getOutput(0));
+  Operation *tanh3 = g.create<ops::TanhOp>(tanh2->getOutput(0));
+  Operation *tanh4 = g.create<ops::TanhOp>(tanh3->getOutput(0));
+  g.create<ops::OutputOp>(tanh4->getOutput(0));
+  input->getOutput(0)->setName("input");
+  tanh4->getOutput(0)->setName("tanh4");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  map<const Operation *, size_t> tensor_ids;
+  for (const auto &action : ma.getInferenceSequence())
+  {
+    const CallFunction *call = getCall(action);
+    if (call != nullptr && !call->outputs.empty())
+      tensor_ids[call->mirOp] = call->outputs[0];
+  }
+
+  const auto &offsets = ma.getArenaOffsets();
+  ASSERT_EQ(offsets.size(), 3u);
+  // lifetimes of tanh1 and tanh3 results do not overlap, so they share memory
+  ASSERT_EQ(offsets.at(tensor_ids[tanh1]), offsets.at(tensor_ids[tanh3]));
+  ASSERT_NE(offsets.at(tensor_ids[tanh1]), offsets.at(tensor_ids[tanh2]));
+  ASSERT_EQ(offsets.count(tensor_ids[tanh4]), 0u);
+  ASSERT_EQ(ma.getArenaSize(), 32u);
+}
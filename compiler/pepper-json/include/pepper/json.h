@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PEPPER_JSON_H__
+#define __PEPPER_JSON_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace pepper
+{
+
+/**
+ * @brief Reader which walks through a JSON document from the beginning
+ *
+ * NOTE Numbers are read as integers, as other kinds of numbers are not needed yet
+ */
+class JsonReader final
+{
+public:
+  /**
+   * @param json    Document to read
+   * @param context Beginning of error messages, e.g. "Invalid exec_time file"
+   */
+  JsonReader(const std::string &json, const std::string &context);
+
+public:
+  /// @brief Read an object, calling member for each key to read its value
+  void object(const std::function<void(const std::string &key)> &member);
+  /// @brief Read an array, calling element to read each element
+  void array(const std::function<void(void)> &element);
+
+  std::string string(void);
+  uint64_t uint64(void);
+  int64_t int64(void);
+
+  /// @brief Skip a value of any kind
+  void skip(void);
+  /// @brief Check that nothing but spaces is left
+  void end(void);
+
+  /// @brief Throw std::runtime_error with the current position
+  [[noreturn]] void error(const std::string &msg) const;
+
+private:
+  uint32_t hex4(void);
+  void skip_spaces(void);
+  bool consume(char c);
+  void expect(char c);
+
+private:
+  const std::string _json;
+  const std::string _context;
+  size_t _pos = 0;
+};
+
+} // namespace pepper
+
+#endif // __PEPPER_JSON_H__
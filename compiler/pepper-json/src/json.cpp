@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pepper/json.h"
+
+#include <cctype>
+#include <stdexcept>
+
+namespace
+{
+
+void append_utf8(std::string &str, uint32_t code)
+{
+  if (code < 0x80)
+    str += static_cast<char>(code);
+  else if (code < 0x800)
+  {
+    str += static_cast<char>(0xC0 | (code >> 6));
+    str += static_cast<char>(0x80 | (code & 0x3F));
+  }
+  else
+  {
+    str += static_cast<char>(0xE0 | (code >> 12));
+    str += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+    str += static_cast<char>(0x80 | (code & 0x3F));
+  }
+}
+
+bool is_digit(char c) { return std::isdigit(static_cast<unsigned char>(c)); }
+
+} // namespace
+
+namespace pepper
+{
+
+JsonReader::JsonReader(const std::string &json, const std::string &context)
+  : _json{json}, _context{context}
+{
+  // DO NOTHING
+}
+
+void JsonReader::object(const std::function<void(const std::string &key)> &member)
+{
+  expect('{');
+  if (consume('}'))
+    return;
+  do
+  {
+    auto key = string();
+    expect(':');
+    member(key);
+  } while (consume(','));
+  expect('}');
+}
+
+void JsonReader::array(const std::function<void(void)> &element)
+{
+  expect('[');
+  if (consume(']'))
+    return;
+  do
+  {
+    element();
+  } while (consume(','));
+  expect(']');
+}
+
+std::string JsonReader::string(void)
+{
+  expect('"');
+
+  std::string str;
+  while (true)
+  {
+    if (_pos >= _json.size())
+      error("unterminated string");
+
+    char c = _json[_pos++];
+    if (c == '"')
+      break;
+    if (c != '\\')
+    {
+      str += c;
+      continue;
+    }
+
+    if (_pos >= _json.size())
+      error("unterminated string");
+
+    c = _json[_pos++];
+    switch (c)
+    {
+      case 'b':
+        str += '\b';
+        break;
+      case 'f':
+        str += '\f';
+        break;
+      case 'n':
+        str += '\n';
+        break;
+      case 'r':
+        str += '\r';
+        break;
+      case 't':
+        str += '\t';
+        break;
+      case 'u':
+        append_utf8(str, hex4());
+        break;
+      default:
+        // '"', '\\' and '/'
+        str += c;
+        break;
+    }
+  }
+  return str;
+}
+
+uint64_t JsonReader::uint64(void)
+{
+  skip_spaces();
+
+  if (_pos >= _json.size() || !is_digit(_json[_pos]))
+    error("expected unsigned integer");
+
+  uint64_t value = 0;
+  while (_pos < _json.size() && is_digit(_json[_pos]))
+  {
+    value = value * 10 + static_cast<uint64_t>(_json[_pos++] - '0');
+  }
+  return value;
+}
+
+int64_t JsonReader::int64(void)
+{
+  skip_spaces();
+
+  const bool negative = _pos < _json.size() && _json[_pos] == '-';
+  if (negative)
+    ++_pos;
+  if (_pos >= _json.size() || !is_digit(_json[_pos]))
+    error("expected integer");
+
+  const auto value = static_cast<int64_t>(uint64());
+  return negative ? -value : value;
+}
+
+void JsonReader::skip(void)
+{
+  skip_spaces();
+  if (_pos >= _json.size())
+    error("unexpected end");
+
+  char c = _json[_pos];
+  if (c == '{')
+    object([&](const std::string &) { skip(); });
+  else if (c == '[')
+    array([&]() { skip(); });
+  else if (c == '"')
+    string();
+  else
+  {
+    // number, true, false or null
+    const auto begin = _pos;
+    while (_pos < _json.size() && (std::isalnum(static_cast<unsigned char>(_json[_pos])) ||
+                                   _json[_pos] == '-' || _json[_pos] == '+' ||
+                                   _json[_pos] == '.'))
+      ++_pos;
+    if (_pos == begin)
+      error("expected value");
+  }
+}
+
+void JsonReader::end(void)
+{
+  skip_spaces();
+  if (_pos != _json.size())
+    error("trailing characters");
+}
+
+void JsonReader::error(const std::string &msg) const
+{
+  throw std::runtime_error(_context + " at " + std::to_string(_pos) + ": " + msg);
+}
+
+uint32_t JsonReader::hex4(void)
+{
+  if (_pos + 4 > _json.size())
+    error("invalid escape");
+
+  uint32_t code = 0;
+  for (uint32_t n = 0; n < 4; ++n)
+  {
+    char c = _json[_pos++];
+    if (!std::isxdigit(static_cast<unsigned char>(c)))
+      error("invalid escape");
+    auto digit = is_digit(c) ? c - '0' : std::tolower(c) - 'a' + 10;
+    code = code * 16 + static_cast<uint32_t>(digit);
+  }
+  return code;
+}
+
+void JsonReader::skip_spaces(void)
+{
+  while (_pos < _json.size() && std::isspace(static_cast<unsigned char>(_json[_pos])))
+    ++_pos;
+}
+
+bool JsonReader::consume(char c)
+{
+  skip_spaces();
+  if (_pos < _json.size() && _json[_pos] == c)
+  {
+    ++_pos;
+    return true;
+  }
+  return false;
+}
+
+void JsonReader::expect(char c)
+{
+  if (!consume(c))
+    error(std::string("expected '") + c + "'");
+}
+
+} // namespace pepper
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pepper/json.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+TEST(JsonReaderTest, object)
+{
+  pepper::JsonReader reader{R"( {"name": "a\"b\u00e9", "shape": [1, 23], "delta": -4,
+                                 "extra": {"x": [true, null, 1.5e3, "y"]}} )",
+                            "test"};
+
+  std::string name;
+  std::vector<uint64_t> shape;
+  int64_t delta = 0;
+  reader.object([&](const std::string &key) {
+    if (key == "name")
+      name = reader.string();
+    else if (key == "shape")
+      reader.array([&]() { shape.push_back(reader.uint64()); });
+    else if (key == "delta")
+      delta = reader.int64();
+    else
+      reader.skip();
+  });
+  reader.end();
+
+  EXPECT_EQ("a\"b\xc3\xa9", name);
+  ASSERT_EQ(2, shape.size());
+  EXPECT_EQ(1, shape.at(0));
+  EXPECT_EQ(23, shape.at(1));
+  EXPECT_EQ(-4, delta);
+}
+
+TEST(JsonReaderTest, empty)
+{
+  pepper::JsonReader reader{"{}", "test"};
+
+  uint32_t members = 0;
+  reader.object([&](const std::string &) { ++members; });
+  reader.end();
+
+  EXPECT_EQ(0, members);
+}
+
+TEST(JsonReaderTest, context_NEG)
+{
+  pepper::JsonReader reader{"[1 2]", "Invalid test file"};
+
+  try
+  {
+    reader.array([&]() { reader.uint64(); });
+    FAIL();
+  }
+  catch (const std::runtime_error &e)
+  {
+    EXPECT_EQ(std::string("Invalid test file at 3: expected ']'"), e.what());
+  }
+}
+
+TEST(JsonReaderTest, not_closed_NEG)
+{
+  pepper::JsonReader reader{R"({"key)", "test"};
+
+  EXPECT_THROW(reader.object([&](const std::string &) { reader.skip(); }), std::runtime_error);
+}
+
+TEST(JsonReaderTest, not_number_NEG)
+{
+  pepper::JsonReader reader{"[five]", "test"};
+
+  EXPECT_THROW(reader.array([&]() { reader.int64(); }), std::runtime_error);
+}
+
+TEST(JsonReaderTest, trailing_NEG)
+{
+  pepper::JsonReader reader{"{} {}", "test"};
+
+  reader.object([&](const std::string &) { reader.skip(); });
+  EXPECT_THROW(reader.end(), std::runtime_error);
+}
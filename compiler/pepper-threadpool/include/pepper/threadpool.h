@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PEPPER_THREADPOOL_H__
+#define __PEPPER_THREADPOOL_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pepper
+{
+
+/**
+ * @brief Fixed-size pool of worker threads
+ *
+ * NOTE The thread which calls parallel_for takes part in the work, so a pool of N threads
+ *      owns N - 1 workers.
+ */
+class ThreadPool final
+{
+public:
+  /**
+   * @param num_threads Number of threads including the calling one,
+   *                    0 means the number of hardware threads
+   */
+  explicit ThreadPool(uint32_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+public:
+  uint32_t num_threads(void) const { return static_cast<uint32_t>(_workers.size()) + 1; }
+
+  /**
+   * @brief Split [0, total) into contiguous ranges of at least "grain" elements and
+   *        call "fn(begin, end)" for each of them in parallel
+   *
+   * Returns when all ranges are processed. The first exception thrown by "fn" is rethrown.
+   */
+  void parallel_for(int64_t total, int64_t grain,
+                    const std::function<void(int64_t, int64_t)> &fn);
+
+  /**
+   * @brief Run "task" on one of the workers (or inline if the pool has no workers)
+   */
+  void submit(std::function<void(void)> task);
+
+private:
+  void work(void);
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<std::function<void(void)>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop = false;
+};
+
+/**
+ * @brief Same as ThreadPool::parallel_for, but runs "fn" inline when "pool" is nullptr
+ */
+inline void parallel_for(ThreadPool *pool, int64_t total, int64_t grain,
+                         const std::function<void(int64_t, int64_t)> &fn)
+{
+  if (pool == nullptr)
+  {
+    if (total > 0)
+      fn(0, total);
+    return;
+  }
+  pool->parallel_for(total, grain, fn);
+}
+
+} // namespace pepper
+
+#endif // __PEPPER_THREADPOOL_H__
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pepper/threadpool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace
+{
+
+// Ranges processed by one parallel_for call
+struct Job
+{
+  const std::function<void(int64_t, int64_t)> *fn = nullptr;
+  int64_t total = 0;
+  int64_t chunk = 0;
+  int64_t num_chunks = 0;
+
+  std::atomic<int64_t> next{0};
+  std::atomic<int64_t> done{0};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::exception_ptr error;
+
+  // Process chunks until there are no unclaimed ones
+  void run(void)
+  {
+    int64_t index;
+    while ((index = next.fetch_add(1)) < num_chunks)
+    {
+      const int64_t begin = index * chunk;
+      const int64_t end = std::min(total, begin + chunk);
+      try
+      {
+        (*fn)(begin, end);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error)
+          error = std::current_exception();
+      }
+      if (done.fetch_add(1) + 1 == num_chunks)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+      }
+    }
+  }
+};
+
+} // namespace
+
+namespace pepper
+{
+
+ThreadPool::ThreadPool(uint32_t num_threads)
+{
+  if (num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  for (uint32_t i = 1; i < num_threads; ++i)
+    _workers.emplace_back([this] { work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  for (auto &worker : _workers)
+    worker.join();
+}
+
+void ThreadPool::work(void)
+{
+  while (true)
+  {
+    std::function<void(void)> task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+      if (_tasks.empty())
+        return;
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+void ThreadPool::submit(std::function<void(void)> task)
+{
+  if (_workers.empty())
+  {
+    task();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.emplace_back(std::move(task));
+  }
+  _cv.notify_one();
+}
+
+void ThreadPool::parallel_for(int64_t total, int64_t grain,
+                              const std::function<void(int64_t, int64_t)> &fn)
+{
+  if (total <= 0)
+    return;
+
+  grain = std::max<int64_t>(grain, 1);
+  // A few chunks per thread balance the load when ranges are not equally expensive
+  const int64_t max_chunks = static_cast<int64_t>(num_threads()) * 4;
+  const int64_t num_chunks = std::min(max_chunks, (total + grain - 1) / grain);
+  if (num_chunks <= 1 || _workers.empty())
+  {
+    fn(0, total);
+    return;
+  }
+
+  auto job = std::make_shared<Job>();
+  job->fn = &fn;
+  job->total = total;
+  job->chunk = (total + num_chunks - 1) / num_chunks;
+  job->num_chunks = (total + job->chunk - 1) / job->chunk;
+
+  // Helpers which start after all chunks are claimed return immediately, so "fn" is never
+  // touched after this call returns
+  const auto num_helpers = std::min<int64_t>(_workers.size(), job->num_chunks - 1);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (int64_t i = 0; i < num_helpers; ++i)
+      _tasks.emplace_back([job] { job->run(); });
+  }
+  _cv.notify_all();
+
+  job->run();
+
+  {
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->cv.wait(lock, [&job] { return job->done.load() == job->num_chunks; });
+  }
+
+  if (job->error)
+    std::rethrow_exception(job->error);
+}
+
+} // namespace pepper
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pepper/threadpool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(ThreadPoolTest, parallel_for_covers_range)
+{
+  pepper::ThreadPool pool{4};
+
+  std::vector<int> visits(1000, 0);
+  pool.parallel_for(visits.size(), 10, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i)
+      visits[i]++;
+  });
+
+  for (auto v : visits)
+    ASSERT_EQ(v, 1);
+}
+
+TEST(ThreadPoolTest, single_thread)
+{
+  pepper::ThreadPool pool{1};
+
+  ASSERT_EQ(pool.num_threads(), 1);
+
+  int64_t calls = 0;
+  pool.parallel_for(100, 1, [&](int64_t begin, int64_t end) {
+    ASSERT_EQ(begin, 0);
+    ASSERT_EQ(end, 100);
+    calls++;
+  });
+  ASSERT_EQ(calls, 1);
+}
+
+TEST(ThreadPoolTest, nested_parallel_for)
+{
+  pepper::ThreadPool pool{3};
+
+  std::atomic<int64_t> sum{0};
+  pool.parallel_for(8, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i)
+    {
+      pool.parallel_for(100, 1, [&](int64_t b, int64_t e) { sum += e - b; });
+    }
+  });
+
+  ASSERT_EQ(sum.load(), 800);
+}
+
+TEST(ThreadPoolTest, null_pool)
+{
+  int64_t calls = 0;
+  pepper::parallel_for(nullptr, 10, 1, [&](int64_t, int64_t) { calls++; });
+
+  ASSERT_EQ(calls, 1);
+}
+
+TEST(ThreadPoolTest, submit)
+{
+  std::atomic<int> counter{0};
+  {
+    pepper::ThreadPool pool{2};
+    for (int i = 0; i < 10; ++i)
+      pool.submit([&] { counter++; });
+  }
+  // Pending tasks are finished before the pool is destroyed
+  ASSERT_EQ(counter.load(), 10);
+}
+
+TEST(ThreadPoolTest, parallel_for_exception_NEG)
+{
+  pepper::ThreadPool pool{4};
+
+  EXPECT_THROW(pool.parallel_for(100, 1,
+                                 [](int64_t begin, int64_t) {
+                                   if (begin == 0)
+                                     throw std::runtime_error("error");
+                                 }),
+               std::runtime_error);
+}
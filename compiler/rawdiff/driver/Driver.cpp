@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Compare.h"
+
+#include <arser/arser.h>
+#include <dio_raw/RawReader.h>
+#include <pepper/threadpool.h>
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+std::string to_string(const std::vector<uint32_t> &shape)
+{
+  std::string str = "(";
+  for (uint32_t d = 0; d < shape.size(); ++d)
+    str += (d == 0 ? "" : ", ") + std::to_string(shape.at(d));
+  return str + ")";
+}
+
+} // namespace
+
+int entry(int argc, char **argv)
+{
+  arser::Arser arser{"rawdiff compares tensors of two raw dumps written by dio-raw"};
+
+  arser.add_argument("lhs").nargs(1).type(arser::DataType::STR).help("Raw dump as reference");
+  arser.add_argument("rhs").nargs(1).type(arser::DataType::STR).help("Raw dump to compare");
+
+  arser.add_argument("--tolerance")
+    .nargs(1)
+    .type(arser::DataType::FLOAT)
+    .help("Fail if max absolute error of any tensor exceeds this value");
+
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .help("Number of threads to compare with. 0 (default) uses all hardware threads.");
+
+  try
+  {
+    arser.parse(argc, argv);
+  }
+  catch (const std::runtime_error &err)
+  {
+    std::cout << err.what() << std::endl;
+    std::cout << arser;
+    return 255;
+  }
+
+  const auto lhs_path = arser.get<std::string>("lhs");
+  const auto rhs_path = arser.get<std::string>("rhs");
+
+  int32_t num_threads = 0;
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+  if (num_threads < 0)
+  {
+    std::cerr << "ERROR: --num_threads should not be negative" << std::endl;
+    return 255;
+  }
+
+  dio::raw::RawReader lhs{lhs_path};
+  dio::raw::RawReader rhs{rhs_path};
+
+  int exitcode = 0;
+
+  std::unordered_map<std::string, const dio::raw::TensorInfo *> rhs_tensors;
+  for (const auto &tensor : rhs.tensors())
+    rhs_tensors[tensor.name] = &tensor;
+
+  // Check tensors to compare
+  std::vector<std::string> names;
+  std::vector<rawdiff::TensorPair> pairs;
+  for (const auto &l : lhs.tensors())
+  {
+    auto it = rhs_tensors.find(l.name);
+    if (it == rhs_tensors.end())
+    {
+      std::cout << l.name << ": missing in " << rhs_path << std::endl;
+      exitcode = 1;
+      continue;
+    }
+    const auto &r = *it->second;
+    rhs_tensors.erase(it);
+
+    if (l.dtype != r.dtype)
+    {
+      std::cout << l.name << ": type mismatch " << dio::raw::to_string(l.dtype) << " vs "
+                << dio::raw::to_string(r.dtype) << std::endl;
+      exitcode = 1;
+      continue;
+    }
+    if (l.shape != r.shape)
+    {
+      std::cout << l.name << ": shape mismatch " << to_string(l.shape) << " vs "
+                << to_string(r.shape) << std::endl;
+      exitcode = 1;
+      continue;
+    }
+
+    names.emplace_back(l.name);
+    pairs.push_back({l.dtype, lhs.data(l), rhs.data(r), dio::raw::num_elements(l.shape)});
+  }
+  for (const auto &tensor : rhs.tensors())
+  {
+    if (rhs_tensors.find(tensor.name) != rhs_tensors.end())
+    {
+      std::cout << tensor.name << ": missing in " << lhs_path << std::endl;
+      exitcode = 1;
+    }
+  }
+
+  // Compare values
+  std::unique_ptr<pepper::ThreadPool> pool;
+  if (num_threads != 1)
+    pool = std::make_unique<pepper::ThreadPool>(static_cast<uint32_t>(num_threads));
+
+  auto stats = rawdiff::compare(pairs, pool.get());
+
+  const bool has_tolerance = arser["--tolerance"];
+  const float tolerance = has_tolerance ? arser.get<float>("--tolerance") : 0.0f;
+
+  // NOTE Cosine similarity close to 1 needs more digits
+  std::cout << std::setprecision(8);
+
+  for (uint32_t n = 0; n < pairs.size(); ++n)
+  {
+    const auto &s = stats.at(n);
+
+    std::cout << names.at(n) << ": max_abs " << s.max_abs << ", mean_abs " << s.mean_abs
+              << ", relative " << s.relative << ", cosine " << s.cosine << std::endl;
+
+    // NOTE NaN exceeds any tolerance
+    if (has_tolerance && !(s.max_abs <= tolerance))
+      exitcode = 1;
+  }
+
+  return exitcode;
+}
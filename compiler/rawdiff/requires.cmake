@@ -0,0 +1,4 @@
+require("arser")
+require("dio-raw")
+require("pepper-threadpool")
+require("safemain")
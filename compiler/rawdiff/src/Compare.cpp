@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Compare.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+// Elements in a chunk, which is the unit of parallel work
+constexpr uint64_t CHUNK = 1 << 16;
+// Elements accumulated in float before being added to double sums
+constexpr uint64_t BLOCK = 2048;
+// Independent accumulators, which compilers map to vector lanes
+// NOTE Some compilers fully unroll the lane loop and miss vectorization with fewer lanes
+constexpr uint32_t LANES = 16;
+
+struct Partial
+{
+  double max_abs = 0.0;
+  double sum_abs = 0.0;
+  double sum_lhs_abs = 0.0;
+  double dot = 0.0;
+  double lhs_sq = 0.0;
+  double rhs_sq = 0.0;
+
+  void merge(const Partial &p)
+  {
+    max_abs = std::max(max_abs, p.max_abs);
+    sum_abs += p.sum_abs;
+    sum_lhs_abs += p.sum_lhs_abs;
+    dot += p.dot;
+    lhs_sq += p.lhs_sq;
+    rhs_sq += p.rhs_sq;
+  }
+};
+
+float half_to_float(uint16_t h)
+{
+  uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1F;
+  uint32_t mant = h & 0x3FF;
+
+  uint32_t bits;
+  if (exp == 0x1F)
+    bits = sign | 0x7F800000 | (mant << 13); // Inf or NaN
+  else if (exp != 0)
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  else if (mant == 0)
+    bits = sign;
+  else
+  {
+    // Subnormal half is a normal float
+    exp = 113;
+    while ((mant & 0x400) == 0)
+    {
+      mant <<= 1;
+      --exp;
+    }
+    bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+  }
+
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+template <typename T> struct ToFloat
+{
+  static float cast(T v) { return static_cast<float>(v); }
+};
+
+// NOTE FLOAT16 is loaded as uint16_t
+struct Half
+{
+  uint16_t bits;
+};
+
+template <> struct ToFloat<Half>
+{
+  static float cast(Half v) { return half_to_float(v.bits); }
+};
+
+/**
+ * @brief Accumulate differences of [0, count) elements, where count <= BLOCK
+ *
+ * NOTE Each lane has its own accumulators so that the inner loop has no dependency between
+ *      iterations and can be vectorized without reordering floating-point additions.
+ */
+template <typename T> Partial accumulate_block(const T *lhs, const T *rhs, uint64_t count)
+{
+  float max_abs[LANES] = {0};
+  float sum_abs[LANES] = {0};
+  float sum_lhs_abs[LANES] = {0};
+  float dot[LANES] = {0};
+  float lhs_sq[LANES] = {0};
+  float rhs_sq[LANES] = {0};
+
+  const uint64_t groups = count / LANES;
+  for (uint64_t g = 0; g < groups; ++g)
+  {
+    const T *lhs_group = lhs + g * LANES;
+    const T *rhs_group = rhs + g * LANES;
+
+    for (uint32_t l = 0; l < LANES; ++l)
+    {
+      const float a = ToFloat<T>::cast(lhs_group[l]);
+      const float b = ToFloat<T>::cast(rhs_group[l]);
+      const float d = std::fabs(a - b);
+
+      max_abs[l] = d > max_abs[l] ? d : max_abs[l];
+      sum_abs[l] += d;
+      sum_lhs_abs[l] += std::fabs(a);
+      dot[l] += a * b;
+      lhs_sq[l] += a * a;
+      rhs_sq[l] += b * b;
+    }
+  }
+
+  Partial res;
+  for (uint32_t l = 0; l < LANES; ++l)
+  {
+    res.max_abs = std::max(res.max_abs, static_cast<double>(max_abs[l]));
+    res.sum_abs += sum_abs[l];
+    res.sum_lhs_abs += sum_lhs_abs[l];
+    res.dot += dot[l];
+    res.lhs_sq += lhs_sq[l];
+    res.rhs_sq += rhs_sq[l];
+  }
+
+  // Remaining elements
+  for (uint64_t i = groups * LANES; i < count; ++i)
+  {
+    const double a = ToFloat<T>::cast(lhs[i]);
+    const double b = ToFloat<T>::cast(rhs[i]);
+    const double d = std::fabs(a - b);
+
+    res.max_abs = std::max(res.max_abs, d);
+    res.sum_abs += d;
+    res.sum_lhs_abs += std::fabs(a);
+    res.dot += a * b;
+    res.lhs_sq += a * a;
+    res.rhs_sq += b * b;
+  }
+
+  return res;
+}
+
+template <typename T> Partial accumulate(const T *lhs, const T *rhs, uint64_t count)
+{
+  // NOTE Sums of each block are added in double to keep precision for large tensors
+  Partial res;
+  for (uint64_t base = 0; base < count; base += BLOCK)
+  {
+    const uint64_t n = std::min(BLOCK, count - base);
+    res.merge(accumulate_block<T>(lhs + base, rhs + base, n));
+  }
+  return res;
+}
+
+template <typename T>
+Partial accumulate(const void *lhs, const void *rhs, uint64_t begin, uint64_t end)
+{
+  auto l = static_cast<const T *>(lhs) + begin;
+  auto r = static_cast<const T *>(rhs) + begin;
+  return accumulate<T>(l, r, end - begin);
+}
+
+Partial accumulate(const rawdiff::TensorPair &pair, uint64_t begin, uint64_t end)
+{
+  using dio::raw::DataType;
+
+  switch (pair.dtype)
+  {
+    case DataType::FLOAT32:
+      return accumulate<float>(pair.lhs, pair.rhs, begin, end);
+    case DataType::FLOAT16:
+      return accumulate<Half>(pair.lhs, pair.rhs, begin, end);
+    case DataType::INT64:
+      return accumulate<int64_t>(pair.lhs, pair.rhs, begin, end);
+    case DataType::INT32:
+      return accumulate<int32_t>(pair.lhs, pair.rhs, begin, end);
+    case DataType::INT16:
+      return accumulate<int16_t>(pair.lhs, pair.rhs, begin, end);
+    case DataType::INT8:
+      return accumulate<int8_t>(pair.lhs, pair.rhs, begin, end);
+    case DataType::UINT8:
+    case DataType::BOOL:
+      return accumulate<uint8_t>(pair.lhs, pair.rhs, begin, end);
+  }
+  throw std::runtime_error("rawdiff: unsupported data type");
+}
+
+struct Chunk
+{
+  uint32_t pair;
+  uint64_t begin;
+  uint64_t end;
+};
+
+} // namespace
+
+namespace rawdiff
+{
+
+std::vector<DiffStats> compare(const std::vector<TensorPair> &pairs, pepper::ThreadPool *pool)
+{
+  // Split all tensors into chunks so that small and large tensors are balanced together
+  std::vector<Chunk> chunks;
+  for (uint32_t p = 0; p < pairs.size(); ++p)
+  {
+    const auto count = pairs.at(p).num_elements;
+    for (uint64_t begin = 0; begin < count; begin += CHUNK)
+      chunks.emplace_back(Chunk{p, begin, std::min(count, begin + CHUNK)});
+  }
+
+  std::vector<Partial> partials(chunks.size());
+  pepper::parallel_for(pool, static_cast<int64_t>(chunks.size()), 1,
+                       [&](int64_t begin, int64_t end) {
+                         for (int64_t c = begin; c < end; ++c)
+                         {
+                           const auto &chunk = chunks.at(c);
+                           partials.at(c) =
+                             accumulate(pairs.at(chunk.pair), chunk.begin, chunk.end);
+                         }
+                       });
+
+  // Merge partials in order, so results are the same for any number of threads
+  std::vector<Partial> totals(pairs.size());
+  for (uint32_t c = 0; c < chunks.size(); ++c)
+    totals.at(chunks.at(c).pair).merge(partials.at(c));
+
+  std::vector<DiffStats> results(pairs.size());
+  for (uint32_t p = 0; p < pairs.size(); ++p)
+  {
+    const auto &t = totals.at(p);
+    auto &r = results.at(p);
+    const auto count = pairs.at(p).num_elements;
+
+    r.max_abs = t.max_abs;
+    r.mean_abs = count == 0 ? 0.0 : t.sum_abs / static_cast<double>(count);
+    if (t.sum_lhs_abs > 0.0)
+      r.relative = t.sum_abs / t.sum_lhs_abs;
+    else
+      r.relative = t.sum_abs > 0.0 ? INFINITY : 0.0;
+    // NOTE Two zero tensors are the same, while a zero tensor is orthogonal to others
+    if (t.lhs_sq > 0.0 && t.rhs_sq > 0.0)
+      r.cosine = t.dot / std::sqrt(t.lhs_sq * t.rhs_sq);
+    else
+      r.cosine = (t.lhs_sq == 0.0 && t.rhs_sq == 0.0) ? 1.0 : 0.0;
+  }
+
+  return results;
+}
+
+} // namespace rawdiff
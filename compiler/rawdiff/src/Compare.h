@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RAWDIFF_COMPARE_H__
+#define __RAWDIFF_COMPARE_H__
+
+#include <dio_raw/RawFormat.h>
+#include <pepper/threadpool.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace rawdiff
+{
+
+// Differences of rhs from lhs
+struct DiffStats
+{
+  double max_abs = 0.0;
+  double mean_abs = 0.0;
+  // sum(|lhs - rhs|) / sum(|lhs|)
+  double relative = 0.0;
+  double cosine = 1.0;
+};
+
+struct TensorPair
+{
+  dio::raw::DataType dtype;
+  const void *lhs;
+  const void *rhs;
+  uint64_t num_elements;
+};
+
+/**
+ * @brief Compare each pair of tensors
+ * @note  Tensors are split into chunks which are compared in parallel on "pool" (if not null).
+ *        Results do not depend on the number of threads.
+ */
+std::vector<DiffStats> compare(const std::vector<TensorPair> &pairs, pepper::ThreadPool *pool);
+
+} // namespace rawdiff
+
+#endif // __RAWDIFF_COMPARE_H__
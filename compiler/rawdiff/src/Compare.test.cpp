@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Compare.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using dio::raw::DataType;
+
+TEST(CompareTest, same)
+{
+  std::vector<float> lhs{1.0f, -2.0f, 3.0f};
+
+  auto stats = rawdiff::compare({{DataType::FLOAT32, lhs.data(), lhs.data(), lhs.size()}}, nullptr);
+
+  ASSERT_EQ(1, stats.size());
+  ASSERT_EQ(0.0, stats[0].max_abs);
+  ASSERT_EQ(0.0, stats[0].mean_abs);
+  ASSERT_EQ(0.0, stats[0].relative);
+  ASSERT_NEAR(1.0, stats[0].cosine, 1e-12);
+}
+
+TEST(CompareTest, stats)
+{
+  std::vector<float> lhs{1.0f, 2.0f, 3.0f, 4.0f};
+  std::vector<float> rhs{1.0f, 2.5f, 2.0f, 4.0f};
+
+  auto stats = rawdiff::compare({{DataType::FLOAT32, lhs.data(), rhs.data(), lhs.size()}}, nullptr);
+
+  ASSERT_EQ(1, stats.size());
+  ASSERT_FLOAT_EQ(1.0, stats[0].max_abs);
+  ASSERT_FLOAT_EQ(1.5 / 4, stats[0].mean_abs);
+  ASSERT_FLOAT_EQ(1.5 / 10, stats[0].relative);
+  ASSERT_FLOAT_EQ(28.0 / std::sqrt(30.0 * 27.25), stats[0].cosine);
+}
+
+TEST(CompareTest, integer)
+{
+  std::vector<uint8_t> lhs{0, 255, 10};
+  std::vector<uint8_t> rhs{1, 250, 10};
+
+  auto stats = rawdiff::compare({{DataType::UINT8, lhs.data(), rhs.data(), lhs.size()}}, nullptr);
+
+  ASSERT_FLOAT_EQ(5.0, stats[0].max_abs);
+  ASSERT_FLOAT_EQ(2.0, stats[0].mean_abs);
+}
+
+TEST(CompareTest, float16)
+{
+  // 1.0, -2.0, 0.5 and a subnormal in half
+  std::vector<uint16_t> lhs{0x3C00, 0xC000, 0x3800, 0x0001};
+  std::vector<uint16_t> rhs{0x3C00, 0xC000, 0x3C00, 0x0001};
+
+  auto stats = rawdiff::compare({{DataType::FLOAT16, lhs.data(), rhs.data(), lhs.size()}}, nullptr);
+
+  ASSERT_FLOAT_EQ(0.5, stats[0].max_abs);
+}
+
+TEST(CompareTest, threads_same_result)
+{
+  const uint32_t count = 300000;
+
+  std::vector<float> lhs(count), rhs(count);
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    lhs[n] = std::sin(static_cast<float>(n));
+    rhs[n] = lhs[n] + 0.001f * std::cos(static_cast<float>(n) * 0.3f);
+  }
+
+  std::vector<rawdiff::TensorPair> pairs;
+  pairs.push_back({DataType::FLOAT32, lhs.data(), rhs.data(), count});
+  pairs.push_back({DataType::FLOAT32, lhs.data(), rhs.data(), 17});
+
+  pepper::ThreadPool pool{4};
+
+  auto single = rawdiff::compare(pairs, nullptr);
+  auto multi = rawdiff::compare(pairs, &pool);
+
+  ASSERT_EQ(2, multi.size());
+  for (uint32_t p = 0; p < pairs.size(); ++p)
+  {
+    ASSERT_EQ(single[p].max_abs, multi[p].max_abs);
+    ASSERT_EQ(single[p].mean_abs, multi[p].mean_abs);
+    ASSERT_EQ(single[p].relative, multi[p].relative);
+    ASSERT_EQ(single[p].cosine, multi[p].cosine);
+  }
+  ASSERT_NEAR(0.001, single[0].max_abs, 1e-5);
+  ASSERT_GT(single[0].cosine, 0.999);
+}
+
+TEST(CompareTest, zero_NEG)
+{
+  std::vector<float> lhs{0.0f, 0.0f};
+  std::vector<float> rhs{0.0f, 1.0f};
+
+  auto stats = rawdiff::compare({{DataType::FLOAT32, lhs.data(), rhs.data(), lhs.size()}}, nullptr);
+
+  ASSERT_TRUE(std::isinf(stats[0].relative));
+  ASSERT_EQ(0.0, stats[0].cosine);
+}
@@ -76,6 +76,18 @@ int entry(const int argc, char **argv)
     .type(arser::DataType::STR)
     .help("Record mode. percentile (default) or moving_average");
 
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .help("Number of threads to run heavy operators with. 1 (default) runs them on the main "
+          "thread, 0 uses all hardware threads.");
+
+  arser.add_argument("--prefetch_depth")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .help("Number of records read from the input data ahead of the one being recorded. "
+          "2 (default) reads them in the background, 0 reads each record on demand.");
+
   arser.add_argument("--generate_profile_data")
     .nargs(0)
     .required(false)
@@ -102,6 +114,8 @@ int entry(const int argc, char **argv)
   std::string mode("percentile");
   float min_percentile = 1.0;
   float max_percentile = 99.0;
+  int32_t num_threads = 1;
+  int32_t prefetch_depth = 2;
 
   if (arser["--min_percentile"])
     min_percentile = arser.get<float>("--min_percentile");
@@ -115,20 +129,33 @@ int entry(const int argc, char **argv)
   if (mode != "percentile" && mode != "moving_average")
     throw std::runtime_error("Unsupported mode");
 
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+
+  if (num_threads < 0)
+    throw std::runtime_error("Number of threads should not be negative");
+
+  if (arser["--prefetch_depth"])
+    prefetch_depth = arser.get<int32_t>("--prefetch_depth");
+
+  if (prefetch_depth < 0)
+    throw std::runtime_error("Prefetch depth should not be negative");
+
   if (arser["--generate_profile_data"])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
 
   RecordMinMax rmm;
 
   // Initialize interpreter and observer
-  rmm.initialize(input_model_path);
+  rmm.initialize(input_model_path, static_cast<uint32_t>(num_threads));
 
   if (arser["--input_data"])
   {
     auto input_data_path = arser.get<std::string>("--input_data");
 
     // Profile min/max while executing the given input data
-    rmm.profileData(mode, input_data_path, min_percentile, max_percentile);
+    rmm.profileData(mode, input_data_path, min_percentile, max_percentile,
+                    static_cast<uint32_t>(prefetch_depth));
   }
   else
   {
@@ -19,6 +19,7 @@
 
 #include <luci/IR/Module.h>
 #include <luci_interpreter/Interpreter.h>
+#include <pepper/threadpool.h>
 
 #include "MinMaxObserver.h"
 
@@ -34,10 +35,12 @@ public:
 
   ~RecordMinMax() = default;
 
-  void initialize(const std::string &input_model_path);
+  // 'num_threads' threads are used to execute heavy kernels (0 means all hardware threads)
+  void initialize(const std::string &input_model_path, uint32_t num_threads = 1);
 
+  // 'prefetch_depth' records are read ahead of the one being interpreted (0 disables it)
   void profileData(const std::string &mode, const std::string &input_data_path,
-                   float min_percentile, float max_percentile);
+                   float min_percentile, float max_percentile, uint32_t prefetch_depth = 2);
 
   void profileDataWithRandomInputs(const std::string &mode, float min_percentile,
                                    float max_percentile);
@@ -46,6 +49,7 @@ public:
 
 private:
   std::unique_ptr<luci::Module> _module;
+  std::unique_ptr<pepper::ThreadPool> _thread_pool;
   std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
   std::unique_ptr<MinMaxObserver> _observer;
 };
@@ -2,4 +2,7 @@ require("luci")
 require("luci-interpreter")
 require("safemain")
 require("arser")
+require("foder")
 require("vconone")
+require("pepper-threadpool")
+require("dio-hdf5")
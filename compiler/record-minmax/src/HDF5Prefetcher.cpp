@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HDF5Prefetcher.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+HDF5Prefetcher::HDF5Prefetcher(HDF5Importer *importer, const std::vector<size_t> &input_sizes,
+                               uint32_t depth)
+  : _importer(importer)
+{
+  assert(importer != nullptr);
+
+  _num_records = _importer->numRecords();
+  _is_raw_data = _importer->isRawData();
+
+  _ring.resize(depth + 1);
+  for (auto &record : _ring)
+  {
+    for (auto size : input_sizes)
+    {
+      record.data.emplace_back(size);
+      record.dtypes.emplace_back(DataType::Unknown);
+      record.shapes.emplace_back(0);
+    }
+  }
+
+  if (depth > 0)
+    _producer = std::thread(&HDF5Prefetcher::produce, this);
+}
+
+HDF5Prefetcher::~HDF5Prefetcher()
+{
+  if (_producer.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _released_cv.notify_one();
+    _producer.join();
+  }
+}
+
+void HDF5Prefetcher::read(int32_t record_idx, Record &record)
+{
+  const auto num_inputs = static_cast<int32_t>(record.data.size());
+  if (num_inputs != _importer->numInputs(record_idx))
+    throw std::runtime_error("Wrong number of inputs.");
+
+  record.index = record_idx;
+  for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+  {
+    auto buffer = record.data[input_idx].data();
+    if (!_is_raw_data)
+      _importer->readTensor(record_idx, input_idx, &record.dtypes[input_idx],
+                            &record.shapes[input_idx], buffer);
+    else
+      _importer->readTensor(record_idx, input_idx, buffer);
+  }
+}
+
+void HDF5Prefetcher::produce()
+{
+  const auto ring_size = static_cast<int32_t>(_ring.size());
+
+  for (int32_t record_idx = 0; record_idx < _num_records; record_idx++)
+  {
+    {
+      // Wait until the slot of 'record_idx' is given back by the consumer
+      std::unique_lock<std::mutex> lock(_mutex);
+      _released_cv.wait(lock, [&] { return _stop || record_idx - _num_released < ring_size; });
+      if (_stop)
+        return;
+    }
+
+    try
+    {
+      read(record_idx, _ring[record_idx % ring_size]);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _error = std::current_exception();
+      _finished = true;
+      _filled_cv.notify_one();
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _num_filled++;
+    }
+    _filled_cv.notify_one();
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _finished = true;
+  _filled_cv.notify_one();
+}
+
+const HDF5Prefetcher::Record *HDF5Prefetcher::next()
+{
+  const auto ring_size = static_cast<int32_t>(_ring.size());
+
+  if (!_producer.joinable())
+  {
+    // Synchronous mode
+    if (_num_returned == _num_records)
+      return nullptr;
+
+    auto &record = _ring[0];
+    read(_num_returned++, record);
+    return &record;
+  }
+
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // Give back the record returned by the previous call
+  if (_num_released < _num_returned)
+  {
+    _num_released++;
+    _released_cv.notify_one();
+  }
+
+  _filled_cv.wait(lock, [&] { return _finished || _num_filled > _num_returned; });
+  if (_num_filled > _num_returned)
+    return &_ring[_num_returned++ % ring_size];
+
+  if (_error)
+    std::rethrow_exception(_error);
+
+  return nullptr;
+}
+
+} // namespace record_minmax
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HDF5PREFETCHER_H__
+#define __RECORD_MINMAX_HDF5PREFETCHER_H__
+
+#include <dio_hdf5/HDF5Importer.h>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace record_minmax
+{
+
+using HDF5Importer = dio::hdf5::HDF5Importer;
+using Shape = dio::hdf5::Shape;
+using DataType = dio::hdf5::DataType;
+
+// HDF5Prefetcher reads the records of HDF5Importer ahead of their use
+//
+// Records are decoded by a background thread into a ring of (depth + 1) buffers which are
+// allocated once, so reading the next 'depth' records overlaps with the interpretation of the
+// current one. While the prefetcher is alive, the importer must not be used by anyone else.
+// With depth 0, records are read synchronously on the calling thread.
+class HDF5Prefetcher
+{
+public:
+  struct Record
+  {
+    int32_t index = 0;
+    // Data, type and shape of each input. Type and shape are valid only for non-raw data.
+    std::vector<std::vector<char>> data;
+    std::vector<DataType> dtypes;
+    std::vector<Shape> shapes;
+  };
+
+public:
+  /**
+   * @param importer : importer whose group was already imported
+   * @param input_sizes : size in bytes of each input of a record
+   * @param depth : number of records read ahead of the current one
+   */
+  HDF5Prefetcher(HDF5Importer *importer, const std::vector<size_t> &input_sizes, uint32_t depth);
+
+  HDF5Prefetcher(const HDF5Prefetcher &) = delete;
+  HDF5Prefetcher &operator=(const HDF5Prefetcher &) = delete;
+
+  ~HDF5Prefetcher();
+
+public:
+  /**
+   * @brief Return the next record, or nullptr when all records were returned
+   * @note  The returned record is valid until the next call to next()
+   *        An exception thrown while reading the record is rethrown here
+   */
+  const Record *next();
+
+private:
+  void read(int32_t record_idx, Record &record);
+  void produce();
+
+private:
+  HDF5Importer *_importer;
+  int32_t _num_records;
+  bool _is_raw_data;
+  std::vector<Record> _ring;
+
+  std::mutex _mutex;
+  std::condition_variable _filled_cv;
+  std::condition_variable _released_cv;
+  int32_t _num_filled = 0;   // records written by the producer
+  int32_t _num_released = 0; // records given back by the consumer
+  int32_t _num_returned = 0; // records returned by next()
+  bool _finished = false;
+  bool _stop = false;
+  std::exception_ptr _error;
+  std::thread _producer;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HDF5PREFETCHER_H__
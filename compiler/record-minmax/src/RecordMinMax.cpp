@@ -17,8 +17,10 @@
 #include "RecordMinMax.h"
 #include "RecordFunction.h"
 #include "MinMaxObserver.h"
-#include "HDF5Importer.h"
+#include "HDF5Prefetcher.h"
 
+#include <dio_hdf5/HDF5Importer.h>
+#include <foder/FileMapper.h>
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
@@ -118,26 +120,20 @@ void update_quantparam(record_minmax::MinMaxObserver *observer, const std::strin
 namespace record_minmax
 {
 
-void RecordMinMax::initialize(const std::string &input_model_path)
+void RecordMinMax::initialize(const std::string &input_model_path, uint32_t num_threads)
 {
-  // Load model from the file
-  std::ifstream fs(input_model_path, std::ifstream::binary);
-  if (fs.fail())
-  {
-    throw std::runtime_error("Cannot open model file \"" + input_model_path + "\".\n");
-  }
-  std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
-                               std::istreambuf_iterator<char>());
+  // Map the model file, so that constants of the module refer to it instead of copies
+  auto model_file = foder::FileMapper(input_model_path).map();
 
   // Verify flatbuffers
-  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_data.data()),
-                                 model_data.size()};
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_file->data()),
+                                 model_file->size()};
   if (!circle::VerifyModelBuffer(verifier))
   {
     throw std::runtime_error("ERROR: Failed to verify circle '" + input_model_path + "'");
   }
 
-  _module = luci::Importer().importModule(circle::GetModel(model_data.data()));
+  _module = luci::Importer().importModule(circle::GetModel(model_file->data()), model_file);
 
   if (_module == nullptr)
   {
@@ -145,7 +141,9 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   }
 
   // Initialize interpreter
-  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  if (num_threads != 1)
+    _thread_pool = std::make_unique<pepper::ThreadPool>(num_threads);
+  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get(), _thread_pool.get());
 
   _observer = std::make_unique<MinMaxObserver>();
 
@@ -153,11 +151,12 @@ void RecordMinMax::initialize(const std::string &input_model_path)
 }
 
 void RecordMinMax::profileData(const std::string &mode, const std::string &input_data_path,
-                               float min_percentile, float max_percentile)
+                               float min_percentile, float max_percentile,
+                               uint32_t prefetch_depth)
 {
   try
   {
-    HDF5Importer importer(input_data_path);
+    dio::hdf5::HDF5Importer importer(input_data_path);
     importer.importGroup();
 
     bool is_raw_data = importer.isRawData();
@@ -169,10 +168,20 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+    std::vector<size_t> input_sizes;
+    for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      assert(input_node->index() == input_idx);
+      input_sizes.emplace_back(getTensorSize(input_node));
+    }
+
+    // Records are read by a background thread while the current one is interpreted
+    HDF5Prefetcher prefetcher(&importer, input_sizes, prefetch_depth);
+
+    while (auto record = prefetcher.next())
     {
-      if (num_inputs != importer.numInputs(record_idx))
-        throw std::runtime_error("Wrong number of inputs.");
+      const auto record_idx = record->index;
 
       if (record_idx % 100 == 0)
         std::cout << "Recording " << record_idx << "'th data" << std::endl;
@@ -180,23 +189,12 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
       for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
       {
         const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-        assert(input_node->index() == input_idx);
-        std::vector<char> input_data(getTensorSize(input_node));
+        const auto &input_data = record->data[input_idx];
 
+        // Check the type and the shape of the input data is valid
+        // Skip type/shape check for raw data
         if (!is_raw_data)
-        {
-          DataType dtype;
-          Shape shape(input_node->rank());
-          importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data());
-
-          // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
-        }
-        else
-        {
-          // Skip type/shape check for raw data
-          importer.readTensor(record_idx, input_idx, input_data.data());
-        }
+          verifyTypeShape(input_node, record->dtypes[input_idx], record->shapes[input_idx]);
 
         // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
         //       We can redcue the copy by directly writing data from file to interpreter inputs
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HDF5Prefetcher.h"
+
+#include <H5Cpp.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace record_minmax;
+
+namespace
+{
+
+const uint32_t num_elements = 4;
+
+// Value of the element 'e' of the input 'i' in the record 'r'
+float value(int32_t r, int32_t i, uint32_t e) { return r * 100.0f + i * 10.0f + e; }
+
+class HDF5PrefetcherTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/record_minmax_test.XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    _path = path;
+  }
+
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  // Write 'num_records' records, the record 'bad_record' with one input less than others
+  void write(int32_t num_records, int32_t num_inputs, int32_t bad_record = -1)
+  {
+    H5::H5File file(_path, H5F_ACC_TRUNC);
+    auto value_grp = file.createGroup("value");
+
+    hsize_t dims[] = {num_elements};
+    H5::DataSpace space(1, dims);
+    for (int32_t r = 0; r < num_records; r++)
+    {
+      auto record_grp = value_grp.createGroup(std::to_string(r));
+      const auto record_inputs = r == bad_record ? num_inputs - 1 : num_inputs;
+      for (int32_t i = 0; i < record_inputs; i++)
+      {
+        std::vector<float> data;
+        for (uint32_t e = 0; e < num_elements; e++)
+          data.push_back(value(r, i, e));
+
+        auto dataset =
+          record_grp.createDataSet(std::to_string(i), H5::PredType::IEEE_F32LE, space);
+        dataset.write(data.data(), H5::PredType::NATIVE_FLOAT);
+      }
+    }
+  }
+
+  std::unique_ptr<HDF5Importer> import()
+  {
+    std::unique_ptr<HDF5Importer> importer(new HDF5Importer(_path));
+    importer->importGroup();
+    return importer;
+  }
+
+protected:
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(HDF5PrefetcherTest, in_order)
+{
+  const int32_t num_records = 10;
+  const int32_t num_inputs = 2;
+  write(num_records, num_inputs);
+
+  const std::vector<size_t> input_sizes(num_inputs, num_elements * sizeof(float));
+  for (uint32_t depth : {0, 1, 3, 16})
+  {
+    auto importer = import();
+    HDF5Prefetcher prefetcher(importer.get(), input_sizes, depth);
+
+    for (int32_t r = 0; r < num_records; r++)
+    {
+      auto record = prefetcher.next();
+      ASSERT_NE(nullptr, record);
+      ASSERT_EQ(r, record->index);
+      ASSERT_EQ(num_inputs, record->data.size());
+      for (int32_t i = 0; i < num_inputs; i++)
+      {
+        ASSERT_EQ(DataType::FLOAT32, record->dtypes[i]);
+        ASSERT_EQ(1, record->shapes[i].num_dims());
+        ASSERT_EQ(num_elements, record->shapes[i].dim(0));
+
+        auto data = reinterpret_cast<const float *>(record->data[i].data());
+        for (uint32_t e = 0; e < num_elements; e++)
+          ASSERT_EQ(value(r, i, e), data[e]);
+      }
+    }
+  }
+}
+
+TEST_F(HDF5PrefetcherTest, end_of_data)
+{
+  write(2, 1);
+
+  const std::vector<size_t> input_sizes(1, num_elements * sizeof(float));
+  for (uint32_t depth : {0, 2})
+  {
+    auto importer = import();
+    HDF5Prefetcher prefetcher(importer.get(), input_sizes, depth);
+
+    ASSERT_NE(nullptr, prefetcher.next());
+    ASSERT_NE(nullptr, prefetcher.next());
+    ASSERT_EQ(nullptr, prefetcher.next());
+    ASSERT_EQ(nullptr, prefetcher.next());
+  }
+}
+
+TEST_F(HDF5PrefetcherTest, no_record)
+{
+  write(0, 1);
+
+  const std::vector<size_t> input_sizes(1, num_elements * sizeof(float));
+  for (uint32_t depth : {0, 2})
+  {
+    auto importer = import();
+    HDF5Prefetcher prefetcher(importer.get(), input_sizes, depth);
+
+    ASSERT_EQ(nullptr, prefetcher.next());
+  }
+}
+
+TEST_F(HDF5PrefetcherTest, destroy_while_prefetching)
+{
+  write(64, 1);
+
+  const std::vector<size_t> input_sizes(1, num_elements * sizeof(float));
+  {
+    auto importer = import();
+    // Producer is blocked on the full ring or still reading when destroyed
+    HDF5Prefetcher prefetcher(importer.get(), input_sizes, 4);
+    ASSERT_NE(nullptr, prefetcher.next());
+  }
+  {
+    auto importer = import();
+    HDF5Prefetcher prefetcher(importer.get(), input_sizes, 4);
+  }
+
+  SUCCEED();
+}
+
+TEST_F(HDF5PrefetcherTest, wrong_num_inputs_NEG)
+{
+  write(3, 2, 1);
+
+  const std::vector<size_t> input_sizes(2, num_elements * sizeof(float));
+  for (uint32_t depth : {0, 2})
+  {
+    auto importer = import();
+    HDF5Prefetcher prefetcher(importer.get(), input_sizes, depth);
+
+    ASSERT_NE(nullptr, prefetcher.next());
+    EXPECT_THROW(prefetcher.next(), std::runtime_error);
+  }
+}
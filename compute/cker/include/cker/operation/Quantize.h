@@ -289,6 +289,46 @@ inline void Requantize<int8_t, uint8_t>(const int8_t *input_data, int32_t size,
   }
 }
 
+template <>
+inline void Requantize<uint8_t, int16_t>(const uint8_t *input_data, int32_t size,
+                                         int32_t effective_scale_multiplier,
+                                         int32_t effective_scale_shift, int32_t input_zeropoint,
+                                         int32_t output_zeropoint, int16_t *output_data)
+{
+  static constexpr int32_t kMinOutput = std::numeric_limits<int16_t>::min();
+  static constexpr int32_t kMaxOutput = std::numeric_limits<int16_t>::max();
+
+  for (int i = 0; i < size; ++i)
+  {
+    const int32_t input = input_data[i] - input_zeropoint;
+    const int32_t output =
+      MultiplyByQuantizedMultiplier(input, effective_scale_multiplier, effective_scale_shift) +
+      output_zeropoint;
+    const int32_t clamped_output = std::max(std::min(output, kMaxOutput), kMinOutput);
+    output_data[i] = static_cast<int16_t>(clamped_output);
+  }
+}
+
+template <>
+inline void Requantize<int16_t, uint8_t>(const int16_t *input_data, int32_t size,
+                                         int32_t effective_scale_multiplier,
+                                         int32_t effective_scale_shift, int32_t input_zeropoint,
+                                         int32_t output_zeropoint, uint8_t *output_data)
+{
+  static constexpr int32_t kMinOutput = std::numeric_limits<uint8_t>::min();
+  static constexpr int32_t kMaxOutput = std::numeric_limits<uint8_t>::max();
+
+  for (int i = 0; i < size; ++i)
+  {
+    const int32_t input = input_data[i] - input_zeropoint;
+    const int32_t output =
+      MultiplyByQuantizedMultiplier(input, effective_scale_multiplier, effective_scale_shift) +
+      output_zeropoint;
+    const int32_t clamped_output = std::max(std::min(output, kMaxOutput), kMinOutput);
+    output_data[i] = static_cast<uint8_t>(clamped_output);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -22,6 +22,7 @@
 #include <ruy/matrix.h>
 #include <ruy/ruy.h>
 #include <cassert>
+#include <vector>
 #include "Types.h"
 
 namespace nnfw
@@ -81,6 +82,63 @@ void MakeRuyMulParams(const GemmParamsType &params, RuySpecType *ruy_mul_params)
   ruy_mul_params->set_clamp_max(params.clamp_max);
 }
 
+template <typename LhsScalar, typename RhsScalar, typename AccumScalar, typename DstScalar,
+          QuantizationFlavor quantization_flavor>
+void Gemm(const MatrixParams<LhsScalar> &lhs_params, const LhsScalar *lhs_data,
+          const MatrixParams<RhsScalar> &rhs_params, const RhsScalar *rhs_data,
+          const MatrixParams<DstScalar> &dst_params, DstScalar *dst_data,
+          const GemmParams<AccumScalar, DstScalar, quantization_flavor> &params,
+          ::ruy::Context *ruy_context)
+{
+  // Below code was copied from tflite::cpu_backend_gemm::detail::GemmImplUsingRuy
+  ::ruy::Matrix<LhsScalar> ruy_lhs;
+  ::ruy::Matrix<RhsScalar> ruy_rhs;
+  ::ruy::Matrix<DstScalar> ruy_dst;
+  MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs, true);
+  MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs, true);
+  MakeRuyMatrix(dst_params, dst_data, &ruy_dst);
+
+  ::ruy::BasicSpec<AccumScalar, DstScalar> ruy_mul_params;
+  MakeRuyMulParams(params, &ruy_mul_params);
+
+  ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+/**
+ * @brief Pack a cacheable LHS into the prepacked cache of ruy_context ahead of the first run
+ *
+ * It multiplies LHS with a dummy vector. Scalar types must be the same as the actual runs, so that
+ * ruy chooses the same kernel and packed layout.
+ */
+template <typename LhsScalar, typename RhsScalar, typename AccumScalar, typename DstScalar>
+void PrepackLhs(const MatrixParams<LhsScalar> &lhs_params, const LhsScalar *lhs_data,
+                RhsScalar rhs_zero_point, ::ruy::Context *ruy_context)
+{
+  assert(lhs_params.cache_policy != CachePolicy::kNeverCache);
+
+  MatrixParams<RhsScalar> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = lhs_params.cols;
+  rhs_params.cols = 1;
+  rhs_params.zero_point = rhs_zero_point;
+  MatrixParams<DstScalar> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = lhs_params.rows;
+  dst_params.cols = 1;
+
+  std::vector<RhsScalar> rhs_data(rhs_params.rows, rhs_zero_point);
+  std::vector<DstScalar> dst_data(dst_params.rows);
+
+  GemmParams<AccumScalar, DstScalar> gemm_params;
+  if (!std::is_floating_point<AccumScalar>::value)
+  {
+    // Any valid multiplier, as the result is thrown away
+    gemm_params.multiplier_fixedpoint = 1 << 30;
+  }
+  Gemm(lhs_params, lhs_data, rhs_params, rhs_data.data(), dst_params, dst_data.data(), gemm_params,
+       ruy_context);
+}
+
 } // namespace ruy_support
 } // namespace ruy
 } // namespace nnfw
@@ -76,6 +76,8 @@ struct ConvParams
   float float_activation_min;
   float float_activation_max;
   bool is_replaced_weights{false};
+  // Mark the filter as cacheable if it is constant, so that its packed form is reused.
+  bool lhs_cacheable{false};
 };
 
 struct FullyConnectedParams
@@ -101,6 +103,16 @@ struct FullyConnectedParams
   // FullyConnectedWeightsFormat weights_format;
 };
 
+struct BatchMatMulParams
+{
+  // Whether to take the transposes of the last two dimensions of lhs and rhs
+  bool adj_x{false};
+  bool adj_y{false};
+  // Mark the operands as cacheable if they are unchanging, e.g. weights.
+  bool lhs_cacheable{false};
+  bool rhs_cacheable{false};
+};
+
 enum class Order
 {
   kColMajor,
@@ -269,6 +281,12 @@ inline CachePolicy DefaultCachePolicy(bool is_constant_data)
   return is_constant_data ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
 }
 
+// Constant weights are packed once and reused for any shape of the other operand
+inline CachePolicy PrepackedCachePolicy(bool is_constant_data)
+{
+  return is_constant_data ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+}
+
 } // namespace ruy
 } // namespace nnfw
 
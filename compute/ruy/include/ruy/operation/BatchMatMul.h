@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_RUY_BATCH_MATMUL_H__
+#define __NNFW_RUY_BATCH_MATMUL_H__
+
+#include "ruy/Shape.h"
+#include "ruy/Types.h"
+#include "ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
+#include <ruy/context.h>
+
+#include <cassert>
+
+namespace nnfw
+{
+namespace ruy
+{
+
+/**
+ * @brief Multiply matrices of the last two dimensions, broadcasting the other dimensions
+ *
+ * lhs is [..., M, K] and rhs is [..., K, N] unless adj_x or adj_y transposes them. Transposed
+ * operands are given to ruy as column-major matrices instead of being transposed in memory.
+ */
+inline void BatchMatMul(const BatchMatMulParams &params, const Shape &lhs_shape,
+                        const float *lhs_data, const Shape &rhs_shape, const float *rhs_data,
+                        const Shape &, float *output_data, ::ruy::Context *ruy_context)
+{
+  const Shape extended_lhs_shape = Shape::ExtendedShape(5, lhs_shape);
+  const Shape extended_rhs_shape = Shape::ExtendedShape(5, rhs_shape);
+
+  // Determine which dimension is the broadcast dimension.
+  auto broadcast_dim = [](int lhs_dim, int rhs_dim) {
+    if (lhs_dim == rhs_dim)
+      return lhs_dim;
+    if (lhs_dim == 1)
+      return rhs_dim;
+    assert(rhs_dim == 1);
+    return lhs_dim;
+  };
+
+  // Compute the "extent" for iterating on this dimension.
+  // If we are broadcasting, then don't advance (i.e return 0).
+  auto extent = [](const Shape &shape, int x) {
+    if (shape.Dims(x) == 1)
+    {
+      return 0;
+    }
+    int prod = 1;
+    for (int i = x + 1; i < shape.DimensionsCount(); ++i)
+    {
+      prod *= shape.Dims(i);
+    }
+    return prod;
+  };
+
+  const int batch_dim0 = broadcast_dim(extended_lhs_shape.Dims(0), extended_rhs_shape.Dims(0));
+  const int batch_dim1 = broadcast_dim(extended_lhs_shape.Dims(1), extended_rhs_shape.Dims(1));
+  const int batch_dim2 = broadcast_dim(extended_lhs_shape.Dims(2), extended_rhs_shape.Dims(2));
+
+  const int lhs_ext0 = extent(extended_lhs_shape, 0);
+  const int lhs_ext1 = extent(extended_lhs_shape, 1);
+  const int lhs_ext2 = extent(extended_lhs_shape, 2);
+  const int rhs_ext0 = extent(extended_rhs_shape, 0);
+  const int rhs_ext1 = extent(extended_rhs_shape, 1);
+  const int rhs_ext2 = extent(extended_rhs_shape, 2);
+
+  MatrixParams<float> lhs_params;
+  lhs_params.order = params.adj_x ? Order::kColMajor : Order::kRowMajor;
+  lhs_params.rows = extended_lhs_shape.Dims(params.adj_x ? 4 : 3);
+  lhs_params.cols = extended_lhs_shape.Dims(params.adj_x ? 3 : 4);
+  lhs_params.cache_policy = PrepackedCachePolicy(params.lhs_cacheable);
+  MatrixParams<float> rhs_params;
+  rhs_params.order = params.adj_y ? Order::kColMajor : Order::kRowMajor;
+  rhs_params.rows = extended_rhs_shape.Dims(params.adj_y ? 4 : 3);
+  rhs_params.cols = extended_rhs_shape.Dims(params.adj_y ? 3 : 4);
+  rhs_params.cache_policy = PrepackedCachePolicy(params.rhs_cacheable);
+  assert(lhs_params.cols == rhs_params.rows);
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kRowMajor;
+  dst_params.rows = lhs_params.rows;
+  dst_params.cols = rhs_params.cols;
+  GemmParams<float, float> gemm_params;
+
+  const int dst_size = dst_params.rows * dst_params.cols;
+  for (int b0 = 0; b0 < batch_dim0; ++b0)
+  {
+    const float *lhs_ptr0 = lhs_data + (b0 * lhs_ext0);
+    const float *rhs_ptr0 = rhs_data + (b0 * rhs_ext0);
+    for (int b1 = 0; b1 < batch_dim1; ++b1)
+    {
+      const float *lhs_ptr1 = lhs_ptr0 + b1 * lhs_ext1;
+      const float *rhs_ptr1 = rhs_ptr0 + b1 * rhs_ext1;
+      for (int b2 = 0; b2 < batch_dim2; ++b2)
+      {
+        const float *lhs_ptr2 = lhs_ptr1 + b2 * lhs_ext2;
+        const float *rhs_ptr2 = rhs_ptr1 + b2 * rhs_ext2;
+        float *out_ptr =
+          output_data + ((b0 * batch_dim1 * batch_dim2) + b1 * batch_dim2 + b2) * dst_size;
+        ruy_support::Gemm(lhs_params, lhs_ptr2, rhs_params, rhs_ptr2, dst_params, out_ptr,
+                          gemm_params, ruy_context);
+      }
+    }
+  }
+}
+
+} // namespace ruy
+} // namespace nnfw
+
+#endif // __NNFW_RUY_BATCH_MATMUL_H__
@@ -26,6 +26,7 @@
 #include <ruy/ruy.h>
 #include <ruy/context.h>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 
 namespace nnfw
@@ -86,6 +87,45 @@ public:
     }
   }
 
+  template <typename T>
+  void operator()(const ConvParams &params, const Shape &input_shape, const T *input_data,
+                  const Shape &filter_shape, const T *filter_data, const Shape &,
+                  const int32_t *bias_data, const Shape &output_shape, T *output_data,
+                  ::ruy::Context *ruy_context,
+                  const int32_t *output_multiplier_perchannel = nullptr,
+                  const int *output_shift_perchannel = nullptr)
+  {
+    static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                  "Quantized Conv supports uint8 and int8 only");
+    if (!_prepared)
+    {
+      // This means that input or output are dynamic or filter is not constant
+      IsRequiredIm2col(input_shape, filter_shape, output_shape, params.stride_width,
+                       params.stride_height, params.dilation_width_factor,
+                       params.dilation_height_factor);
+      _prepared = true;
+    }
+
+    ConvQuantized(params, input_shape, input_data, filter_shape, filter_data, bias_data,
+                  output_shape, output_data, output_multiplier_perchannel,
+                  output_shift_perchannel, ruy_context);
+  }
+
+  /**
+   * @brief Pack constant filter into the prepacked cache before the first run
+   */
+  template <typename T>
+  void prepack(const ConvParams &params, const Shape &filter_shape, const T *filter_data,
+               ::ruy::Context *ruy_context)
+  {
+    using AccumScalar =
+      typename std::conditional<std::is_floating_point<T>::value, T, int32_t>::type;
+    const T input_zero_point =
+      std::is_floating_point<T>::value ? 0 : static_cast<T>(-params.input_offset);
+    ruy_support::PrepackLhs<T, T, AccumScalar, T>(FilterParams<T>(params, filter_shape),
+                                                  filter_data, input_zero_point, ruy_context);
+  }
+
 private:
   void ConvFloat(const ConvParams &params, const Shape &input_shape, const float *input_data,
                  const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
@@ -143,10 +183,8 @@ private:
 
     // When an optimized CBLAS implementation is not available, fall back
     // to using cpu_backend_gemm.
-    MatrixParams<float> lhs_params;
-    lhs_params.order = Order::kRowMajor;
-    lhs_params.rows = n;
-    lhs_params.cols = k;
+    const auto lhs_params = FilterParams<float>(params, filter_shape);
+    assert(lhs_params.rows == n && lhs_params.cols == k);
     MatrixParams<float> rhs_params;
     rhs_params.order = Order::kColMajor;
     rhs_params.rows = k;
@@ -160,19 +198,99 @@ private:
     gemm_params.clamp_min = output_activation_min;
     gemm_params.clamp_max = output_activation_max;
 
-    // Below code is from tflite::cpu_backend_gemm::detail::GemmImplUsingRuy
-    ::ruy::Matrix<float> ruy_lhs;
-    ::ruy::Matrix<float> ruy_rhs;
-    ::ruy::Matrix<float> ruy_dst;
-    // Note that cache is always enabled for input and weight tensors
-    ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs, true);
-    ruy_support::MakeRuyMatrix(rhs_params, gemm_input_data, &ruy_rhs, true);
-    ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+    ruy_support::Gemm(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params,
+                      output_data, gemm_params, ruy_context);
+  }
 
-    ::ruy::BasicSpec<float, float> ruy_mul_params;
-    ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+  template <typename T>
+  void ConvQuantized(const ConvParams &params, const Shape &input_shape, const T *input_data,
+                     const Shape &filter_shape, const T *filter_data, const int32_t *bias_data,
+                     const Shape &output_shape, T *output_data,
+                     const int32_t *output_multiplier_perchannel,
+                     const int *output_shift_perchannel, ::ruy::Context *ruy_context)
+  {
+    assert(input_shape.DimensionsCount() == 4);
+    assert(filter_shape.DimensionsCount() == 4);
+    assert(output_shape.DimensionsCount() == 4);
 
-    ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+    // Padded area is filled with the zero point of input
+    const T input_zero_point = static_cast<T>(-params.input_offset);
+    const uint8_t zero_byte = *reinterpret_cast<const uint8_t *>(&input_zero_point);
+    const T *gemm_input_data = input_data;
+    const Shape *gemm_input_shape = &input_shape;
+    if (_need_im2col)
+    {
+      _im2col_buffer.resize(_im2col_shape.FlatSize() * sizeof(T));
+      T *im2col_data = reinterpret_cast<T *>(_im2col_buffer.data());
+      if (params.dilation_width_factor != 1 || params.dilation_height_factor != 1)
+      {
+        DilatedIm2col(params, zero_byte, input_shape, input_data, filter_shape, output_shape,
+                      im2col_data);
+      }
+      else
+      {
+        Im2col(params, filter_shape.Dims(1), filter_shape.Dims(2), zero_byte, input_shape,
+               input_data, _im2col_shape, im2col_data);
+      }
+      gemm_input_data = im2col_data;
+      gemm_input_shape = &_im2col_shape;
+    }
+
+    const int gemm_input_dims = gemm_input_shape->DimensionsCount();
+    int m = FlatSizeSkipDim(*gemm_input_shape, gemm_input_dims - 1);
+    int n = output_shape.Dims(3);
+    int k = gemm_input_shape->Dims(gemm_input_dims - 1);
+
+    const auto lhs_params = FilterParams<T>(params, filter_shape);
+    assert(lhs_params.rows == n && lhs_params.cols == k);
+    MatrixParams<T> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = k;
+    rhs_params.cols = m;
+    rhs_params.zero_point = input_zero_point;
+    MatrixParams<T> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = n;
+    dst_params.cols = m;
+    dst_params.zero_point = static_cast<T>(params.output_offset);
+
+    if (output_multiplier_perchannel != nullptr)
+    {
+      assert(output_shift_perchannel != nullptr);
+      GemmParams<int32_t, T, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+      gemm_params.bias = bias_data;
+      gemm_params.clamp_min = static_cast<T>(params.quantized_activation_min);
+      gemm_params.clamp_max = static_cast<T>(params.quantized_activation_max);
+      gemm_params.multiplier_fixedpoint_perchannel = output_multiplier_perchannel;
+      gemm_params.multiplier_exponent_perchannel = output_shift_perchannel;
+      ruy_support::Gemm(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params,
+                        output_data, gemm_params, ruy_context);
+    }
+    else
+    {
+      GemmParams<int32_t, T> gemm_params;
+      gemm_params.bias = bias_data;
+      gemm_params.clamp_min = static_cast<T>(params.quantized_activation_min);
+      gemm_params.clamp_max = static_cast<T>(params.quantized_activation_max);
+      gemm_params.multiplier_fixedpoint = params.output_multiplier;
+      gemm_params.multiplier_exponent = params.output_shift;
+      ruy_support::Gemm(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params,
+                        output_data, gemm_params, ruy_context);
+    }
+  }
+
+  // Filter is [depth_out, kernel_height, kernel_width, depth_in], i.e. a row-major matrix
+  template <typename T>
+  static MatrixParams<T> FilterParams(const ConvParams &params, const Shape &filter_shape)
+  {
+    MatrixParams<T> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = filter_shape.Dims(0);
+    lhs_params.cols = FlatSizeSkipDim(filter_shape, 0);
+    lhs_params.zero_point =
+      std::is_floating_point<T>::value ? 0 : static_cast<T>(-params.weights_offset);
+    lhs_params.cache_policy = PrepackedCachePolicy(params.lhs_cacheable);
+    return lhs_params;
   }
 
   void IsRequiredIm2col(const Shape &input_shape, const Shape &kernel_shape,
@@ -196,6 +314,8 @@ private:
 
 private:
   Shape _im2col_shape;
+  // im2col buffer of quantized types
+  std::vector<uint8_t> _im2col_buffer;
   bool _need_im2col;
   bool _prepared;
 };
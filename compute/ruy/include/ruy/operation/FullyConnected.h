@@ -26,11 +26,29 @@
 #include <ruy/ruy.h>
 #include <ruy/context.h>
 
+#include <limits>
+#include <type_traits>
+
 namespace nnfw
 {
 namespace ruy
 {
 
+template <typename T>
+inline MatrixParams<T> FullyConnectedWeightsParams(const FullyConnectedParams &params,
+                                                   const Shape &weights_shape)
+{
+  const int dims_count = weights_shape.DimensionsCount();
+  MatrixParams<T> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.cols = weights_shape.Dims(dims_count - 1);
+  lhs_params.rows = FlatSizeSkipDim(weights_shape, dims_count - 1);
+  lhs_params.zero_point =
+    std::is_floating_point<T>::value ? 0 : static_cast<T>(-params.weights_offset);
+  lhs_params.cache_policy = PrepackedCachePolicy(params.lhs_cacheable);
+  return lhs_params;
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const float *input_data, const Shape &weights_shape,
                            const float *weights_data, const Shape &,
@@ -45,11 +63,7 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   rhs_params.cols = input_shape.FlatSize() / input_rows;
   rhs_params.cache_policy = DefaultCachePolicy(params.rhs_cacheable);
   assert(input_shape.FlatSize() == (rhs_params.rows * rhs_params.cols));
-  MatrixParams<float> lhs_params;
-  lhs_params.order = Order::kRowMajor;
-  lhs_params.cols = weights_shape.Dims(dims_count - 1);
-  lhs_params.rows = FlatSizeSkipDim(weights_shape, dims_count - 1);
-  lhs_params.cache_policy = DefaultCachePolicy(params.lhs_cacheable);
+  const auto lhs_params = FullyConnectedWeightsParams<float>(params, weights_shape);
   MatrixParams<float> dst_params;
   dst_params.order = Order::kColMajor;
   dst_params.rows = output_shape.Dims(output_shape.DimensionsCount() - 1);
@@ -59,19 +73,62 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   gemm_params.clamp_min = params.float_activation_min;
   gemm_params.clamp_max = params.float_activation_max;
 
-  // Below code was copied from tflite::cpu_backend_gemm::detail::GemmImplUsingRuy
-  ::ruy::Matrix<float> ruy_lhs;
-  ::ruy::Matrix<float> ruy_rhs;
-  ::ruy::Matrix<float> ruy_dst;
-  // Note that cache is always enabled for input and weight tensors
-  ruy_support::MakeRuyMatrix(lhs_params, weights_data, &ruy_lhs, true);
-  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs, true);
-  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+  ruy_support::Gemm(lhs_params, weights_data, rhs_params, input_data, dst_params, output_data,
+                    gemm_params, ruy_context);
+}
 
-  ::ruy::BasicSpec<float, float> ruy_mul_params;
-  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+template <typename T>
+inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                           const T *input_data, const Shape &weights_shape, const T *weights_data,
+                           const Shape &, const int32_t *bias_data, const Shape &output_shape,
+                           T *output_data, ::ruy::Context *ruy_context)
+{
+  static_assert(std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value,
+                "Quantized FullyConnected supports uint8 and int8 only");
+  assert(params.output_offset >= std::numeric_limits<T>::min());
+  assert(params.output_offset <= std::numeric_limits<T>::max());
 
-  ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+  const int dims_count = weights_shape.DimensionsCount();
+  const int input_rows = weights_shape.Dims(dims_count - 1);
+  MatrixParams<T> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = input_rows;
+  rhs_params.cols = input_shape.FlatSize() / input_rows;
+  rhs_params.zero_point = static_cast<T>(-params.input_offset);
+  rhs_params.cache_policy = DefaultCachePolicy(params.rhs_cacheable);
+  assert(input_shape.FlatSize() == (rhs_params.rows * rhs_params.cols));
+  const auto lhs_params = FullyConnectedWeightsParams<T>(params, weights_shape);
+  MatrixParams<T> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_shape.Dims(output_shape.DimensionsCount() - 1);
+  dst_params.cols = FlatSizeSkipDim(output_shape, output_shape.DimensionsCount() - 1);
+  dst_params.zero_point = static_cast<T>(params.output_offset);
+  GemmParams<int32_t, T> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<T>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<T>(params.quantized_activation_max);
+  gemm_params.multiplier_fixedpoint = params.output_multiplier;
+  gemm_params.multiplier_exponent = params.output_shift;
+
+  ruy_support::Gemm(lhs_params, weights_data, rhs_params, input_data, dst_params, output_data,
+                    gemm_params, ruy_context);
+}
+
+/**
+ * @brief Pack constant weights into the prepacked cache before the first run
+ */
+template <typename T>
+inline void PrepackFullyConnectedWeights(const FullyConnectedParams &params,
+                                         const Shape &weights_shape, const T *weights_data,
+                                         ::ruy::Context *ruy_context)
+{
+  using AccumScalar =
+    typename std::conditional<std::is_floating_point<T>::value, T, int32_t>::type;
+  const T input_zero_point =
+    std::is_floating_point<T>::value ? 0 : static_cast<T>(-params.input_offset);
+  ruy_support::PrepackLhs<T, T, AccumScalar, T>(
+    FullyConnectedWeightsParams<T>(params, weights_shape), weights_data, input_zero_point,
+    ruy_context);
 }
 
 } // namespace ruy
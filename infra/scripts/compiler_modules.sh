@@ -4,7 +4,7 @@
 [[ "${BASH_SOURCE[0]}" == "${0}" ]] && echo "Please don't execute ${BASH_SOURCE[0]}, source it" && return
 
 DEBUG_BUILD_ITEMS="angkor;cwrap;pepper-str;pepper-strcast;pp"
-DEBUG_BUILD_ITEMS+=";oops;pepper-assert"
+DEBUG_BUILD_ITEMS+=";oops;pepper-assert;pepper-threadpool"
 DEBUG_BUILD_ITEMS+=";hermes;hermes-std"
 DEBUG_BUILD_ITEMS+=";loco;locop;locomotiv;logo-core;logo"
 DEBUG_BUILD_ITEMS+=";foder;crew;souschef;arser;vconone"
@@ -13,10 +13,10 @@ DEBUG_BUILD_ITEMS+=";tflite2circle"
 DEBUG_BUILD_ITEMS+=";luci"
 DEBUG_BUILD_ITEMS+=";luci-interpreter"
 DEBUG_BUILD_ITEMS+=";luci-eval-driver;luci-pass-value-test;luci-value-test"
-DEBUG_BUILD_ITEMS+=";circle2circle;record-minmax;circle-quantizer"
+DEBUG_BUILD_ITEMS+=";circle2circle;dio-hdf5;record-minmax;circle-quantizer;circle-mpqsolver"
 DEBUG_BUILD_ITEMS+=";circle-partitioner;circle-part-driver"
 DEBUG_BUILD_ITEMS+=";circle-verify"
-DEBUG_BUILD_ITEMS+=";circle-tensordump"
+DEBUG_BUILD_ITEMS+=";dio-raw;circle-tensordump;rawdiff"
 DEBUG_BUILD_ITEMS+=";tflchef;circlechef"
 DEBUG_BUILD_ITEMS+=";common-artifacts"
 DEBUG_BUILD_ITEMS+=";circle2circle-dredd-recipe-test"
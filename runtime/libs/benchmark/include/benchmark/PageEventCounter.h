@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_PAGE_EVENT_COUNTER_H__
+#define __NNFW_BENCHMARK_PAGE_EVENT_COUNTER_H__
+
+#include <cstdint>
+
+namespace benchmark
+{
+
+struct PageEvents
+{
+  uint64_t page_faults = 0;
+  // -1 if the TLB miss counter is not available
+  int64_t tlb_misses = -1;
+};
+
+// Counts page faults and data TLB misses of this process
+//
+// NOTE TLB misses are counted by perf_event_open(2), which may be disallowed by
+//      /proc/sys/kernel/perf_event_paranoid. Threads created before this counter are not counted.
+class PageEventCounter
+{
+public:
+  PageEventCounter();
+  ~PageEventCounter();
+
+  PageEventCounter(const PageEventCounter &) = delete;
+  PageEventCounter &operator=(const PageEventCounter &) = delete;
+
+public:
+  // Cumulative events of this process, to be compared between two reads
+  PageEvents read() const;
+
+private:
+  int _tlb_fd;
+};
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_PAGE_EVENT_COUNTER_H__
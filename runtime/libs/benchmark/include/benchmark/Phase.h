@@ -33,6 +33,8 @@ struct Phase
   uint32_t count;
   std::vector<uint64_t> time;                                // us
   std::vector<uint32_t> memory[MemoryType::END_OF_MEM_TYPE]; // kB
+  std::vector<uint64_t> page_faults;
+  std::vector<int64_t> tlb_misses; // -1 if not available
 };
 
 struct PhaseOption
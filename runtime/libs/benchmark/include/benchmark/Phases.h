@@ -19,6 +19,7 @@
 
 #include "Phase.h"
 #include "MemoryPoller.h"
+#include "PageEventCounter.h"
 
 #include <string>
 #include <functional>
@@ -61,6 +62,7 @@ private:
   const PhaseOption _option;
   std::unordered_map<std::string, Phase> _phases;
   std::unique_ptr<MemoryPoller> _mem_poll;
+  PageEventCounter _page_events;
   uint32_t _mem_before_init;
   uint32_t _mem_after_run;
 };
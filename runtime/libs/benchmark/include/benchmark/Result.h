@@ -33,6 +33,8 @@ public:
 
   double time[PhaseEnum::END_OF_PHASE][FigureType::END_OF_FIG_TYPE];
   uint32_t memory[PhaseEnum::END_OF_PHASE][MemoryType::END_OF_MEM_TYPE];
+  uint64_t page_faults[PhaseEnum::END_OF_PHASE] = {};
+  int64_t tlb_misses[PhaseEnum::END_OF_PHASE] = {}; // -1 if not available
   bool print_memory = false;
   uint32_t init_memory = 0;
   uint32_t peak_memory = 0;
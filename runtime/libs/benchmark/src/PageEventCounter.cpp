@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/PageEventCounter.h"
+
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+
+uint64_t pageFaults()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+  return static_cast<uint64_t>(usage.ru_minflt) + static_cast<uint64_t>(usage.ru_majflt);
+}
+
+int openTlbMissCounter()
+{
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HW_CACHE;
+  attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Count threads created later, e.g. by backends' thread pools
+  attr.inherit = 1;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+} // namespace
+
+namespace benchmark
+{
+
+PageEventCounter::PageEventCounter() : _tlb_fd{openTlbMissCounter()}
+{
+  // DO NOTHING
+}
+
+PageEventCounter::~PageEventCounter()
+{
+  if (_tlb_fd >= 0)
+    close(_tlb_fd);
+}
+
+PageEvents PageEventCounter::read() const
+{
+  PageEvents events;
+  events.page_faults = pageFaults();
+  uint64_t count = 0;
+  if (_tlb_fd >= 0 && ::read(_tlb_fd, &count, sizeof(count)) == sizeof(count))
+    events.tlb_misses = static_cast<int64_t>(count);
+  return events;
+}
+
+} // namespace benchmark
@@ -69,17 +69,23 @@ void Phases::run(const std::string &tag, const PhaseFunc &exec, const PhaseFunc
     if (!option_disable && _option.memory)
       _mem_poll->start(p);
 
+    const auto events_before = _page_events.read();
     uint64_t t = 0u;
     t = nowMicros();
 
     exec(phase, i);
 
     t = nowMicros() - t;
+    const auto events_after = _page_events.read();
 
     if (!option_disable && _option.memory)
       _mem_poll->end(p);
 
     phase.time.emplace_back(t);
+    phase.page_faults.emplace_back(events_after.page_faults - events_before.page_faults);
+    phase.tlb_misses.emplace_back(events_before.tlb_misses < 0
+                                    ? -1
+                                    : events_after.tlb_misses - events_before.tlb_misses);
 
     if (!option_disable && _option.memory)
     {
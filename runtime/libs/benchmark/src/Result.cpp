@@ -72,6 +72,21 @@ double geomeanTimeMs(const benchmark::Phase &phase)
   return std::exp(log_sum / static_cast<double>(phase.time.size()));
 }
 
+uint64_t averagePageFaults(const benchmark::Phase &phase)
+{
+  return std::accumulate(phase.page_faults.begin(), phase.page_faults.end(), uint64_t{0}) /
+         phase.page_faults.size();
+}
+
+int64_t averageTlbMisses(const benchmark::Phase &phase)
+{
+  if (std::any_of(phase.tlb_misses.begin(), phase.tlb_misses.end(),
+                  [](int64_t misses) { return misses < 0; }))
+    return -1;
+  return std::accumulate(phase.tlb_misses.begin(), phase.tlb_misses.end(), int64_t{0}) /
+         static_cast<int64_t>(phase.tlb_misses.size());
+}
+
 uint32_t averageMemoryKb(const benchmark::Phase &phase, int type)
 {
   return average<uint32_t, uint32_t>(phase.memory[type]);
@@ -119,6 +134,28 @@ void printResultTime(
   std::cout << "===================================" << std::endl;
 }
 
+void printResultPageEvents(const uint64_t page_faults[benchmark::PhaseEnum::END_OF_PHASE],
+                           const int64_t tlb_misses[benchmark::PhaseEnum::END_OF_PHASE])
+{
+  using namespace benchmark;
+
+  std::cout << "PAGE FAULTS / dTLB MISSES" << std::endl;
+  for (int i = PhaseEnum::MODEL_LOAD; i <= PhaseEnum::EXECUTE; ++i)
+  {
+    // Note. Tricky. Ignore WARMUP
+    if (i == PhaseEnum::WARMUP)
+      continue;
+    std::cout << "- " << std::setw(12) << std::left << getPhaseString(i) << " takes "
+              << page_faults[i] << " / ";
+    if (tlb_misses[i] < 0)
+      std::cout << "N/A";
+    else
+      std::cout << tlb_misses[i];
+    std::cout << std::endl;
+  }
+  std::cout << "===================================" << std::endl;
+}
+
 void printResultMemory(
   const uint32_t memory[benchmark::PhaseEnum::END_OF_PHASE][benchmark::MemoryType::END_OF_MEM_TYPE])
 {
@@ -163,6 +200,8 @@ Result::Result(const Phases &phases)
     {
       auto phase = phases.at(gPhaseStrings[i]);
       time[i][FigureType::MEAN] = averageTimeMs(phase);
+      page_faults[i] = averagePageFaults(phase);
+      tlb_misses[i] = averageTlbMisses(phase);
     }
 
     int i = PhaseEnum::EXECUTE;
@@ -171,6 +210,8 @@ Result::Result(const Phases &phases)
     time[i][FigureType::MAX] = maxTimeMs(exec_phase);
     time[i][FigureType::MIN] = minTimeMs(exec_phase);
     time[i][FigureType::GEOMEAN] = geomeanTimeMs(exec_phase);
+    page_faults[i] = averagePageFaults(exec_phase);
+    tlb_misses[i] = averageTlbMisses(exec_phase);
   }
   if (option.memory)
   {
@@ -191,6 +232,7 @@ Result::Result(const Phases &phases)
 void printResult(const Result &result)
 {
   printResultTime(result.time);
+  printResultPageEvents(result.page_faults, result.tlb_misses);
 
   if (result.print_memory == false)
     return;
@@ -286,11 +286,12 @@ NNFW_STATUS nnfw_run(nnfw_session *session);
  * session is prepared for inference by {@link nnfw_prepare}, set input and output buffers
  * by {@link nnfw_set_input} and {@link nnfw_set_output}.</p>
  *
- * <p>This function returns immediately after starting a thread to run the inference.
- * To get the result of it or to do the next inference with {@link nnfw_run} or
- * {@link nnfw_run_async}, {@link nnfw_await} must be called to ensure the current asynchronous
- * inference has finished. Only one asynchronous inference is allowed at a time for a session.
- * If this function is called while the previous one is still running, it returns an error.</p>
+ * <p>This function returns immediately after queueing the inference to the worker thread of the
+ * session. Input and output buffers are captured when queued, so buffers for the next inference
+ * can be set and queued by this function again while the previous ones are still running.
+ * Queued inferences are done in order. To get the result of them or to do the next inference with
+ * {@link nnfw_run}, {@link nnfw_await} must be called to ensure that all asynchronous inferences
+ * have finished.</p>
  *
  * @param[in] session The session to run inference
  * @return    @c NNFW_STATUS_NO_ERROR if successful
@@ -300,16 +301,16 @@ NNFW_STATUS nnfw_run_async(nnfw_session *session);
 /**
  * @brief     Wait for asynchronous run to finish
  *
- * <p>This function must be called after calling {@link nnfw_run_asnyc}, and can be called only once
- * for a {@link nnfw_run_async} call.
+ * <p>This function must be called after calling {@link nnfw_run_asnyc}, and waits for all
+ * {@link nnfw_run_async} calls made before it.
  *
- * <p>When this function returns, it means that this session has finished the asynchronous run. Then
- * the user can safely use the output data.</p>
+ * <p>When this function returns, it means that this session has finished the asynchronous runs.
+ * Then the user can safely use the output data.</p>
  *
- * <p>This function returns after the asynchronous inference is finished.</p>
+ * <p>This function returns after the asynchronous inferences are finished.</p>
  *
  * @param[in] session The session to run inference
- * @return    @c NNFW_STATUS_NO_ERROR if successful
+ * @return    @c NNFW_STATUS_NO_ERROR if successful, @c NNFW_STATUS_ERROR if any of the runs failed
  */
 NNFW_STATUS nnfw_await(nnfw_session *session);
 
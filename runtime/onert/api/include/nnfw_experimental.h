@@ -96,4 +96,61 @@ NNFW_STATUS nnfw_input_tensorindex(nnfw_session *session, const char *tensorname
  */
 NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensorname, uint32_t *index);
 
+/**
+ * @brief Callback to be notified when an asynchronous run finishes
+ *
+ * It is called on the worker thread of the session, so it must not call the API of the session
+ * and should return quickly.
+ *
+ * @param[in] session   the session which has finished a run
+ * @param[in] status    @c NNFW_STATUS_NO_ERROR if the run succeeded, otherwise @c NNFW_STATUS_ERROR
+ * @param[in] user_data the pointer given to {@link nnfw_run_async_with_callback}
+ */
+typedef void (*nnfw_run_callback)(nnfw_session *session, NNFW_STATUS status, void *user_data);
+
+/**
+ * @brief Run inference asynchronously and get notified when it finishes
+ *
+ * This works like {@link nnfw_run_async}, and calls @c callback when this run finishes.
+ * {@link nnfw_await} must still be called before reading outputs from the session or before
+ * running synchronously.
+ *
+ * @param[in] session   the session to run inference
+ * @param[in] callback  the function to be called when this run finishes, may be @c NULL
+ * @param[in] user_data the pointer to be passed to @c callback
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_async_with_callback(nnfw_session *session, nnfw_run_callback callback,
+                                         void *user_data);
+
+/**
+ * @brief Get an eventfd which is signaled whenever an asynchronous run finishes
+ *
+ * The counter of the eventfd is increased by one for each run queued after this call, so it can be
+ * polled together with other file descriptors. The eventfd is non-blocking and owned by the
+ * session; do not close it.
+ *
+ * @param[in]  session the session object
+ * @param[out] fd      the eventfd
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_async_eventfd(nnfw_session *session, int *fd);
+
+/**
+ * @brief Pin the input and output buffers which are set now
+ *
+ * Pinned buffers are bound to the model once, and following runs reuse the binding instead of
+ * binding them on every run. Calling {@link nnfw_set_input}, {@link nnfw_set_output} or
+ * {@link nnfw_set_input_tensorinfo} unpins all of them. The buffers must stay valid and their
+ * contents may be changed between runs.
+ *
+ * Kernels read and write the buffers directly unless a model input or output needs a copy, e.g.
+ * when its backend uses another layout. Set ONERT_LOG_ENABLE=1 to see which ones are
+ * copied and why.
+ *
+ * @param[in] session the session object
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_pin_io_buffers(nnfw_session *session);
+
 #endif // __NNFW_EXPERIMENTAL_H__
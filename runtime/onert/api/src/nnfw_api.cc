@@ -367,3 +367,22 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->output_tensorindex(tensorname, index);
 }
+
+NNFW_STATUS nnfw_run_async_with_callback(nnfw_session *session, nnfw_run_callback callback,
+                                         void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_async(callback, user_data);
+}
+
+NNFW_STATUS nnfw_async_eventfd(nnfw_session *session, int *fd)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->async_eventfd(fd);
+}
+
+NNFW_STATUS nnfw_pin_io_buffers(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->pin_io_buffers();
+}
@@ -27,11 +27,14 @@
 #include "ir/OpCode.h"
 #include "util/TracingCtx.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <dirent.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 #include <misc/string_helpers.h>
 
 /*
@@ -155,6 +158,59 @@ void setConfigKeyValues(const CfgKeyValues &keyValues)
   onert::util::config_source_ext(std::move(configsrc));
 }
 
+/**
+ * @brief Create a cache of executors specialized for input shapes, if enabled by config
+ *
+ * @note  This must be called before compilation as the compiler lowers @c subgs in place
+ */
+std::unique_ptr<onert::exec::ShapeBucketCache>
+createShapeBucketCache(const onert::ir::Subgraphs &subgs,
+                       const onert::compiler::CompilerOptions &options)
+{
+  using onert::util::getConfigInt;
+  namespace config = onert::util::config;
+
+  const auto capacity = getConfigInt(config::SHAPE_BUCKET_CACHE_SIZE);
+  if (capacity <= 0)
+    return nullptr;
+
+  // Operand data is shared, so this copies graph structures only
+  auto model = std::make_shared<onert::ir::Subgraphs>();
+  subgs.iterate([&](const onert::ir::SubgraphIndex &index, const onert::ir::Graph &graph) {
+    auto copy = std::make_shared<onert::ir::Graph>(graph);
+    copy->setSubgraphs(model);
+    model->push(index, copy);
+  });
+
+  onert::exec::ShapeBucketCache::Shapes model_shapes;
+  const auto primary = model->primary();
+  for (const auto &ind : primary->getInputs())
+    model_shapes.emplace_back(primary->operands().at(ind).shape());
+
+  auto builder = [model, options](const onert::exec::ShapeBucketCache::Shapes &shapes) {
+    auto subgs = std::make_shared<onert::ir::Subgraphs>();
+    model->iterate([&](const onert::ir::SubgraphIndex &index, const onert::ir::Graph &graph) {
+      auto copy = std::make_shared<onert::ir::Graph>(graph);
+      copy->setSubgraphs(subgs);
+      subgs->push(index, copy);
+    });
+
+    auto primary = subgs->primary();
+    for (uint32_t i = 0; i < shapes.size(); ++i)
+      primary->operands().at(primary->getInputs().at(i)).info().shape(shapes[i]);
+
+    onert::compiler::Compiler compiler{subgs, options.tracing_ctx};
+    compiler.options() = options;
+    return compiler.compile();
+  };
+
+  const auto memory_limit =
+    static_cast<uint64_t>(std::max(getConfigInt(config::SHAPE_BUCKET_CACHE_MB), 0)) << 20;
+  return std::make_unique<onert::exec::ShapeBucketCache>(
+    model_shapes, builder, capacity, memory_limit,
+    onert::util::getConfigBool(config::SHAPE_BUCKET_PADDING));
+}
+
 } // namespace
 
 nnfw_session::nnfw_session()
@@ -164,7 +220,13 @@ nnfw_session::nnfw_session()
   // DO NOTHING
 }
 
-nnfw_session::~nnfw_session() = default;
+nnfw_session::~nnfw_session()
+{
+  // Finish queued asynchronous runs before what their callbacks refer to is destroyed
+  _execution.reset();
+  if (_async_eventfd >= 0)
+    close(_async_eventfd);
+}
 
 NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
 {
@@ -347,9 +409,12 @@ NNFW_STATUS nnfw_session::prepare()
 
   try
   {
+    auto shape_cache = createShapeBucketCache(*_subgraphs, _compiler->options());
     _subgraphs.reset();
     std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
     _execution = std::make_unique<onert::exec::Execution>(executors);
+    if (shape_cache)
+      _execution->setShapeBucketCache(std::move(shape_cache));
   }
   catch (const std::exception &e)
   {
@@ -390,21 +455,84 @@ NNFW_STATUS nnfw_session::run()
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::run_async()
+NNFW_STATUS nnfw_session::run_async(nnfw_run_callback callback, void *user_data)
 {
-  if (!isStatePreparedOrFinishedRun())
+  // More runs can be queued while others are in flight
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
   {
     std::cerr << "Error during nnfw_session::run_async : "
               << "run_async should be run after prepare" << std::endl;
     return NNFW_STATUS_INVALID_STATE;
   }
 
-  _execution->startExecute();
+  try
+  {
+    onert::exec::Execution::Callback on_finish;
+    const int event_fd = _async_eventfd;
+    if (callback != nullptr || event_fd >= 0)
+    {
+      on_finish = [this, callback, user_data, event_fd](std::exception_ptr error) {
+        if (callback != nullptr)
+          callback(this, error ? NNFW_STATUS_ERROR : NNFW_STATUS_NO_ERROR, user_data);
+        if (event_fd >= 0)
+        {
+          const uint64_t count = 1;
+          if (write(event_fd, &count, sizeof(count)) != sizeof(count))
+            VERBOSE(NNFW_SESSION) << "Failed to signal asynchronous run eventfd" << std::endl;
+        }
+      };
+    }
+    _execution->startExecute(on_finish);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
 
   _state = State::RUNNING;
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::async_eventfd(int *fd)
+{
+  if (fd == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (_async_eventfd < 0)
+  {
+    _async_eventfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (_async_eventfd < 0)
+    {
+      std::cerr << "Error during nnfw_session::async_eventfd : cannot create eventfd" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+  }
+
+  *fd = _async_eventfd;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::pin_io_buffers()
+{
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::pin_io_buffers : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    _execution->pinIO();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::pin_io_buffers : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::await()
 {
   if (!isStateRunning())
@@ -414,16 +542,26 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
+  NNFW_STATUS status = NNFW_STATUS_NO_ERROR;
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    status = NNFW_STATUS_ERROR;
+  }
 
   _state = State::FINISHED_RUN;
-  return NNFW_STATUS_NO_ERROR;
+  return status;
 }
 
 NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const void *buffer,
                                     size_t length)
 {
-  if (!isStatePreparedOrFinishedRun())
+  // Buffers for the next run may be set while earlier ones are in flight
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
   {
     std::cerr << "Error during nnfw_session::set_input : invalid state" << std::endl;
     return NNFW_STATUS_INVALID_STATE;
@@ -452,7 +590,8 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
 NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *buffer,
                                      size_t length)
 {
-  if (!isStatePreparedOrFinishedRun())
+  // Buffers for the next run may be set while earlier ones are in flight
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
   {
     std::cerr << "Error during nnfw_session::set_output : invalid state" << std::endl;
     return NNFW_STATUS_INVALID_STATE;
@@ -620,7 +759,7 @@ NNFW_STATUS nnfw_session::apply_tensorinfo(uint32_t index, nnfw_tensorinfo ti)
   for (int32_t i = 0; i < ti.rank; i++)
     new_shape.dim(i) = ti.dims[i];
 
-  if (!isStatePreparedOrFinishedRun())
+  if (isStateModelLoaded())
   {
     // In this case, if we apply input shape in primary_subgraph, it will propagate after
     // compilation and excution
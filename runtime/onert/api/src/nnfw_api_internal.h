@@ -82,7 +82,9 @@ private:
    *   | await   | run_async            |
    *   |         v                      |
    *   |       +--------------+         |
-   *   +------ |   RUNNING    | <-------+
+   *   +------ |              | <-------+
+   *           |   RUNNING    | -----+
+   *           |              | <----+ run_async
    *           +--------------+
    */
   enum class State
@@ -102,7 +104,7 @@ public:
   NNFW_STATUS prepare();
   NNFW_STATUS run();
 
-  NNFW_STATUS run_async();
+  NNFW_STATUS run_async(nnfw_run_callback callback = nullptr, void *user_data = nullptr);
   NNFW_STATUS await();
 
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
@@ -139,6 +141,8 @@ public:
   NNFW_STATUS register_custom_operation(const std::string &id, nnfw_custom_eval eval_func);
   NNFW_STATUS input_tensorindex(const char *tensorname, uint32_t *index);
   NNFW_STATUS output_tensorindex(const char *tensorname, uint32_t *index);
+  NNFW_STATUS async_eventfd(int *fd);
+  NNFW_STATUS pin_io_buffers();
 
 private:
   const onert::ir::Graph *primary_subgraph();
@@ -157,6 +161,7 @@ private:
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
 
   std::unique_ptr<onert::util::TracingCtx> _tracing_ctx;
+  int _async_eventfd{-1};
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
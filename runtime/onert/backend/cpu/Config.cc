@@ -27,6 +27,67 @@ bool Config::initialize() { return true; }
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
+bool Config::supportOperation(const ir::Operands &, const ir::Operation &node)
+{
+  // Operations which KernelGenerator visits
+  switch (node.opcode())
+  {
+    case ir::OpCode::AddN:
+    case ir::OpCode::ArgMinMax:
+    case ir::OpCode::BatchMatMul:
+    case ir::OpCode::BatchToSpaceND:
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::BroadcastTo:
+    case ir::OpCode::Comparison:
+    case ir::OpCode::Concat:
+    case ir::OpCode::Conv2D:
+    case ir::OpCode::DepthToSpace:
+    case ir::OpCode::DepthwiseConv2D:
+    case ir::OpCode::Einsum:
+    case ir::OpCode::ElementwiseActivation:
+    case ir::OpCode::ElementwiseBinary:
+    case ir::OpCode::ElementwiseUnary:
+    case ir::OpCode::ExpandDims:
+    case ir::OpCode::Fill:
+    case ir::OpCode::FullyConnected:
+    case ir::OpCode::FusedBatchNorm:
+    case ir::OpCode::Gather:
+    case ir::OpCode::L2Normalization:
+    case ir::OpCode::LSTM:
+    case ir::OpCode::LogSoftmax:
+    case ir::OpCode::MatrixBandPart:
+    case ir::OpCode::OneHot:
+    case ir::OpCode::Pack:
+    case ir::OpCode::Pad:
+    case ir::OpCode::Pool2D:
+    case ir::OpCode::Pow:
+    case ir::OpCode::Range:
+    case ir::OpCode::Rank:
+    case ir::OpCode::Reduce:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::ResizeBilinear:
+    case ir::OpCode::Reverse:
+    case ir::OpCode::Select:
+    case ir::OpCode::Shape:
+    case ir::OpCode::Slice:
+    case ir::OpCode::Softmax:
+    case ir::OpCode::SpaceToBatchND:
+    case ir::OpCode::SpaceToDepth:
+    case ir::OpCode::Split:
+    case ir::OpCode::SplitV:
+    case ir::OpCode::SquaredDifference:
+    case ir::OpCode::Squeeze:
+    case ir::OpCode::StatelessRandomUniform:
+    case ir::OpCode::StridedSlice:
+    case ir::OpCode::Tile:
+    case ir::OpCode::Transpose:
+    case ir::OpCode::Unpack:
+      return true;
+    default:
+      return false;
+  }
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
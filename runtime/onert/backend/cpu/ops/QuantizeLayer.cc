@@ -54,6 +54,10 @@ void QuantizeLayer::configure(const IPortableTensor *input, IPortableTensor *out
   else if (((input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
             (output->data_type() == OperandType::QUANT_INT8_ASYMM)) ||
            ((input->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+            (output->data_type() == OperandType::QUANT_UINT8_ASYMM)) ||
+           ((input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
+            (output->data_type() == OperandType::QUANT_INT16_ASYMM)) ||
+           ((input->data_type() == OperandType::QUANT_INT16_ASYMM) &&
             (output->data_type() == OperandType::QUANT_UINT8_ASYMM)))
   {
     const double effective_output_scale =
@@ -70,7 +74,10 @@ void QuantizeLayer::run()
 {
   if ((_input->data_type() == OperandType::FLOAT32))
   {
-    affineQuantize<float, uint8_t>(_input, _output);
+    if (_output->data_type() == OperandType::QUANT_INT16_ASYMM)
+      affineQuantize<float, int16_t>(_input, _output);
+    else
+      affineQuantize<float, uint8_t>(_input, _output);
   }
   else if ((_input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
            (_output->data_type() == OperandType::QUANT_INT8_ASYMM))
@@ -88,6 +95,22 @@ void QuantizeLayer::run()
       _output_multiplier, _output_shift, _input->data_zero_point(), _output->data_zero_point(),
       getBuffer<uint8_t>(_output));
   }
+  else if ((_input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
+           (_output->data_type() == OperandType::QUANT_INT16_ASYMM))
+  {
+    nnfw::cker::Requantize<uint8_t, int16_t>(
+      getBuffer<uint8_t>(_input), MatchingFlatSize(getShape(_input), getShape(_output)),
+      _output_multiplier, _output_shift, _input->data_zero_point(), _output->data_zero_point(),
+      getBuffer<int16_t>(_output));
+  }
+  else if ((_input->data_type() == OperandType::QUANT_INT16_ASYMM) &&
+           (_output->data_type() == OperandType::QUANT_UINT8_ASYMM))
+  {
+    nnfw::cker::Requantize<int16_t, uint8_t>(
+      getBuffer<int16_t>(_input), MatchingFlatSize(getShape(_input), getShape(_output)),
+      _output_multiplier, _output_shift, _input->data_zero_point(), _output->data_zero_point(),
+      getBuffer<uint8_t>(_output));
+  }
   else
   {
     throw std::runtime_error{"Quantize: Unsupported  data type"};
@@ -16,6 +16,8 @@
 
 #include "Config.h"
 
+#include <ir/Operations.Include.h>
+
 namespace onert
 {
 namespace backend
@@ -27,6 +29,31 @@ bool Config::initialize() { return true; }
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
+bool Config::supportOperation(const ir::Operands &operands, const ir::Operation &node)
+{
+  const auto opcode = node.opcode();
+  if (opcode != ir::OpCode::BatchMatMul && opcode != ir::OpCode::Conv2D &&
+      opcode != ir::OpCode::FullyConnected)
+    return false;
+
+  const auto input_type = operands.at(node.getInputs().at(0)).typeInfo().type();
+  if (opcode == ir::OpCode::BatchMatMul)
+    return input_type == ir::DataType::FLOAT32;
+  if (input_type != ir::DataType::FLOAT32 && input_type != ir::DataType::QUANT_UINT8_ASYMM &&
+      input_type != ir::DataType::QUANT_INT8_ASYMM)
+    return false;
+  if (opcode == ir::OpCode::Conv2D)
+    return true;
+
+  // FullyConnected supports neither hybrid nor per-channel quantization
+  const auto &weights =
+    operands.at(node.getInputs().at(ir::operation::FullyConnected::WEIGHT)).typeInfo();
+  const bool same_type = weights.type() == input_type ||
+                         (input_type == ir::DataType::QUANT_INT8_ASYMM &&
+                          weights.type() == ir::DataType::QUANT_INT8_SYMM);
+  return same_type && weights.scales().size() <= 1;
+}
+
 } // namespace ruy
 } // namespace backend
 } // namespace onert
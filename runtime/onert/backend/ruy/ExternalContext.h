@@ -20,6 +20,11 @@
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -33,22 +38,87 @@ private:
   static const int kDefaultNumThreadpoolThreads = 4;
 
 public:
-  ExternalContext() : _ruy_context(new ::ruy::Context)
+  /**
+   * @brief Exclusive use of a ruy context, which goes back to ExternalContext when destroyed
+   */
+  class RuyContextLease
+  {
+  public:
+    RuyContextLease(const ExternalContext *owner, size_t index)
+      : _owner{owner}, _index{index}, _context{owner->_ruy_contexts[index].get()}
+    {
+    }
+    RuyContextLease(RuyContextLease &&other)
+      : _owner{other._owner}, _index{other._index}, _context{other._context}
+    {
+      other._owner = nullptr;
+    }
+    ~RuyContextLease()
+    {
+      if (_owner)
+        _owner->release(_index);
+    }
+
+    operator ::ruy::Context *() const { return _context; }
+    ::ruy::Context *operator->() const { return _context; }
+
+  private:
+    const ExternalContext *_owner;
+    size_t _index;
+    ::ruy::Context *_context;
+  };
+
+public:
+  ExternalContext()
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
   }
 
   void setMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-      max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    std::lock_guard<std::mutex> lock{_mutex};
+    _max_num_threads = max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
+    if (_ruy_contexts.empty())
+      addContext();
+    for (auto &context : _ruy_contexts)
+      context->set_max_num_threads(_max_num_threads);
   }
 
-  ::ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  /**
+   * @brief Get a ruy context which no other kernel is using
+   * @note  Kernels which run one at a time always get the first context so that they share its
+   *        prepacked cache. Another context is only created for kernels running concurrently.
+   */
+  RuyContextLease ruy_context() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = std::find(_in_use.begin(), _in_use.end(), false);
+    if (it == _in_use.end())
+      it = addContext();
+    *it = true;
+    return RuyContextLease{this, static_cast<size_t>(it - _in_use.begin())};
+  }
+
+private:
+  std::vector<bool>::iterator addContext() const
+  {
+    _ruy_contexts.emplace_back(new ::ruy::Context);
+    _ruy_contexts.back()->set_max_num_threads(_max_num_threads);
+    _in_use.push_back(false);
+    return _in_use.end() - 1;
+  }
+
+  void release(size_t index) const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _in_use[index] = false;
+  }
 
 private:
-  const std::unique_ptr<::ruy::Context> _ruy_context;
+  mutable std::mutex _mutex;
+  mutable std::vector<std::unique_ptr<::ruy::Context>> _ruy_contexts;
+  mutable std::vector<bool> _in_use;
+  int _max_num_threads = kDefaultNumThreadpoolThreads;
 };
 
 } // namespace ruy
@@ -16,6 +16,7 @@
 
 #include "KernelGenerator.h"
 
+#include "ops/BatchMatMulLayer.h"
 #include "ops/ConvolutionLayer.h"
 #include "ops/FullyConnectedLayer.h"
 
@@ -89,6 +90,26 @@ KernelGenerator::KernelGenerator(
   // DO NOTHING
 }
 
+void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lhs_index{node.getInputs().at(ir::operation::BatchMatMul::LHS)};
+  const auto rhs_index{node.getInputs().at(ir::operation::BatchMatMul::RHS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto lhs_tensor = _tensor_reg->getPortableTensor(lhs_index);
+  auto rhs_tensor = _tensor_reg->getPortableTensor(rhs_index);
+
+  const auto adj_x = node.param().adj_x;
+  const auto adj_y = node.param().adj_y;
+
+  auto fn = std::make_unique<ops::BatchMatMulLayer>();
+
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Conv2D &node)
 {
   using ir::operation::Conv2D;
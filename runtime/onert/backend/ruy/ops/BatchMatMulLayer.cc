@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BatchMatMulLayer.h"
+
+#include <ruy/operation/BatchMatMul.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace ruy
+{
+namespace ops
+{
+
+BatchMatMulLayer::BatchMatMulLayer()
+  : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
+    _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+BatchMatMulLayer::~BatchMatMulLayer() = default;
+
+void BatchMatMulLayer::batchMatMulFloat32()
+{
+  nnfw::ruy::BatchMatMulParams op_params;
+  op_params.adj_x = _adj_x;
+  op_params.adj_y = _adj_y;
+  op_params.lhs_cacheable = _lhs->is_constant();
+  op_params.rhs_cacheable = _rhs->is_constant();
+
+  nnfw::ruy::BatchMatMul(op_params, getTensorShape(_lhs),
+                         reinterpret_cast<const float *>(_lhs->buffer()), getTensorShape(_rhs),
+                         reinterpret_cast<const float *>(_rhs->buffer()), getTensorShape(_output),
+                         reinterpret_cast<float *>(_output->buffer()),
+                         _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(lhs != nullptr);
+  assert(rhs != nullptr);
+  assert(output != nullptr);
+
+  _lhs = lhs;
+  _rhs = rhs;
+  _adj_x = adj_x;
+  _adj_y = adj_y;
+  _output = output;
+  _external_context = external_context;
+}
+
+void BatchMatMulLayer::run()
+{
+  if ((_lhs->data_type() == OperandType::FLOAT32) && (_rhs->data_type() == OperandType::FLOAT32))
+  {
+    batchMatMulFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"BatchMatMul: unsupported data type"};
+  }
+}
+
+void BatchMatMulLayer::prepare()
+{
+  // Pack a constant operand ahead so that the first run does not pay for it. The other operand
+  // is not known yet, so the packing is done by a run on zeros.
+  if (_lhs->data_type() != OperandType::FLOAT32 || _rhs->data_type() != OperandType::FLOAT32)
+    return;
+  if (_lhs->is_constant() == _rhs->is_constant() || _lhs->is_dynamic() || _rhs->is_dynamic() ||
+      _output->is_dynamic())
+    return;
+
+  const auto lhs_shape = getTensorShape(_lhs);
+  const auto rhs_shape = getTensorShape(_rhs);
+  const auto output_shape = getTensorShape(_output);
+  std::vector<float> dummy(_lhs->is_constant() ? rhs_shape.FlatSize() : lhs_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::ruy::BatchMatMulParams op_params;
+  op_params.adj_x = _adj_x;
+  op_params.adj_y = _adj_y;
+  op_params.lhs_cacheable = _lhs->is_constant();
+  op_params.rhs_cacheable = _rhs->is_constant();
+
+  const float *lhs_data =
+    _lhs->is_constant() ? reinterpret_cast<const float *>(_lhs->buffer()) : dummy.data();
+  const float *rhs_data =
+    _rhs->is_constant() ? reinterpret_cast<const float *>(_rhs->buffer()) : dummy.data();
+  nnfw::ruy::BatchMatMul(op_params, lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
+                         output.data(), _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace ruy
+} // namespace backend
+} // namespace onert
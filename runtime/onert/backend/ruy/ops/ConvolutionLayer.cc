@@ -19,6 +19,8 @@
 #include "../Tensor.h"
 #include "ir/Padding.h"
 
+#include <type_traits>
+
 namespace onert
 {
 namespace backend
@@ -39,11 +41,8 @@ ConvolutionLayer::ConvolutionLayer()
 
 ConvolutionLayer::~ConvolutionLayer() = default;
 
-void ConvolutionLayer::convFloat32()
+nnfw::ruy::ConvParams ConvolutionLayer::convParams() const
 {
-  float output_activation_min = 0, output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
   nnfw::ruy::ConvParams op_params;
   op_params.padding_type = getPaddingType(_paddingType);
   op_params.padding_values.width = _paddingLeft;
@@ -52,17 +51,69 @@ void ConvolutionLayer::convFloat32()
   op_params.stride_height = _strideHeight;
   op_params.dilation_width_factor = _dilationWidthFactor;
   op_params.dilation_height_factor = _dilationHeightFactor;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _kernel->is_constant();
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    float output_activation_min = 0, output_activation_max = 0;
+    CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+    op_params.float_activation_min = output_activation_min;
+    op_params.float_activation_max = output_activation_max;
+    return op_params;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    double real_multiplier = 0.0;
+    int32_t output_multiplier = 0;
+    int32_t output_shift = 0;
+    GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+    op_params.weights_offset = -_kernel->data_zero_point();
+    op_params.output_multiplier = output_multiplier;
+    op_params.output_shift = output_shift;
+  }
+  else
+  {
+    // int8 filter is symmetric and quantized per channel
+    op_params.weights_offset = 0;
+    op_params.output_multiplier = 0;
+    op_params.output_shift = 0;
+  }
+  return op_params;
+}
 
+void ConvolutionLayer::convFloat32()
+{
   nnfw::ruy::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+  kernel(convParams(), getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
          getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
          getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
          getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
          _external_context->ruy_context());
 }
 
+template <typename T> void ConvolutionLayer::convQuant8()
+{
+  const bool per_channel = std::is_same<T, int8_t>::value;
+  nnfw::ruy::Conv &kernel = *_conv_kernel;
+  kernel(convParams(), getTensorShape(_input), reinterpret_cast<const T *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const T *>(_kernel->buffer()),
+         getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()),
+         _external_context->ruy_context(),
+         per_channel ? _per_channel_output_multiplier.data() : nullptr,
+         per_channel ? _per_channel_output_shift.data() : nullptr);
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -127,6 +178,14 @@ void ConvolutionLayer::run()
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    convQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convQuant8<int8_t>();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -138,11 +197,33 @@ void ConvolutionLayer::prepare()
   if (_prepare)
     return;
 
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    const auto &filter_scales = _kernel->data_scales();
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), filter_scales.data(), filter_scales.size(),
+      getTensorShape(_kernel).Dims(0), _per_channel_output_multiplier, _per_channel_output_shift);
+  }
+
   nnfw::ruy::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  if (_kernel->is_constant() && !_kernel->is_dynamic())
   {
     kernel.prepare(getTensorShape(_input), getTensorShape(_kernel), getTensorShape(_output),
                    _strideWidth, _strideHeight, _dilationWidthFactor, _dilationHeightFactor);
+
+    // Pack constant filter ahead so that the first run does not pay for it
+    const auto op_params = convParams();
+    const auto kernel_shape = getTensorShape(_kernel);
+    auto ruy_context = _external_context->ruy_context();
+    if (_input->data_type() == OperandType::FLOAT32)
+      kernel.prepack(op_params, kernel_shape, reinterpret_cast<const float *>(_kernel->buffer()),
+                     ruy_context);
+    else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+      kernel.prepack(op_params, kernel_shape,
+                     reinterpret_cast<const uint8_t *>(_kernel->buffer()), ruy_context);
+    else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+      kernel.prepack(op_params, kernel_shape, reinterpret_cast<const int8_t *>(_kernel->buffer()),
+                     ruy_context);
   }
   _prepare = true;
 }
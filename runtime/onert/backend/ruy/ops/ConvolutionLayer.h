@@ -25,6 +25,7 @@
 #include <exec/IFunction.h>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -44,6 +45,8 @@ public:
 public:
   void convFloat32();
 
+  template <typename T> void convQuant8();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
@@ -77,9 +80,16 @@ private:
 
   std::unique_ptr<nnfw::ruy::Conv> _conv_kernel;
 
+  // Used for int8 quantization which is per-channel
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
   bool _prepare;
 
   std::shared_ptr<ExternalContext> _external_context;
+
+private:
+  nnfw::ruy::ConvParams convParams() const;
 };
 
 } // namespace ops
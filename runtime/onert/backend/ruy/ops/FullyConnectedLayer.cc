@@ -58,6 +58,41 @@ void FullyConnectedLayer::fullyConnectedFloat32()
     _external_context->ruy_context());
 }
 
+nnfw::ruy::FullyConnectedParams FullyConnectedLayer::quantizedParams() const
+{
+  double real_multiplier = 0.0;
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
+  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::ruy::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.weights_offset = -_weights->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.output_multiplier = output_multiplier;
+  op_params.output_shift = output_shift;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _weights->is_constant();
+  op_params.rhs_cacheable = _input->is_constant();
+  return op_params;
+}
+
+template <typename T> void FullyConnectedLayer::fullyConnectedQuant8()
+{
+  nnfw::ruy::FullyConnected(
+    quantizedParams(), getTensorShape(_input), reinterpret_cast<const T *>(_input->buffer()),
+    getTensorShape(_weights), reinterpret_cast<const T *>(_weights->buffer()),
+    getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias ? _bias->buffer() : nullptr),
+    getTensorShape(_output), reinterpret_cast<T *>(_output->buffer()),
+    _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
@@ -71,6 +106,13 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _activation = activation;
   _output = output;
   _external_context = external_context;
+
+  if (_input->data_type() != _weights->data_type() &&
+      !(_input->data_type() == OperandType::QUANT_INT8_ASYMM &&
+        _weights->data_type() == OperandType::QUANT_INT8_SYMM))
+    throw std::runtime_error{"FullyConnected: hybrid quantization is not supported"};
+  if (_weights->data_scales().size() > 1)
+    throw std::runtime_error{"FullyConnected: per-channel quantization is not supported"};
 }
 
 void FullyConnectedLayer::run()
@@ -79,6 +121,14 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedFloat32();
   }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    fullyConnectedQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedQuant8<int8_t>();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -87,7 +137,7 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  if (_input->data_type() == OperandType::FLOAT32 && _bias && _bias->is_constant())
   {
     const int bias_size = getTensorShape(_bias).FlatSize();
     if (nnfw::ruy::IsZeroVector(reinterpret_cast<float *>(_bias->buffer()), bias_size))
@@ -95,6 +145,32 @@ void FullyConnectedLayer::prepare()
       _bias = nullptr;
     }
   }
+
+  // Pack constant weights ahead so that the first run does not pay for it
+  if (!_weights->is_constant() || _weights->is_dynamic())
+    return;
+
+  auto ruy_context = _external_context->ruy_context();
+  const auto weights_shape = getTensorShape(_weights);
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    nnfw::ruy::FullyConnectedParams op_params;
+    op_params.lhs_cacheable = true;
+    nnfw::ruy::PrepackFullyConnectedWeights(
+      op_params, weights_shape, reinterpret_cast<const float *>(_weights->buffer()), ruy_context);
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    nnfw::ruy::PrepackFullyConnectedWeights(
+      quantizedParams(), weights_shape, reinterpret_cast<const uint8_t *>(_weights->buffer()),
+      ruy_context);
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    nnfw::ruy::PrepackFullyConnectedWeights(
+      quantizedParams(), weights_shape, reinterpret_cast<const int8_t *>(_weights->buffer()),
+      ruy_context);
+  }
 }
 
 } // namespace ops
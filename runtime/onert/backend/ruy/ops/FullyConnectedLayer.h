@@ -41,6 +41,8 @@ public:
 public:
   void fullyConnectedFloat32();
 
+  template <typename T> void fullyConnectedQuant8();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
@@ -59,6 +61,9 @@ private:
   ir::Activation _activation;
 
   std::shared_ptr<ExternalContext> _external_context;
+
+private:
+  nnfw::ruy::FullyConnectedParams quantizedParams() const;
 };
 
 } // namespace ops
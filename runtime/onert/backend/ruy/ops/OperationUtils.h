@@ -27,6 +27,7 @@
 #include <ir/Padding.h>
 
 #include <limits>
+#include <vector>
 
 using OperandType = onert::ir::DataType;
 
@@ -113,6 +114,21 @@ void CalculateActivationRange(ir::Activation activation, T *activation_min, T *a
   }
 }
 
+void QuantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier, int *shift);
+
+void GetQuantizedConvolutionMultiplier(const IPortableTensor *inputDescr,
+                                       const IPortableTensor *filterDescr,
+                                       const IPortableTensor *biasDescr,
+                                       const IPortableTensor *outputDescr, double *multiplier);
+
+void GetQuantizedConvolutionMultipliersAndShifts(
+  float input_scale, float output_scale, const float *filter_scales, size_t filter_scales_size,
+  int num_channels, std::vector<int32_t> &per_channel_output_multiplier,
+  std::vector<int> &per_channel_output_shift);
+
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max);
+
 nnfw::ruy::PaddingType getPaddingType(ir::PaddingType ir_padding_type);
 
 } // namespace ops
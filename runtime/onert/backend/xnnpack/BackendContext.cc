@@ -18,11 +18,15 @@
 
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
+#include "SubgraphBuilder.h"
 #include "util/logging.h"
 #include "ir/Index.h"
 #include "ir/OperandIndexMap.h"
 #include "ir/OperandIndexSequence.h"
 #include "backend/basic/BackendContextHelpers.h"
+#include "util/ConfigSource.h"
+
+#include <algorithm>
 
 namespace onert
 {
@@ -33,14 +37,100 @@ namespace xnnpack
 
 ITensorRegistry *BackendContext::genTensors() { return basic::genTensors(*this); }
 
-FunctionMap BackendContext::genKernels()
+FunctionMap BackendContext::genSubgraphKernels()
 {
   FunctionMap ret;
+  const auto &graph = *_data.graph;
+  const auto &operands = graph.operands();
+  const auto &operations = graph.operations();
+
+  std::vector<ir::OperationIndex> group;
+  auto flush = [&]() {
+    if (group.empty())
+      return;
+
+    // Operands which never leave the group can be planned and fused by XNNPACK
+    util::Set<ir::OperandIndex> internals;
+    for (const auto &op_ind : group)
+    {
+      for (const auto &ind : operations.at(op_ind).getOutputs() | ir::Remove::UNDEFINED)
+      {
+        const auto &uses = operands.at(ind).getUses();
+        const bool used_in_group =
+          std::all_of(uses.begin(), uses.end(), [&](const ir::OperationIndex &use) {
+            return std::find(group.begin(), group.end(), use) != group.end();
+          });
+        if (used_in_group && !graph.getOutputs().contains(ind) &&
+            !_data.external_operands.contains(ind))
+          internals.add(ind);
+      }
+    }
+
+    auto fn_seq = kernel_gen->generateSubgraph(group, internals);
+    if (fn_seq)
+    {
+      VERBOSE(BackendContext) << "XNNPACK subgraph with " << group.size() << " operations from #"
+                              << group.front().value() << std::endl;
+      // The first operation runs the whole group and the others do nothing
+      ret.emplace_back(group.front(), std::move(fn_seq));
+      for (auto it = std::next(group.begin()); it != group.end(); ++it)
+        ret.emplace_back(*it, std::make_unique<exec::FunctionSequence>());
+    }
+    else
+    {
+      for (const auto &op_ind : group)
+        ret.emplace_back(op_ind, kernel_gen->generate(op_ind));
+    }
+    group.clear();
+  };
+
+  // An operation joins the group only if its inputs are ready when the group starts. Inputs from
+  // other backends may be computed between the operations of the group.
+  auto ready = [&](const ir::Operation &op) {
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+    {
+      const auto &operand = operands.at(ind);
+      if (!operand.isConstant() && !operand.getDef().valid())
+        return false;
+    }
+    return true;
+  };
 
   for (auto op_ind : _data.op_order)
   {
-    auto fn_seq = kernel_gen->generate(op_ind);
-    ret.emplace_back(op_ind, std::move(fn_seq));
+    if (!SubgraphBuilder::isSupported(operands, operations, op_ind))
+    {
+      flush();
+      ret.emplace_back(op_ind, kernel_gen->generate(op_ind));
+      continue;
+    }
+
+    if (!group.empty() && !ready(operations.at(op_ind)))
+      flush();
+    group.emplace_back(op_ind);
+  }
+  flush();
+
+  return ret;
+}
+
+FunctionMap BackendContext::genKernels()
+{
+  FunctionMap ret;
+
+  // Subgraph runs operations out of the order of other backends, so only linear executor is
+  // supported
+  if (util::getConfigBool(util::config::XNNPACK_SUBGRAPH) && _data.is_linear_executor)
+  {
+    ret = genSubgraphKernels();
+  }
+  else
+  {
+    for (auto op_ind : _data.op_order)
+    {
+      auto fn_seq = kernel_gen->generate(op_ind);
+      ret.emplace_back(op_ind, std::move(fn_seq));
+    }
   }
 
   basic::initConsts(*this);
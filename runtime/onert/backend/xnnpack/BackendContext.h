@@ -53,6 +53,9 @@ public:
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
 
+private:
+  FunctionMap genSubgraphKernels();
+
 public:
   // TODO Make it private
   std::shared_ptr<TensorBuilder> tensor_builder;
@@ -39,6 +39,20 @@ bool Config::initialize()
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
+bool Config::supportOperation(const ir::Operands &operands, const ir::Operation &node)
+{
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    case ir::OpCode::DepthwiseConv2D:
+    case ir::OpCode::FullyConnected:
+      // Kernels are for float only
+      return operands.at(node.getInputs().at(0)).typeInfo().type() == ir::DataType::FLOAT32;
+    default:
+      return false;
+  }
+}
+
 } // namespace xnnpack
 } // namespace backend
 } // namespace onert
@@ -37,9 +37,11 @@ public:
   std::string id() override { return "xnnpack"; }
   bool initialize() override;
   ir::Layout supportLayout(const ir::Operation &node, ir::Layout frontend_layout) override;
+  bool supportOperation(const ir::Operands &operands, const ir::Operation &node) override;
   bool supportPermutation() override { return true; }
   bool supportDynamicTensor() override { return true; }
   bool supportFP16() override { return false; }
+  bool supportParallelCompile() override { return true; }
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
 };
@@ -19,6 +19,8 @@
 #include "ops/ConvolutionLayer.h"
 #include "ops/DepthwiseConvolutionLayer.h"
 #include "ops/FullyConnectedLayer.h"
+#include "ops/SubgraphLayer.h"
+#include "SubgraphBuilder.h"
 
 #include <backend/Backend.h>
 #include <backend/IConfig.h>
@@ -90,6 +92,47 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
   return ret;
 }
 
+std::unique_ptr<exec::FunctionSequence>
+KernelGenerator::generateSubgraph(const std::vector<ir::OperationIndex> &ops,
+                                  const util::Set<ir::OperandIndex> &internals)
+{
+  assert(!ops.empty());
+
+  SubgraphBuilder builder{_ctx, _operations_ctx, ops, internals};
+  if (!builder.build())
+    return nullptr;
+
+  std::vector<IPortableTensor *> externals;
+  for (const auto &ind : builder.externals())
+  {
+    auto tensor = _tensor_reg->getPortableTensor(ind);
+    assert(tensor != nullptr);
+    assert(tensor->layout() == ir::Layout::NHWC);
+    externals.emplace_back(tensor);
+  }
+
+  auto fn = std::make_unique<ops::SubgraphLayer>(_external_context);
+  if (!fn->configure(builder.releaseSubgraph(), externals, builder.releaseConstants()))
+    return nullptr;
+
+  auto ret = std::make_unique<exec::FunctionSequence>();
+  ret->append(std::move(fn));
+
+  for (const auto &op_ind : ops)
+  {
+    const auto &op = _operations_ctx.at(op_ind);
+    for (auto ind : (op.getInputs() | ir::Remove::UNDEFINED) + op.getOutputs())
+    {
+      auto tensor = _tensor_reg->getNativeTensor(ind);
+      if (tensor)
+      {
+        tensor->increase_ref();
+      }
+    }
+  }
+  return ret;
+}
+
 void KernelGenerator::visit(const ir::operation::Conv2D &node)
 {
   using ir::operation::Conv2D;
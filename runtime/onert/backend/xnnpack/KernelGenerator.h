@@ -26,6 +26,9 @@
 #include <backend/basic/KernelGeneratorBase.h>
 #include <ir/Operands.h>
 #include <ir/Operations.h>
+#include <util/Set.h>
+
+#include <vector>
 
 namespace onert
 {
@@ -43,6 +46,15 @@ public:
                   const std::shared_ptr<ExternalContext> &external_context);
 
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex ind) override;
+  /**
+   * @brief  Generate one function which runs the operations as an XNNPACK subgraph
+   * @param  ops       Operations in execution order
+   * @param  internals Operands which are used only by the operations
+   * @return Generated function, or @c nullptr if XNNPACK does not support them
+   */
+  std::unique_ptr<exec::FunctionSequence>
+  generateSubgraph(const std::vector<ir::OperationIndex> &ops,
+                   const util::Set<ir::OperandIndex> &internals);
 
 private:
   void visit(const ir::operation::Conv2D &) override;
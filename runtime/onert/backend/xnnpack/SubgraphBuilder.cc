@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SubgraphBuilder.h"
+
+#include "ops/OperationUtils.h"
+
+#include <ir/Padding.h>
+#include <util/logging.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+
+SubgraphBuilder::SubgraphBuilder(const ir::Operands &operands, const ir::Operations &operations,
+                                 const std::vector<ir::OperationIndex> &ops,
+                                 const util::Set<ir::OperandIndex> &internals)
+  : _operands{operands}, _operations{operations}, _ops{ops}, _internals{internals},
+    _subgraph{nullptr}, _status{xnn_status_success}, _values_valid{true}
+{
+  for (const auto &op_ind : _ops)
+  {
+    const auto &op = _operations.at(op_ind);
+    for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::DUPLICATED |
+                             ir::Remove::UNDEFINED)
+    {
+      if (isConstant(ind) || _internals.contains(ind))
+        continue;
+      if (std::find(_externals.begin(), _externals.end(), ind) == _externals.end())
+        _externals.emplace_back(ind);
+    }
+  }
+}
+
+SubgraphBuilder::~SubgraphBuilder()
+{
+  if (_subgraph)
+    xnn_delete_subgraph(_subgraph);
+}
+
+bool SubgraphBuilder::isSupported(const ir::Operands &operands, const ir::Operations &operations,
+                                  const ir::OperationIndex &ind)
+{
+  util::Set<ir::OperandIndex> no_internals;
+  SubgraphBuilder builder{operands, operations, {ind}, no_internals};
+  return builder.build();
+}
+
+bool SubgraphBuilder::build()
+{
+  assert(_subgraph == nullptr);
+  if (xnn_create_subgraph(_externals.size(), 0, &_subgraph) != xnn_status_success)
+    return false;
+
+  // External values are defined first so that their ids are the same as the external ids
+  ir::OperandIndexMap<bool> defined_in_subgraph;
+  for (const auto &op_ind : _ops)
+  {
+    for (const auto &ind : _operations.at(op_ind).getOutputs() | ir::Remove::UNDEFINED)
+      defined_in_subgraph[ind] = true;
+  }
+  for (uint32_t external_id = 0; external_id < _externals.size(); ++external_id)
+  {
+    const auto &ind = _externals[external_id];
+    const uint32_t flags = defined_in_subgraph.count(ind) ? XNN_VALUE_FLAG_EXTERNAL_OUTPUT
+                                                          : XNN_VALUE_FLAG_EXTERNAL_INPUT;
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    if (!defineValue(ind, external_id, flags, &id))
+      return false;
+    _values[ind] = id;
+  }
+
+  for (const auto &op_ind : _ops)
+  {
+    const auto &op = _operations.at(op_ind);
+    // Operations which are not visited here are not supported
+    _status = xnn_status_unsupported_parameter;
+    _values_valid = true;
+    op.accept(*this);
+    if (_status != xnn_status_success || !_values_valid)
+    {
+      VERBOSE(SubgraphBuilder) << "XNNPACK subgraph does not support " << op.name() << "(#"
+                               << op_ind.value() << ")" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+xnn_subgraph_t SubgraphBuilder::releaseSubgraph()
+{
+  auto subgraph = _subgraph;
+  _subgraph = nullptr;
+  return subgraph;
+}
+
+bool SubgraphBuilder::isConstant(const ir::OperandIndex &ind) const
+{
+  return _operands.at(ind).isConstant();
+}
+
+uint32_t SubgraphBuilder::value(const ir::OperandIndex &ind)
+{
+  if (!ind.valid())
+    return XNN_INVALID_VALUE_ID;
+
+  auto it = _values.find(ind);
+  if (it != _values.end())
+    return it->second;
+
+  // Constants and internal values are defined when an operation uses them first
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  if (!defineValue(ind, XNN_INVALID_VALUE_ID, 0, &id))
+  {
+    _values_valid = false;
+    return XNN_INVALID_VALUE_ID;
+  }
+  _values[ind] = id;
+  return id;
+}
+
+bool SubgraphBuilder::defineValue(const ir::OperandIndex &ind, uint32_t external_id,
+                                  uint32_t flags, uint32_t *id)
+{
+  const auto &operand = _operands.at(ind);
+  const auto &info = operand.info();
+  // NOTE XNNPACK of the version in use defines float values only in subgraphs
+  if (info.typeInfo().type() != ir::DataType::FLOAT32 || info.isDynamic() ||
+      info.shape().hasUnspecifiedDims() || info.shape().rank() > XNN_MAX_TENSOR_DIMS)
+    return false;
+
+  std::vector<size_t> dims;
+  for (const auto dim : info.shape().dims())
+    dims.emplace_back(static_cast<size_t>(dim));
+
+  const void *data = nullptr;
+  if (operand.isConstant())
+  {
+    auto shared_data = operand.shareData();
+    data = shared_data->base();
+    _constants.emplace_back(std::move(shared_data));
+  }
+
+  return xnn_define_tensor_value(_subgraph, xnn_datatype_fp32, dims.size(), dims.data(), data,
+                                 external_id, flags, id) == xnn_status_success;
+}
+
+bool SubgraphBuilder::activationRange(ir::Activation activation, float *min, float *max)
+{
+  if (activation != ir::Activation::NONE && activation != ir::Activation::RELU &&
+      activation != ir::Activation::RELU1 && activation != ir::Activation::RELU6)
+    return false;
+
+  ops::CalculateActivationRange<float>(activation, min, max);
+  // XNNPACK takes unbounded clamping as infinity
+  if (*max == std::numeric_limits<float>::max())
+    *max = std::numeric_limits<float>::infinity();
+  if (*min == std::numeric_limits<float>::lowest())
+    *min = -std::numeric_limits<float>::infinity();
+  return true;
+}
+
+void SubgraphBuilder::visit(const ir::operation::BinaryArithmetic &node)
+{
+  using ir::operation::BinaryArithmetic;
+
+  float min = 0.f, max = 0.f;
+  if (!activationRange(node.param().activation, &min, &max))
+    return;
+
+  const auto lhs = value(node.getInputs().at(BinaryArithmetic::Input::LHS));
+  const auto rhs = value(node.getInputs().at(BinaryArithmetic::Input::RHS));
+  const auto out = value(node.getOutputs().at(0));
+  switch (node.param().arithmetic_type)
+  {
+    case BinaryArithmetic::ArithmeticType::ADD:
+      _status = xnn_define_add2(_subgraph, min, max, lhs, rhs, out, 0);
+      break;
+    case BinaryArithmetic::ArithmeticType::SUB:
+      _status = xnn_define_subtract(_subgraph, min, max, lhs, rhs, out, 0);
+      break;
+    case BinaryArithmetic::ArithmeticType::MUL:
+      _status = xnn_define_multiply2(_subgraph, min, max, lhs, rhs, out, 0);
+      break;
+    case BinaryArithmetic::ArithmeticType::DIV:
+      _status = xnn_define_divide(_subgraph, min, max, lhs, rhs, out, 0);
+      break;
+    default:
+      break;
+  }
+}
+
+void SubgraphBuilder::visit(const ir::operation::Conv2D &node)
+{
+  using ir::operation::Conv2D;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(Conv2D::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(Conv2D::Input::KERNEL)};
+  const auto bias_index{node.getInputs().at(Conv2D::Input::BIAS)};
+
+  float min = 0.f, max = 0.f;
+  if (!activationRange(node.param().activation, &min, &max) || !isConstant(ker_index))
+    return;
+
+  const auto &param = node.param();
+  const auto ifm_shape = _operands.at(ifm_index).shape().asFeature(ir::Layout::NHWC);
+  const auto ofm_shape = _operands.at(ofm_index).shape().asFeature(ir::Layout::NHWC);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _operands.at(ker_index).shape();
+  const uint32_t ker_height = ker_shape.dim(1);
+  const uint32_t ker_width = ker_shape.dim(2);
+  const auto padding = ir::calculatePadding(param.padding, ifm_shape, ofm_shape, param.stride,
+                                            ker_width, ker_height, param.dilation.width_factor,
+                                            param.dilation.height_factor);
+
+  _status = xnn_define_convolution_2d(
+    _subgraph, padding.top, padding.right, padding.bottom, padding.left, ker_height, ker_width,
+    param.stride.vertical, param.stride.horizontal, param.dilation.height_factor,
+    param.dilation.width_factor, 1 /* groups */, ker_shape.dim(3) /* group_input_channels */,
+    ker_shape.dim(0) /* group_output_channels */, min, max, value(ifm_index),
+    value(ker_index), value(bias_index), value(ofm_index), 0);
+}
+
+void SubgraphBuilder::visit(const ir::operation::DepthwiseConv2D &node)
+{
+  using ir::operation::DepthwiseConv2D;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(DepthwiseConv2D::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(DepthwiseConv2D::Input::KERNEL)};
+  const auto bias_index{node.getInputs().at(DepthwiseConv2D::Input::BIAS)};
+
+  float min = 0.f, max = 0.f;
+  if (!activationRange(node.param().activation, &min, &max) || !isConstant(ker_index))
+    return;
+
+  const auto &param = node.param();
+  const auto ifm_shape = _operands.at(ifm_index).shape().asFeature(ir::Layout::NHWC);
+  const auto ofm_shape = _operands.at(ofm_index).shape().asFeature(ir::Layout::NHWC);
+  // Kernel format is [1, kernel_height, kernel_width, depth_out].
+  const auto &ker_shape = _operands.at(ker_index).shape();
+  const uint32_t ker_height = ker_shape.dim(1);
+  const uint32_t ker_width = ker_shape.dim(2);
+  const auto padding = ir::calculatePadding(param.padding, ifm_shape, ofm_shape, param.stride,
+                                            ker_width, ker_height, param.dilation.width_factor,
+                                            param.dilation.height_factor);
+
+  _status = xnn_define_depthwise_convolution_2d(
+    _subgraph, padding.top, padding.right, padding.bottom, padding.left, ker_height, ker_width,
+    param.stride.vertical, param.stride.horizontal, param.dilation.height_factor,
+    param.dilation.width_factor, param.multiplier, ifm_shape.C /* input_channels */, min, max,
+    value(ifm_index), value(ker_index), value(bias_index), value(ofm_index), 0);
+}
+
+void SubgraphBuilder::visit(const ir::operation::ElementwiseActivation &node)
+{
+  using ir::operation::ElementwiseActivation;
+
+  const auto input = value(node.getInputs().at(ElementwiseActivation::Input::INPUT));
+  const auto output = value(node.getOutputs().at(0));
+  const auto &param = node.param();
+  switch (param.op_type)
+  {
+    case ElementwiseActivation::Type::RELU:
+      // alpha and beta are the upper and lower bounds
+      _status = xnn_define_clamp(_subgraph, param.beta, param.alpha, input, output, 0);
+      break;
+    case ElementwiseActivation::Type::LOGISTIC:
+      _status = xnn_define_sigmoid(_subgraph, input, output, 0);
+      break;
+    default:
+      break;
+  }
+}
+
+void SubgraphBuilder::visit(const ir::operation::ElementwiseBinary &node)
+{
+  using ir::operation::ElementwiseBinary;
+
+  const auto lhs = value(node.getInputs().at(ElementwiseBinary::Input::LHS));
+  const auto rhs = value(node.getInputs().at(ElementwiseBinary::Input::RHS));
+  const auto out = value(node.getOutputs().at(0));
+  switch (node.param().op_type)
+  {
+    case ElementwiseBinary::ElementwiseBinaryType::MAX:
+      _status = xnn_define_maximum2(_subgraph, lhs, rhs, out, 0);
+      break;
+    case ElementwiseBinary::ElementwiseBinaryType::MIN:
+      _status = xnn_define_minimum2(_subgraph, lhs, rhs, out, 0);
+      break;
+    default:
+      break;
+  }
+}
+
+void SubgraphBuilder::visit(const ir::operation::ElementwiseUnary &node)
+{
+  using ir::operation::ElementwiseUnary;
+
+  const auto input = value(node.getInputs().at(ElementwiseUnary::Input::INPUT));
+  const auto output = value(node.getOutputs().at(0));
+  switch (node.param().op_type)
+  {
+    case ElementwiseUnary::Type::ABS:
+      _status = xnn_define_abs(_subgraph, input, output, 0);
+      break;
+    case ElementwiseUnary::Type::FLOOR:
+      _status = xnn_define_floor(_subgraph, input, output, 0);
+      break;
+    case ElementwiseUnary::Type::NEG:
+      _status = xnn_define_negate(_subgraph, input, output, 0);
+      break;
+    case ElementwiseUnary::Type::SQRT:
+      _status = xnn_define_square_root(_subgraph, input, output, 0);
+      break;
+    case ElementwiseUnary::Type::SQUARE:
+      _status = xnn_define_square(_subgraph, input, output, 0);
+      break;
+    default:
+      break;
+  }
+}
+
+void SubgraphBuilder::visit(const ir::operation::FullyConnected &node)
+{
+  using ir::operation::FullyConnected;
+
+  const auto input_index{node.getInputs().at(FullyConnected::Input::INPUT)};
+  const auto weight_index{node.getInputs().at(FullyConnected::Input::WEIGHT)};
+  const auto bias_index{node.getInputs().at(FullyConnected::Input::BIAS)};
+  const auto output_index{node.getOutputs().at(0)};
+
+  float min = 0.f, max = 0.f;
+  if (!activationRange(node.param().activation, &min, &max) || !isConstant(weight_index) ||
+      node.param().weights_format != ir::FullyConnectedWeightsFormat::Default)
+    return;
+
+  // XNNPACK regards all the outer dimensions of input as batch
+  const auto &input_shape = _operands.at(input_index).shape();
+  const auto &weight_shape = _operands.at(weight_index).shape();
+  if (input_shape.dim(input_shape.rank() - 1) != weight_shape.dim(1))
+    return;
+
+  _status = xnn_define_fully_connected(_subgraph, min, max, value(input_index),
+                                       value(weight_index), value(bias_index),
+                                       value(output_index), 0);
+}
+
+void SubgraphBuilder::visit(const ir::operation::Pool2D &node)
+{
+  using ir::operation::Pool2D;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(Pool2D::Input::INPUT)};
+
+  const auto &param = node.param();
+  float min = 0.f, max = 0.f;
+  if (!activationRange(param.activation, &min, &max))
+    return;
+
+  const auto ifm_shape = _operands.at(ifm_index).shape().asFeature(ir::Layout::NHWC);
+  const auto ofm_shape = _operands.at(ofm_index).shape().asFeature(ir::Layout::NHWC);
+  const auto padding =
+    ir::calculatePadding(param.padding, ifm_shape, ofm_shape, param.stride, param.kw, param.kh);
+
+  switch (param.op_type)
+  {
+    case Pool2D::PoolType::MAX:
+      _status = xnn_define_max_pooling_2d(
+        _subgraph, padding.top, padding.right, padding.bottom, padding.left, param.kh, param.kw,
+        param.stride.vertical, param.stride.horizontal, 1, 1, min, max, value(ifm_index),
+        value(ofm_index), 0);
+      break;
+    case Pool2D::PoolType::AVG:
+    {
+      // Average must not count padded elements, which XNNPACK does only for TensorFlow SAME
+      // padding
+      const bool padded =
+        padding.top != 0 || padding.right != 0 || padding.bottom != 0 || padding.left != 0;
+      if (padded && param.padding.type != ir::PaddingType::SAME)
+        break;
+      _status = xnn_define_average_pooling_2d(
+        _subgraph, 0, 0, 0, 0, param.kh, param.kw, param.stride.vertical, param.stride.horizontal,
+        min, max, value(ifm_index), value(ofm_index),
+        padded ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void SubgraphBuilder::visit(const ir::operation::PReLU &node)
+{
+  using ir::operation::PReLU;
+
+  const auto alpha_index{node.getInputs().at(PReLU::Input::ALPHA)};
+  if (!isConstant(alpha_index))
+    return;
+
+  _status = xnn_define_prelu(_subgraph, value(node.getInputs().at(PReLU::Input::INPUT)),
+                             value(alpha_index), value(node.getOutputs().at(0)), 0);
+}
+
+void SubgraphBuilder::visit(const ir::operation::Softmax &node)
+{
+  using ir::operation::Softmax;
+
+  if (node.param().beta != 1.f)
+    return;
+
+  _status = xnn_define_softmax(_subgraph, value(node.getInputs().at(Softmax::Input::INPUT)),
+                               value(node.getOutputs().at(0)), 0);
+}
+
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_XNNPACK_SUBGRAPH_BUILDER_H__
+#define __ONERT_BACKEND_XNNPACK_SUBGRAPH_BUILDER_H__
+
+#include <ir/Data.h>
+#include <ir/OperandIndexMap.h>
+#include <ir/Operands.h>
+#include <ir/OperationVisitor.h>
+#include <ir/Operations.h>
+#include <util/Set.h>
+
+#include <memory>
+#include <vector>
+
+#include <xnnpack.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+
+/**
+ * @brief Class to define a run of operations as one XNNPACK subgraph
+ *
+ * Operands in @c internals live only inside the subgraph, so XNNPACK plans their memory and may
+ * fuse their producers and consumers. Every other non-constant operand becomes an external value
+ * which is bound to an onert tensor at run time.
+ */
+class SubgraphBuilder : public ir::OperationVisitor
+{
+public:
+  SubgraphBuilder(const ir::Operands &operands, const ir::Operations &operations,
+                  const std::vector<ir::OperationIndex> &ops,
+                  const util::Set<ir::OperandIndex> &internals);
+  ~SubgraphBuilder();
+
+public:
+  /**
+   * @brief  Define all the operations as nodes of the subgraph
+   * @return @c false if XNNPACK does not support any of the operations or operands
+   */
+  bool build();
+  /**
+   * @brief  Release the built subgraph whose ownership goes to the caller
+   */
+  xnn_subgraph_t releaseSubgraph();
+  /**
+   * @brief  Operands bound to external values, indexed by the external value id
+   */
+  const std::vector<ir::OperandIndex> &externals() const { return _externals; }
+  /**
+   * @brief  Constant data the subgraph refers to, which must outlive the runtime
+   */
+  std::vector<std::shared_ptr<ir::Data>> releaseConstants() { return std::move(_constants); }
+
+public:
+  /**
+   * @brief  Check if an operation can be a node of XNNPACK subgraph by defining it alone
+   */
+  static bool isSupported(const ir::Operands &operands, const ir::Operations &operations,
+                          const ir::OperationIndex &ind);
+
+private:
+  void visit(const ir::operation::BinaryArithmetic &) override;
+  void visit(const ir::operation::Conv2D &) override;
+  void visit(const ir::operation::DepthwiseConv2D &) override;
+  void visit(const ir::operation::ElementwiseActivation &) override;
+  void visit(const ir::operation::ElementwiseBinary &) override;
+  void visit(const ir::operation::ElementwiseUnary &) override;
+  void visit(const ir::operation::FullyConnected &) override;
+  void visit(const ir::operation::Pool2D &) override;
+  void visit(const ir::operation::PReLU &) override;
+  void visit(const ir::operation::Softmax &) override;
+
+private:
+  uint32_t value(const ir::OperandIndex &ind);
+  bool defineValue(const ir::OperandIndex &ind, uint32_t external_id, uint32_t flags,
+                   uint32_t *id);
+  bool activationRange(ir::Activation activation, float *min, float *max);
+  bool isConstant(const ir::OperandIndex &ind) const;
+
+private:
+  const ir::Operands &_operands;
+  const ir::Operations &_operations;
+  const std::vector<ir::OperationIndex> _ops;
+  const util::Set<ir::OperandIndex> &_internals;
+  xnn_subgraph_t _subgraph;
+  std::vector<ir::OperandIndex> _externals;
+  ir::OperandIndexMap<uint32_t> _values;
+  std::vector<std::shared_ptr<ir::Data>> _constants;
+  // Result of defining the current operation
+  xnn_status _status;
+  bool _values_valid;
+};
+
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_XNNPACK_SUBGRAPH_BUILDER_H__
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SubgraphLayer.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+SubgraphLayer::SubgraphLayer(const std::shared_ptr<ExternalContext> external_context)
+  : _runtime{nullptr}, _external_context{external_context}
+{
+  // DO NOTHING
+}
+
+SubgraphLayer::~SubgraphLayer()
+{
+  if (_runtime)
+    xnn_delete_runtime(_runtime);
+}
+
+bool SubgraphLayer::configure(xnn_subgraph_t subgraph,
+                              const std::vector<IPortableTensor *> &externals,
+                              std::vector<std::shared_ptr<ir::Data>> &&constants)
+{
+  assert(subgraph != nullptr);
+  assert(_external_context && _external_context->getThreadPool());
+
+  // XNNPACK packs weights and plans memory of internal values here
+  enum xnn_status status =
+    xnn_create_runtime_v2(subgraph, _external_context->getThreadPool(), 0, &_runtime);
+  xnn_delete_subgraph(subgraph);
+  if (status != xnn_status_success)
+  {
+    _runtime = nullptr;
+    return false;
+  }
+
+  _externals = externals;
+  _constants = std::move(constants);
+  _bound.clear();
+  for (uint32_t id = 0; id < _externals.size(); ++id)
+    _bound.emplace_back(xnn_external_value{id, nullptr});
+  return true;
+}
+
+void SubgraphLayer::run()
+{
+  assert(_runtime != nullptr);
+
+  // Setup again only if buffers have been changed, e.g. by user's inputs and outputs
+  bool changed = false;
+  for (size_t i = 0; i < _externals.size(); ++i)
+  {
+    auto tensor = _externals[i];
+    if (tensor->is_dynamic())
+      throw std::runtime_error{"XNNPACK subgraph does not support dynamic tensors"};
+    if (tensor->buffer() == nullptr)
+      throw std::runtime_error{"XNNPACK subgraph: external tensor has no buffer"};
+    if (_bound[i].data != tensor->buffer())
+    {
+      _bound[i].data = tensor->buffer();
+      changed = true;
+    }
+  }
+
+  if (changed)
+  {
+    enum xnn_status status = xnn_setup_runtime(_runtime, _bound.size(), _bound.data());
+    if (status != xnn_status_success)
+      throw std::runtime_error{"failed to setup XNNPACK runtime"};
+  }
+
+  enum xnn_status status = xnn_invoke_runtime(_runtime);
+  if (status != xnn_status_success)
+    throw std::runtime_error{"failed to run XNNPACK runtime"};
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
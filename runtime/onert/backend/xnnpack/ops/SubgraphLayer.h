@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_XNNPACK_OPS_SUBGRAPH_LAYER_H__
+#define __ONERT_BACKEND_XNNPACK_OPS_SUBGRAPH_LAYER_H__
+
+#include <exec/IFunction.h>
+#include <backend/IPortableTensor.h>
+#include <ir/Data.h>
+#include "../ExternalContext.h"
+
+#include <memory>
+#include <vector>
+
+#include <xnnpack.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+/**
+ * @brief Function to execute consecutive operations as one XNNPACK runtime
+ */
+class SubgraphLayer : public ::onert::exec::IFunction
+{
+public:
+  SubgraphLayer(const std::shared_ptr<ExternalContext> external_context);
+  ~SubgraphLayer();
+
+public:
+  /**
+   * @brief     Create XNNPACK runtime from a subgraph
+   * @param[in] subgraph  Subgraph to create the runtime from, which is deleted by this function
+   * @param[in] externals Tensors bound to the external values, indexed by the external value id
+   * @param[in] constants Constant data the subgraph refers to
+   * @return    @c false if XNNPACK fails to create the runtime
+   */
+  bool configure(xnn_subgraph_t subgraph, const std::vector<IPortableTensor *> &externals,
+                 std::vector<std::shared_ptr<ir::Data>> &&constants);
+
+  void run() override;
+
+private:
+  xnn_runtime_t _runtime;
+  std::vector<IPortableTensor *> _externals;
+  // Buffers bound to the runtime by the last setup
+  std::vector<xnn_external_value> _bound;
+  std::vector<std::shared_ptr<ir::Data>> _constants;
+  const std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_XNNPACK_OPS_SUBGRAPH_LAYER_H__
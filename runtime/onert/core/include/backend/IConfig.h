@@ -19,6 +19,7 @@
 
 #include "ir/Layout.h"
 #include "ir/Operation.h"
+#include "ir/Operands.h"
 #include "util/ITimer.h"
 
 #include <memory>
@@ -69,6 +70,31 @@ struct IConfig
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  /**
+   * @brief Returns whether contexts of this backend can generate kernels concurrently
+   *
+   * @return true  genKernels() of different contexts may run on different threads at once
+   * @return false Kernels must be generated one context at a time
+   */
+  virtual bool supportParallelCompile() { return false; }
+  /**
+   * @brief Returns whether this backend has a kernel for the given \p node
+   *
+   * @param operands Operands of the graph which \p node belongs to
+   * @param node Operation
+   * @return true  The backend can run \p node
+   * @return false The backend may not run \p node, or does not tell
+   * @note  HEScheduler considers a backend for an operation never profiled on it only if this
+   *        returns true
+   */
+  virtual bool supportOperation(const ir::Operands &, const ir::Operation &) { return false; }
+  /**
+   * @brief Returns whether kernels of this backend can run concurrently
+   *
+   * @return true  Different kernels of a context may run on different threads at once
+   * @return false Kernels must run one at a time
+   */
+  virtual bool supportConcurrentExecution() { return false; }
 };
 
 } // namespace backend
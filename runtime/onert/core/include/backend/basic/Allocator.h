@@ -22,6 +22,8 @@
 #ifndef __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace onert
@@ -37,16 +39,44 @@ namespace basic
 class Allocator
 {
 public:
+  // Alignment of memory allocated by Allocator, enough for any SIMD load/store
+  static constexpr size_t ALIGNMENT = 64;
+
+  using Deleter = std::function<void(uint8_t *)>;
+
+public:
+  /**
+   * @brief Allocate zero-filled memory of @c capacity bytes
+   */
   Allocator(uint32_t capacity);
+  /**
+   * @brief Take memory allocated by others, which is given back through @c deleter on release
+   */
+  Allocator(uint8_t *base, Deleter deleter);
+  ~Allocator() { release(); }
+
+  Allocator(const Allocator &) = delete;
+  Allocator &operator=(const Allocator &) = delete;
+
+public:
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
-  uint8_t *base() const { return _base.get(); }
-  void release() { _base.reset(); }
+  uint8_t *base() const { return _base; }
+  void release();
+
+public:
+  /**
+   * @brief Allocate uninitialized memory aligned by ALIGNMENT
+   * @note  The memory must be freed with freeAligned()
+   */
+  static uint8_t *allocAligned(size_t size);
+  static void freeAligned(uint8_t *base);
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  uint8_t *_base;
+  Deleter _deleter;
 };
 
 } // namespace basic
@@ -54,18 +54,39 @@ private:
   std::shared_ptr<Allocator> _mem_alloc;
 };
 
+class DynamicMemoryPool;
+
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
-  virtual ~DynamicMemoryManager() = default;
+  DynamicMemoryManager();
+  virtual ~DynamicMemoryManager();
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
+  /**
+   * @brief Free memory which is kept to be reused by dynamic tensors
+   * @note  Deallocated memory is kept for later allocations until this is called, so that
+   *        running with varying input shapes does not allocate memory for every run.
+   */
+  void trim(void);
+
+public:
+  // Number of allocations served by memory kept for reuse
+  size_t hits(void) const;
+  // Number of allocations which got new memory
+  size_t misses(void) const;
+  // Bytes of memory kept for reuse
+  size_t cachedBytes(void) const;
+  // Peak of bytes of memory in use, which caps memory in use and kept together
+  size_t peakBytes(void) const;
+
 private:
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  // Shared with allocators of tensors which may be released after this manager
+  std::shared_ptr<DynamicMemoryPool> _mem_pool;
 };
 
 } // namespace basic
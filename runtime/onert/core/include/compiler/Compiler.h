@@ -55,10 +55,13 @@ struct CompilerOptions
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   std::string executor;       //< Executor name to use
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
-  bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
-  bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
-  bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
-  bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool he_scheduler;         //< HEScheduler if true, ManualScheduler otherwise
+  bool partition_backends;   //< Move operations of ManualScheduler to reduce permutations
+  bool he_profiling_mode;    //< Whether HEScheduler profiling mode ON/OFF
+  bool disable_compile;      //< Run with Interpreter if true, try compilation otherwise
+  bool fp16_enable;          //< Whether fp16 mode ON/OFF
+  uint32_t compile_threads;  //< Number of threads to lower subgraphs and generate kernels with
+  uint32_t parallel_threads; //< Max operations at once per backend in Parallel executor
 
   util::TracingCtx *tracing_ctx; //< Profiling information
 };
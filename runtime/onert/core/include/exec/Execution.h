@@ -24,7 +24,15 @@
 #include "ir/Layout.h"
 #include "exec/IExecutor.h"
 #include "IODescription.h"
-
+#include "exec/ShapeBucketCache.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <thread>
 
 namespace onert
@@ -45,6 +53,7 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<ExecutorMap> &executors);
+  ~Execution();
 
 public:
   /**
@@ -114,6 +123,12 @@ public:
    * @param[in] layout  Output data's data format
    */
   void setOutputLayout(const ir::IOIndex &index, ir::Layout layout);
+  /**
+   * @brief  Pin input and output buffers which are set now
+   * @note   Executors bind pinned buffers once and reuse the binding for following runs until any
+   *         input or output is set again. The buffers must stay valid while pinned.
+   */
+  void pinIO();
   /**
    * @brief  Execution
    * @note   It should be called after setting input and output buffer
@@ -121,18 +136,39 @@ public:
   void execute();
 
   /**
-   * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
-   *        It should be called after setting input and output buffer
+   * @brief     Function called on the worker thread when an asynchronous run finishes
+   * @param[in] error Exception thrown by the run, or @c nullptr on success
+   * @note      It must not throw
    */
-  void startExecute(void);
+  using Callback = std::function<void(std::exception_ptr error)>;
+
+  /**
+   * @brief     Start asynchronous execution
+   * @param[in] callback  Function called when this run finishes
+   * @return    Id of the run which can be given to @c waitFinish
+   * @note      It returns after the run is queued to the worker thread of this execution.
+   *            It should be called after setting input and output buffer. Input and output
+   *            settings are copied when queued, so they may be changed for the next run while
+   *            this one is in flight.
+   */
+  uint64_t startExecute(const Callback &callback = nullptr);
 
   /**
    * @brief Return when execution is finished
-   * @note  It waits until execution is finished
+   * @note  It waits until all queued runs are finished, and rethrows the exception of the first
+   *        failed one
    */
   void waitFinish(void);
 
+  /**
+   * @brief     Return when the given run is finished
+   * @param[in] run_id  Id returned by @c startExecute
+   * @note      Runs are done in order, so the runs queued before it are finished too. It rethrows
+   *            the exception of the given run only, and that of another run is kept until the
+   *            run is waited for.
+   */
+  void waitFinish(uint64_t run_id);
+
   /**
    * @brief   Check execution is finished
    * @return  @c true if execution is finished, otherwise @c false
@@ -142,6 +178,30 @@ public:
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
 
+  /**
+   * @brief     Run changed input shapes on executors specialized for them
+   * @param[in] cache Cache of executors compiled with static input shapes
+   * @note      Input shapes which the cache cannot serve still run on the dynamic path
+   */
+  void setShapeBucketCache(std::unique_ptr<ShapeBucketCache> cache)
+  {
+    _shape_cache = std::move(cache);
+  }
+
+private:
+  struct AsyncRun
+  {
+    uint64_t id;
+    std::unique_ptr<IODescription> desc;
+    Callback callback;
+  };
+
+  void run(IODescription &desc);
+  bool executeWithShapeBucket(IODescription &desc);
+  void runAsyncWorker();
+  // Wait for runs until run_id, and rethrow the first exception of runs from first_error_id
+  void waitRuns(uint64_t run_id, uint64_t first_error_id);
+
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
   {
@@ -152,8 +212,23 @@ private:
 private:
   const std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
-  std::unique_ptr<std::thread> _exec_thread;
-  bool finished{false};
+  // Written under _async_mutex for asynchronous runs, read by isFinished() without it
+  std::atomic<bool> finished{false};
+  std::unique_ptr<ShapeBucketCache> _shape_cache;
+  std::mutex _shape_cache_mutex;
+
+  // Persistent worker for asynchronous runs, created on the first startExecute()
+  std::thread _worker;
+  std::mutex _async_mutex;
+  std::condition_variable _queued_cv;
+  std::condition_variable _finished_cv;
+  std::deque<AsyncRun> _queued_runs;
+  std::deque<AsyncRun> _finished_runs;
+  // Exceptions of finished runs which are not waited for yet
+  std::map<uint64_t, std::exception_ptr> _run_errors;
+  uint64_t _last_queued_id{0};
+  uint64_t _last_finished_id{0};
+  bool _stop_worker{false};
 };
 
 } // namespace exec
@@ -64,6 +64,8 @@ struct IODescription
   std::vector<std::unique_ptr<OutputDesc>> outputs;
   // Contains shape of input set by nnfw_set_input_tensorinfo(..)
   std::unordered_map<ir::IOIndex, ir::Shape> dynamic_input_shapes;
+  // Non-zero if the buffers are pinned, identifying them so that executors bind them only once
+  uint64_t pinned_id{0};
 };
 
 } // namespace exec
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  ShapeBucketCache.h
+ * @brief This file defines ShapeBucketCache which keeps executors specialized for input shapes
+ */
+#ifndef __ONERT_EXEC_SHAPE_BUCKET_CACHE_H__
+#define __ONERT_EXEC_SHAPE_BUCKET_CACHE_H__
+
+#include "IExecutor.h"
+#include "ir/Shape.h"
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief LRU cache of executors compiled with fully static input shapes
+ *
+ * Models whose inputs change shape at run time go through dynamic shape inference and dynamic
+ * memory allocation on every run. This cache compiles the model once per observed input shape set
+ * (a "bucket") so that repeated shapes run on the static path instead.
+ *
+ * When padding is allowed, a dimension that differs from the model's own input dimension is
+ * rounded up to the next power of two, so that nearby shapes share one bucket. The caller is
+ * responsible for zero-padding the inputs to the bucket shape.
+ */
+class ShapeBucketCache
+{
+public:
+  using Shapes = std::vector<ir::Shape>;
+  using Builder = std::function<std::shared_ptr<ExecutorMap>(const Shapes &)>;
+
+  struct Entry
+  {
+    Shapes bucket;
+    std::shared_ptr<ExecutorMap> executors;
+    uint64_t memory_size;
+  };
+
+public:
+  /**
+   * @brief     Construct a new ShapeBucketCache object
+   * @param[in] model_shapes  Input shapes the model was compiled with
+   * @param[in] builder       Function to compile executors for given input shapes
+   * @param[in] capacity      Maximum number of cached executors
+   * @param[in] memory_limit  Maximum estimated memory in bytes for all cached executors
+   * @param[in] allow_padding Whether inputs may be padded up to a larger bucket
+   */
+  ShapeBucketCache(const Shapes &model_shapes, const Builder &builder, uint32_t capacity,
+                   uint64_t memory_limit, bool allow_padding);
+
+public:
+  /**
+   * @brief     Find or compile executors for the given input shapes
+   * @param[in] shapes  Input shapes for the next run
+   * @return    Cache entry, or @c nullptr if the shapes must run on the dynamic path
+   * @note      The returned entry is valid until the next call of @c lookup
+   */
+  const Entry *lookup(const Shapes &shapes);
+
+  /**
+   * @brief     Return the bucket shapes that the given input shapes map to
+   */
+  Shapes bucketOf(const Shapes &shapes) const;
+
+  uint32_t size() const { return static_cast<uint32_t>(_entries.size()); }
+  uint64_t memorySize() const { return _memory_size; }
+  uint32_t hits() const { return _hits; }
+  uint32_t misses() const { return _misses; }
+
+private:
+  void evict();
+
+private:
+  const Shapes _model_shapes;
+  const Builder _builder;
+  const uint32_t _capacity;
+  const uint64_t _memory_limit;
+  const bool _allow_padding;
+  // Most recently used entry comes first
+  std::list<Entry> _entries;
+  // Buckets that can never fit in the cache
+  std::vector<Shapes> _rejected;
+  uint64_t _memory_size{0};
+  uint32_t _hits{0};
+  uint32_t _misses{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_SHAPE_BUCKET_CACHE_H__
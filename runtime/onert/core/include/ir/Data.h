@@ -18,6 +18,7 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <memory>
 #include <sys/mman.h>
 
 namespace onert
@@ -70,6 +71,23 @@ private:
   const size_t _size;
 };
 
+/**
+ * @brief Data in a pool which is shared with other Data, e.g. all constants of a model
+ */
+class PooledData final : public ExternalData
+{
+public:
+  PooledData(const std::shared_ptr<uint8_t> &pool, const uint8_t *base, size_t size)
+    : ExternalData(base, size), _pool{pool}
+  {
+    // DO NOTHING
+  }
+
+private:
+  // Keeps the pool alive while this data is in use
+  std::shared_ptr<uint8_t> _pool;
+};
+
 class MMapedData final : public ExternalData
 {
 public:
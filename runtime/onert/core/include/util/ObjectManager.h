@@ -17,12 +17,13 @@
 #ifndef __ONERT_UTIL_OBJECT_MANAGER_H__
 #define __ONERT_UTIL_OBJECT_MANAGER_H__
 
+#include <algorithm>
+#include <cassert>
 #include <unordered_map>
 #include <memory>
-#include <list>
 #include <functional>
-
-#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "util/logging.h"
 
@@ -34,6 +35,10 @@ namespace util
 /**
  * @brief Class that owns objects and maps them with indices as a handle for them
  *
+ * Objects are kept in a vector addressed by the index value, so a lookup is a plain array access
+ * and iteration follows the index order. Only indices far beyond the number of objects (which
+ * can be given to @c push explicitly) are kept in a hash map, so that they do not blow up the
+ * vector.
  */
 template <typename Index, typename Object> class ObjectManager
 {
@@ -52,7 +57,7 @@ public:
     auto index = generateIndex();
     if (!index.valid())
       return index;
-    _objects.emplace(index, std::make_unique<Object>(std::forward<Args>(args)...));
+    insert(index, std::make_unique<Object>(std::forward<Args>(args)...));
     return index;
   }
 
@@ -69,7 +74,7 @@ public:
   {
     auto gen_index = tryIndex(index);
     if (gen_index.valid())
-      _objects.emplace(gen_index, std::move(object));
+      insert(gen_index, std::move(object));
     return gen_index;
   }
   /**
@@ -84,7 +89,7 @@ public:
   {
     auto gen_index = generateIndex();
     if (gen_index.valid())
-      _objects.emplace(gen_index, std::move(object));
+      insert(gen_index, std::move(object));
     return gen_index;
   }
   /**
@@ -100,7 +105,13 @@ public:
   Index set(Index index, std::unique_ptr<Object> &&object)
   {
     if (index.valid())
-      _objects[index] = std::move(object);
+    {
+      auto slot = find(index);
+      if (slot != nullptr)
+        *slot = std::move(object);
+      else
+        insert(index, std::move(object));
+    }
     return index;
   }
   /**
@@ -109,7 +120,22 @@ public:
    * @param[in] index Index of the object to be removed
    * @return N/A
    */
-  void remove(const Index &index) { _objects.erase(index); }
+  void remove(const Index &index)
+  {
+    if (index.value() < _dense.size())
+    {
+      auto &slot = _dense[index.value()];
+      if (slot != nullptr)
+      {
+        slot.reset();
+        _size--;
+      }
+    }
+    else if (_sparse.erase(index) > 0)
+    {
+      _size--;
+    }
+  }
 
   /**
    * @brief Get the object that is associated with the given index
@@ -119,7 +145,13 @@ public:
    * @param[in] index Index of the object to be returned
    * @return Object
    */
-  const Object &at(const Index &index) const { return *(_objects.at(index)); }
+  const Object &at(const Index &index) const
+  {
+    auto object = getRawPtr(index);
+    if (object == nullptr)
+      throw std::out_of_range{"ObjectManager: no object with the given index"};
+    return *object;
+  }
   /**
    * @brief Get the object that is associated with the given index
    *
@@ -128,7 +160,10 @@ public:
    * @param[in] index Index of the object to be returned
    * @return Object
    */
-  Object &at(const Index &index) { return *(_objects.at(index)); }
+  Object &at(const Index &index)
+  {
+    return const_cast<Object &>(const_cast<const ObjectManager<Index, Object> *>(this)->at(index));
+  }
   /**
    * @brief Get the object that is associated with the given index
    *
@@ -139,14 +174,11 @@ public:
    */
   const Object *getRawPtr(const Index &index) const
   {
-    auto itr = _objects.find(index);
-    if (itr == _objects.end())
+    auto slot = find(index);
+    if (slot == nullptr)
       return nullptr;
-    else
-    {
-      assert(itr->second != nullptr);
-      return itr->second.get();
-    }
+    assert(*slot != nullptr);
+    return slot->get();
   }
   /**
    * @brief Get the object that is associated with the given index
@@ -167,17 +199,13 @@ public:
    * @param[in] index Index of the object to be returned
    * @return true if such entry exists otherwise false
    */
-  bool exist(const Index &index) const
-  {
-    auto it = _objects.find(index);
-    return it != _objects.end();
-  }
+  bool exist(const Index &index) const { return find(index) != nullptr; }
   /**
    * @brief Return the number of objects that the manager contains
    *
    * @return size_t Number of objects
    */
-  size_t size() const { return _objects.size(); }
+  size_t size() const { return _size; }
   /**
    * @brief Iterate over the container with given function
    *
@@ -186,9 +214,15 @@ public:
    */
   void iterate(const std::function<void(const Index &, const Object &)> &fn) const
   {
-    for (const auto &e : _objects)
+    for (uint32_t value = 0; value < _dense.size(); ++value)
+    {
+      if (_dense[value] != nullptr)
+        fn(Index{value}, *_dense[value]);
+    }
+    if (!_sparse.empty())
     {
-      fn(e.first, *e.second);
+      for (const auto &index : sparseIndices())
+        fn(index, *_sparse.at(index));
     }
   }
   /**
@@ -199,18 +233,25 @@ public:
    */
   void iterate(const std::function<void(const Index &, Object &)> &fn)
   {
-    // TODO Remove this workaround
-    // This implementation is a workaround in case of adding operands while iteration
-    std::list<Index> l;
-
-    for (auto &e : _objects)
+    // Objects may be added or removed by fn, so visit only the ones which exist at this point
+    std::vector<Index> indices;
+    indices.reserve(_size);
+    for (uint32_t value = 0; value < _dense.size(); ++value)
+    {
+      if (_dense[value] != nullptr)
+        indices.emplace_back(value);
+    }
+    if (!_sparse.empty())
     {
-      l.push_back(e.first);
+      auto sparse_indices = sparseIndices();
+      indices.insert(indices.end(), sparse_indices.begin(), sparse_indices.end());
     }
 
-    for (auto index : l)
+    for (const auto &index : indices)
     {
-      fn(index, *_objects[index]);
+      auto object = getRawPtr(index);
+      if (object != nullptr)
+        fn(index, *object);
     }
   }
 
@@ -220,7 +261,7 @@ private:
   {
     if (!index.valid())
       return index;
-    if (_objects.find(index) == _objects.end())
+    if (!exist(index))
     {
       // If the given index does not exist, update the next index and return the index
       if (index.value() >= _next_index)
@@ -245,11 +286,92 @@ private:
       return Index{};
   }
 
+  // Return the slot holding the object of the given index, or nullptr if there is no object
+  const std::unique_ptr<Object> *find(const Index &index) const
+  {
+    if (index.value() < _dense.size())
+    {
+      const auto &slot = _dense[index.value()];
+      return slot != nullptr ? &slot : nullptr;
+    }
+    auto it = _sparse.find(index);
+    return it != _sparse.end() ? &it->second : nullptr;
+  }
+
+  std::unique_ptr<Object> *find(const Index &index)
+  {
+    return const_cast<std::unique_ptr<Object> *>(
+      const_cast<const ObjectManager<Index, Object> *>(this)->find(index));
+  }
+
+  // Put an object to an empty slot. An object which is already there is kept as it is.
+  void insert(const Index &index, std::unique_ptr<Object> &&object)
+  {
+    const auto value = index.value();
+    // The vector may grow up to about twice the number of objects
+    const auto dense_limit = 2 * (static_cast<size_t>(_size) + 1) + kMinDenseSize;
+    if (value >= _dense.size() && value < dense_limit)
+      growDense(std::min(std::max<size_t>(value + 1, 2 * _dense.size()), dense_limit));
+
+    if (value < _dense.size())
+    {
+      auto &slot = _dense[value];
+      if (slot == nullptr)
+      {
+        slot = std::move(object);
+        _size++;
+      }
+    }
+    else if (_sparse.emplace(index, std::move(object)).second)
+    {
+      _size++;
+    }
+  }
+
+  void growDense(size_t new_size)
+  {
+    _dense.resize(new_size);
+
+    // Move objects which now fall into the vector
+    for (auto it = _sparse.begin(); it != _sparse.end();)
+    {
+      if (it->first.value() < _dense.size())
+      {
+        _dense[it->first.value()] = std::move(it->second);
+        it = _sparse.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  std::vector<Index> sparseIndices() const
+  {
+    std::vector<Index> indices;
+    indices.reserve(_sparse.size());
+    for (const auto &e : _sparse)
+      indices.push_back(e.first);
+    std::sort(indices.begin(), indices.end(),
+              [](const Index &lhs, const Index &rhs) { return lhs.value() < rhs.value(); });
+    return indices;
+  }
+
+private:
+  static constexpr size_t kMinDenseSize = 64;
+
+  std::vector<std::unique_ptr<Object>> _dense;
+  std::unordered_map<Index, std::unique_ptr<Object>> _sparse;
+  size_t _size = 0;
+
 protected:
-  std::unordered_map<Index, std::unique_ptr<Object>> _objects;
   uint32_t _next_index;
 };
 
+template <typename Index, typename Object>
+constexpr size_t ObjectManager<Index, Object>::kMinDenseSize;
+
 } // namespace util
 } // namespace onert
 
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PageAllocator.h
+ * @brief This file declares functions to allocate memory with a page policy
+ */
+#ifndef __ONERT_UTIL_PAGE_ALLOCATOR_H__
+#define __ONERT_UTIL_PAGE_ALLOCATOR_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Policy of pages which back large and long-lived buffers such as static tensor arenas
+ *        and constant pools
+ */
+struct PagePolicy
+{
+  enum class HugePage
+  {
+    NONE,        ///< Regular pages
+    TRANSPARENT, ///< Transparent huge pages by madvise(MADV_HUGEPAGE)
+    EXPLICIT,    ///< Pages from the hugetlbfs pool, falling back to TRANSPARENT if it is empty
+  };
+
+  // NUMA node not to bind
+  static constexpr int NUMA_NONE = -1;
+  // NUMA node of the thread which allocates the buffer
+  static constexpr int NUMA_LOCAL = -2;
+
+  HugePage huge_page = HugePage::NONE;
+  int numa_node = NUMA_NONE;
+
+  bool enabled() const { return huge_page != HugePage::NONE || numa_node != NUMA_NONE; }
+
+  /**
+   * @brief Read the policy from HUGE_PAGES and NUMA_NODE configs
+   */
+  static PagePolicy fromConfig();
+};
+
+/**
+ * @brief     Parse a value of HUGE_PAGES config, one of "none", "transparent" and "explicit"
+ */
+PagePolicy::HugePage toHugePage(const std::string &val);
+
+/**
+ * @brief     Parse a value of NUMA_NODE config, one of "none", "local" and a node id
+ */
+int toNumaNode(const std::string &val);
+
+/**
+ * @brief     Allocate zero-filled memory backed by pages following @c policy
+ * @param[in] size    Size in bytes
+ * @param[in] policy  Page policy
+ * @return    Memory which is unmapped when the last reference is released
+ * @note      All pages are touched here so that running does not take page faults on them.
+ *            Huge pages and NUMA binding are best-effort and the memory is still allocated
+ *            when the system does not support them.
+ */
+std::shared_ptr<uint8_t> allocatePages(size_t size, const PagePolicy &policy);
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PAGE_ALLOCATOR_H__
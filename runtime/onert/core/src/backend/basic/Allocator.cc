@@ -18,6 +18,12 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
 namespace onert
 {
 namespace backend
@@ -25,14 +31,41 @@ namespace backend
 namespace basic
 {
 
-Allocator::Allocator(uint32_t capacity)
+constexpr size_t Allocator::ALIGNMENT;
+
+Allocator::Allocator(uint32_t capacity) : _base{allocAligned(capacity)}, _deleter{freeAligned}
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
+  std::memset(_base, 0, capacity);
 
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
-  VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
+  VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base) << std::endl;
+}
+
+Allocator::Allocator(uint8_t *base, Deleter deleter) : _base{base}, _deleter{std::move(deleter)}
+{
+  assert(_base != nullptr);
+}
+
+void Allocator::release()
+{
+  if (_base != nullptr)
+  {
+    _deleter(_base);
+    _base = nullptr;
+  }
+}
+
+uint8_t *Allocator::allocAligned(size_t size)
+{
+  void *base = nullptr;
+  // NOTE posix_memalign may return nullptr for zero size
+  if (posix_memalign(&base, ALIGNMENT, std::max<size_t>(size, 1)) != 0)
+    throw std::bad_alloc{};
+  return static_cast<uint8_t *>(base);
 }
 
+void Allocator::freeAligned(uint8_t *base) { free(base); }
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DynamicMemoryPool.h"
+
+#include "backend/basic/Allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+DynamicMemoryPool::~DynamicMemoryPool() { trim(); }
+
+uint8_t *DynamicMemoryPool::allocate(size_t size)
+{
+  const auto class_size = sizeClass(size);
+  std::vector<uint8_t *> evicted;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Reuse a buffer of the smallest class that wastes at most half of it
+    auto it = _free_lists.lower_bound(class_size);
+    if (it != _free_lists.end() && it->first <= class_size * 2)
+    {
+      const auto cached_size = it->first;
+      auto base = it->second.back();
+      it->second.pop_back();
+      if (it->second.empty())
+        _free_lists.erase(it);
+      _cached_bytes -= cached_size;
+      _used_bytes += cached_size;
+      _used_classes[base] = cached_size;
+      _peak_bytes = std::max(_peak_bytes, _used_bytes);
+      _hits++;
+      return base;
+    }
+    _misses++;
+
+    // The new buffer counts as in use from here, so that others do not evict for it again
+    _used_bytes += class_size;
+    _peak_bytes = std::max(_peak_bytes, _used_bytes);
+    evict(evicted);
+  }
+
+  for (auto base : evicted)
+    Allocator::freeAligned(base);
+
+  auto base = Allocator::allocAligned(class_size);
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  _used_classes[base] = class_size;
+  return base;
+}
+
+void DynamicMemoryPool::release(uint8_t *base)
+{
+  assert(base != nullptr);
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto it = _used_classes.find(base);
+  assert(it != _used_classes.end());
+  const auto class_size = it->second;
+  _used_classes.erase(it);
+
+  assert(_used_bytes >= class_size);
+  _free_lists[class_size].push_back(base);
+  _used_bytes -= class_size;
+  _cached_bytes += class_size;
+}
+
+void DynamicMemoryPool::evict(std::vector<uint8_t *> &bases)
+{
+  auto it = _free_lists.begin();
+  while (_used_bytes + _cached_bytes > _peak_bytes && it != _free_lists.end())
+  {
+    auto &free_list = it->second;
+    while (_used_bytes + _cached_bytes > _peak_bytes && !free_list.empty())
+    {
+      bases.push_back(free_list.back());
+      free_list.pop_back();
+      _cached_bytes -= it->first;
+    }
+    it = free_list.empty() ? _free_lists.erase(it) : std::next(it);
+  }
+}
+
+void DynamicMemoryPool::trim()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  for (auto &e : _free_lists)
+  {
+    for (auto base : e.second)
+      Allocator::freeAligned(base);
+  }
+  _free_lists.clear();
+  _cached_bytes = 0;
+}
+
+size_t DynamicMemoryPool::hits() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _hits;
+}
+
+size_t DynamicMemoryPool::misses() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _misses;
+}
+
+size_t DynamicMemoryPool::cachedBytes() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _cached_bytes;
+}
+
+size_t DynamicMemoryPool::peakBytes() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _peak_bytes;
+}
+
+size_t DynamicMemoryPool::sizeClass(size_t size)
+{
+  if (size <= Allocator::ALIGNMENT)
+    return Allocator::ALIGNMENT;
+
+  // Round up to a multiple of a quarter of the largest power of two below size
+  size_t pow2 = Allocator::ALIGNMENT;
+  while (pow2 * 2 < size)
+    pow2 *= 2;
+  const auto step = pow2 / 4;
+  return (size + step - 1) / step * step;
+}
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
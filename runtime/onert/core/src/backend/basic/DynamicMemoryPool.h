@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_DYNAMIC_MEMORY_POOL_H__
+#define __ONERT_BACKEND_BASIC_DYNAMIC_MEMORY_POOL_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+/**
+ * @brief Pool of dynamic tensor buffers grouped by size class
+ *
+ * Released buffers are kept for later allocations of the same or a slightly smaller size class.
+ * Buffers in use and kept together are no more than the peak usage, so smaller buffers are freed
+ * first when a new buffer would exceed it, and the rest are freed by trim(). Buffers are aligned
+ * by Allocator::ALIGNMENT and are not initialized.
+ */
+class DynamicMemoryPool
+{
+public:
+  DynamicMemoryPool() = default;
+  ~DynamicMemoryPool();
+
+  DynamicMemoryPool(const DynamicMemoryPool &) = delete;
+  DynamicMemoryPool &operator=(const DynamicMemoryPool &) = delete;
+
+public:
+  /**
+   * @brief Get a buffer of at least @c size bytes
+   */
+  uint8_t *allocate(size_t size);
+  /**
+   * @brief Give back a buffer got by allocate()
+   */
+  void release(uint8_t *base);
+  /**
+   * @brief Free all the buffers kept for reuse
+   */
+  void trim();
+
+  size_t hits() const;
+  size_t misses() const;
+  // Bytes of buffers kept for reuse
+  size_t cachedBytes() const;
+  // Peak of bytes of buffers in use
+  size_t peakBytes() const;
+
+  /**
+   * @brief Return the size of buffers allocated for @c size bytes
+   * @note  Classes are 4 steps per power of two, so at most 25% of a buffer is wasted
+   */
+  static size_t sizeClass(size_t size);
+
+private:
+  // Take cached buffers to free, smaller ones first, so that those in use and cached are no
+  // more than _peak_bytes
+  void evict(std::vector<uint8_t *> &bases);
+
+private:
+  mutable std::mutex _mutex;
+  // Ordered to find the smallest cached class which is not smaller than the requested one
+  std::map<size_t, std::vector<uint8_t *>> _free_lists;
+  std::unordered_map<uint8_t *, size_t> _used_classes; // size class of buffers given out
+  size_t _hits = 0;
+  size_t _misses = 0;
+  size_t _cached_bytes = 0; // bytes of buffers in _free_lists
+  size_t _used_bytes = 0;   // bytes of buffers given out
+  size_t _peak_bytes = 0;   // peak of _used_bytes
+};
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_BASIC_DYNAMIC_MEMORY_POOL_H__
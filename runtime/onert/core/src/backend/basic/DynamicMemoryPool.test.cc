@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "DynamicMemoryPool.h"
+#include "backend/basic/Allocator.h"
+#include "backend/basic/MemoryManager.h"
+
+using onert::backend::basic::Allocator;
+using onert::backend::basic::DynamicMemoryManager;
+using onert::backend::basic::DynamicMemoryPool;
+
+TEST(DynamicMemoryPool, size_class)
+{
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(0), 64);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(64), 64);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(65), 80);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(128), 128);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(1000), 1024);
+  ASSERT_EQ(DynamicMemoryPool::sizeClass(1025), 1280);
+
+  for (size_t size = 1; size < 100000; size += 37)
+  {
+    auto class_size = DynamicMemoryPool::sizeClass(size);
+    ASSERT_GE(class_size, size);
+    ASSERT_LE(class_size, std::max<size_t>(64, size + size / 4));
+  }
+}
+
+TEST(DynamicMemoryPool, reuse)
+{
+  DynamicMemoryPool pool;
+
+  auto base0 = pool.allocate(1000);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(base0) % Allocator::ALIGNMENT, 0);
+  pool.release(base0);
+  ASSERT_EQ(pool.cachedBytes(), 1024);
+
+  // Same size class
+  auto base1 = pool.allocate(1010);
+  ASSERT_EQ(base1, base0);
+  ASSERT_EQ(pool.hits(), 1);
+  ASSERT_EQ(pool.misses(), 1);
+
+  // Different size class
+  auto base2 = pool.allocate(2000);
+  ASSERT_NE(base2, base0);
+  ASSERT_EQ(pool.misses(), 2);
+  ASSERT_EQ(pool.peakBytes(), 1024 + 2048);
+
+  pool.release(base1);
+  pool.release(base2);
+  pool.trim();
+  ASSERT_EQ(pool.cachedBytes(), 0);
+}
+
+TEST(DynamicMemoryPool, reuse_larger_class)
+{
+  DynamicMemoryPool pool;
+
+  auto base0 = pool.allocate(2048);
+  pool.release(base0);
+
+  // 1280 bytes class is served by the cached 2048 bytes class
+  auto base1 = pool.allocate(1100);
+  ASSERT_EQ(base1, base0);
+  ASSERT_EQ(pool.hits(), 1);
+  ASSERT_EQ(pool.cachedBytes(), 0);
+
+  // The buffer goes back to its own class
+  pool.release(base1);
+  ASSERT_EQ(pool.cachedBytes(), 2048);
+
+  // Too large to waste for 64 bytes
+  auto base2 = pool.allocate(64);
+  ASSERT_NE(base2, base0);
+  ASSERT_EQ(pool.misses(), 2);
+  pool.release(base2);
+}
+
+TEST(DynamicMemoryPool, cap_at_peak)
+{
+  DynamicMemoryPool pool;
+
+  // Peak usage is 2048 + 256 * 2 bytes
+  auto base0 = pool.allocate(2048);
+  auto base1 = pool.allocate(256);
+  auto base2 = pool.allocate(256);
+  pool.release(base0);
+  pool.release(base1);
+  pool.release(base2);
+  ASSERT_EQ(pool.peakBytes(), 2560);
+  ASSERT_EQ(pool.cachedBytes(), 2560);
+
+  // Shapes change, so that cached buffers are not reusable for 320 bytes class
+  auto base3 = pool.allocate(300);
+  ASSERT_EQ(pool.misses(), 4);
+  // Smaller buffers are freed first to keep 2560 bytes at most
+  ASSERT_EQ(pool.cachedBytes(), 2048);
+  pool.release(base3);
+  ASSERT_EQ(pool.cachedBytes(), 2048 + 320);
+  ASSERT_EQ(pool.peakBytes(), 2560);
+
+  // Larger usage raises the peak
+  auto base4 = pool.allocate(4096);
+  ASSERT_EQ(pool.peakBytes(), 4096);
+  ASSERT_EQ(pool.cachedBytes(), 0);
+  pool.release(base4);
+  ASSERT_EQ(pool.cachedBytes(), 4096);
+}
+
+TEST(DynamicMemoryManager, reuse_after_deallocate)
+{
+  DynamicMemoryManager mgr;
+  // Only used as keys
+  auto tensor0 = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+  auto tensor1 = reinterpret_cast<const onert::backend::ITensor *>(0x20);
+
+  auto alloc0 = mgr.allocate(tensor0, 4096);
+  auto base0 = alloc0->base();
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(base0) % Allocator::ALIGNMENT, 0);
+  mgr.deallocate(tensor0);
+  ASSERT_EQ(alloc0->base(), nullptr);
+
+  auto alloc1 = mgr.allocate(tensor1, 4000);
+  ASSERT_EQ(alloc1->base(), base0);
+
+  // Allocator may outlive the manager
+  auto mgr2 = std::make_unique<DynamicMemoryManager>();
+  auto alloc2 = mgr2->allocate(tensor0, 100);
+  mgr2.reset();
+  alloc2->release();
+}
+
+TEST(DynamicMemoryManager, trim)
+{
+  DynamicMemoryManager mgr;
+  auto tensor = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+
+  mgr.allocate(tensor, 1000);
+  mgr.deallocate(tensor);
+  mgr.allocate(tensor, 1000);
+  mgr.deallocate(tensor);
+  ASSERT_EQ(mgr.hits(), 1);
+  ASSERT_EQ(mgr.misses(), 1);
+  ASSERT_EQ(mgr.peakBytes(), 1024);
+  ASSERT_EQ(mgr.cachedBytes(), 1024);
+
+  mgr.trim();
+  ASSERT_EQ(mgr.cachedBytes(), 0);
+
+  mgr.allocate(tensor, 1000);
+  ASSERT_EQ(mgr.misses(), 2);
+}
+
+TEST(DynamicMemoryManager, neg_allocate_twice)
+{
+  DynamicMemoryManager mgr;
+  auto tensor = reinterpret_cast<const onert::backend::ITensor *>(0x10);
+  mgr.allocate(tensor, 16);
+  EXPECT_THROW(mgr.allocate(tensor, 16), std::runtime_error);
+}
@@ -18,8 +18,10 @@
 
 #include <cassert>
 
+#include "DynamicMemoryPool.h"
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
+#include "util/PageAllocator.h"
 #include "util/logging.h"
 
 namespace onert
@@ -60,7 +62,18 @@ void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->rel
 
 void MemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
+  const auto policy = util::PagePolicy::fromConfig();
+  if (policy.enabled())
+  {
+    auto pages = util::allocatePages(_mem_planner->capacity(), policy);
+    auto base = pages.get();
+    _mem_alloc = std::make_shared<basic::Allocator>(
+      base, [pages](uint8_t *) mutable { pages.reset(); });
+  }
+  else
+  {
+    _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
+  }
   assert(_mem_alloc->base());
 }
 
@@ -71,6 +84,18 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+DynamicMemoryManager::DynamicMemoryManager() : _mem_pool{std::make_shared<DynamicMemoryPool>()}
+{
+  // DO NOTHING
+}
+
+DynamicMemoryManager::~DynamicMemoryManager()
+{
+  VERBOSE(DynamicMemoryManager) << "pool hits: " << _mem_pool->hits()
+                                << ", misses: " << _mem_pool->misses()
+                                << ", peak bytes: " << _mem_pool->peakBytes() << std::endl;
+}
+
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                  uint32_t capacity)
 {
@@ -78,8 +103,12 @@ std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
-  return _mem_alloc_map[tensor];
+  auto mem_pool = _mem_pool;
+  auto base = mem_pool->allocate(capacity);
+  auto alloc = std::make_shared<basic::Allocator>(
+    base, [mem_pool](uint8_t *base) { mem_pool->release(base); });
+  _mem_alloc_map[tensor] = alloc;
+  return alloc;
 }
 
 void DynamicMemoryManager::deallocate(const ITensor *tensor)
@@ -103,6 +132,22 @@ void DynamicMemoryManager::deallocate(void)
   _mem_alloc_map.clear();
 }
 
+void DynamicMemoryManager::trim(void)
+{
+  VERBOSE(DynamicMemoryManager) << "trim " << _mem_pool->cachedBytes() << " bytes (pool hits: "
+                                << _mem_pool->hits() << ", misses: " << _mem_pool->misses() << ")"
+                                << std::endl;
+  _mem_pool->trim();
+}
+
+size_t DynamicMemoryManager::hits(void) const { return _mem_pool->hits(); }
+
+size_t DynamicMemoryManager::misses(void) const { return _mem_pool->misses(); }
+
+size_t DynamicMemoryManager::cachedBytes(void) const { return _mem_pool->cachedBytes(); }
+
+size_t DynamicMemoryManager::peakBytes(void) const { return _mem_pool->peakBytes(); }
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
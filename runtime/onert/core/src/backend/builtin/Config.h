@@ -42,6 +42,7 @@ public:
     return true;
   }
   bool supportFP16() override { return false; }
+  bool supportParallelCompile() override { return true; }
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
 };
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackendPartitioner.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+
+using namespace onert;
+
+// Large enough to lose against any feasible assignment, small enough not to overflow when summed
+constexpr int64_t kInfeasible = std::numeric_limits<int64_t>::max() / 16;
+// Chains are revisited at most this many times, though few graphs need more than two
+constexpr int kMaxSweeps = 8;
+
+int64_t addCost(int64_t lhs, int64_t rhs) { return std::min(lhs + rhs, kInfeasible); }
+
+// Operation which produces the only non-constant input, or undefined index if there are more
+ir::OperationIndex singleProducer(const ir::Graph &graph, const ir::Operation &op)
+{
+  ir::OperationIndex producer;
+  for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+  {
+    const auto &operand = graph.operands().at(input);
+    if (operand.isConstant())
+      continue;
+    const auto def = operand.getDef();
+    if (!def.valid() || (producer.valid() && producer != def))
+      return ir::OperationIndex{};
+    producer = def;
+  }
+  return producer;
+}
+
+// Whether all outputs of an operation are used by the given operation only
+bool usedOnlyBy(const ir::Graph &graph, const ir::Operation &op, const ir::OperationIndex &user)
+{
+  for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED)
+  {
+    if (graph.getOutputs().contains(output))
+      return false;
+    for (const auto &use : graph.operands().at(output).getUses())
+    {
+      if (use != user)
+        return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+BackendPartitioner::BackendPartitioner(const ir::Graph &graph,
+                                       const std::vector<const backend::Backend *> &backends,
+                                       const CostModel &cost_model)
+  : _graph{graph}, _backends{backends}, _cost_model{cost_model}
+{
+}
+
+uint32_t BackendPartitioner::partition(const ir::OperationIndexSet &movable,
+                                       BackendResolver &backend_resolver)
+{
+  // An operation may always stay where it is
+  for (const auto &index : movable)
+  {
+    const auto backend = backend_resolver.getBackend(index);
+    if (std::find(_backends.begin(), _backends.end(), backend) == _backends.end())
+      _backends.emplace_back(backend);
+  }
+
+  _operation_costs.clear();
+  for (const auto &index : movable)
+  {
+    const auto &op = _graph.operations().at(index);
+    const auto current = backend_resolver.getBackend(index);
+    auto &costs = _operation_costs[index];
+    for (const auto backend : _backends)
+    {
+      const bool feasible =
+        backend == current || backend->config()->supportOperation(_graph.operands(), op);
+      costs.emplace_back(feasible ? _cost_model.operationTime(backend, _graph, op) : kInfeasible);
+    }
+  }
+
+  ir::OperationIndexMap<const backend::Backend *> initial;
+  for (const auto &index : movable)
+    initial[index] = backend_resolver.getBackend(index);
+  const auto permutes_before = countPermutes(_graph, backend_resolver);
+
+  const auto chains = makeChains(movable);
+  for (int sweep = 0; sweep < kMaxSweeps; ++sweep)
+  {
+    bool changed = false;
+    for (const auto &chain : chains)
+      changed |= optimizeChain(chain, backend_resolver);
+    if (!changed)
+      break;
+  }
+
+  uint32_t moved = 0;
+  for (const auto &index : movable)
+  {
+    if (backend_resolver.getBackend(index) != initial.at(index))
+      moved++;
+  }
+  VERBOSE(BackendPartitioner) << "Moved " << moved << " of " << movable.size() << " operations in "
+                              << chains.size() << " chains, permuted operands " << permutes_before
+                              << " -> " << countPermutes(_graph, backend_resolver) << std::endl;
+  return moved;
+}
+
+uint32_t BackendPartitioner::countPermutes(const ir::Graph &graph,
+                                           const BackendResolver &backend_resolver)
+{
+  uint32_t count = 0;
+  graph.operands().iterate([&](const ir::OperandIndex &, const ir::Operand &operand) {
+    if (operand.isConstant() || !operand.getDef().valid())
+      return;
+    const auto def_backend = backend_resolver.getBackend(operand.getDef());
+    std::vector<const backend::Backend *> use_backends;
+    for (const auto &use : operand.getUses())
+    {
+      const auto use_backend = backend_resolver.getBackend(use);
+      if (use_backend != def_backend &&
+          std::find(use_backends.begin(), use_backends.end(), use_backend) == use_backends.end())
+        use_backends.emplace_back(use_backend);
+    }
+    count += use_backends.size();
+  });
+  return count;
+}
+
+std::vector<BackendPartitioner::Chain>
+BackendPartitioner::makeChains(const ir::OperationIndexSet &movable) const
+{
+  std::vector<Chain> chains;
+  // Chain which ends with the operation
+  ir::OperationIndexMap<size_t> chain_of_tail;
+  for (const auto &index : _graph.topolSortOperations())
+  {
+    if (!movable.contains(index))
+      continue;
+
+    const auto &op = _graph.operations().at(index);
+    const auto producer = singleProducer(_graph, op);
+    auto it = chain_of_tail.find(producer);
+    if (producer.valid() && it != chain_of_tail.end() &&
+        usedOnlyBy(_graph, _graph.operations().at(producer), index))
+    {
+      const auto chain = it->second;
+      chains[chain].emplace_back(index);
+      chain_of_tail.erase(it);
+      chain_of_tail.emplace(index, chain);
+    }
+    else
+    {
+      chains.emplace_back(Chain{index});
+      chain_of_tail.emplace(index, chains.size() - 1);
+    }
+  }
+  return chains;
+}
+
+bool BackendPartitioner::optimizeChain(const Chain &chain, BackendResolver &backend_resolver) const
+{
+  const auto num_backends = _backends.size();
+
+  // Cost of each operation on each backend, including edges to operations out of the chain
+  auto localCost = [&](size_t pos, size_t b) {
+    const auto &index = chain[pos];
+    const auto backend = _backends[b];
+    const auto &op = _graph.operations().at(index);
+    int64_t cost = operationCost(index, b);
+    if (cost >= kInfeasible)
+      return kInfeasible;
+
+    for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      const auto &operand = _graph.operands().at(input);
+      const auto def = operand.getDef();
+      if (operand.isConstant() || !def.valid() || (pos > 0 && def == chain[pos - 1]))
+        continue;
+      cost = addCost(cost, edgeCost(input, def, backend_resolver.getBackend(def), index, backend));
+    }
+    for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      for (const auto &use : _graph.operands().at(output).getUses())
+      {
+        if (pos + 1 < chain.size() && use == chain[pos + 1])
+          continue;
+        cost =
+          addCost(cost, edgeCost(output, index, backend, use, backend_resolver.getBackend(use)));
+      }
+    }
+    return cost;
+  };
+
+  // Cost of edges from an operation to the next one in the chain
+  auto transitionCost = [&](size_t pos, size_t from, size_t to) {
+    const auto &def = chain[pos];
+    const auto &use = chain[pos + 1];
+    int64_t cost = 0;
+    for (const auto &output : _graph.operations().at(def).getOutputs() | ir::Remove::UNDEFINED)
+    {
+      if (_graph.operands().at(output).getUses().contains(use))
+        cost = addCost(cost, edgeCost(output, def, _backends[from], use, _backends[to]));
+    }
+    return cost;
+  };
+
+  // Viterbi: best[pos][b] is the least cost of the chain up to pos when pos runs on b
+  std::vector<std::vector<int64_t>> best(chain.size(), std::vector<int64_t>(num_backends));
+  std::vector<std::vector<size_t>> prev(chain.size(), std::vector<size_t>(num_backends, 0));
+  for (size_t b = 0; b < num_backends; ++b)
+    best[0][b] = localCost(0, b);
+  for (size_t pos = 1; pos < chain.size(); ++pos)
+  {
+    for (size_t b = 0; b < num_backends; ++b)
+    {
+      const auto local = localCost(pos, b);
+      best[pos][b] = kInfeasible;
+      if (local >= kInfeasible)
+        continue;
+      for (size_t a = 0; a < num_backends; ++a)
+      {
+        const auto cost = addCost(addCost(best[pos - 1][a], transitionCost(pos - 1, a, b)), local);
+        if (cost < best[pos][b])
+        {
+          best[pos][b] = cost;
+          prev[pos][b] = a;
+        }
+      }
+    }
+  }
+
+  // Keep the current assignment unless another one is strictly better
+  std::vector<size_t> current(chain.size());
+  int64_t current_cost = 0;
+  for (size_t pos = 0; pos < chain.size(); ++pos)
+  {
+    const auto backend = backend_resolver.getBackend(chain[pos]);
+    current[pos] = std::find(_backends.begin(), _backends.end(), backend) - _backends.begin();
+    current_cost = addCost(current_cost, localCost(pos, current[pos]));
+    if (pos > 0)
+      current_cost = addCost(current_cost, transitionCost(pos - 1, current[pos - 1], current[pos]));
+  }
+
+  const auto last = chain.size() - 1;
+  size_t b = std::min_element(best[last].begin(), best[last].end()) - best[last].begin();
+  if (best[last][b] >= current_cost)
+    return false;
+
+  for (size_t pos = chain.size(); pos-- > 0;)
+  {
+    backend_resolver.setBackend(chain[pos], _backends[b]);
+    b = prev[pos][b];
+  }
+  return true;
+}
+
+int64_t BackendPartitioner::operationCost(const ir::OperationIndex &index, size_t backend) const
+{
+  return _operation_costs.at(index).at(backend);
+}
+
+int64_t BackendPartitioner::edgeCost(const ir::OperandIndex &operand, const ir::OperationIndex &def,
+                                     const backend::Backend *def_backend,
+                                     const ir::OperationIndex &use,
+                                     const backend::Backend *use_backend) const
+{
+  if (def_backend == use_backend)
+    return 0;
+
+  const auto frontend_layout = _graph.layout();
+  const bool change_layout =
+    def_backend->config()->supportLayout(_graph.operations().at(def), frontend_layout) !=
+    use_backend->config()->supportLayout(_graph.operations().at(use), frontend_layout);
+  // Size of input and output of the permutation
+  const auto size = _graph.operands().at(operand).info().total_size() * 2;
+  return _cost_model.permuteTime(def_backend, use_backend, size, change_layout);
+}
+
+} // namespace compiler
+} // namespace onert
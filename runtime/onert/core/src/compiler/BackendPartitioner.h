@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  BackendPartitioner.h
+ * @brief This file contains BackendPartitioner class to reduce permutations between backends
+ */
+
+#ifndef __ONERT_COMPILER_BACKEND_PARTITIONER_H__
+#define __ONERT_COMPILER_BACKEND_PARTITIONER_H__
+
+#include "CostModel.h"
+#include "compiler/BackendResolver.h"
+#include "ir/Graph.h"
+#include "ir/OperationIndexSet.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to reassign backends so that adjacent operations share a backend
+ *
+ * Assigning backends one operation at a time makes a Permute wherever neighbours land on
+ * different backends. This class minimizes the estimated time of all operations plus all
+ * permutations, where a permutation is the cost of an edge between operations on different
+ * backends.
+ *
+ * The graph is split into chains, where each operation has a single producer and a single user
+ * within the chain. The best backends of a chain, given the backends around it, are found by
+ * dynamic programming over the chain. Chains are revisited until no assignment changes. Every
+ * step lowers the total cost, so this always ends.
+ */
+class BackendPartitioner
+{
+public:
+  /**
+   * @brief     Construct a new BackendPartitioner object
+   * @param[in] graph       Graph to partition
+   * @param[in] backends    Backends which operations may move to
+   * @param[in] cost_model  Model to estimate operations and permutations with
+   */
+  BackendPartitioner(const ir::Graph &graph, const std::vector<const backend::Backend *> &backends,
+                     const CostModel &cost_model);
+
+public:
+  /**
+   * @brief         Reassign backends of movable operations
+   * @param[in]     movable           Operations which may run on any backend supporting them
+   * @param[in,out] backend_resolver  Backends of all operations of the graph
+   * @return        Number of operations which moved
+   */
+  uint32_t partition(const ir::OperationIndexSet &movable, BackendResolver &backend_resolver);
+
+  /**
+   * @brief  Count operands which are permuted to other backends under the given assignment
+   * @note   An operand used on two other backends counts twice
+   */
+  static uint32_t countPermutes(const ir::Graph &graph, const BackendResolver &backend_resolver);
+
+private:
+  using Chain = std::vector<ir::OperationIndex>;
+
+  std::vector<Chain> makeChains(const ir::OperationIndexSet &movable) const;
+  bool optimizeChain(const Chain &chain, BackendResolver &backend_resolver) const;
+  int64_t operationCost(const ir::OperationIndex &index, size_t backend) const;
+  int64_t edgeCost(const ir::OperandIndex &operand, const ir::OperationIndex &def,
+                   const backend::Backend *def_backend, const ir::OperationIndex &use,
+                   const backend::Backend *use_backend) const;
+
+private:
+  const ir::Graph &_graph;
+  std::vector<const backend::Backend *> _backends;
+  CostModel _cost_model;
+  // Estimated time of each movable operation on each backend, or kInfeasible
+  ir::OperationIndexMap<std::vector<int64_t>> _operation_costs;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_BACKEND_PARTITIONER_H__
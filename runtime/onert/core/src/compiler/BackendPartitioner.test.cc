@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackendPartitioner.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert;
+
+struct MockConfig : public backend::IConfig
+{
+  MockConfig(const std::string &id, bool support) : _id{id}, _support{support} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override { return ir::Layout::NHWC; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+  bool supportOperation(const ir::Operands &, const ir::Operation &) override { return _support; }
+
+  std::string _id;
+  bool _support;
+};
+
+struct MockBackend : public backend::Backend
+{
+  MockBackend(const std::string &id, bool support) : _id{id}, _support{support} {}
+  std::shared_ptr<backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id, _support);
+  }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+  std::string _id;
+  bool _support;
+};
+
+// Create straight graph: Add->Sub->Mul
+std::unique_ptr<ir::Graph> createStraightGraph()
+{
+  auto graph = std::make_unique<ir::Graph>();
+  const ir::TypeInfo float_type{ir::DataType::FLOAT32};
+  using BinaryArithmetic = ir::operation::BinaryArithmetic;
+
+  auto in = graph->addOperand(ir::Shape{4}, float_type);
+  auto rhs = graph->addOperand(ir::Shape{4}, float_type);
+  auto add_out = graph->addOperand(ir::Shape{4}, float_type);
+  auto sub_out = graph->addOperand(ir::Shape{4}, float_type);
+  auto mul_out = graph->addOperand(ir::Shape{4}, float_type);
+  auto create = [&](BinaryArithmetic::ArithmeticType type, ir::OperandIndex lhs,
+                    ir::OperandIndex out) {
+    graph->addOperation(std::make_unique<BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{out},
+      BinaryArithmetic::Param{type, ir::Activation::NONE}));
+  };
+  create(BinaryArithmetic::ArithmeticType::ADD, in, add_out);
+  create(BinaryArithmetic::ArithmeticType::SUB, add_out, sub_out);
+  create(BinaryArithmetic::ArithmeticType::MUL, sub_out, mul_out);
+  graph->addInput(in);
+  graph->addInput(rhs);
+  graph->addOutput(mul_out);
+  graph->verify();
+  return graph;
+}
+
+} // namespace
+
+TEST(BackendPartitioner, merge_neighbours)
+{
+  auto graph = createStraightGraph();
+  const ir::OperationIndex add{0}, sub{1}, mul{2};
+  const MockBackend cpu{"cpu", true};
+  const MockBackend npu{"npu", true};
+  const compiler::CostModel model{{1000, 10000}};
+
+  // Only Sub is pinned on npu
+  compiler::BackendResolver resolver;
+  resolver.setBackend(add, &cpu);
+  resolver.setBackend(sub, &npu);
+  resolver.setBackend(mul, &cpu);
+  ASSERT_EQ(compiler::BackendPartitioner::countPermutes(*graph, resolver), 2);
+
+  // Two permutations cost more than the overhead of running neighbours on npu
+  compiler::BackendPartitioner partitioner{*graph, {&cpu, &npu}, model};
+  ASSERT_EQ(partitioner.partition({add, mul}, resolver), 2);
+  ASSERT_EQ(resolver.getBackend(add), &npu);
+  ASSERT_EQ(resolver.getBackend(mul), &npu);
+  ASSERT_EQ(compiler::BackendPartitioner::countPermutes(*graph, resolver), 0);
+}
+
+TEST(BackendPartitioner, neg_unsupported)
+{
+  auto graph = createStraightGraph();
+  const ir::OperationIndex add{0}, sub{1}, mul{2};
+  const MockBackend cpu{"cpu", true};
+  const MockBackend npu{"npu", false};
+  const compiler::CostModel model{{1000, 10000}};
+
+  compiler::BackendResolver resolver;
+  resolver.setBackend(add, &cpu);
+  resolver.setBackend(sub, &npu);
+  resolver.setBackend(mul, &cpu);
+
+  // npu does not tell it supports Add and Mul
+  compiler::BackendPartitioner partitioner{*graph, {&cpu, &npu}, model};
+  ASSERT_EQ(partitioner.partition({add, mul}, resolver), 0);
+  ASSERT_EQ(resolver.getBackend(add), &cpu);
+  ASSERT_EQ(resolver.getBackend(mul), &cpu);
+}
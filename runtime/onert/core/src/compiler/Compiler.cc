@@ -39,6 +39,12 @@
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
+#include "CriticalPathRanker.h"
+#include "ParallelRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 namespace
 {
@@ -62,6 +68,13 @@ std::string getOpBackends(std::unordered_map<ir::OpCode, std::string> &opcode_to
   return opbackends;
 }
 
+using Clock = std::chrono::steady_clock;
+
+double elapsedMilliseconds(const Clock::time_point &begin)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+}
+
 } // namespace
 
 namespace onert
@@ -78,9 +91,29 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.executor = util::getConfigString(util::config::EXECUTOR);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
+  options.partition_backends = util::getConfigBool(util::config::PARTITION_BACKENDS);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  {
+    // Negative value means the number of hardware threads
+    // NOTE Default is 1 as every compilation would spawn threads otherwise, while the automatic
+    //      default of PARALLEL_THREADS takes effect only with the opt-in Parallel executor
+    auto compile_threads = util::getConfigInt(util::config::COMPILE_THREADS);
+    options.compile_threads = compile_threads < 0
+                                ? std::max(std::thread::hardware_concurrency(), 1u)
+                                : static_cast<uint32_t>(std::max(compile_threads, 1));
+  }
+  {
+    // Negative value means sharing hardware threads with intra-op threads of ruy, so that
+    // inter-op and intra-op parallelism together do not oversubscribe cores
+    auto parallel_threads = util::getConfigInt(util::config::PARALLEL_THREADS);
+    auto intra_op_threads =
+      static_cast<uint32_t>(std::max(util::getConfigInt(util::config::RUY_THREADS), 1));
+    options.parallel_threads =
+      parallel_threads < 0 ? std::max(std::thread::hardware_concurrency() / intra_op_threads, 1u)
+                           : static_cast<uint32_t>(std::max(parallel_threads, 1));
+  }
 
   {
     // Backend for all
@@ -179,9 +212,12 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
                       << getOpBackends(_options.manual_scheduler_options.opcode_to_backend)
                       << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
+    VERBOSE(Compiler) << "partition_backends       : " << _options.partition_backends << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
-    VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl
+    VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "compile_threads          : " << _options.compile_threads << std::endl;
+    VERBOSE(Compiler) << "parallel_threads         : " << _options.parallel_threads << std::endl
                       << std::noboolalpha;
   }
 
@@ -222,30 +258,67 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
    ***************************************************/
   auto dump_level = static_cast<dumper::dot::DotDumper::Level>(_options.graph_dump_level);
 
+  // Compile time of each phase in milliseconds, dumped at the end of compilation
+  std::vector<std::pair<std::string, double>> compile_times;
+
+  std::vector<ir::SubgraphIndex> subg_indices;
+  _subgraphs->iterate(
+    [&](const ir::SubgraphIndex &index, ir::Graph &) { subg_indices.push_back(index); });
+  std::sort(subg_indices.begin(), subg_indices.end(),
+            [](const ir::SubgraphIndex &lhs, const ir::SubgraphIndex &rhs) {
+              return lhs.value() < rhs.value();
+            });
+  const auto num_subgs = static_cast<uint32_t>(subg_indices.size());
+
+  // Load all backends before lowering as BackendManager is not thread-safe
+  for (const auto &backend_str : _options.backend_list)
+    BackendManager::get().loadBackend(backend_str);
+
+  // Subgraphs are lowered in parallel except for HEScheduler which records execution times
+  const auto lower_threads = _options.he_scheduler ? 1 : _options.compile_threads;
+
   // Lower: Assign backend
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
-  _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
-    onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
-    dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
-
-    // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<compiler::LoweredGraph>(subg, _options);
+  {
+    std::vector<std::unique_ptr<compiler::LoweredGraph>> lowered(num_subgs);
+    std::vector<double> lower_times(num_subgs);
+    auto begin = Clock::now();
+    runParallel(num_subgs, lower_threads, [&](uint32_t i) {
+      auto subg_begin = Clock::now();
+      const auto &index = subg_indices[i];
+      auto &subg = *_subgraphs->at(index);
+
+      onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
+      dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
+
+      // Lower: Assign backend
+      lowered[i] = std::make_unique<compiler::LoweredGraph>(subg, _options);
+
+      subg.setSubgraphs(nullptr);
+      lower_times[i] = elapsedMilliseconds(subg_begin);
+    });
+    compile_times.emplace_back("Lowering", elapsedMilliseconds(begin));
 
-    subg.setSubgraphs(nullptr);
-  });
+    for (uint32_t i = 0; i < num_subgs; ++i)
+    {
+      lowered_subgs[subg_indices[i]] = std::move(lowered[i]);
+      compile_times.emplace_back("  subg-" + std::to_string(subg_indices[i].value()),
+                                 lower_times[i]);
+    }
+  }
 
   _subgraphs.reset();
 
-  for (auto &pair : lowered_subgs)
+  for (const auto &index : subg_indices)
   {
-    const auto &subg_index = pair.first;
-    auto &lowered_subg = pair.second;
+    auto &lowered_subg = lowered_subgs.at(index);
     onert::dumper::dot::DotDumper dot_dumper_lowered(lowered_subg.get(), dump_level);
-    dot_dumper_lowered.dump("after_lower_subg-" + std::to_string(subg_index.value()));
+    dot_dumper_lowered.dump("after_lower_subg-" + std::to_string(index.value()));
   }
 
   // Shape inference.
   {
+    auto begin = Clock::now();
     const auto primary_subg_idx = ir::SubgraphIndex{0};
     StaticShapeInferer inferer(primary_subg_idx, lowered_subgs);
     auto &lowered_subg = lowered_subgs.at(primary_subg_idx);
@@ -257,6 +330,7 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
       lowered_subg->setHasDynamicTensor(op_ind, has_dynamic_tensor);
     }
     inferer.dump();
+    compile_times.emplace_back("Shape inference", elapsedMilliseconds(begin));
   }
 
   // Shape validation
@@ -266,31 +340,71 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   //      - Check parameter value validation which valid value is depend on input tensor shape
   //      - Output tensor shape validation check is needless because
   //        static/dynamic shape inferer will make valid output shape
-  for (auto &pair : lowered_subgs)
   {
-    auto &lowered_subg = pair.second;
-    compiler::ShapeValidator{lowered_subg->graph()}();
+    auto begin = Clock::now();
+    runParallel(num_subgs, _options.compile_threads, [&](uint32_t i) {
+      auto &lowered_subg = lowered_subgs.at(subg_indices[i]);
+      compiler::ShapeValidator{lowered_subg->graph()}();
+    });
+    compile_times.emplace_back("Shape validation", elapsedMilliseconds(begin));
   }
 
   /*************************************************************
    *  Backend independent analysis & optimization phase finished
    *************************************************************/
 
+  // Kernels of subgraphs are generated in parallel only if every backend allows it
+  const auto all_backends = BackendManager::get().getAll();
+  const bool parallel_codegen =
+    !_options.he_scheduler &&
+    std::all_of(all_backends.begin(), all_backends.end(),
+                [](const backend::Backend *backend) {
+                  return backend->config()->supportParallelCompile();
+                });
+  const auto codegen_threads = parallel_codegen ? _options.compile_threads : 1;
+
   executors = std::make_shared<exec::ExecutorMap>();
-  for (auto &pair : lowered_subgs)
   {
-    const auto &subg_index = pair.first;
-    auto &lowered_subg = pair.second;
-    auto indexed_ranks = lowered_subg->indexed_ranks();
-
-    ir::OperationDumper dumper("Executor generation of Subgraph " +
-                               std::to_string(subg_index.value()));
-    lowered_subg->graph().operations().iterate(
-      [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
-    auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_subg), _options, executors)};
-    executor->setIndexedRanks(indexed_ranks);
-    executors->insert(std::make_pair(subg_index, std::move(executor)));
+    std::vector<std::unique_ptr<exec::IExecutor>> subg_executors(num_subgs);
+    std::vector<double> codegen_times(num_subgs);
+    auto begin = Clock::now();
+    runParallel(num_subgs, codegen_threads, [&](uint32_t i) {
+      auto subg_begin = Clock::now();
+      const auto &subg_index = subg_indices[i];
+      auto &lowered_subg = lowered_subgs.at(subg_index);
+      auto indexed_ranks = lowered_subg->indexed_ranks();
+      // Without HEScheduler, rank operations by critical path for non-linear executors
+      if (!indexed_ranks && _options.executor != "Linear")
+        indexed_ranks = CriticalPathRanker{*lowered_subg}.rank();
+
+      ir::OperationDumper dumper("Executor generation of Subgraph " +
+                                 std::to_string(subg_index.value()));
+      lowered_subg->graph().operations().iterate(
+        [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
+      auto executor = std::unique_ptr<exec::IExecutor>{
+        ExecutorFactory::get().create(std::move(lowered_subg), _options, executors)};
+      executor->setIndexedRanks(indexed_ranks);
+      subg_executors[i] = std::move(executor);
+      codegen_times[i] = elapsedMilliseconds(subg_begin);
+    });
+    compile_times.emplace_back("Executor generation", elapsedMilliseconds(begin));
+
+    for (uint32_t i = 0; i < num_subgs; ++i)
+    {
+      executors->insert(std::make_pair(subg_indices[i], std::move(subg_executors[i])));
+      compile_times.emplace_back("  subg-" + std::to_string(subg_indices[i].value()),
+                                 codegen_times[i]);
+    }
+  }
+
+  {
+    VERBOSE(Compiler) << "==== Compile Time (ms) ====" << std::endl;
+    for (const auto &entry : compile_times)
+    {
+      auto phase = entry.first;
+      phase.resize(std::max<size_t>(phase.size(), 25), ' ');
+      VERBOSE(Compiler) << phase << ": " << entry.second << std::endl;
+    }
   }
 
   /********************************
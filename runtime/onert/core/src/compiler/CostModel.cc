@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CostModel.h"
+
+#include "ir/Operations.Include.h"
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+// Fraction of arithmetic which runs in parallel on intra-op threads
+constexpr double kParallelFraction = 0.9;
+// 8-bit kernels process twice as many lanes per instruction as float kernels
+constexpr double kQuant8Speedup = 2.0;
+// Permutation between layouts accesses one side with strides
+constexpr double kTransposeSlowdown = 4.0;
+// The micro-benchmark measures scalar arithmetic, which a 128-bit SIMD kernel does 4 at once
+constexpr double kVectorLanes = 4.0;
+// Duration of each micro-benchmark in microseconds
+constexpr double kBenchmarkTime = 2000.0;
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMicroseconds(const Clock::time_point &begin)
+{
+  return std::chrono::duration<double, std::micro>(Clock::now() - begin).count();
+}
+
+int64_t numElements(const ir::Graph &graph, const ir::OperandIndex &index)
+{
+  const auto &info = graph.operands().at(index).info();
+  if (info.isDynamic())
+    return 1;
+  return std::max<int64_t>(info.shape().num_elements(), 1);
+}
+
+int64_t dim(const ir::Graph &graph, const ir::OperandIndex &index, int axis)
+{
+  const auto &shape = graph.operands().at(index).shape();
+  if (axis < 0)
+    axis += shape.rank();
+  if (axis < 0 || axis >= shape.rank())
+    return 1;
+  return std::max<int64_t>(shape.dim(axis), 1);
+}
+
+// Number of multiply-accumulates of each output element
+int64_t macsPerOutput(const ir::Graph &graph, const ir::Operation &op)
+{
+  const auto &inputs = op.getInputs();
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      // Kernel is [O, H, W, I]
+      const auto kernel = inputs.at(ir::operation::Conv2D::KERNEL);
+      return numElements(graph, kernel) / dim(graph, kernel, 0);
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      // Kernel is [1, H, W, O]
+      const auto kernel = inputs.at(ir::operation::DepthwiseConv2D::KERNEL);
+      return numElements(graph, kernel) / dim(graph, kernel, 3);
+    }
+    case ir::OpCode::FullyConnected:
+      return dim(graph, inputs.at(ir::operation::FullyConnected::WEIGHT), 1);
+    case ir::OpCode::BatchMatMul:
+    {
+      const auto &param = static_cast<const ir::operation::BatchMatMul &>(op).param();
+      return dim(graph, inputs.at(ir::operation::BatchMatMul::LHS), param.adj_x ? -2 : -1);
+    }
+    default:
+      return 1;
+  }
+}
+
+bool isQuant8(const ir::Graph &graph, const ir::Operation &op)
+{
+  for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED)
+  {
+    const auto type = graph.operands().at(input).typeInfo().type();
+    if (type == ir::DataType::QUANT_UINT8_ASYMM || type == ir::DataType::QUANT_INT8_ASYMM)
+      return true;
+  }
+  return false;
+}
+
+double measureMacRate()
+{
+  constexpr int kLength = 1024;
+  constexpr int kAccumulators = 8;
+  const std::vector<float> lhs(kLength, 1.0001f);
+  const std::vector<float> rhs(kLength, 0.9999f);
+  // Independent accumulators so that additions do not wait for each other
+  float acc[kAccumulators] = {};
+
+  int64_t macs = 0;
+  double elapsed = 0;
+  const auto begin = Clock::now();
+  do
+  {
+    for (int repeat = 0; repeat < 16; ++repeat)
+    {
+      for (int i = 0; i < kLength; i += kAccumulators)
+        for (int j = 0; j < kAccumulators; ++j)
+          acc[j] += lhs[i + j] * rhs[i + j];
+    }
+    macs += 16 * kLength;
+    elapsed = elapsedMicroseconds(begin);
+  } while (elapsed < kBenchmarkTime);
+
+  // Keep the loop from being optimized out
+  volatile float sink = std::accumulate(acc, acc + kAccumulators, 0.f);
+  (void)sink;
+  return macs / elapsed * kVectorLanes;
+}
+
+double measureBandwidth()
+{
+  // Larger than last level caches of usual mobile and embedded processors
+  constexpr size_t kSize = 8 * 1024 * 1024;
+  std::vector<uint8_t> src(kSize, 1);
+  std::vector<uint8_t> dst(kSize, 0);
+
+  int64_t bytes = 0;
+  double elapsed = 0;
+  const auto begin = Clock::now();
+  do
+  {
+    // Make each copy differ from the last so that none of them is optimized out
+    src[0] = static_cast<uint8_t>(bytes);
+    std::memcpy(dst.data(), src.data(), kSize);
+    bytes += 2 * kSize;
+    elapsed = elapsedMicroseconds(begin);
+  } while (elapsed < kBenchmarkTime);
+
+  volatile uint8_t sink = dst[0];
+  (void)sink;
+  return bytes / elapsed;
+}
+
+compiler::CostModel::HostRates loadOrMeasureHostRates()
+{
+  const auto path = util::getConfigString(util::config::COST_MODEL_FILE);
+  compiler::CostModel::HostRates rates{0, 0};
+  if (!path.empty())
+  {
+    std::ifstream file{path};
+    if (file >> rates.macs_per_us >> rates.bytes_per_us && rates.macs_per_us > 0 &&
+        rates.bytes_per_us > 0)
+    {
+      VERBOSE(CostModel) << "Load host rates from " << path << std::endl;
+      return rates;
+    }
+  }
+
+  rates = compiler::CostModel::measureHostRates();
+  VERBOSE(CostModel) << "Host rates: " << rates.macs_per_us << " MACs/us, " << rates.bytes_per_us
+                     << " bytes/us" << std::endl;
+  if (!path.empty())
+  {
+    std::ofstream file{path};
+    file << rates.macs_per_us << " " << rates.bytes_per_us << std::endl;
+  }
+  return rates;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+CostModel::CostModel() : _rates{hostRates()} {}
+
+CostModel::CostModel(const HostRates &rates) : _rates{rates}
+{
+  assert(rates.macs_per_us > 0 && rates.bytes_per_us > 0);
+}
+
+const CostModel::HostRates &CostModel::hostRates()
+{
+  static const HostRates rates = loadOrMeasureHostRates();
+  return rates;
+}
+
+CostModel::HostRates CostModel::measureHostRates()
+{
+  return HostRates{measureMacRate(), measureBandwidth()};
+}
+
+CostModel::BackendTraits CostModel::traits(const std::string &backend_id)
+{
+  // Thread counts follow the defaults of each backend's ExternalContext
+  if (backend_id == "cpu")
+  {
+    const auto threads = util::getConfigInt(util::config::RUY_THREADS);
+    return {1.0, static_cast<uint32_t>(std::max(threads, 1)), 1};
+  }
+  if (backend_id == "ruy")
+  {
+    const auto threads = util::getConfigInt(util::config::RUY_THREADS);
+    return {1.0, static_cast<uint32_t>(threads > -1 ? std::max(threads, 1) : 4), 1};
+  }
+  if (backend_id == "xnnpack")
+  {
+    const auto threads = util::getConfigInt(util::config::XNNPACK_THREADS);
+    return {1.25, static_cast<uint32_t>(std::max(threads, 1)), 2};
+  }
+  if (backend_id == "acl_neon")
+    return {1.0, std::max(std::thread::hardware_concurrency(), 1u), 5};
+  if (backend_id == "acl_cl")
+    return {8.0, 1, 50};
+  if (backend_id == "builtin")
+    return {1.0, 1, 1};
+  return {1.0, 1, 10};
+}
+
+int64_t CostModel::countMacs(const ir::Graph &graph, const ir::Operation &op)
+{
+  int64_t macs = 0;
+  for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED)
+    macs += numElements(graph, output) * macsPerOutput(graph, op);
+  return macs;
+}
+
+int64_t CostModel::countBytes(const ir::Graph &graph, const ir::Operation &op)
+{
+  int64_t bytes = 0;
+  for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+  {
+    const auto &operand = graph.operands().at(ind);
+    bytes += numElements(graph, ind) * ir::sizeOfDataType(operand.typeInfo().type());
+  }
+  return bytes;
+}
+
+int64_t CostModel::operationTime(const backend::Backend *backend, const ir::Graph &graph,
+                                 const ir::Operation &op) const
+{
+  const auto t = traits(backend->config()->id());
+  const double speedup = 1.0 / ((1.0 - kParallelFraction) + kParallelFraction / t.threads);
+  double rate = _rates.macs_per_us * t.compute_scale * speedup;
+  if (isQuant8(graph, op))
+    rate *= kQuant8Speedup;
+
+  const double compute_time = countMacs(graph, op) / rate;
+  const double memory_time = countBytes(graph, op) / _rates.bytes_per_us;
+  const auto time = t.overhead + std::llround(std::max(compute_time, memory_time));
+  return std::max<int64_t>(time, 1);
+}
+
+int64_t CostModel::permuteTime(const backend::Backend *src_backend,
+                               const backend::Backend *dst_backend, uint32_t size,
+                               bool change_layout) const
+{
+  // Backends on other devices map and unmap their buffers around the copy
+  const auto overhead = std::max(traits(src_backend->config()->id()).overhead,
+                                 traits(dst_backend->config()->id()).overhead);
+  double copy_time = size / _rates.bytes_per_us;
+  if (change_layout)
+    copy_time *= kTransposeSlowdown;
+  return std::max<int64_t>(overhead + std::llround(copy_time), 1);
+}
+
+} // namespace compiler
+} // namespace onert
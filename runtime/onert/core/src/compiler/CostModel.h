@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  CostModel.h
+ * @brief This file contains CostModel class to estimate execution time without profiling
+ */
+
+#ifndef __ONERT_COMPILER_COST_MODEL_H__
+#define __ONERT_COMPILER_COST_MODEL_H__
+
+#include "backend/Backend.h"
+#include "ir/Graph.h"
+
+#include <string>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to estimate execution time of operations and permutations on backends
+ *
+ * An operation takes the longer of its arithmetic time and its memory time plus a fixed overhead
+ * of its backend. Arithmetic time is multiply-accumulates divided by the rate of the backend,
+ * which scales with the backend's threads by Amdahl's law. Memory time is the bytes of inputs and
+ * outputs divided by the memory bandwidth. A permutation moves its bytes once, or several times
+ * slower if it changes the layout.
+ *
+ * The rates of the host come from a micro-benchmark which runs once per process. It is kept in
+ * the file named by COST_MODEL_FILE config, if any, so that it runs once per device.
+ */
+class CostModel
+{
+public:
+  struct HostRates
+  {
+    // Multiply-accumulates per microsecond of a vectorized kernel on one thread
+    double macs_per_us;
+    // Bytes read and written per microsecond by one thread
+    double bytes_per_us;
+  };
+
+public:
+  /**
+   * @brief Construct a new CostModel object with the rates of the host measured or loaded
+   */
+  CostModel();
+  /**
+   * @brief Construct a new CostModel object
+   * @param[in] rates Rates of the host
+   */
+  explicit CostModel(const HostRates &rates);
+
+public:
+  /**
+   * @brief  Estimate execution time of an operation on a backend
+   * @return Estimated time in microseconds, at least 1
+   */
+  int64_t operationTime(const backend::Backend *backend, const ir::Graph &graph,
+                        const ir::Operation &op) const;
+  /**
+   * @brief  Estimate time to permute data from one backend to another
+   * @param[in] size          Sum of input and output sizes in bytes
+   * @param[in] change_layout Whether the permutation transposes data between layouts
+   * @return Estimated time in microseconds, at least 1
+   */
+  int64_t permuteTime(const backend::Backend *src_backend, const backend::Backend *dst_backend,
+                      uint32_t size, bool change_layout) const;
+
+  const HostRates &rates() const { return _rates; }
+
+public:
+  /**
+   * @brief Count multiply-accumulates of an operation, or output elements if it has no arithmetic
+   */
+  static int64_t countMacs(const ir::Graph &graph, const ir::Operation &op);
+  /**
+   * @brief Count bytes of inputs, including constants, and outputs of an operation
+   */
+  static int64_t countBytes(const ir::Graph &graph, const ir::Operation &op);
+  /**
+   * @brief Rates of this host, which are measured on first call or loaded from COST_MODEL_FILE
+   */
+  static const HostRates &hostRates();
+  /**
+   * @brief Run the micro-benchmark, which takes a few milliseconds
+   */
+  static HostRates measureHostRates();
+
+private:
+  struct BackendTraits
+  {
+    // Arithmetic rate relative to HostRates::macs_per_us
+    double compute_scale;
+    uint32_t threads;
+    // Fixed time of launching a kernel in microseconds
+    int64_t overhead;
+  };
+
+  static BackendTraits traits(const std::string &backend_id);
+
+private:
+  HostRates _rates;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COST_MODEL_H__
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CostModel.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/FullyConnected.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert;
+
+struct MockConfig : public backend::IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override
+  {
+    return ir::Layout::UNKNOWN;
+  }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+  std::string _id;
+};
+
+struct MockBackend : public backend::Backend
+{
+  MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id);
+  }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+  std::string _id;
+};
+
+} // namespace
+
+TEST(CostModel, operation_time)
+{
+  ir::Graph graph;
+  const ir::TypeInfo float_type{ir::DataType::FLOAT32};
+
+  auto input = graph.addOperand(ir::Shape{1, 1024}, float_type);
+  auto weight = graph.addOperand(ir::Shape{1024, 1024}, float_type);
+  auto fc_out = graph.addOperand(ir::Shape{1, 1024}, float_type);
+  ir::operation::FullyConnected::Param fc_param{ir::Activation::NONE,
+                                                ir::FullyConnectedWeightsFormat::Default};
+  ir::operation::FullyConnected fc{{input, weight, ir::OperandIndex{}}, {fc_out}, fc_param};
+
+  auto add_out = graph.addOperand(ir::Shape{1, 1024}, float_type);
+  ir::operation::BinaryArithmetic::Param add_param{
+    ir::operation::BinaryArithmetic::ArithmeticType::ADD, ir::Activation::NONE};
+  ir::operation::BinaryArithmetic add{{fc_out, input}, {add_out}, add_param};
+
+  // FullyConnected does 1024 multiply-accumulates for each output element
+  ASSERT_EQ(compiler::CostModel::countMacs(graph, fc), 1024 * 1024);
+  ASSERT_EQ(compiler::CostModel::countMacs(graph, add), 1024);
+  ASSERT_EQ(compiler::CostModel::countBytes(graph, add), 3 * 1024 * 4);
+
+  const compiler::CostModel model{{1000, 10000}};
+  const MockBackend cpu{"cpu"};
+  const MockBackend gpu{"acl_cl"};
+  const auto fc_time = model.operationTime(&cpu, graph, fc);
+  const auto add_time = model.operationTime(&cpu, graph, add);
+  ASSERT_GE(add_time, 1);
+  ASSERT_GT(fc_time, add_time * 100);
+  // GPU is faster at arithmetic but has a larger launch overhead
+  ASSERT_LT(model.operationTime(&gpu, graph, fc), fc_time);
+  ASSERT_GT(model.operationTime(&gpu, graph, add), add_time);
+}
+
+TEST(CostModel, permute_time)
+{
+  const compiler::CostModel model{{1000, 10000}};
+  const MockBackend cpu{"cpu"};
+  const MockBackend gpu{"acl_cl"};
+
+  const auto time = model.permuteTime(&cpu, &gpu, 1024 * 1024, false);
+  ASSERT_GE(time, 1024 * 1024 / 10000);
+  ASSERT_GT(model.permuteTime(&cpu, &gpu, 1024 * 1024, true), time);
+  ASSERT_LT(model.permuteTime(&cpu, &gpu, 1024, false), time);
+}
+
+TEST(CostModel, measure_host_rates)
+{
+  const auto rates = compiler::CostModel::measureHostRates();
+  ASSERT_GT(rates.macs_per_us, 0);
+  ASSERT_GT(rates.bytes_per_us, 0);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CriticalPathRanker.h"
+
+#include "compiler/BackendManager.h"
+#include "util/logging.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace compiler
+{
+
+CriticalPathRanker::CriticalPathRanker(const LoweredGraph &lowered_graph)
+  : _lowered_graph{lowered_graph},
+    _exec_time{std::make_unique<exec::ExecTime>(BackendManager::get().getAll())}
+{
+}
+
+int64_t CriticalPathRanker::operationTime(const ir::OperationIndex &index,
+                                          const ir::Operation &op) const
+{
+  const auto &graph = _lowered_graph.graph();
+  const auto backend = _lowered_graph.lower_info().operation.at(index).backend();
+
+  bool quant = false;
+  uint32_t size = 0;
+  for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+  {
+    const auto &operand = graph.operands().at(ind);
+    quant |= operand.typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM;
+    size += operand.info().total_size();
+  }
+
+  const auto time = _exec_time->getOperationExecTime(backend, op.name(), quant, size);
+  if (time != exec::ExecTime::NOT_FOUND && time < exec::ExecTime::getMax())
+    return std::max<int64_t>(time, 1);
+  return _cost_model.operationTime(backend, graph, op);
+}
+
+std::shared_ptr<ir::OperationIndexMap<int64_t>> CriticalPathRanker::rank()
+{
+  return rank(_lowered_graph.graph(),
+              [&](const ir::OperationIndex &index, const ir::Operation &op) {
+                return operationTime(index, op);
+              });
+}
+
+std::shared_ptr<ir::OperationIndexMap<int64_t>> CriticalPathRanker::rank(
+  const ir::Graph &graph,
+  const std::function<int64_t(const ir::OperationIndex &, const ir::Operation &)> &op_time)
+{
+  auto ranks = std::make_shared<ir::OperationIndexMap<int64_t>>();
+
+  // Users come after their producers in topological order, so visit it backwards
+  const auto order = graph.topolSortOperations();
+  for (auto it = order.rbegin(); it != order.rend(); ++it)
+  {
+    const auto &index = *it;
+    const auto &op = graph.operations().at(index);
+
+    int64_t max_user_rank = 0;
+    for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      for (const auto &user : graph.operands().at(output).getUses())
+        max_user_rank = std::max(max_user_rank, ranks->at(user));
+    }
+
+    const auto rank = op_time(index, op) + max_user_rank;
+    ranks->emplace(index, rank);
+    VERBOSE(CriticalPathRanker) << "rank of operation (" << index << ")" << op.name() << " is "
+                                << rank << std::endl;
+  }
+  return ranks;
+}
+
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  CriticalPathRanker.h
+ * @brief This file contains CriticalPathRanker class to prioritize operations on the critical path
+ */
+
+#ifndef __ONERT_COMPILER_CRITICAL_PATH_RANKER_H__
+#define __ONERT_COMPILER_CRITICAL_PATH_RANKER_H__
+
+#include "CostModel.h"
+#include "compiler/LoweredGraph.h"
+#include "exec/ExecTime.h"
+
+#include <functional>
+#include <memory>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to rank operations by the length of the longest path from them to the graph end
+ *
+ * The rank of an operation is its own cost plus the largest rank of the operations which use its
+ * outputs, so running ready operations in descending rank order shortens the critical path first.
+ * The cost is the execution time measured by profiling(@c exec::ExecTime) on the assigned
+ * backend, or estimated by @c CostModel if it has never been measured.
+ */
+class CriticalPathRanker
+{
+public:
+  CriticalPathRanker(const LoweredGraph &lowered_graph);
+
+public:
+  /**
+   * @brief  Rank all operations of the graph
+   * @return Rank of each operation, which is comparable with ranks from @c HEScheduler
+   */
+  std::shared_ptr<ir::OperationIndexMap<int64_t>> rank();
+
+  /**
+   * @brief  Rank all operations of @c graph, where @c op_time gives the cost of each operation
+   * @return Rank of each operation
+   */
+  static std::shared_ptr<ir::OperationIndexMap<int64_t>>
+  rank(const ir::Graph &graph,
+       const std::function<int64_t(const ir::OperationIndex &, const ir::Operation &)> &op_time);
+
+private:
+  int64_t operationTime(const ir::OperationIndex &index, const ir::Operation &op) const;
+
+private:
+  const LoweredGraph &_lowered_graph;
+  std::unique_ptr<exec::ExecTime> _exec_time;
+  CostModel _cost_model;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_CRITICAL_PATH_RANKER_H__
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CriticalPathRanker.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+
+TEST(CriticalPathRanker, rank_branched)
+{
+  // in -> A -> B -> D -> out
+  //        \-> C -/
+  // in -> E -> out2
+  ir::Graph graph;
+  const ir::TypeInfo float_type{ir::DataType::FLOAT32};
+  using BinaryArithmetic = ir::operation::BinaryArithmetic;
+
+  auto in = graph.addOperand(ir::Shape{4}, float_type);
+  auto a_out = graph.addOperand(ir::Shape{4}, float_type);
+  auto b_out = graph.addOperand(ir::Shape{4}, float_type);
+  auto c_out = graph.addOperand(ir::Shape{4}, float_type);
+  auto out = graph.addOperand(ir::Shape{4}, float_type);
+  auto out2 = graph.addOperand(ir::Shape{4}, float_type);
+  auto create = [&](ir::OperandIndex lhs, ir::OperandIndex rhs, ir::OperandIndex result) {
+    return graph.addOperation(std::make_unique<BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{result},
+      BinaryArithmetic::Param{BinaryArithmetic::ArithmeticType::ADD, ir::Activation::NONE}));
+  };
+  auto a = create(in, in, a_out);
+  auto b = create(a_out, in, b_out);
+  auto c = create(a_out, in, c_out);
+  auto d = create(b_out, c_out, out);
+  auto e = create(in, in, out2);
+  graph.addInput(in);
+  graph.addOutput(out);
+  graph.addOutput(out2);
+  graph.verify();
+
+  const ir::OperationIndexMap<int64_t> times{{a, 1}, {b, 10}, {c, 2}, {d, 3}, {e, 4}};
+  auto ranks = compiler::CriticalPathRanker::rank(
+    graph, [&](const ir::OperationIndex &index, const ir::Operation &) { return times.at(index); });
+
+  ASSERT_EQ(ranks->size(), 5);
+  ASSERT_EQ(ranks->at(d), 3);
+  ASSERT_EQ(ranks->at(b), 13);
+  ASSERT_EQ(ranks->at(c), 5);
+  // A is followed by the longer one of its branches
+  ASSERT_EQ(ranks->at(a), 14);
+  ASSERT_EQ(ranks->at(e), 4);
+}
+
+TEST(CriticalPathRanker, rank_empty)
+{
+  ir::Graph graph;
+  auto ranks = compiler::CriticalPathRanker::rank(
+    graph, [](const ir::OperationIndex &, const ir::Operation &) { return 1; });
+  ASSERT_TRUE(ranks->empty());
+}
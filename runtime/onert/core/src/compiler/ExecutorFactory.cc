@@ -15,7 +15,9 @@
  */
 
 #include "ExecutorFactory.h"
+#include "ParallelRunner.h"
 
+#include <algorithm>
 #include <deque>
 #include <functional>
 #include "ir/OperationCloner.h"
@@ -119,26 +121,82 @@ void initializeSubgraphIOTensors(compiler::LoweredGraph &lowered_graph,
   }
 }
 
+using OrderedContexts = std::deque<std::pair<const backend::Backend *, backend::BackendContext *>>;
+
+/**
+ * @brief Generate kernels of @c ordered_contexts, returned in the same order
+ *
+ * @note  Contexts before builtin one generate kernels concurrently if all of their backends
+ *        allow it. The builtin context goes last as it requires all the others' tensors.
+ */
+std::vector<backend::FunctionMap> generateKernels(const OrderedContexts &ordered_contexts,
+                                                  uint32_t num_threads)
+{
+  auto is_builtin = [](const OrderedContexts::value_type &pair) {
+    return pair.first->config()->id() == backend::builtin::Config::ID;
+  };
+  auto parallel_end = std::find_if(ordered_contexts.begin(), ordered_contexts.end(), is_builtin);
+  auto support_parallel = [](const OrderedContexts::value_type &pair) {
+    return pair.first->config()->supportParallelCompile();
+  };
+  const bool parallel = std::all_of(ordered_contexts.begin(), parallel_end, support_parallel);
+  const auto num_parallel = static_cast<uint32_t>(parallel_end - ordered_contexts.begin());
+
+  std::vector<backend::FunctionMap> codes(ordered_contexts.size());
+  compiler::runParallel(num_parallel, parallel ? num_threads : 1,
+                        [&](uint32_t i) { codes[i] = ordered_contexts[i].second->genKernels(); });
+  for (auto i = num_parallel; i < ordered_contexts.size(); ++i)
+    codes[i] = ordered_contexts[i].second->genKernels();
+
+  return codes;
+}
+
 backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, bool linear_executor)
 {
   backend::BackendContexts contexts;
   auto &backend_manager = compiler::BackendManager::get();
 
+  auto context_data_map =
+    compiler::createContextData(lgraph.graph(), lgraph.lower_info(), backend_manager.getAll());
+
+  // Create contexts
+  for (auto &pair : context_data_map)
+  {
+    auto backend = pair.first;
+    auto &data = pair.second;
+    data.is_linear_executor = linear_executor;
+    data.custom_kernel_builder = lgraph.graph().getKernelBuilder();
+    contexts.emplace(backend, backend->newContext(std::move(data)));
+  }
+  return contexts;
+}
+
+} // namespace
+} // namespace onert
+
+namespace onert
+{
+namespace compiler
+{
+
+std::unordered_map<const backend::Backend *, backend::ContextData>
+createContextData(ir::Graph &whole_graph, const GraphLowerInfo &lower_info,
+                  const std::vector<const backend::Backend *> &backends)
+{
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
 
   // Generate partial graphs for each backend
-  for (auto backend : backend_manager.getAll())
+  for (auto backend : backends)
   {
     auto &data = context_data_map[backend];
     auto graph = std::make_unique<ir::Graph>();
-    graph->setLayout(lgraph.graph().layout());
+    graph->setLayout(whole_graph.layout());
     data.graph = std::move(graph);
   }
 
-  auto &whole_graph = lgraph.graph();
   // Separate operands into partial graphs
   whole_graph.operands().iterate([&](const ir::OperandIndex &operand_ind, ir::Operand &operand) {
-    auto &operand_li = lgraph.lower_info().operand;
+    auto &operand_li = lower_info.operand;
     const auto &def_factors = operand_li.at(operand_ind).def_factors();
     if (def_factors.size() == 0) // Ignore unused tensor
       return;
@@ -160,7 +218,7 @@ backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, b
   // Separate operations into partial graphs
   whole_graph.operations().iterate(
     [&](const ir::OperationIndex &op_ind, const ir::Operation &operation) {
-      auto &op_li = lgraph.lower_info().operation;
+      auto &op_li = lower_info.operation;
       auto backend = op_li.at(op_ind).backend();
       auto &partial_graph = *context_data_map[backend].graph;
       auto &external_operands = context_data_map[backend].external_operands;
@@ -183,8 +241,7 @@ backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, b
           UNUSED_RELEASE(new_operand_ind);
           assert(new_operand_ind == operand_ind);
 
-          auto layout =
-            lgraph.lower_info().operand.at(operand_ind).def_factors().getOnlyElement().layout();
+          auto layout = lower_info.operand.at(operand_ind).def_factors().getOnlyElement().layout();
           assert(operand_layouts.find(operand_ind) == operand_layouts.end());
           operand_layouts[operand_ind] = layout;
           external_operands.add(operand_ind);
@@ -196,42 +253,38 @@ backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, b
       }
     });
 
-  // Create contexts
-  auto whole_op_order = lgraph.graph().topolSortOperations();
+  // Set inputs and outputs of partial graphs
+  auto whole_op_order = whole_graph.topolSortOperations();
   for (auto &pair : context_data_map)
   {
-    auto backend = pair.first;
     auto &data = pair.second;
-    // Handle graph input/outputs or external tensors
     data.graph->operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &operand) {
       if (whole_graph.getInputs().contains(ind) || whole_graph.getOutputs().contains(ind))
         data.external_operands.add(ind);
       // Inputs are either "graph input" or "no def op and non-constant"
       if (whole_graph.getInputs().contains(ind) ||
           (!operand.getDef().valid() && !operand.isConstant()))
-        // Outputs are either "graph output" or "no uses"
         data.graph->addInput(ind);
-      if (whole_graph.getOutputs().contains(ind) || operand.getUses().size() == 0)
+      // Outputs are either "graph output", "no uses" or "defined here and used by other
+      // backends". The latter are not external operands, as their tensors belong to this backend.
+      const auto &whole_uses = whole_graph.operands().at(ind).getUses();
+      const bool used_by_others =
+        operand.getDef().valid() &&
+        std::any_of(whole_uses.begin(), whole_uses.end(), [&](const ir::OperationIndex &use) {
+          return !data.graph->operations().exist(use);
+        });
+      if (whole_graph.getOutputs().contains(ind) || operand.getUses().size() == 0 ||
+          used_by_others)
         data.graph->addOutput(ind);
     });
     dumper::text::dumpGraph(*data.graph);
 
     std::copy_if(whole_op_order.begin(), whole_op_order.end(), std::back_inserter(data.op_order),
                  [&](const auto &ind) { return data.graph->operations().exist(ind); });
-    data.is_linear_executor = linear_executor;
-    data.custom_kernel_builder = lgraph.graph().getKernelBuilder();
-    contexts.emplace(backend, backend->newContext(std::move(data)));
   }
-  return contexts;
-}
-
-} // namespace
-} // namespace onert
 
-namespace onert
-{
-namespace compiler
-{
+  return context_data_map;
+}
 
 ExecutorFactory &ExecutorFactory::get()
 {
@@ -325,7 +378,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   ExecutionBuilder builder;
 
   // Adjust the order of backends for the upcoming iteration
-  std::deque<std::pair<const backend::Backend *, backend::BackendContext *>> ordered_contexts;
+  OrderedContexts ordered_contexts;
   for (auto &pair : backend_contexts)
   {
     // NOTE builtin backend must be processed lastly.
@@ -392,9 +445,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   }
 
   // Generate kernels
-  for (auto &pair : ordered_contexts)
+  for (auto &codes : generateKernels(ordered_contexts, options.compile_threads))
   {
-    auto codes = pair.second->genKernels();
     for (auto &pair : codes)
     {
       auto &op_ind = pair.first;
@@ -461,7 +513,7 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   ExecutionBuilder builder;
 
   // Adjust the order of backends for the upcoming iteration
-  std::deque<std::pair<const backend::Backend *, backend::BackendContext *>> ordered_contexts;
+  OrderedContexts ordered_contexts;
   for (auto &pair : backend_contexts)
   {
     // NOTE builtin backend must be processed lastly.
@@ -475,9 +527,8 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   }
 
   // Generate kernels
-  for (auto &pair : ordered_contexts)
+  for (auto &codes : generateKernels(ordered_contexts, options.compile_threads))
   {
-    auto codes = pair.second->genKernels();
     for (auto &pair : codes)
     {
       auto &op_ind = pair.first;
@@ -496,7 +547,8 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   if (parallel)
   {
     exec = new exec::ParallelExecutor{std::move(lowered_graph), std::move(backend_contexts),
-                                      tensor_regs, std::move(code_map), options.tracing_ctx};
+                                      tensor_regs, std::move(code_map), options.tracing_ctx,
+                                      options.parallel_threads};
   }
   else
   {
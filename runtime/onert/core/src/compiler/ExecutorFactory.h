@@ -18,7 +18,9 @@
 #define __ONERT_COMPILER_EXECUTOR_FACTORY_H__
 
 #include <unordered_map>
+#include <vector>
 
+#include "backend/BackendContext.h"
 #include "backend/ITensor.h"
 #include "exec/IExecutor.h"
 #include "compiler/LoweredGraph.h"
@@ -62,6 +64,16 @@ private:
     _map;
 };
 
+/**
+ * @brief Split @c whole_graph into a partial graph for each of @c backends
+ *
+ * @note  An operand used by operations of another backend is an output of the partial graph of
+ *        its defining backend, and an external operand of the partial graphs using it.
+ */
+std::unordered_map<const backend::Backend *, backend::ContextData>
+createContextData(ir::Graph &whole_graph, const GraphLowerInfo &lower_info,
+                  const std::vector<const backend::Backend *> &backends);
+
 } // namespace compiler
 } // namespace onert
 
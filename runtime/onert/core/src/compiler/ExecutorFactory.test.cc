@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExecutorFactory.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert;
+
+struct MockBackend : public backend::Backend
+{
+  std::shared_ptr<backend::IConfig> config() const override { return nullptr; }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+};
+
+} // namespace
+
+TEST(ExecutorFactory, createContextData_two_backends)
+{
+  // in -> Add(cpu) -> add_out -> Sub(npu) -> sub_out -> Mul(cpu) -> out
+  //                      \-----------------------------------^
+  ir::Graph graph;
+  const ir::TypeInfo float_type{ir::DataType::FLOAT32};
+  using BinaryArithmetic = ir::operation::BinaryArithmetic;
+
+  const float rhs_data[4] = {1, 2, 3, 4};
+  auto in = graph.addOperand(ir::Shape{4}, float_type);
+  auto rhs = graph.addOperand(ir::Shape{4}, float_type);
+  graph.operands().at(rhs).data(std::make_unique<ir::ExternalData>(
+    reinterpret_cast<const uint8_t *>(rhs_data), sizeof(rhs_data)));
+  auto add_out = graph.addOperand(ir::Shape{4}, float_type);
+  auto sub_out = graph.addOperand(ir::Shape{4}, float_type);
+  auto out = graph.addOperand(ir::Shape{4}, float_type);
+  auto create = [&](BinaryArithmetic::ArithmeticType type, ir::OperandIndex lhs_ind,
+                    ir::OperandIndex rhs_ind, ir::OperandIndex out_ind) {
+    return graph.addOperation(std::make_unique<BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs_ind, rhs_ind}, ir::OperandIndexSequence{out_ind},
+      BinaryArithmetic::Param{type, ir::Activation::NONE}));
+  };
+  auto add = create(BinaryArithmetic::ArithmeticType::ADD, in, rhs, add_out);
+  auto sub = create(BinaryArithmetic::ArithmeticType::SUB, add_out, rhs, sub_out);
+  auto mul = create(BinaryArithmetic::ArithmeticType::MUL, sub_out, add_out, out);
+  graph.addInput(in);
+  graph.addOutput(out);
+  graph.verify();
+
+  const MockBackend cpu;
+  const MockBackend npu;
+  const MockBackend unused;
+
+  compiler::GraphLowerInfo lower_info;
+  auto set_def = [&](ir::OperandIndex ind, const backend::Backend *backend) {
+    auto operand_li = std::make_unique<compiler::OperandLowerInfo>();
+    operand_li->addDefPermuteFactor(compiler::PermuteFactor{backend, ir::Layout::NHWC});
+    lower_info.operand.set(ind, std::move(operand_li));
+  };
+  set_def(in, &cpu);
+  set_def(rhs, &cpu);
+  set_def(add_out, &cpu);
+  set_def(sub_out, &npu);
+  set_def(out, &cpu);
+  auto set_op = [&](ir::OperationIndex ind, const backend::Backend *backend) {
+    lower_info.operation.set(
+      ind, std::make_unique<compiler::OperationLowerInfo>(backend, ir::Layout::NHWC));
+  };
+  set_op(add, &cpu);
+  set_op(sub, &npu);
+  set_op(mul, &cpu);
+
+  auto data_map = compiler::createContextData(graph, lower_info, {&cpu, &npu, &unused});
+  ASSERT_EQ(data_map.size(), 3);
+
+  // Add and Mul run on cpu, which uses sub_out from npu
+  {
+    const auto &data = data_map.at(&cpu);
+    const auto &partial = *data.graph;
+    ASSERT_EQ(data.op_order, (std::vector<ir::OperationIndex>{add, mul}));
+    ASSERT_EQ(partial.operands().size(), 5);
+    ASSERT_EQ(partial.getInputs().size(), 2);
+    ASSERT_EQ(partial.getInputs().at(0u), in);
+    ASSERT_EQ(partial.getInputs().at(1u), sub_out);
+    ASSERT_EQ(partial.getOutputs().size(), 2);
+    ASSERT_EQ(partial.getOutputs().at(0u), add_out);
+    ASSERT_EQ(partial.getOutputs().at(1u), out);
+
+    // add_out is defined here, so it is an output but not an external operand
+    ASSERT_TRUE(data.external_operands.contains(sub_out));
+    ASSERT_TRUE(data.external_operands.contains(in));
+    ASSERT_TRUE(data.external_operands.contains(out));
+    ASSERT_FALSE(data.external_operands.contains(add_out));
+    ASSERT_FALSE(data.external_operands.contains(rhs));
+  }
+
+  // Sub runs on npu, which uses add_out and rhs from cpu
+  {
+    const auto &data = data_map.at(&npu);
+    const auto &partial = *data.graph;
+    ASSERT_EQ(data.op_order, (std::vector<ir::OperationIndex>{sub}));
+    ASSERT_EQ(partial.operands().size(), 3);
+    ASSERT_EQ(partial.getInputs().size(), 1);
+    ASSERT_EQ(partial.getInputs().at(0u), add_out);
+    ASSERT_EQ(partial.getOutputs().size(), 1);
+    ASSERT_EQ(partial.getOutputs().at(0u), sub_out);
+
+    ASSERT_TRUE(data.external_operands.contains(add_out));
+    ASSERT_TRUE(data.external_operands.contains(rhs));
+    ASSERT_FALSE(data.external_operands.contains(sub_out));
+  }
+
+  // A backend without operations gets an empty partial graph
+  {
+    const auto &data = data_map.at(&unused);
+    ASSERT_EQ(data.graph->operations().size(), 0);
+    ASSERT_EQ(data.graph->operands().size(), 0);
+    ASSERT_TRUE(data.op_order.empty());
+  }
+}
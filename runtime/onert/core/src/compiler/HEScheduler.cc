@@ -198,6 +198,7 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
 {
   _graph = &graph;
   VERBOSE(HEScheduler::schedule) << "task scheduling started" << std::endl;
+  calibrateCostModel();
   // Make ranks and save in descending order
   makeRank();
 
@@ -237,18 +238,70 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
   return std::move(_backend_resolver);
 }
 
-int64_t HEScheduler::getOpTime(const backend::Backend *backend, const std::string &operation,
-                               bool quant, uint32_t size)
+void HEScheduler::calibrateCostModel()
 {
-  const auto time = _exec_time->getOperationExecTime(backend, operation, quant, size);
+  for (const auto *backend : _all_backends)
+  {
+    // Geometric mean of the ratios, so that a few large operations do not dominate it
+    double log_ratio_sum = 0;
+    int count = 0;
+    _graph->operations().iterate([&](const ir::OperationIndex &, const ir::Operation &node) {
+      const bool quant = isQuant(*_graph, node);
+      const auto size = getOperationsFlattenedIOSize(*_graph, node);
+      if (!_exec_time->hasOperationExecTime(backend, node.name(), quant, size))
+        return;
+      const auto measured = _exec_time->getOperationExecTime(backend, node.name(), quant, size);
+      if (measured <= 0 || measured >= _exec_time->getMax())
+        return;
+      const auto estimated = _cost_model.operationTime(backend, *_graph, node);
+      log_ratio_sum += std::log(static_cast<double>(measured) / estimated);
+      ++count;
+    });
+    _model_scale[backend] = count > 0 ? std::exp(log_ratio_sum / count) : 1.0;
+    VERBOSE(HEScheduler::calibrateCostModel)
+      << "cost model scale of " << backend->config()->id() << " is " << _model_scale[backend]
+      << " from " << count << " measured operations" << std::endl;
+  }
+}
+
+int64_t HEScheduler::estimateOpTime(const backend::Backend *backend, const ir::Operation &node)
+{
+  const auto estimated = _cost_model.operationTime(backend, *_graph, node);
+  return std::max<int64_t>(std::llround(estimated * _model_scale.at(backend)), 1);
+}
+
+int64_t HEScheduler::getOpTime(const backend::Backend *backend, const ir::Operation &node)
+{
+  const bool quant = isQuant(*_graph, node);
+  const auto size = getOperationsFlattenedIOSize(*_graph, node);
+  const auto time = _exec_time->getOperationExecTime(backend, node.name(), quant, size);
   if (time != _exec_time->NOT_FOUND)
-    return time;
+  {
+    if (time >= _exec_time->getMax() ||
+        _exec_time->hasOperationExecTime(backend, node.name(), quant, size))
+      return time;
+    // Interpolation by IO size alone misses the arithmetic which depends on shapes
+    return (time + estimateOpTime(backend, node)) / 2;
+  }
+
+  // In profiling mode, try all backends to measure them
+  if (_is_profiling_mode)
+    return 1;
 
-  return _is_supported.at(backend).at(operation) ? 1 : _exec_time->getMax();
+  if (!backend->config()->supportOperation(_graph->operands(), node))
+  {
+    VERBOSE(HEScheduler::getOpTime)
+      << "There is no profiling info for " << node.name() << " on backend "
+      << backend->config()->id() << " which does not tell it supports. So this backend won't "
+      << "be used." << std::endl;
+    return _exec_time->getMax();
+  }
+  return estimateOpTime(backend, node);
 }
 
 int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
-                                    const backend::Backend *dst_backend, bool quant, uint32_t size)
+                                    const backend::Backend *dst_backend, bool quant, uint32_t size,
+                                    bool change_layout)
 {
   // TODO Change it to getOperationExecTime()
   const auto time = _exec_time->getPermuteTime(src_backend, dst_backend, quant, size);
@@ -256,43 +309,7 @@ int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
   if (time != _exec_time->NOT_FOUND)
     return time;
 
-  // FIXME permute time is not recorded so the control reaches here always
-  // Makes the scheduler prefer keeping computations on one backend
-  return size / 400;
-}
-
-int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backend *backend)
-{
-  // if there is no profiling info don't use this backend during scheduling
-  if (!_is_profiling_mode)
-  {
-    VERBOSE(HEScheduler::tryBackend)
-      << "Trying to HE schedule while there is no profiling info for " << node.name()
-      << " on backend " << backend->config()->id() << ". So this backend won't be used. "
-      << std::endl;
-    _is_supported[backend][node.name()] = false;
-    return _exec_time->getMax();
-  }
-  auto iter = _is_supported.find(backend);
-  if (iter != _is_supported.end())
-  {
-    auto it2 = iter->second.find(node.name());
-    if (it2 != iter->second.end())
-    {
-      return _is_supported[backend][node.name()] ? 1 : _exec_time->getMax();
-    }
-  }
-  try
-  {
-    // DO NOTHING
-
-    _is_supported[backend][node.name()] = true;
-  }
-  catch (std::runtime_error &e)
-  {
-    _is_supported[backend][node.name()] = false;
-  }
-  return _is_supported[backend][node.name()] ? 1 : _exec_time->getMax();
+  return _cost_model.permuteTime(src_backend, dst_backend, size, change_layout);
 }
 
 void HEScheduler::makeRank()
@@ -318,8 +335,6 @@ int64_t HEScheduler::DFSMaxRank(const ir::OperationIndex &index)
 
   const auto &node = _graph->operations().at(index);
   int64_t rank = 0;
-  const bool quant = isQuant(*_graph, node);
-  const auto size = getOperationsFlattenedIOSize(*_graph, node);
   auto supported_backends_quantity = static_cast<int64_t>(_all_backends.size());
 
   const auto max_child_rank = DFSChildrenMaxRank(index);
@@ -327,11 +342,7 @@ int64_t HEScheduler::DFSMaxRank(const ir::OperationIndex &index)
   // get average exec time of this op
   for (const auto &backend : _all_backends)
   {
-    auto exec_time = _exec_time->getOperationExecTime(backend, node.name(), quant, size);
-    if (exec_time == _exec_time->NOT_FOUND)
-    {
-      exec_time = tryBackend(node, backend);
-    }
+    const auto exec_time = getOpTime(backend, node);
     if (exec_time < _exec_time->getMax())
     {
       rank += exec_time;
@@ -352,7 +363,7 @@ int64_t HEScheduler::DFSMaxRank(const ir::OperationIndex &index)
   int64_t std = 0;
   for (const auto backend : _all_backends)
   {
-    const auto exec_time = getOpTime(backend, node.name(), quant, size);
+    const auto exec_time = getOpTime(backend, node);
     if (exec_time < _exec_time->getMax())
     {
       std += (exec_time - rank) * (exec_time - rank);
@@ -489,7 +500,6 @@ HEScheduler::ESTAndExecTime(const backend::Backend *backend, const ir::Operation
   const int64_t CPU_DELAY = 2;
   const auto &node = _graph->operations().at(index);
   const bool quant = isQuant(*_graph, node);
-  const auto size = getOperationsFlattenedIOSize(*_graph, node);
   // if this node can be part of a op_seq, then assigning different backend will cause creating
   // another op_seq
   if (isMergeable(*_graph, node))
@@ -501,7 +511,7 @@ HEScheduler::ESTAndExecTime(const backend::Backend *backend, const ir::Operation
     return {_exec_time->getMax(), _exec_time->getMax()};
   }
   // get average exec time of the op on this backend
-  auto exec_time = getOpTime(backend, node.name(), quant, size);
+  auto exec_time = getOpTime(backend, node);
   if (backend->config()->id() == "cpu" && _is_parallel_exec)
   {
     exec_time *= CPU_DELAY;
@@ -585,9 +595,14 @@ int64_t HEScheduler::predMaxEFT(const backend::Backend *backend, const ir::Opera
       max_pred_eft = std::max(max_pred_eft, _ops_eft.at(input_node_idx));
       if (parent_backend != backend)
       {
+        const auto &parent_node = _graph->operations().at(input_node_idx);
+        const bool change_layout =
+          parent_backend->config()->supportLayout(parent_node, _graph->layout()) !=
+          backend->config()->supportLayout(node, _graph->layout());
         // Multiply operand size by 2 because size must describe input+output size
         int64_t transfer_cost =
-          getPermuteTime(parent_backend, backend, quant, input_operand.info().total_size() * 2);
+          getPermuteTime(parent_backend, backend, quant, input_operand.info().total_size() * 2,
+                         change_layout);
         transfer_st_exec_time.emplace(_ops_eft.at(input_node_idx), transfer_cost);
       }
     }
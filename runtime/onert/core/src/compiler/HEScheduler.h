@@ -27,6 +27,7 @@
 #include "compiler/BackendManager.h"
 #include "compiler/Compiler.h"
 #include "ir/Graph.h"
+#include "compiler/CostModel.h"
 #include "exec/ExecTime.h"
 #include "backend/Backend.h"
 #include <memory>
@@ -51,7 +52,7 @@ public:
    * @param[in] backend_resolver backend resolver
    */
   HEScheduler(const std::vector<const backend::Backend *> &backends, const CompilerOptions &options)
-    : _is_supported{}, _backends_avail_time{}, _ops_eft{},
+    : _backends_avail_time{}, _ops_eft{},
       _op_to_rank{std::make_shared<ir::OperationIndexMap<int64_t>>()},
       _is_profiling_mode{options.he_profiling_mode}, _is_linear_exec{options.executor == "Linear"},
       _is_parallel_exec{options.executor == "Parallel"}
@@ -136,15 +137,31 @@ private:
   int64_t backendAvailableTime(const backend::Backend *backend, const int64_t &starting_time,
                                const int64_t &time_amount);
 
-  int64_t getOpTime(const backend::Backend *backend, const std::string &operation, bool quant,
-                    uint32_t size);
+  /**
+   * @brief   Returns exec time of an operation on a backend
+   *
+   * @note  Uses the measured time if the operation was profiled with the same size. Otherwise
+   *        the time is estimated by CostModel, and blended with the time interpolated from
+   *        other sizes if there is any.
+   *
+   * @param[in] backend: backend, for which to return the time
+   * @param[in] node: operation
+   *
+   * @return exec time, or ExecTime::getMax() if the backend cannot run the operation
+   */
+  int64_t getOpTime(const backend::Backend *backend, const ir::Operation &node);
 
   int64_t getPermuteTime(const backend::Backend *src_backend, const backend::Backend *dst_backend,
-                         bool quant, uint32_t size);
+                         bool quant, uint32_t size, bool change_layout = false);
 
   void scheduleShufflingBackends();
 
-  int64_t tryBackend(const ir::Operation &node, const backend::Backend *backend);
+  /**
+   * @brief   Scale CostModel estimates of each backend to fit its measured times on this graph
+   */
+  void calibrateCostModel();
+
+  int64_t estimateOpTime(const backend::Backend *backend, const ir::Operation &node);
 
   /**
    * @brief   Schedule a node and its successor until:
@@ -159,11 +176,6 @@ private:
   void scheduleBranch(const ir::OperationIndex &index, ir::OperationIndexMap<bool> &scheduled);
 
 private:
-  // This variable stores backend/node pairs with unknown execution time, and hints scheduler
-  // whether it should assign these backends to these nodes:
-  // * It stores false for unsupported nodes
-  // * During rank calculation with enabled profiling mode it stores true for supported nodes
-  std::unordered_map<const backend::Backend *, std::unordered_map<std::string, bool>> _is_supported;
   // Finishing and starting time of each backend
   std::unordered_map<const backend::Backend *, std::map<int64_t, int64_t>> _backends_avail_time;
   ir::OperationIndexMap<int64_t> _ops_eft;
@@ -171,6 +183,9 @@ private:
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _op_to_rank;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver;
   std::unique_ptr<exec::ExecTime> _exec_time;
+  CostModel _cost_model;
+  // Ratio of measured times to CostModel estimates of each backend
+  std::unordered_map<const backend::Backend *, double> _model_scale;
   const ir::Graph *_graph{nullptr};
   std::vector<const backend::Backend *> _all_backends;
   const backend::Backend *_cpu_backend{nullptr}; // TODO Change this to _builtin_backend
@@ -103,10 +103,23 @@ LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &option
   pass::PassRunner{}.append(std::make_unique<pass::PermutationEliminationPass>(*this)).run();
 
   VERBOSE(LoweredGraph) << "Dump after all the passes" << std::endl;
+  // Model IO next to a Permute is copied on every run, otherwise kernels use user buffers directly
+  auto is_permuted = [&](const ir::OperationIndex &op_ind) {
+    return op_ind.valid() && _graph.operations().at(op_ind).opcode() == ir::OpCode::Permute;
+  };
   for (auto operand : _graph.getInputs())
-    VERBOSE(LoweredGraph) << "Graph Input : " << operand << std::endl;
+  {
+    const auto &uses = _graph.operands().at(operand).getUses();
+    const bool copied = std::any_of(uses.begin(), uses.end(), is_permuted);
+    VERBOSE(LoweredGraph) << "Graph Input : " << operand << (copied ? " (copied)" : " (zero-copy)")
+                          << std::endl;
+  }
   for (auto operand : _graph.getOutputs())
-    VERBOSE(LoweredGraph) << "Graph Output : " << operand << std::endl;
+  {
+    const bool copied = is_permuted(_graph.operands().at(operand).getDef());
+    VERBOSE(LoweredGraph) << "Graph Output : " << operand << (copied ? " (copied)" : " (zero-copy)")
+                          << std::endl;
+  }
   dumper::text::dumpLoweredGraph(*this);
 
   // Graph verifications
@@ -15,10 +15,12 @@
  */
 
 #include "ManualScheduler.h"
+#include "BackendPartitioner.h"
 #include "ir/OpCode.h"
 #include "ir/Operations.Include.h"
 #include "backend/Backend.h"
 #include "backend/IConfig.h"
+#include "backend/builtin/Config.h"
 #include "compiler/BackendManager.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
@@ -58,8 +60,11 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
   VERBOSE(ManualScheduler) << "Default backend for all ops: " << backend_all->config()->id()
                            << std::endl;
 
+  // Operations which keep this default backend may be moved by BackendPartitioner
+  ir::OperationIndexSet movable;
   graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &) {
     backend_resolver->setBackend(index, backend_all);
+    movable.insert(index);
   });
 
   // 2. Backend per operation type
@@ -76,6 +81,7 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
     if (itr != op_type_map.end())
     {
       backend_resolver->setBackend(index, itr->second);
+      movable.remove(index);
     }
   });
 
@@ -89,6 +95,8 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
     {
       graph.operations().at(key); // Check if exist, or this will throw
       backend_resolver->setBackend(key, BackendManager::get().get(val));
+      if (movable.contains(key))
+        movable.remove(key);
     }
     catch (...)
     {
@@ -97,6 +105,18 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
     }
   }
 
+  // 4. Reduce permutations by moving operations without explicit backends
+  if (_options.partition_backends && movable.size() > 0)
+  {
+    std::vector<const backend::Backend *> backends;
+    for (const auto backend : _backends)
+    {
+      if (backend->config()->id() != backend::builtin::Config::ID)
+        backends.emplace_back(backend);
+    }
+    BackendPartitioner{graph, backends, CostModel{}}.partition(movable, *backend_resolver);
+  }
+
   // Dump final assignment
   WHEN_LOG_ENABLED(backend_resolver->iterate(
     [&](const ir::OperationIndex &index, const backend::Backend &backend) {
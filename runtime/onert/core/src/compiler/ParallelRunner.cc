@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+
+void runParallel(uint32_t count, uint32_t num_threads, const std::function<void(uint32_t)> &fn)
+{
+  const auto num_workers = std::min(count, std::max(num_threads, 1u));
+  if (num_workers <= 1)
+  {
+    for (uint32_t i = 0; i < count; ++i)
+      fn(i);
+    return;
+  }
+
+  std::atomic<uint32_t> next{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto work = [&]() {
+    for (auto i = next++; i < count && !failed; i = next++)
+    {
+      try
+      {
+        fn(i);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock{error_mutex};
+        if (!error)
+          error = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < num_workers; ++i)
+    threads.emplace_back(work);
+  work();
+  for (auto &thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+} // namespace compiler
+} // namespace onert
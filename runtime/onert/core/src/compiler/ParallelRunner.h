@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PARALLEL_RUNNER_H__
+#define __ONERT_COMPILER_PARALLEL_RUNNER_H__
+
+#include <cstdint>
+#include <functional>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Run @c fn for every index in [0, @c count) using at most @c num_threads threads
+ *
+ * @note  The calling thread runs jobs too, so @c num_threads 1 runs them all in order on it.
+ *        Once a job throws, no more jobs are started and the first exception is rethrown
+ *        after the running ones finish.
+ */
+void runParallel(uint32_t count, uint32_t num_threads, const std::function<void(uint32_t)> &fn);
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PARALLEL_RUNNER_H__
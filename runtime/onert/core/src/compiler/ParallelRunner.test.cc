@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelRunner.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using onert::compiler::runParallel;
+
+TEST(ParallelRunner, runs_every_job_once)
+{
+  for (uint32_t num_threads : {0u, 1u, 3u, 16u})
+  {
+    std::vector<std::atomic<int>> hits(100);
+    runParallel(hits.size(), num_threads, [&](uint32_t i) { hits[i]++; });
+    for (auto &hit : hits)
+      ASSERT_EQ(hit, 1);
+  }
+}
+
+TEST(ParallelRunner, in_order_with_single_thread)
+{
+  std::vector<uint32_t> order;
+  runParallel(10, 1, [&](uint32_t i) { order.push_back(i); });
+  for (uint32_t i = 0; i < order.size(); ++i)
+    ASSERT_EQ(order[i], i);
+}
+
+TEST(ParallelRunner, neg_rethrow)
+{
+  auto fn = [](uint32_t i) {
+    if (i == 3)
+      throw std::runtime_error{"job failed"};
+  };
+  EXPECT_THROW(runParallel(64, 1, fn), std::runtime_error);
+  EXPECT_THROW(runParallel(64, 4, fn), std::runtime_error);
+}
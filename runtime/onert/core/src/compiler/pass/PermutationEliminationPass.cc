@@ -37,6 +37,15 @@ void PermutationEliminationPass::visit(const ir::operation::Permute &node)
   auto in_operand = node.getInputs().at(0);
   auto out_operand = node.getOutputs().at(0);
 
+  // Permutes left next to model inputs and outputs copy user buffers on every run, so tell why
+  const bool is_model_io =
+    _graph.getInputs().contains(in_operand) || _graph.getOutputs().contains(out_operand);
+  auto keep = [&](const std::string &reason) {
+    if (is_model_io)
+      VERBOSE(IOCopy) << "Permute " << _op_ind << " (" << in_operand << " -> " << out_operand
+                      << ") is kept : " << reason << std::endl;
+  };
+
   // Check if two tensors are both portable if not, we can't eliminate the node
   {
     auto &operand_li_map = _lowered_graph.lower_info().operand;
@@ -49,7 +58,21 @@ void PermutationEliminationPass::visit(const ir::operation::Permute &node)
     // FIXME Supporting dynamic tensor does not exactly mean those are portable.
     //       It may need to have another config option for checking if each uses `IPortableTensor`.
     if (!(in_config->supportDynamicTensor() && out_config->supportDynamicTensor()))
+    {
+      keep("tensors of backend " +
+           (in_config->supportDynamicTensor() ? out_config : in_config)->id() +
+           " are not portable");
       return;
+    }
+
+    // Sharing a buffer is only possible when both sides see the same memory layout
+    if (in_def_factor.layout() != out_def_factor.layout() ||
+        node.getPermuteType() != ir::operation::Permute::Type::COPY)
+    {
+      keep(std::string{"layout changes from "} + ir::to_string(in_def_factor.layout()) + " to " +
+           ir::to_string(out_def_factor.layout()));
+      return;
+    }
   }
 
   if (_graph.getOutputs().contains(out_operand))
@@ -58,15 +81,24 @@ void PermutationEliminationPass::visit(const ir::operation::Permute &node)
     // output buffer during prepare phase.
     auto permute_input = node.getInputs().at(0);
     if (_graph.operands().at(permute_input).isConstant())
+    {
+      keep("output is a constant");
       return;
+    }
     // If the input is a model input, we cannot remove it since our API lets users to set different
     // buffers for inputs and outputs even though one tensor is both at the same time.
     auto permute_output = node.getOutputs().at(0);
     if (_graph.getInputs().contains(permute_input) && _graph.getOutputs().contains(permute_output))
+    {
+      keep("output is also a model input");
       return;
+    }
     // Likewise, if copying between outputs to outputs, keep it.
     if (_graph.getOutputs().contains(permute_input) && _graph.getOutputs().contains(permute_output))
+    {
+      keep("output is also another model output");
       return;
+    }
 
     // Exceptional case : When the output operand is a model output
     // In this case we keep the output and remove the input
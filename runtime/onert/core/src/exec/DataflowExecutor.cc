@@ -54,7 +54,7 @@ void DataflowExecutor::emplaceToReadyJobs(const uint32_t &id)
 {
   auto &job = _waiting_jobs[id];
   assert(job != nullptr);
-  auto rank = calculateRank({_job_to_op[job->index()]});
+  auto rank = calculateRank({_job_to_op.at(job->index())});
   _ready_jobs.emplace(rank, std::move(job));
 }
 
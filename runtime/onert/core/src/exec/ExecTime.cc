@@ -94,6 +94,24 @@ int64_t ExecTime::getOperationExecTime(const backend::Backend *backend,
   return std::max<int64_t>(interpolated_value, 1);
 }
 
+bool ExecTime::hasOperationExecTime(const backend::Backend *backend, const std::string &operation,
+                                    bool quant, uint32_t op_size) const
+{
+  auto found_backend = _measurements.find(backend);
+  if (found_backend == _measurements.end())
+    return false;
+
+  auto found_operation_with_type = found_backend->second.find(operation);
+  if (found_operation_with_type == found_backend->second.end())
+    return false;
+
+  auto found_operation = found_operation_with_type->second.find(quant);
+  if (found_operation == found_operation_with_type->second.end())
+    return false;
+
+  return found_operation->second.find(op_size) != found_operation->second.end();
+}
+
 void ExecTime::updateOperationExecTime(const backend::Backend *backend,
                                        const std::string &operation, bool quant, uint32_t op_size,
                                        int64_t time)
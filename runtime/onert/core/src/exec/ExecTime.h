@@ -52,6 +52,17 @@ public:
    */
   int64_t getOperationExecTime(const backend::Backend *backend, const std::string &operation,
                                bool quant, uint32_t op_size) const;
+  /**
+   * @brief Check if exec time of an operation was measured with exactly the given input size
+   *
+   * @param[in] backend id of a backend
+   * @param[in] operation name of an operation
+   * @param[in] quant if input type quantized
+   * @param[in] op_size sum of operation's flattened sizes of inputs and outputs
+   * @return true if @c getOperationExecTime returns a record rather than an interpolated value
+   */
+  bool hasOperationExecTime(const backend::Backend *backend, const std::string &operation,
+                            bool quant, uint32_t op_size) const;
   /**
    * @brief Update exec time of the operation on a backend with given input size or
    *        add new entity if there is no one.
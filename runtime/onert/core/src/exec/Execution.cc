@@ -18,6 +18,51 @@
 
 #include "util/logging.h"
 
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+namespace
+{
+
+using namespace onert;
+
+// Copy a row-major buffer into a larger zero-filled one, keeping each element at its coordinates
+void padCopy(const uint8_t *src, const ir::Shape &src_shape, uint8_t *dst,
+             const ir::Shape &dst_shape, size_t element_size)
+{
+  const auto num_elements = src_shape.num_elements();
+  if (num_elements == 0)
+    return;
+
+  const int rank = src_shape.rank();
+  if (rank == 0)
+  {
+    memcpy(dst, src, element_size);
+    return;
+  }
+
+  const auto row_size = src_shape.dim(rank - 1) * element_size;
+  const auto num_rows = num_elements / src_shape.dim(rank - 1);
+  std::vector<int32_t> coords(rank - 1, 0);
+  for (uint64_t row = 0; row < num_rows; ++row)
+  {
+    uint64_t offset = 0;
+    for (int axis = 0; axis < rank - 1; ++axis)
+      offset = offset * dst_shape.dim(axis) + coords[axis];
+    memcpy(dst + offset * dst_shape.dim(rank - 1) * element_size, src + row * row_size, row_size);
+
+    for (int axis = rank - 2; axis >= 0; --axis)
+    {
+      if (++coords[axis] < src_shape.dim(axis))
+        break;
+      coords[axis] = 0;
+    }
+  }
+}
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -32,12 +77,24 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
 }
 
+Execution::~Execution()
+{
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    _stop_worker = true;
+  }
+  _queued_cv.notify_one();
+  if (_worker.joinable())
+    _worker.join();
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This will be used later to set input tensor dynamic
   // Note that 'compiled' model will not be updated with new_shape
   // but new_shape will change model input shape while 'running' the model
   _io_desc.dynamic_input_shapes[index] = new_shape;
+  _io_desc.pinned_id = 0;
 
   VERBOSE(Execution) << "Model input shape will be changed at the start of execute()"
                      << "(index: " << index << ")" << std::endl;
@@ -69,6 +126,7 @@ void Execution::setInput(const ir::IOIndex &index, const void *buffer, size_t le
   }
 
   _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(info, buffer, length, layout);
+  _io_desc.pinned_id = 0;
 }
 
 // TODO Remove default parameter
@@ -83,6 +141,7 @@ void Execution::setInput(const ir::IOIndex &index, const ir::TypeInfo &type, con
   }
 
   _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(info, buffer, length, layout);
+  _io_desc.pinned_id = 0;
 }
 
 // TODO Remove default parameter
@@ -97,6 +156,7 @@ void Execution::setOutput(const ir::IOIndex &index, void *buffer, size_t length,
   }
 
   _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(info, buffer, length, layout);
+  _io_desc.pinned_id = 0;
 }
 
 // TODO Remove default parameter
@@ -111,6 +171,7 @@ void Execution::setOutput(const ir::IOIndex &index, const ir::TypeInfo &type,
   }
 
   _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(info, buffer, length, layout);
+  _io_desc.pinned_id = 0;
 }
 
 void Execution::setInputLayout(const ir::IOIndex &index, ir::Layout layout)
@@ -118,6 +179,7 @@ void Execution::setInputLayout(const ir::IOIndex &index, ir::Layout layout)
   const auto &input_desc = _io_desc.inputs.at(index.value());
   _io_desc.inputs.at(index.value()) =
     std::make_unique<InputDesc>(input_desc->info, input_desc->buffer, input_desc->size, layout);
+  _io_desc.pinned_id = 0;
 }
 
 void Execution::setOutputLayout(const ir::IOIndex &index, ir::Layout layout)
@@ -125,31 +187,259 @@ void Execution::setOutputLayout(const ir::IOIndex &index, ir::Layout layout)
   const auto &output_desc = _io_desc.outputs.at(index.value());
   _io_desc.outputs.at(index.value()) =
     std::make_unique<OutputDesc>(output_desc->info, output_desc->buffer, output_desc->size, layout);
+  _io_desc.pinned_id = 0;
+}
+
+void Execution::pinIO()
+{
+  static std::atomic<uint64_t> last_pinned_id{0};
+
+  for (uint32_t i = 0; i < _io_desc.inputs.size(); ++i)
+  {
+    if (_io_desc.inputs[i] == nullptr)
+      throw std::runtime_error{"Input " + std::to_string(i) + "'s buffer is not set."};
+    if (reinterpret_cast<uintptr_t>(_io_desc.inputs[i]->buffer) % alignof(std::max_align_t) != 0)
+      VERBOSE(Execution) << "Input " << i << "'s buffer is not aligned" << std::endl;
+  }
+  for (uint32_t i = 0; i < _io_desc.outputs.size(); ++i)
+  {
+    if (_io_desc.outputs[i] == nullptr)
+      throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is not set."};
+    if (reinterpret_cast<uintptr_t>(_io_desc.outputs[i]->buffer) % alignof(std::max_align_t) != 0)
+      VERBOSE(Execution) << "Output " << i << "'s buffer is not aligned" << std::endl;
+  }
+
+  _io_desc.pinned_id = ++last_pinned_id;
+  VERBOSE(Execution) << "Pin input and output buffers (id: " << _io_desc.pinned_id << ")"
+                     << std::endl;
 }
 
 void Execution::execute()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
 
-  primary_executor()->execute(_io_desc);
+  run(_io_desc);
   finished = true;
 
   VERBOSE(Execution) << "Execution finished" << std::endl;
 }
 
-void Execution::startExecute()
+void Execution::run(IODescription &desc)
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  if (_shape_cache == nullptr || desc.dynamic_input_shapes.empty() ||
+      !executeWithShapeBucket(desc))
+  {
+    primary_executor()->execute(desc);
+  }
+}
+
+bool Execution::executeWithShapeBucket(IODescription &io_desc)
+{
+  const auto &primary_subg = primary_subgraph();
+  const auto input_count = primary_subg.getInputs().size();
+  const auto output_count = primary_subg.getOutputs().size();
+
+  ShapeBucketCache::Shapes shapes;
+  for (uint32_t i = 0; i < input_count; ++i)
+  {
+    if (io_desc.inputs.at(i) == nullptr)
+      return false;
+    auto itr = io_desc.dynamic_input_shapes.find(ir::IOIndex{i});
+    shapes.emplace_back(itr != io_desc.dynamic_input_shapes.end()
+                          ? itr->second
+                          : primary_subg.operands().at(primary_subg.getInputs().at(i)).shape());
+  }
+
+  // Copy the entry as another run may evict it meanwhile
+  ShapeBucketCache::Entry entry;
+  {
+    std::lock_guard<std::mutex> lock{_shape_cache_mutex};
+    const auto found = _shape_cache->lookup(shapes);
+    if (found == nullptr)
+      return false;
+    entry = *found;
+  }
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  // Every shape of the specialized executor is static, so it runs without dynamic_input_shapes
+  auto &executor = entry.executors->at(ir::SubgraphIndex{0});
+  const auto &graph = executor->graph();
+  IODescription desc;
+  std::vector<std::vector<uint8_t>> padded_inputs(input_count);
+  for (uint32_t i = 0; i < input_count; ++i)
+  {
+    const auto &input = *io_desc.inputs.at(i);
+    const auto &info = graph.operands().at(graph.getInputs().at(i)).info();
+    if (entry.bucket[i] == shapes[i])
+    {
+      desc.inputs.emplace_back(
+        std::make_unique<InputDesc>(info, input.buffer, input.size, input.layout));
+      continue;
+    }
+
+    // Padding works on the model layout, so a permuted user buffer cannot be padded here
+    if (input.layout != primary_subg.layout())
+      return false;
+
+    auto &padded = padded_inputs[i];
+    padded.assign(info.total_size(), 0);
+    padCopy(static_cast<const uint8_t *>(input.buffer), shapes[i], padded.data(),
+            entry.bucket[i], ir::sizeOfDataType(info.typeInfo().type()));
+    desc.inputs.emplace_back(
+      std::make_unique<InputDesc>(info, padded.data(), padded.size(), input.layout));
+  }
+
+  for (uint32_t n = 0; n < output_count; ++n)
+  {
+    const auto &output = io_desc.outputs.at(n);
+    if (output == nullptr)
+    {
+      desc.outputs.emplace_back(nullptr);
+      continue;
+    }
+
+    const auto &info = graph.operands().at(graph.getOutputs().at(n)).info();
+    if (!info.isDynamic() && info.total_size() > output->size)
+      return false;
+    desc.outputs.emplace_back(
+      std::make_unique<OutputDesc>(output->info, output->buffer, output->size, output->layout));
+  }
+
+  executor->execute(desc);
+
+  for (uint32_t n = 0; n < output_count; ++n)
+  {
+    if (desc.outputs[n] != nullptr)
+      io_desc.outputs[n]->info.shape(desc.outputs[n]->info.shape());
+  }
+  return true;
+}
+
+uint64_t Execution::startExecute(const Callback &callback)
+{
+  // Snapshot IO settings so that the user may set up the next run meanwhile
+  auto desc = std::make_unique<IODescription>();
+  for (const auto &input : _io_desc.inputs)
+  {
+    if (input == nullptr)
+      desc->inputs.emplace_back(nullptr);
+    else
+      desc->inputs.emplace_back(std::make_unique<InputDesc>(*input));
+  }
+  for (const auto &output : _io_desc.outputs)
+  {
+    if (output == nullptr)
+      desc->outputs.emplace_back(nullptr);
+    else
+      desc->outputs.emplace_back(std::make_unique<OutputDesc>(*output));
+  }
+  desc->dynamic_input_shapes = _io_desc.dynamic_input_shapes;
+  desc->pinned_id = _io_desc.pinned_id;
+
+  uint64_t run_id;
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    if (!_worker.joinable())
+    {
+      VERBOSE(Execution) << "Create asynchronous execution worker" << std::endl;
+      _worker = std::thread(&Execution::runAsyncWorker, this);
+    }
+
+    run_id = ++_last_queued_id;
+    _queued_runs.emplace_back(AsyncRun{run_id, std::move(desc), callback});
+    finished = false;
+  }
+  _queued_cv.notify_one();
+
+  VERBOSE(Execution) << "Queue asynchronous execution #" << run_id << std::endl;
+  return run_id;
+}
+
+void Execution::runAsyncWorker()
+{
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  while (true)
+  {
+    _queued_cv.wait(lock, [&] { return _stop_worker || !_queued_runs.empty(); });
+    // Runs queued before stopping are still done
+    if (_queued_runs.empty())
+      return;
+
+    auto async_run = std::move(_queued_runs.front());
+    _queued_runs.pop_front();
+    lock.unlock();
+
+    std::exception_ptr error;
+    try
+    {
+      run(*async_run.desc);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+    if (async_run.callback)
+      async_run.callback(error);
+
+    lock.lock();
+    if (error != nullptr)
+      _run_errors.emplace(async_run.id, error);
+    _last_finished_id = async_run.id;
+    _finished_runs.emplace_back(std::move(async_run));
+    _finished_cv.notify_all();
+  }
 }
 
 void Execution::waitFinish()
 {
-  VERBOSE(Execution) << "Wait to finish execution" << std::endl;
+  uint64_t run_id;
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    run_id = _last_queued_id;
+  }
+  waitRuns(run_id, 1);
+}
 
-  _exec_thread->join();
-  finished = true;
+void Execution::waitFinish(uint64_t run_id) { waitRuns(run_id, run_id); }
+
+void Execution::waitRuns(uint64_t run_id, uint64_t first_error_id)
+{
+  VERBOSE(Execution) << "Wait to finish execution #" << run_id << std::endl;
+
+  std::deque<AsyncRun> runs;
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock{_async_mutex};
+    if (run_id > _last_queued_id)
+      throw std::runtime_error{"Execution #" + std::to_string(run_id) + " is not started"};
+
+    _finished_cv.wait(lock, [&] { return _last_finished_id >= run_id; });
+    while (!_finished_runs.empty() && _finished_runs.front().id <= run_id)
+    {
+      runs.emplace_back(std::move(_finished_runs.front()));
+      _finished_runs.pop_front();
+    }
+    finished = _last_finished_id == _last_queued_id;
+
+    auto begin = _run_errors.lower_bound(first_error_id);
+    auto end = _run_errors.upper_bound(run_id);
+    if (begin != end)
+      error = begin->second;
+    _run_errors.erase(begin, end);
+  }
+
+  // Report output shapes of the latest run through getOutputShape()
+  for (const auto &async_run : runs)
+  {
+    for (uint32_t n = 0; n < _io_desc.outputs.size(); ++n)
+    {
+      const auto &output = async_run.desc->outputs.at(n);
+      if (output != nullptr && _io_desc.outputs[n] != nullptr)
+        _io_desc.outputs[n]->info.shape(output->info.shape());
+    }
+  }
+
+  if (error != nullptr)
+    std::rethrow_exception(error);
 }
 
 bool Execution::isFinished(void) const { return finished; }
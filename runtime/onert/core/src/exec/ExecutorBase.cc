@@ -83,6 +83,7 @@ void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs
     }
     input_tensor->setTensor(input);
   }
+  _bound_pinned_id = 0;
 
   assert(outputs.size() == _graph.getOutputs().size());
   assert(outputs.size() == _output_tensors.size());
@@ -105,6 +106,35 @@ void ExecutorBase::execute(const IODescription &desc)
   //       do not need to use mutex (otherwise, use mutex)
   std::lock_guard<std::mutex> lock(_mutex);
 
+  // Pinned buffers bound by the last run are still bound
+  if (desc.pinned_id == 0 || desc.pinned_id != _bound_pinned_id)
+  {
+    bindIO(desc);
+    _bound_pinned_id = desc.pinned_id;
+  }
+
+  executeImpl();
+
+  // Update output(s) desc
+  for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
+  {
+    ir::IOIndex output_index{n};
+    // Optional output
+    if (desc.outputs.at(n) == nullptr)
+    {
+      continue;
+    }
+    auto &output = *desc.outputs.at(n);
+
+    // set shape of outputDesc to tensor shape since tensor can be dynamic
+    const auto output_tensor_shape = _output_tensors[n]->getShape();
+    output.info.shape(
+      convertShape(output_tensor_shape, _output_tensors[n]->layout(), output.layout));
+  }
+}
+
+void ExecutorBase::bindIO(const IODescription &desc)
+{
   // Set input(s)
   assert(_input_tensors.size() == desc.inputs.size());
   for (uint32_t i = 0; i < _input_tensors.size(); ++i)
@@ -126,6 +156,10 @@ void ExecutorBase::execute(const IODescription &desc)
     handleDynamicInputTensor(ir::IOIndex{i}, desc);
   }
 
+  // Output shapes can change only after an input shape does. Marking outputs dynamic otherwise
+  // would make their producers redo shape dependent preparation on every run.
+  const bool dynamic_input = hasDynamicInput();
+
   assert(_output_tensors.size() == desc.outputs.size());
   for (uint32_t i = 0; i < _output_tensors.size(); ++i)
   {
@@ -134,26 +168,8 @@ void ExecutorBase::execute(const IODescription &desc)
     if (desc.outputs[i] == nullptr)
       throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is not set."};
     tensor->setUserTensor(static_cast<uint8_t *>(desc.outputs[i]->buffer), desc.outputs[i]->size);
-    tensor->set_dynamic(); // It can't be resized but shape could change
-  }
-
-  executeImpl();
-
-  // Update output(s) desc
-  for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
-  {
-    ir::IOIndex output_index{n};
-    // Optional output
-    if (desc.outputs.at(n) == nullptr)
-    {
-      continue;
-    }
-    auto &output = *desc.outputs.at(n);
-
-    // set shape of outputDesc to tensor shape since tensor can be dynamic
-    const auto output_tensor_shape = _output_tensors[n]->getShape();
-    output.info.shape(
-      convertShape(output_tensor_shape, _output_tensors[n]->layout(), output.layout));
+    if (dynamic_input)
+      tensor->set_dynamic(); // It can't be resized but shape could change
   }
 }
 
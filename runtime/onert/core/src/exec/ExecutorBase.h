@@ -96,7 +96,12 @@ protected:
   const util::TracingCtx *_tracing_ctx;
 
 private:
+  void bindIO(const IODescription &desc);
   void handleDynamicInputTensor(ir::IOIndex input_index, const IODescription &desc);
+
+private:
+  // Id of the pinned buffers which IO tensors are bound to, or zero if not pinned
+  uint64_t _bound_pinned_id{0};
 };
 
 } // namespace exec
@@ -16,11 +16,54 @@
 
 #include "ParallelExecutor.h"
 
+#include <algorithm>
 #include <cassert>
+#include <map>
 
 #include "util/logging.h"
 #include "exec/IFunction.h"
 
+namespace
+{
+
+using namespace onert;
+
+// Estimate how many jobs of each backend can be ready at once, by the number of its jobs at the
+// same depth from the graph inputs
+std::unordered_map<const backend::Backend *, uint32_t>
+maxWidths(const std::vector<std::list<uint32_t>> &output_info,
+          const std::vector<uint32_t> &input_info,
+          const std::vector<const backend::Backend *> &job_backends)
+{
+  const auto num_jobs = output_info.size();
+  std::vector<uint32_t> depth(num_jobs, 0);
+  std::vector<uint32_t> remaining{input_info};
+  std::vector<uint32_t> queue;
+  for (uint32_t id = 0; id < num_jobs; ++id)
+  {
+    if (remaining[id] == 0)
+      queue.push_back(id);
+  }
+
+  std::map<std::pair<const backend::Backend *, uint32_t>, uint32_t> counts;
+  std::unordered_map<const backend::Backend *, uint32_t> widths;
+  for (size_t head = 0; head < queue.size(); ++head)
+  {
+    const auto id = queue[head];
+    const auto backend = job_backends[id];
+    widths[backend] = std::max(widths[backend], ++counts[{backend, depth[id]}]);
+    for (auto next : output_info[id])
+    {
+      depth[next] = std::max(depth[next], depth[id] + 1);
+      if (--remaining[next] == 0)
+        queue.push_back(next);
+    }
+  }
+  return widths;
+}
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -53,6 +96,7 @@ void ParallelExecutor::notify(uint32_t finished_job_id)
 {
   std::unique_lock<std::mutex> lock{_mu_jobs};
 
+  _idle_threads.at(_job_backends[finished_job_id])++;
   DataflowExecutor::notify(finished_job_id);
 
   lock.unlock();
@@ -63,11 +107,34 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
                                    backend::BackendContexts &&backend_contexts,
                                    const compiler::TensorRegistries &tensor_regs,
                                    compiler::CodeMap &&code_map,
-                                   const util::TracingCtx *tracing_ctx)
+                                   const util::TracingCtx *tracing_ctx, uint32_t parallel_threads)
   : DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
                      std::move(code_map), tracing_ctx}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
+
+  _job_backends.resize(_finished_jobs.size());
+  for (const auto &pair : _job_to_op)
+    _job_backends[pair.first] = _lowered_graph->lower_info().operation.at(pair.second).backend();
+
+  // More threads than jobs which can run at once would only sit idle
+  for (const auto &pair : maxWidths(_output_info, _initial_input_info, _job_backends))
+  {
+    const auto backend = pair.first;
+    const auto max_width = pair.second;
+    _num_threads[backend] = backend->config()->supportConcurrentExecution()
+                              ? std::max(std::min(parallel_threads, max_width), 1u)
+                              : 1;
+    VERBOSE(ParallelExecutor) << backend->config()->id() << " runs up to "
+                              << _num_threads[backend] << " jobs at once" << std::endl;
+  }
+}
+
+decltype(ParallelExecutor::_ready_jobs)::iterator ParallelExecutor::findDispatchableJob()
+{
+  return std::find_if(_ready_jobs.begin(), _ready_jobs.end(), [this](const auto &pair) {
+    return _idle_threads.at(_job_backends[pair.second->index()]) > 0;
+  });
 }
 
 void ParallelExecutor::executeImpl()
@@ -75,13 +142,8 @@ void ParallelExecutor::executeImpl()
   bool dynamic_input_exists = hasDynamicInput();
 
   // Init scheduler
-  // TODO Consider to have distinct backend set in GraphLowerInfo
-  BackendSet backends;
-  _lowered_graph->lower_info().operation.iterate(
-    [&](const ir::OperationIndex &, const compiler::OperationLowerInfo &lower_info) {
-      backends.add(lower_info.backend());
-    });
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(_num_threads);
+  _idle_threads = _num_threads;
 
   assert(noWaitingJobs());
 
@@ -108,26 +170,30 @@ void ParallelExecutor::executeImpl()
   {
     std::unique_lock<std::mutex> lock{_mu_jobs};
 
-    if (_ready_jobs.empty())
+    // Jobs wait here rather than in the backend's queue, so that a job on the critical path which
+    // becomes ready later still runs before the others
+    auto job_it = _ready_jobs.end();
+    _cv_jobs.wait(lock, [&] {
+      job_it = findDispatchableJob();
+      return job_it != _ready_jobs.end() || (_ready_jobs.empty() && noWaitingJobs());
+    });
+    // Check finish condition
+    if (job_it == _ready_jobs.end())
     {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
+      break;
     }
 
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
+    auto job = std::move(job_it->second);
+    _ready_jobs.erase(job_it);
+    _idle_threads.at(_job_backends[job->index()])--;
 
     lock.unlock();
 
     VERBOSE(ParallelExecutor) << "Assigning fn " << job->index() << std::endl;
 
     auto job_index = job->index();
-    auto op_ind = _job_to_op[job_index];
-    auto backend = _lowered_graph->lower_info().operation.at(op_ind).backend();
+    auto op_ind = _job_to_op.at(job_index);
+    auto backend = _job_backends[job_index];
     auto setup = [&, op_ind, backend]() {
       _subject.notifyJobBegin(this, profiling_subg_index, op_ind, backend);
     };
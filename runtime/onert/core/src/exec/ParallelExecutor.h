@@ -50,18 +50,32 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param parallel_threads Max number of jobs which run at once on a backend
    */
   ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                    backend::BackendContexts &&backend_contexts,
                    const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                   const util::TracingCtx *tracing_ctx);
+                   const util::TracingCtx *tracing_ctx, uint32_t parallel_threads = 1);
 
   void executeImpl() override;
 
+private:
+  /**
+   * @brief Find the ready job of the highest rank whose backend has an idle thread
+   * @return Iterator of @c _ready_jobs, or its end if there is no such job
+   */
+  decltype(_ready_jobs)::iterator findDispatchableJob();
+
 private:
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
   std::unique_ptr<ParallelScheduler> _scheduler;
+  /// @brief Backend of each job
+  std::vector<const backend::Backend *> _job_backends;
+  /// @brief Number of threads for each backend
+  std::unordered_map<const backend::Backend *, uint32_t> _num_threads;
+  /// @brief Number of threads not running a job for each backend in current execution
+  std::unordered_map<const backend::Backend *, uint32_t> _idle_threads;
 };
 
 } // namespace exec
@@ -26,13 +26,14 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(
+  const std::unordered_map<const backend::Backend *, uint32_t> &num_threads)
 {
-  assert(!backends.empty());
+  assert(!num_threads.empty());
 
-  for (auto backend : backends)
+  for (const auto &pair : num_threads)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    _thread_pools[pair.first] = std::make_unique<ThreadPool>(pair.second);
   }
 }
 
@@ -35,9 +35,9 @@ public:
   /**
    * @brief Constructs ParallelScheduler object
    *
-   * @param backends Backend set
+   * @param num_threads Number of threads for each backend
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const std::unordered_map<const backend::Backend *, uint32_t> &num_threads);
   /**
    * @brief Assign a task to the given backend
    *
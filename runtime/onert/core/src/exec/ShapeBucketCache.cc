@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ShapeBucketCache.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+
+using namespace onert;
+
+int32_t roundUpToPowerOfTwo(int32_t value)
+{
+  int32_t ret = 1;
+  while (ret < value)
+    ret <<= 1;
+  return ret;
+}
+
+// Estimate memory which static tensors of an executor occupy
+uint64_t estimateMemorySize(exec::IExecutor &executor)
+{
+  uint64_t size = 0;
+  executor.graph().operands().iterate([&](const ir::OperandIndex &, const ir::Operand &operand) {
+    const auto &info = operand.info();
+    if (!info.isConstant() && !info.isDynamic())
+      size += info.total_size();
+  });
+  return size;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+ShapeBucketCache::ShapeBucketCache(const Shapes &model_shapes, const Builder &builder,
+                                   uint32_t capacity, uint64_t memory_limit, bool allow_padding)
+  : _model_shapes{model_shapes}, _builder{builder}, _capacity{capacity},
+    _memory_limit{memory_limit}, _allow_padding{allow_padding}
+{
+  assert(_builder);
+}
+
+ShapeBucketCache::Shapes ShapeBucketCache::bucketOf(const Shapes &shapes) const
+{
+  if (!_allow_padding)
+    return shapes;
+
+  assert(shapes.size() == _model_shapes.size());
+  Shapes bucket{shapes};
+  for (size_t i = 0; i < bucket.size(); ++i)
+  {
+    const auto &model_shape = _model_shapes[i];
+    auto &shape = bucket[i];
+    if (shape.rank() != model_shape.rank())
+      continue;
+
+    // Keep dimensions fixed by the model as they are, e.g. channels of an image
+    for (int axis = 0; axis < shape.rank(); ++axis)
+    {
+      if (shape.dim(axis) != model_shape.dim(axis))
+        shape.dim(axis) = roundUpToPowerOfTwo(shape.dim(axis));
+    }
+  }
+  return bucket;
+}
+
+const ShapeBucketCache::Entry *ShapeBucketCache::lookup(const Shapes &shapes)
+{
+  if (_capacity == 0)
+    return nullptr;
+
+  const auto bucket = bucketOf(shapes);
+  auto it = std::find_if(_entries.begin(), _entries.end(),
+                         [&](const Entry &entry) { return entry.bucket == bucket; });
+  if (it != _entries.end())
+  {
+    _hits++;
+    _entries.splice(_entries.begin(), _entries, it);
+    return &_entries.front();
+  }
+
+  if (std::find(_rejected.begin(), _rejected.end(), bucket) != _rejected.end())
+    return nullptr;
+
+  _misses++;
+  auto executors = _builder(bucket);
+  assert(executors != nullptr);
+  const auto memory_size = estimateMemorySize(*executors->at(ir::SubgraphIndex{0}));
+  if (memory_size > _memory_limit)
+  {
+    VERBOSE(ShapeBucketCache) << "Bucket needs " << memory_size << " bytes which exceeds limit "
+                              << _memory_limit << ", run it dynamically" << std::endl;
+    _rejected.emplace_back(bucket);
+    return nullptr;
+  }
+
+  _entries.emplace_front(Entry{bucket, executors, memory_size});
+  _memory_size += memory_size;
+  evict();
+
+  VERBOSE(ShapeBucketCache) << "Compiled bucket #" << _misses << " (" << memory_size
+                            << " bytes, " << _entries.size() << " cached)" << std::endl;
+  return &_entries.front();
+}
+
+void ShapeBucketCache::evict()
+{
+  // The front entry is the one just added, which always fits by itself
+  while (_entries.size() > 1 && (_entries.size() > _capacity || _memory_size > _memory_limit))
+  {
+    _memory_size -= _entries.back().memory_size;
+    _entries.pop_back();
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ShapeBucketCache.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using exec::ShapeBucketCache;
+
+namespace
+{
+
+// Executor which only owns a graph with a single float input and output of the given shape
+class MockExecutor : public exec::IExecutor
+{
+public:
+  MockExecutor(const ir::Shape &shape)
+  {
+    const ir::TypeInfo float_type{ir::DataType::FLOAT32};
+    auto input = _graph.addOperand(shape, float_type);
+    auto output = _graph.addOperand(shape, float_type);
+    _graph.addInput(input);
+    _graph.addOutput(output);
+  }
+
+  const ir::Graph &graph() override { return _graph; }
+  void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>>) override {}
+  void execute(const exec::IODescription &) override {}
+  void execute(const std::vector<backend::IPortableTensor *> &,
+               const std::vector<backend::IPortableTensor *> &) override
+  {
+  }
+  const std::vector<backend::builtin::IOTensor *> &getOutputTensors() const override
+  {
+    return _output_tensors;
+  }
+
+private:
+  ir::Graph _graph;
+  std::vector<backend::builtin::IOTensor *> _output_tensors;
+};
+
+struct MockBuilder
+{
+  std::shared_ptr<exec::ExecutorMap> operator()(const ShapeBucketCache::Shapes &shapes)
+  {
+    (*count)++;
+    auto executors = std::make_shared<exec::ExecutorMap>();
+    executors->emplace(ir::SubgraphIndex{0}, std::make_unique<MockExecutor>(shapes.at(0)));
+    return executors;
+  }
+
+  std::shared_ptr<uint32_t> count = std::make_shared<uint32_t>(0);
+};
+
+// Bytes which MockExecutor occupies for a float shape of given elements
+constexpr uint64_t memorySize(uint64_t num_elements) { return 2 * 4 * num_elements; }
+
+} // namespace
+
+TEST(ShapeBucketCache, compile_once_per_shape)
+{
+  MockBuilder builder;
+  ShapeBucketCache cache{{ir::Shape{1, 4}}, builder, 4, UINT64_MAX, false};
+
+  auto entry = cache.lookup({ir::Shape{1, 8}});
+  ASSERT_NE(entry, nullptr);
+  ASSERT_EQ(entry->bucket.at(0), (ir::Shape{1, 8}));
+  ASSERT_EQ(entry->memory_size, memorySize(8));
+  ASSERT_NE(cache.lookup({ir::Shape{1, 16}}), nullptr);
+  ASSERT_NE(cache.lookup({ir::Shape{1, 8}}), nullptr);
+
+  ASSERT_EQ(*builder.count, 2);
+  ASSERT_EQ(cache.hits(), 1);
+  ASSERT_EQ(cache.misses(), 2);
+  ASSERT_EQ(cache.size(), 2);
+}
+
+TEST(ShapeBucketCache, evict_least_recently_used)
+{
+  MockBuilder builder;
+  ShapeBucketCache cache{{ir::Shape{1, 4}}, builder, 2, UINT64_MAX, false};
+
+  cache.lookup({ir::Shape{1, 1}});
+  cache.lookup({ir::Shape{1, 2}});
+  cache.lookup({ir::Shape{1, 1}});
+  // {1, 2} is the least recently used one
+  cache.lookup({ir::Shape{1, 3}});
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(*builder.count, 3);
+
+  cache.lookup({ir::Shape{1, 1}});
+  ASSERT_EQ(*builder.count, 3);
+  cache.lookup({ir::Shape{1, 2}});
+  ASSERT_EQ(*builder.count, 4);
+}
+
+TEST(ShapeBucketCache, evict_by_memory_limit)
+{
+  MockBuilder builder;
+  ShapeBucketCache cache{{ir::Shape{1, 4}}, builder, 8, memorySize(20), false};
+
+  cache.lookup({ir::Shape{1, 8}});
+  cache.lookup({ir::Shape{1, 16}});
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(cache.memorySize(), memorySize(16));
+}
+
+TEST(ShapeBucketCache, pad_changed_dims_only)
+{
+  MockBuilder builder;
+  ShapeBucketCache cache{{ir::Shape{1, 4, 3}}, builder, 4, UINT64_MAX, true};
+
+  ASSERT_EQ(cache.bucketOf({ir::Shape{1, 5, 3}}).at(0), (ir::Shape{1, 8, 3}));
+  ASSERT_EQ(cache.bucketOf({ir::Shape{2, 4, 3}}).at(0), (ir::Shape{2, 4, 3}));
+  ASSERT_EQ(cache.bucketOf({ir::Shape{3, 4, 3}}).at(0), (ir::Shape{4, 4, 3}));
+
+  cache.lookup({ir::Shape{1, 5, 3}});
+  cache.lookup({ir::Shape{1, 7, 3}});
+  ASSERT_EQ(*builder.count, 1);
+  ASSERT_EQ(cache.hits(), 1);
+}
+
+TEST(ShapeBucketCache, neg_disabled)
+{
+  MockBuilder builder;
+  ShapeBucketCache cache{{ir::Shape{1, 4}}, builder, 0, UINT64_MAX, false};
+
+  ASSERT_EQ(cache.lookup({ir::Shape{1, 8}}), nullptr);
+  ASSERT_EQ(*builder.count, 0);
+}
+
+TEST(ShapeBucketCache, neg_too_large)
+{
+  MockBuilder builder;
+  ShapeBucketCache cache{{ir::Shape{1, 4}}, builder, 4, memorySize(4), false};
+
+  ASSERT_EQ(cache.lookup({ir::Shape{1, 8}}), nullptr);
+  ASSERT_EQ(cache.lookup({ir::Shape{1, 8}}), nullptr);
+  // Rejected buckets are not compiled again
+  ASSERT_EQ(*builder.count, 1);
+  ASSERT_EQ(cache.size(), 0);
+}
@@ -27,7 +27,7 @@ namespace ir
 Operands::Operands(const Operands &obj)
 {
   obj.iterate([&](const OperandIndex &index, const Operand &operand) {
-    _objects.emplace(index, std::make_unique<Operand>(operand));
+    push(std::make_unique<Operand>(operand), index);
   });
   _next_index = obj._next_index;
 }
@@ -25,8 +25,7 @@ namespace ir
 
 Operations::Operations(const Operations &obj)
 {
-  obj.iterate(
-    [&](const OperationIndex &index, const Operation &op) { _objects.emplace(index, clone(op)); });
+  obj.iterate([&](const OperationIndex &index, const Operation &op) { push(clone(op), index); });
   _next_index = obj._next_index;
 }
 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PageAllocator.h"
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+
+using namespace onert;
+
+size_t roundUp(size_t value, size_t unit) { return (value + unit - 1) / unit * unit; }
+
+size_t hugePageSize()
+{
+  static const size_t size = [] {
+    // e.g. "Hugepagesize:       2048 kB"
+    std::ifstream meminfo{"/proc/meminfo"};
+    std::string key;
+    while (meminfo >> key)
+    {
+      if (key == "Hugepagesize:")
+      {
+        size_t kb = 0;
+        if (meminfo >> kb && kb > 0)
+          return kb * 1024;
+        break;
+      }
+      meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return static_cast<size_t>(2 * 1024 * 1024);
+  }();
+  return size;
+}
+
+uint8_t *mapAnonymous(size_t length, int flags)
+{
+  void *base =
+    mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  return base == MAP_FAILED ? nullptr : static_cast<uint8_t *>(base);
+}
+
+// Map @c length bytes aligned by @c alignment, by over-mapping and trimming both ends
+uint8_t *mapAligned(size_t length, size_t alignment)
+{
+  auto mapped = mapAnonymous(length + alignment, 0);
+  if (mapped == nullptr)
+    return nullptr;
+
+  const auto addr = reinterpret_cast<uintptr_t>(mapped);
+  auto base = reinterpret_cast<uint8_t *>(roundUp(addr, alignment));
+  const size_t head = base - mapped;
+  const size_t tail = alignment - head;
+  if (head > 0)
+    munmap(mapped, head);
+  if (tail > 0)
+    munmap(base + length, tail);
+  return base;
+}
+
+void bindToNumaNode(uint8_t *base, size_t length, int node)
+{
+  if (node == util::PagePolicy::NUMA_NONE)
+    return;
+
+  if (node == util::PagePolicy::NUMA_LOCAL)
+  {
+    unsigned int cpu = 0;
+    unsigned int local_node = 0;
+    if (syscall(SYS_getcpu, &cpu, &local_node, nullptr) != 0)
+    {
+      VERBOSE(PageAllocator) << "Cannot find the local NUMA node: " << std::strerror(errno)
+                             << std::endl;
+      return;
+    }
+    node = static_cast<int>(local_node);
+  }
+
+  constexpr size_t bits = sizeof(unsigned long) * 8;
+  std::vector<unsigned long> nodemask(node / bits + 1, 0);
+  nodemask[node / bits] |= 1UL << (node % bits);
+  // NOTE MPOL_PREFERRED rather than MPOL_BIND, so that allocation falls back to other nodes
+  //      instead of failing when the node runs out of memory
+  // NOTE The kernel takes one more than the number of bits in the mask
+  if (syscall(SYS_mbind, base, length, MPOL_PREFERRED, nodemask.data(), nodemask.size() * bits + 1,
+              0) != 0)
+  {
+    VERBOSE(PageAllocator) << "Cannot bind memory to NUMA node " << node << ": "
+                           << std::strerror(errno) << std::endl;
+  }
+}
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+constexpr int PagePolicy::NUMA_NONE;
+constexpr int PagePolicy::NUMA_LOCAL;
+
+PagePolicy PagePolicy::fromConfig()
+{
+  PagePolicy policy;
+  policy.huge_page = toHugePage(getConfigString(config::HUGE_PAGES));
+  policy.numa_node = toNumaNode(getConfigString(config::NUMA_NODE));
+  return policy;
+}
+
+PagePolicy::HugePage toHugePage(const std::string &val)
+{
+  if (val.empty() || val == "none")
+    return PagePolicy::HugePage::NONE;
+  if (val == "transparent")
+    return PagePolicy::HugePage::TRANSPARENT;
+  if (val == "explicit")
+    return PagePolicy::HugePage::EXPLICIT;
+  throw std::runtime_error("Invalid HUGE_PAGES: " + val);
+}
+
+int toNumaNode(const std::string &val)
+{
+  if (val.empty() || val == "none")
+    return PagePolicy::NUMA_NONE;
+  if (val == "local")
+    return PagePolicy::NUMA_LOCAL;
+
+  size_t pos = 0;
+  int node = -1;
+  try
+  {
+    node = std::stoi(val, &pos);
+  }
+  catch (const std::logic_error &)
+  {
+    // Handled below
+  }
+  if (pos != val.size() || node < 0)
+    throw std::runtime_error("Invalid NUMA_NODE: " + val);
+  return node;
+}
+
+std::shared_ptr<uint8_t> allocatePages(size_t size, const PagePolicy &policy)
+{
+  const size_t page_size = getpagesize();
+  const size_t huge_page_size = hugePageSize();
+  size = std::max<size_t>(size, 1);
+
+  // Rounding a small buffer up to a huge page wastes more than it saves
+  auto huge_page = size >= huge_page_size ? policy.huge_page : PagePolicy::HugePage::NONE;
+
+  uint8_t *base = nullptr;
+  size_t length = 0;
+  if (huge_page == PagePolicy::HugePage::EXPLICIT)
+  {
+    length = roundUp(size, huge_page_size);
+    base = mapAnonymous(length, MAP_HUGETLB);
+    if (base == nullptr)
+    {
+      VERBOSE(PageAllocator) << "No huge pages reserved for " << length
+                             << " bytes, use transparent huge pages" << std::endl;
+      huge_page = PagePolicy::HugePage::TRANSPARENT;
+    }
+  }
+
+  if (huge_page == PagePolicy::HugePage::TRANSPARENT)
+  {
+    length = roundUp(size, huge_page_size);
+    base = mapAligned(length, huge_page_size);
+    if (base != nullptr && madvise(base, length, MADV_HUGEPAGE) != 0)
+    {
+      VERBOSE(PageAllocator) << "Transparent huge pages are not available: "
+                             << std::strerror(errno) << std::endl;
+    }
+  }
+  else if (huge_page == PagePolicy::HugePage::NONE)
+  {
+    length = roundUp(size, page_size);
+    base = mapAnonymous(length, 0);
+  }
+
+  if (base == nullptr)
+    throw std::bad_alloc{};
+
+  bindToNumaNode(base, length, policy.numa_node);
+
+  // Fault all pages in now, on the node bound above
+  std::memset(base, 0, length);
+
+  VERBOSE(PageAllocator) << "Allocated " << length << " bytes at " << static_cast<void *>(base)
+                         << std::endl;
+  return std::shared_ptr<uint8_t>{base, [length](uint8_t *ptr) { munmap(ptr, length); }};
+}
+
+} // namespace util
+} // namespace onert
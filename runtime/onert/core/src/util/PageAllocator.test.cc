@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PageAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using onert::util::allocatePages;
+using onert::util::PagePolicy;
+
+TEST(PageAllocator, parse_config)
+{
+  ASSERT_EQ(onert::util::toHugePage("none"), PagePolicy::HugePage::NONE);
+  ASSERT_EQ(onert::util::toHugePage("transparent"), PagePolicy::HugePage::TRANSPARENT);
+  ASSERT_EQ(onert::util::toHugePage("explicit"), PagePolicy::HugePage::EXPLICIT);
+
+  ASSERT_EQ(onert::util::toNumaNode("none"), PagePolicy::NUMA_NONE);
+  ASSERT_EQ(onert::util::toNumaNode("local"), PagePolicy::NUMA_LOCAL);
+  ASSERT_EQ(onert::util::toNumaNode("1"), 1);
+}
+
+TEST(PageAllocator, neg_parse_config)
+{
+  ASSERT_THROW(onert::util::toHugePage("huge"), std::runtime_error);
+  ASSERT_THROW(onert::util::toNumaNode("-3"), std::runtime_error);
+  ASSERT_THROW(onert::util::toNumaNode("1a"), std::runtime_error);
+}
+
+TEST(PageAllocator, allocate)
+{
+  const size_t sizes[] = {1, 4096, 3 * 1024 * 1024};
+  const PagePolicy::HugePage huge_pages[] = {PagePolicy::HugePage::NONE,
+                                             PagePolicy::HugePage::TRANSPARENT,
+                                             PagePolicy::HugePage::EXPLICIT};
+  for (auto huge_page : huge_pages)
+  {
+    for (auto size : sizes)
+    {
+      PagePolicy policy;
+      policy.huge_page = huge_page;
+      policy.numa_node = PagePolicy::NUMA_LOCAL;
+
+      // Huge pages and NUMA binding are best-effort, so allocation must not fail without them
+      auto pages = allocatePages(size, policy);
+      ASSERT_NE(pages, nullptr);
+      ASSERT_EQ(std::accumulate(pages.get(), pages.get() + size, 0), 0);
+      std::fill(pages.get(), pages.get() + size, 1);
+    }
+  }
+}
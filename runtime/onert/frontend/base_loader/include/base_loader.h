@@ -33,6 +33,7 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #include <util/logging.h>
+#include <util/PageAllocator.h>
 
 namespace onert
 {
@@ -71,6 +72,7 @@ public:
     : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _subgraphs(subgs), _model{nullptr}
   {
     _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA);
+    _page_policy = util::PagePolicy::fromConfig();
   }
 
   /**
@@ -169,9 +171,14 @@ private:
                                std::to_string(subg_index)};
   }
 
+  // Constants in the pool are aligned enough for any SIMD load
+  static size_t alignedConstantSize(size_t size) { return (size + 63) / 64 * 64; }
+
 protected:
   // Base address for mapped region for loading (if needed)
   uint8_t *_base;
+  // Size of the model including buffers stored out of line
+  size_t _size = 0;
   // Memory page size
   int32_t _pagesize;
   // loaded file description
@@ -186,6 +193,11 @@ protected:
   std::unique_ptr<Verifier> _verifier;
   // Boolean flag to use MMAPED_DATA
   bool _use_mmaped_data = false;
+  // Page policy for the constant pool
+  util::PagePolicy _page_policy;
+  // Pool which constants are copied into, allocated only when the page policy is enabled
+  std::shared_ptr<uint8_t> _const_pool;
+  size_t _const_pool_offset = 0;
 
   std::unordered_map<uint32_t /* Buffer Index in circle file */, std::shared_ptr<ir::Data>>
     _buf_to_data;
@@ -205,7 +217,8 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
   {
     throw std::runtime_error("Fstat failed or file " + file_path + " is not a regular file");
   }
-  int size = file_stat.st_size;
+  // Models with buffers stored out of line may exceed 2GB
+  const size_t size = file_stat.st_size;
 
   // Map model file into memory region
   _base = static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, _fd, 0));
@@ -215,6 +228,7 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
     throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
   }
 
+  _size = size;
   _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
 
   loadModel();
@@ -227,6 +241,7 @@ template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::BaseLoader::loadFromBuffer(uint8_t *buffer, size_t size)
 {
   _base = buffer;
+  _size = size;
   _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
   loadModel();
 }
@@ -336,7 +351,9 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   const auto operand_index = subg.addOperand(shape, type_info);
 
   // Constant tensors are indicated by non-empty data.
-  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
+  size_t data_size = 0;
+  const uint8_t *data =
+    LoaderDomain::GetBufferData(_model->buffers()->Get(tensor->buffer()), _base, _size, &data_size);
   if (data != nullptr)
   {
     using std::ptrdiff_t;
@@ -344,12 +361,11 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
 
     if (_fd == -1) // Model is from memory
     {
-      data_obj = std::make_shared<ir::ExternalData>(data->data(), data->size());
+      data_obj = std::make_shared<ir::ExternalData>(data, data_size);
     }
     else // Model is loaded(mmap'd) from a file
     {
-      size_t data_size = data->size();
-      ptrdiff_t unaligned_offset_start = data->data() - _base;
+      ptrdiff_t unaligned_offset_start = data - _base;
       ptrdiff_t offset_end = unaligned_offset_start + data_size;
 
       // Calculated aligned offset from base address of mapped region
@@ -372,6 +388,14 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
                                                     unaligned_offset_start, data_size);
         _buf_to_data[buf_idx] = data_obj;
       }
+      else if (_const_pool)
+      {
+        auto pool_base = _const_pool.get() + _const_pool_offset;
+        std::copy(data, data + data_size, pool_base);
+        _const_pool_offset += alignedConstantSize(data_size);
+        data_obj = std::make_shared<ir::PooledData>(_const_pool, pool_base, data_size);
+        _buf_to_data[buf_idx] = data_obj;
+      }
       else
       {
         size_t offset = unaligned_offset_start - aligned_offset_start;
@@ -1614,6 +1638,19 @@ template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadModel()
 {
   LoaderDomain::VerifyModelBuffer(*_verifier.get());
   _model = LoaderDomain::GetModel(_base);
+  // Copy constants into one pool backed by the page policy, instead of a heap buffer each
+  if (_fd != -1 && !_use_mmaped_data && _page_policy.enabled())
+  {
+    size_t pool_size = 0;
+    for (const auto *buffer : *_model->buffers())
+    {
+      size_t data_size = 0;
+      if (LoaderDomain::GetBufferData(buffer, _base, _size, &data_size) != nullptr)
+        pool_size += alignedConstantSize(data_size);
+    }
+    if (pool_size > 0)
+      _const_pool = util::allocatePages(pool_size, _page_policy);
+  }
   // Version unused
   // const auto version = _model->version();
   // Description unused
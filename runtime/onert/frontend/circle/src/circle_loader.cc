@@ -67,6 +67,25 @@ struct LoaderDomain
   static const char *EnumNameTensorType(TensorType e) { return circle::EnumNameTensorType(e); }
   static const Model *GetModel(const void *buf) { return circle::GetModel(buf); }
   static bool VerifyModelBuffer(Verifier &verifier) { return circle::VerifyModelBuffer(verifier); }
+  // Return the data of a buffer, which may be stored out of line after the flatbuffer
+  static const uint8_t *GetBufferData(const Buffer *buffer, const uint8_t *base, size_t base_size,
+                                      size_t *size)
+  {
+    if (buffer->data() != nullptr)
+    {
+      *size = buffer->data()->size();
+      return buffer->data()->data();
+    }
+    if (buffer->offset() > 1)
+    {
+      if (buffer->offset() > base_size || buffer->size() > base_size - buffer->offset())
+        throw std::runtime_error("Buffer data is out of the model file");
+      *size = buffer->size();
+      return base + buffer->offset();
+    }
+    *size = 0;
+    return nullptr;
+  }
 };
 
 class CircleLoader final : public base_loader::BaseLoader<LoaderDomain>
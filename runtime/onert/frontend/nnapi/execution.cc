@@ -263,21 +263,31 @@ int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution *execution,
     return ANEURALNETWORKS_UNEXPECTED_NULL;
   }
 
-  // TODO: Handle event
+  uint64_t run_id = 0;
+  if (!execution->startExecute(&run_id))
+  {
+    VERBOSE(NNAPI::Execution) << "startCompute: Fail to start execution" << std::endl;
+    return ANEURALNETWORKS_BAD_STATE;
+  }
+
+  // The event waits for this run only, so several runs of an execution can be in flight
   auto instance = execution->instance();
-  *event = new (std::nothrow) ANeuralNetworksEvent{instance};
+  *event = new (std::nothrow) ANeuralNetworksEvent{instance, run_id};
   if (*event == nullptr)
   {
     VERBOSE(NNAPI::Execution) << "startCompute: Fail to create event" << std::endl;
+    try
+    {
+      // Do not leave a run that nobody can wait for
+      instance->waitFinish(run_id);
+    }
+    catch (const std::exception &e)
+    {
+      VERBOSE(EXCEPTION) << e.what() << std::endl;
+    }
     return ANEURALNETWORKS_OUT_OF_MEMORY;
   }
 
-  if (!execution->startExecute())
-  {
-    VERBOSE(NNAPI::Execution) << "startCompute: Fail to start execution" << std::endl;
-    return ANEURALNETWORKS_BAD_STATE;
-  }
-
   return ANEURALNETWORKS_NO_ERROR;
 }
 
@@ -19,8 +19,9 @@
 #include "exec/Execution.h"
 #include "util/logging.h"
 
-ANeuralNetworksEvent::ANeuralNetworksEvent(const std::shared_ptr<onert::exec::Execution> &execution)
-  : _execution{execution}
+ANeuralNetworksEvent::ANeuralNetworksEvent(const std::shared_ptr<onert::exec::Execution> &execution,
+                                           uint64_t run_id)
+  : _execution{execution}, _run_id{run_id}
 {
   // DO NOTHING
 }
@@ -29,7 +30,7 @@ bool ANeuralNetworksEvent::waitFinish(void) noexcept
 {
   try
   {
-    _execution->waitFinish();
+    _execution->waitFinish(_run_id);
   }
   catch (const std::exception &e)
   {
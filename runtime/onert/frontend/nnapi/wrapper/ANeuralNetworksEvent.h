@@ -19,6 +19,7 @@
 
 #include <NeuralNetworks.h>
 
+#include <cstdint>
 #include <memory>
 
 namespace onert
@@ -32,13 +33,14 @@ class Execution;
 struct ANeuralNetworksEvent
 {
 public:
-  ANeuralNetworksEvent(const std::shared_ptr<onert::exec::Execution> &execution);
+  ANeuralNetworksEvent(const std::shared_ptr<onert::exec::Execution> &execution, uint64_t run_id);
 
 public:
   bool waitFinish(void) noexcept;
 
 private:
   const std::shared_ptr<onert::exec::Execution> _execution;
+  const uint64_t _run_id;
 };
 
 #endif
@@ -227,11 +227,11 @@ bool ANeuralNetworksExecution::setOutput(uint32_t index, const ANeuralNetworksOp
   return true;
 }
 
-bool ANeuralNetworksExecution::startExecute(void) noexcept
+bool ANeuralNetworksExecution::startExecute(uint64_t *run_id) noexcept
 {
   try
   {
-    _execution->startExecute();
+    *run_id = _execution->startExecute();
   }
   catch (const std::exception &e)
   {
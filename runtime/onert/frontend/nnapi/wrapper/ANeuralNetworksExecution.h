@@ -39,7 +39,7 @@ public:
                         size_t length) noexcept;
   bool setOutput(uint32_t index, const ANeuralNetworksOperandType *type, void *buffer,
                  size_t length) noexcept;
-  bool startExecute(void) noexcept;
+  bool startExecute(uint64_t *run_id) noexcept;
   bool execute(void) noexcept;
 
   const onert::ir::OperandIndex getInputOperandIndex(int32_t index) noexcept;
@@ -60,6 +60,16 @@ struct LoaderDomain
   {
     return onert_tflite::VerifyModelBuffer(verifier);
   }
+  static const uint8_t *GetBufferData(const Buffer *buffer, const uint8_t *, size_t, size_t *size)
+  {
+    if (buffer->data() == nullptr)
+    {
+      *size = 0;
+      return nullptr;
+    }
+    *size = buffer->data()->size();
+    return buffer->data()->data();
+  }
 };
 
 class TFLiteLoader final : public base_loader::BaseLoader<LoaderDomain>
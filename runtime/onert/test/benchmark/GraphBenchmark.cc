@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Measure load and compile time of onert IR on a large synthetic graph
+ *
+ * Usage: onert_graph_benchmark [operations=10000] [repeat=3] [compile=1]
+ *
+ * The graph is a chain of Add operations, each with a constant operand, which is what a loader
+ * builds for a model with that many operations. Phases are timed separately:
+ *   - build   : add operands and operations, as a loader does
+ *   - verify  : check the graph is a valid DAG and validate operations
+ *   - copy    : copy the graph, as LoweredGraph does, cloning every operation
+ *   - iterate : walk all operands and operations and sort operations topologically
+ *   - compile : Compiler::compile() with the backends of the global config
+ *
+ * NOTE Graph verification and sorting are recursive over the chain, so much longer chains may need
+ *      a larger stack (ulimit -s).
+ */
+
+#include "compiler/Compiler.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "util/TracingCtx.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(const Clock::time_point &begin)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+}
+
+std::shared_ptr<ir::Graph> build_graph(uint32_t num_operations, const std::vector<float> &rhs)
+{
+  auto graph = std::make_shared<ir::Graph>();
+
+  const ir::Shape shape{1, static_cast<int32_t>(rhs.size())};
+  const ir::TypeInfo type{ir::DataType::FLOAT32};
+
+  auto input = graph->addOperand(shape, type);
+  graph->addInput(input);
+
+  auto lhs = input;
+  for (uint32_t i = 0; i < num_operations; ++i)
+  {
+    auto constant = graph->addOperand(shape, type);
+    graph->operands().at(constant).data(std::make_unique<ir::ExternalData>(
+      reinterpret_cast<const uint8_t *>(rhs.data()), rhs.size() * sizeof(float)));
+    auto result = graph->addOperand(shape, type);
+
+    ir::operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = ir::Activation::NONE;
+    graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, constant}, ir::OperandIndexSequence{result}, param));
+    lhs = result;
+  }
+  graph->addOutput(lhs);
+
+  return graph;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  const uint32_t num_operations = argc > 1 ? std::atoi(argv[1]) : 10000;
+  const uint32_t repeat = argc > 2 ? std::atoi(argv[2]) : 3;
+  const bool compile = argc > 3 ? std::atoi(argv[3]) != 0 : true;
+
+  const std::vector<float> rhs(16, 1.0f);
+
+  for (uint32_t r = 0; r < repeat; ++r)
+  {
+    auto begin = Clock::now();
+    auto graph = build_graph(num_operations, rhs);
+    const auto build_ms = elapsed_ms(begin);
+
+    begin = Clock::now();
+    graph->verify();
+    const auto verify_ms = elapsed_ms(begin);
+
+    begin = Clock::now();
+    {
+      ir::Graph copied{*graph};
+      (void)copied;
+    }
+    const auto copy_ms = elapsed_ms(begin);
+
+    begin = Clock::now();
+    size_t num_uses = 0;
+    graph->operands().iterate([&](const ir::OperandIndex &, const ir::Operand &operand) {
+      num_uses += operand.getUses().size();
+    });
+    graph->operations().iterate([&](const ir::OperationIndex &, const ir::Operation &op) {
+      num_uses -= op.getInputs().size();
+    });
+    const auto order = graph->topolSortOperations();
+    const auto iterate_ms = elapsed_ms(begin);
+    if (num_uses != 0 || order.size() != num_operations)
+    {
+      std::cerr << "[ERROR] Wrong graph" << std::endl;
+      return 255;
+    }
+
+    std::cout << "[INFO] " << num_operations << " operations: build " << build_ms << " ms, verify "
+              << verify_ms << " ms, copy " << copy_ms << " ms, iterate " << iterate_ms << " ms";
+
+    if (compile)
+    {
+      begin = Clock::now();
+      try
+      {
+        auto subgs = std::make_shared<ir::Subgraphs>();
+        subgs->push(ir::SubgraphIndex{0}, graph);
+        auto tracing_ctx = std::make_unique<util::TracingCtx>(subgs.get());
+        compiler::Compiler compiler{subgs, tracing_ctx.get()};
+        auto executors = compiler.compile();
+        std::cout << ", compile " << elapsed_ms(begin) << " ms";
+      }
+      catch (const std::exception &e)
+      {
+        std::cout << std::endl;
+        std::cerr << "[ERROR] Failed to compile: " << e.what() << std::endl;
+        return 255;
+      }
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
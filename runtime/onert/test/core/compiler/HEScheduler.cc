@@ -47,6 +47,7 @@ struct MockConfigCPU : public IConfig
   Layout supportLayout(const Operation &, Layout) override { return Layout::UNKNOWN; }
   bool supportDynamicTensor() override { return false; }
   bool supportFP16() override { return false; }
+  bool supportOperation(const Operands &, const Operation &) override { return true; }
 };
 
 class MockBackendContext : public BackendContext
@@ -77,6 +78,7 @@ struct MockConfigGPU : public IConfig
   }
   bool supportDynamicTensor() override { return false; }
   bool supportFP16() override { return false; }
+  bool supportOperation(const Operands &, const Operation &) override { return true; }
 };
 
 struct MockBackendGPU : public Backend
@@ -411,6 +413,32 @@ TEST_P(HESchedulerTestWithExecutorParam, straight_graph_known_exec_time)
   }
 }
 
+// Test scheduler behavior for straight graph without any profiling data
+TEST_P(HESchedulerTestWithExecutorParam, straight_graph_unknown_exec_time)
+{
+  setExecutor(GetParam());
+  setProfilingMode(false);
+
+  // Prepare graph
+  ir::Subgraphs subgs;
+  auto graph(createStraightGraph());
+  subgs.push(ir::SubgraphIndex{0}, graph);
+  OperationIndex add_op_idx(0), sub_op_idx(1), mul_op_idx(2);
+
+  // Expected behaviour: scheduler estimates execution time instead of failing, and does not use
+  // npu which does not tell it supports the nodes. cpu has the smallest overhead in the model.
+  auto scheduler =
+    compiler::HEScheduler(_mock_backends, compiler::fetchCompilerOptionsFromGlobalConfig(subgs));
+  const auto br = scheduler.schedule(*graph);
+  ASSERT_EQ(br->getBackend(add_op_idx)->config()->id(), "cpu");
+  ASSERT_EQ(br->getBackend(sub_op_idx)->config()->id(), "cpu");
+  ASSERT_EQ(br->getBackend(mul_op_idx)->config()->id(), "cpu");
+
+  // Store the profile data so that TearDown finds it
+  ExecTime et(_mock_backends);
+  et.storeOperationsExecTime();
+}
+
 // Test scheduler behavior for branched graph with known execution time of all nodes and permutes
 TEST_P(HESchedulerTestWithExecutorParam, branched_graph_known_exec_time)
 {
@@ -298,4 +298,105 @@ TEST(ExecInstance, async)
   }
 }
 
+// Queue several runs with their own buffers before waiting
+TEST(ExecInstance, async_in_flight)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[2][4] = {{1, 0, -1, -2}, {1, -1, 2, -3}};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[2][4] = {};
+  const float output_expected[2][4] = {{5, -2, 0, -1}, {5, -3, 3, -2}};
+
+  onert::exec::Execution execution{executors};
+
+  std::vector<std::exception_ptr> errors;
+  auto callback = [&](std::exception_ptr error) { errors.emplace_back(error); };
+
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  uint64_t run_ids[2];
+  for (auto n = 0; n < 2; n++)
+  {
+    execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer[n]), 16);
+    execution.setOutput(output, reinterpret_cast<void *>(output_buffer[n]), 16);
+    run_ids[n] = execution.startExecute(callback);
+  }
+  execution.waitFinish(run_ids[0]);
+  execution.waitFinish();
+
+  ASSERT_EQ(errors.size(), 2);
+  for (auto n = 0; n < 2; n++)
+  {
+    EXPECT_EQ(errors[n], nullptr);
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[n][i], output_expected[n][i]);
+    }
+  }
+}
+
+// Exception of a run is reported only to the one waiting for that run
+TEST(ExecInstance, async_error_of_run)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  // The first run fails without output buffer
+  auto failed_id = execution.startExecute();
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+  auto run_id = execution.startExecute();
+
+  EXPECT_NO_THROW(execution.waitFinish(run_id));
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+
+  EXPECT_THROW(execution.waitFinish(failed_id), std::runtime_error);
+  // The exception is reported once
+  EXPECT_NO_THROW(execution.waitFinish(failed_id));
+}
+
+// Waiting for all runs reports the exception of any of them
+TEST(ExecInstance, neg_async_error_of_all)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input_buffer[4] = {1, 0, -1, -2};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(input1, reinterpret_cast<const void *>(input_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(input_buffer), 16);
+  execution.startExecute();
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+  execution.startExecute();
+
+  EXPECT_THROW(execution.waitFinish(), std::runtime_error);
+}
+
 } // namespace
@@ -71,6 +71,10 @@ TEST(ExecTime, roundtrip_ok)
     ASSERT_EQ(time, 150);
     time = et.getOperationExecTime(b, "op1", false, 100);
     ASSERT_EQ(time, 888);
+    // Only recorded sizes are exact
+    ASSERT_TRUE(et.hasOperationExecTime(b, "op1", true, 200));
+    ASSERT_FALSE(et.hasOperationExecTime(b, "op1", true, 150));
+    ASSERT_FALSE(et.hasOperationExecTime(b, "op2", true, 100));
     et.storeOperationsExecTime();
   }
   // clean up
@@ -209,3 +209,53 @@ TEST(ObjectManager, neg_getRawPtr)
   auto ptr = man.getRawPtr(Index{1});
   ASSERT_EQ(ptr, nullptr);
 }
+
+TEST(ObjectManager, iterate_in_index_order)
+{
+  util::ObjectManager<Index, int> man;
+
+  man.push(std::make_unique<int>(300), Index{1000});
+  man.push(std::make_unique<int>(200), Index{7});
+  man.push(std::make_unique<int>(100), Index{3});
+
+  std::vector<uint32_t> indices;
+  man.iterate([&](const Index &index, const int &) { indices.push_back(index.value()); });
+  ASSERT_EQ(indices, (std::vector<uint32_t>{3, 7, 1000}));
+}
+
+TEST(ObjectManager, sparse_indices)
+{
+  util::ObjectManager<Index, int> man;
+
+  // Far index first, then fill the indices before it
+  auto far = man.push(std::make_unique<int>(-1), Index{500});
+  for (uint32_t i = 0; i < 500; ++i)
+    ASSERT_EQ(man.push(std::make_unique<int>(i), Index{i}).value(), i);
+  ASSERT_EQ(man.size(), 501);
+  ASSERT_EQ(man.at(far), -1);
+
+  int sum = 0;
+  uint32_t prev = 0;
+  man.iterate([&](const Index &index, const int &val) {
+    ASSERT_TRUE(index.value() == 0 || index.value() > prev);
+    prev = index.value();
+    sum += val;
+  });
+  ASSERT_EQ(sum, 499 * 500 / 2 - 1);
+
+  for (uint32_t i = 0; i < 500; i += 2)
+    man.remove(Index{i});
+  man.remove(far);
+  ASSERT_EQ(man.size(), 250);
+  ASSERT_FALSE(man.exist(far));
+  ASSERT_FALSE(man.exist(Index{0}));
+  ASSERT_EQ(man.at(Index{1}), 1);
+}
+
+TEST(ObjectManager, neg_at)
+{
+  util::ObjectManager<Index, int> man;
+  man.emplace(100);
+  EXPECT_THROW(man.at(Index{1}), std::out_of_range);
+  EXPECT_THROW(man.at(Index{kMaxUInt32 - 1}), std::out_of_range);
+}
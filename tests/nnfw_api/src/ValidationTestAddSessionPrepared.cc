@@ -17,6 +17,9 @@
 #include "fixtures.h"
 #include "NNPackages.h"
 
+#include <atomic>
+#include <unistd.h>
+
 using ValidationTestAddSessionPrepared = ValidationTestSessionPrepared<NNPackages::ADD>;
 
 TEST_F(ValidationTestAddSessionPrepared, run)
@@ -70,6 +73,81 @@ TEST_F(ValidationTestAddSessionPrepared, run_async)
   ASSERT_FLOAT_EQ(_output[0], 5.0);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, run_async_queue_many)
+{
+  // Each run keeps the buffers that were set when it was queued
+  std::vector<float> inputs{1.0, 2.0, 3.0};
+  std::vector<float> outputs(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    NNFW_ENSURE_SUCCESS(
+      nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &inputs[i], sizeof(float)));
+    NNFW_ENSURE_SUCCESS(
+      nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &outputs[i], sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_run_async(_session));
+  }
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session));
+
+  for (size_t i = 0; i < inputs.size(); ++i)
+    ASSERT_FLOAT_EQ(outputs[i], inputs[i] + 2.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_async_with_callback)
+{
+  SetInOutBuffers();
+  _input[0] = 3.0;
+  std::atomic<int> count{0};
+  auto callback = [](nnfw_session *, NNFW_STATUS status, void *user_data) {
+    if (status == NNFW_STATUS_NO_ERROR)
+      (*static_cast<std::atomic<int> *>(user_data))++;
+  };
+  NNFW_ENSURE_SUCCESS(nnfw_run_async_with_callback(_session, callback, &count));
+  NNFW_ENSURE_SUCCESS(nnfw_run_async_with_callback(_session, callback, &count));
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session));
+  ASSERT_EQ(count, 2);
+  ASSERT_FLOAT_EQ(_output[0], 5.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_async_eventfd)
+{
+  SetInOutBuffers();
+  int fd = -1;
+  NNFW_ENSURE_SUCCESS(nnfw_async_eventfd(_session, &fd));
+  ASSERT_GE(fd, 0);
+
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(_session));
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(_session));
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session));
+
+  uint64_t count = 0;
+  ASSERT_EQ(read(fd, &count, sizeof(count)), sizeof(count));
+  ASSERT_EQ(count, 2);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_pinned_io)
+{
+  SetInOutBuffers();
+  NNFW_ENSURE_SUCCESS(nnfw_pin_io_buffers(_session));
+  for (float v = 1.0; v <= 3.0; v += 1.0)
+  {
+    _input[0] = v;
+    NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+    ASSERT_FLOAT_EQ(_output[0], v + 2.0);
+  }
+
+  // Setting another buffer unpins the others
+  float output = 0;
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &output, sizeof(output)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_FLOAT_EQ(output, 5.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_pin_io_buffers_not_set)
+{
+  ASSERT_EQ(nnfw_pin_io_buffers(_session), NNFW_STATUS_ERROR);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, set_input_001)
 {
   char input[32];
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_BatchMatMul)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 2, 3}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, 3, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}});
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, 2, 3, 4, 5, 6}, {1, 0, -1, 2, 0, 1, 2, -1, 1, 1, 0, 0}}, {{4, 5, 3, 0, 10, 11, 6, 3}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_Broadcast)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{2, 2, 3}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{3, 2}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}});
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4, 5, 6, -1, 0, 1, 2, -2, 0},
+                                           {1, 0, 0, 1, 1, -1}},
+                                          {{4, -1, 10, -1, 0, -1, 2, -2}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_AdjX)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 3, 2}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, 3, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}}, true, false);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, 2, 3, 4, 5, 6}, {1, 0, -1, 2, 0, 1, 2, -1, 1, 1, 0, 0}}, {{6, 8, 5, -1, 8, 10, 6, 0}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_AdjY)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 2, 3}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, 4, 3}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}}, false, true);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, 2, 3, 4, 5, 6}, {1, 0, -1, 2, 0, 1, 0, 1, 2, -1, 1, 0}}, {{-2, 5, 8, 1, -2, 14, 17, 1}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_AdjXAdjY)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 3, 2}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1, 4, 3}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}}, true, true);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, 2, 3, 4, 5, 6}, {1, 0, -1, 2, 0, 1, 0, 1, 2, -1, 1, 0}}, {{-4, 7, 13, 2, -4, 10, 16, 2}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+// Constant operands are packed on prepare, and the packed one is reused by every run
+TEST_F(GenModelTest, OneOp_BatchMatMul_ConstRhs)
+{
+  CircleGen cgen;
+  std::vector<float> rhs_data{1, 2, 0, 1, -1, 0};
+  uint32_t rhs_buf = cgen.addBuffer(rhs_data);
+  int lhs = cgen.addTensor({{2, 1, 3}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{3, 2}, circle::TensorType::TensorType_FLOAT32, rhs_buf});
+  int out = cgen.addTensor({{2, 1, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}});
+  cgen.setInputsAndOutputs({lhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4, 5, 6}}, {{-2, 4, -2, 13}}));
+  _context->addTestCase(uniformTCD<float>({{0, 1, 0, -1, 0, 2}}, {{0, 1, -3, -2}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BatchMatMul_ConstLhs)
+{
+  CircleGen cgen;
+  std::vector<float> lhs_data{1, 2, 3, 4, 5, 6};
+  uint32_t lhs_buf = cgen.addBuffer(lhs_data);
+  int lhs = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_FLOAT32, lhs_buf});
+  int rhs = cgen.addTensor({{2, 3, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}});
+  cgen.setInputsAndOutputs({rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 0, -1, 2, 1, 0}}, {{-2, -2, 4, 13}}));
+  _context->addTestCase(uniformTCD<float>({{0, 0, 1, 1, 1, 1}}, {{3, 6, 6, 15}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_BatchMatMul_InvalidType)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1, 2, 3}, circle::TensorType::TensorType_INT32});
+  int rhs = cgen.addTensor({{1, 3, 4}, circle::TensorType::TensorType_INT32});
+  int out = cgen.addTensor({{1, 2, 4}, circle::TensorType::TensorType_INT32});
+  cgen.addOperatorBatchMatMul({{lhs, rhs}, {out}});
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu", "ruy"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
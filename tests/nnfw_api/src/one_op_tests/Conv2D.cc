@@ -106,7 +106,7 @@ TEST_F(GenModelTest, OneOp_Conv2D_I8)
 
   _context = std::make_unique<GenModelTestContext>(cgen.finish());
   _context->addTestCase(uniformTCD<int8_t>({{10, 10, 10}}, {{15, 38, 61}}));
-  _context->setBackends({"cpu"});
+  _context->setBackends({"cpu", "ruy"});
 
   SUCCEED();
 }
@@ -131,7 +131,7 @@ TEST_F(GenModelTest, OneOp_Conv2D_I8_PerChannel)
 
   _context = std::make_unique<GenModelTestContext>(cgen.finish());
   _context->addTestCase(uniformTCD<int8_t>({{10, 10, 10}}, {{15, 30, 60}}));
-  _context->setBackends({"cpu"});
+  _context->setBackends({"cpu", "ruy"});
 
   SUCCEED();
 }
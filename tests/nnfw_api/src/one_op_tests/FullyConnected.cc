@@ -207,3 +207,71 @@ TEST_F(GenModelTest, neg_OneOp_FullyConnected_NoBias)
 
   SUCCEED();
 }
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Uint8)
+{
+  CircleGen cgen;
+  std::vector<uint8_t> weight_data{3, 5, 1, 1, 3, 5};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<int32_t> bias_data{4, -4};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, 3}, circle::TensorType::TensorType_UINT8}, 0.5, 2);
+  int weight = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_UINT8, weight_buf}, 0.5, 1);
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, bias_buf}, 0.25, 0);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_UINT8}, 1.0, 0);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<uint8_t>({{4, 6, 8}}, {{6, 7}}));
+  _context->addTestCase(uniformTCD<uint8_t>({{2, 2, 2}}, {{1, 0}}));
+  _context->setBackends({"cpu", "ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_FullyConnected_Int8)
+{
+  CircleGen cgen;
+  std::vector<int8_t> weight_data{2, 4, 0, 0, 2, 4};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<int32_t> bias_data{4, -4};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, 3}, circle::TensorType::TensorType_INT8}, 0.5, 0);
+  int weight = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_INT8, weight_buf}, 0.5, 0);
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, bias_buf}, 0.25, 0);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT8}, 0.5, -10);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<int8_t>({{2, 4, 6}}, {{2, 4}}));
+  _context->addTestCase(uniformTCD<int8_t>({{0, 0, 0}}, {{-8, -12}}));
+  _context->setBackends({"ruy"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_FullyConnected_Int8_PerChannel)
+{
+  CircleGen cgen;
+  std::vector<int8_t> weight_data{2, 4, 0, 0, 1, 2};
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<int32_t> bias_data{0, 0};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, 3}, circle::TensorType::TensorType_INT8}, 0.5, 0);
+  std::vector<float> weight_scales = {0.5, 1};
+  std::vector<int64_t> weight_zeropoints = {0, 0};
+  int weight = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_INT8, weight_buf},
+                              weight_scales, weight_zeropoints);
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, bias_buf}, 0.25, 0);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT8}, 0.5, 0);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"ruy"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
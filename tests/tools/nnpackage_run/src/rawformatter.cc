@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rawformatter.h"
+#include "nnfw.h"
+#include "nnfw_util.h"
+
+#include <dio_raw/RawFormat.h>
+#include <json/json.h>
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace
+{
+const char *raw_dtype_name(NNFW_TYPE dtype)
+{
+  switch (dtype)
+  {
+    case NNFW_TYPE_TENSOR_FLOAT32:
+      return "float32";
+    case NNFW_TYPE_TENSOR_INT32:
+      return "int32";
+    case NNFW_TYPE_TENSOR_INT64:
+      return "int64";
+    case NNFW_TYPE_TENSOR_UINT8:
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
+      return "uint8";
+    case NNFW_TYPE_TENSOR_BOOL:
+      return "bool";
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
+      return "int8";
+    default:
+      throw std::runtime_error("nnpkg_run can dump f32, i32, i64, qasymm8, bool and uint8.");
+  }
+}
+} // namespace
+
+namespace nnpkg_run
+{
+void RawFormatter::dumpOutputs(const std::string &filename, std::vector<Allocation> &outputs)
+{
+  uint32_t num_outputs;
+  NNPR_ENSURE_STATUS(nnfw_output_size(session_, &num_outputs));
+  try
+  {
+    std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.good())
+      throw std::runtime_error("failed to open " + filename);
+
+    Json::Value tensors(Json::arrayValue);
+    uint64_t end = 0;
+    for (uint32_t i = 0; i < num_outputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session_, i, &ti));
+
+      Json::Value shape(Json::arrayValue);
+      for (int32_t j = 0; j < ti.rank; ++j)
+      {
+        if (ti.dims[j] < 0)
+          throw std::runtime_error("Negative dimension in output tensor");
+        shape.append(Json::UInt64(ti.dims[j]));
+      }
+
+      const uint64_t alignment = dio::raw::ALIGNMENT;
+      const uint64_t offset = (end + alignment - 1) / alignment * alignment;
+      const uint64_t size = bufsize_for(&ti);
+
+      // zero-fill the gap to align data of this output
+      const std::vector<char> zeros(offset - end, 0);
+      file.write(zeros.data(), zeros.size());
+      file.write(static_cast<const char *>(outputs[i].data()), size);
+      end = offset + size;
+
+      Json::Value tensor;
+      tensor["name"] = std::to_string(i);
+      tensor["dtype"] = raw_dtype_name(ti.dtype);
+      tensor["shape"] = shape;
+      tensor["offset"] = Json::UInt64(offset);
+      tensor["size"] = Json::UInt64(size);
+      tensors.append(tensor);
+    }
+    file.close();
+    if (file.fail())
+      throw std::runtime_error("failed to write " + filename);
+
+    Json::Value index;
+    index["format"] = "dio-raw";
+    index["version"] = 1;
+    index["alignment"] = Json::UInt64(dio::raw::ALIGNMENT);
+    index["tensors"] = tensors;
+
+    std::ofstream index_file(filename + ".json");
+    index_file << index;
+    index_file.close();
+    if (index_file.fail())
+      throw std::runtime_error("failed to write " + filename + ".json");
+  }
+  catch (const std::runtime_error &e)
+  {
+    std::cerr << "Error during dumpOutputs on nnpackage_run : " << e.what() << std::endl;
+    std::exit(-1);
+  }
+}
+
+} // end of namespace nnpkg_run